@@ -10,12 +10,19 @@
 #define CONFIG_ADC_BUTTON_MAX_BUTTON_PER_CHANNEL 8       //range 1 10
 #define CONFIG_ADC_BUTTON_MAX_CHANNEL 3                 // range 1 5
 #define CONFIG_ADC_BUTTON_SAMPLE_TIMES 1                // range 1 4
+#define CONFIG_ADC_BUTTON_CONTINUOUS_MODE 0             // 1: sample all channels by DMA (IDF >= 5.0), ADC1 can't be used in oneshot mode by others
+#define CONFIG_ADC_BUTTON_FILTER_SIZE 3                 // range 1 7, median window of the channel voltage
+#define CONFIG_ADC_BUTTON_FILTER_IIR_SHIFT 1            // range 0 8, IIR weight 1/(1<<shift) of each sample, 0 disables it
+#define CONFIG_ADC_BUTTON_FILTER_SNAP_MV 100            // voltage step in mV which bypasses the IIR
 #define CONFIG_BUTTON_DEBOUNCE_TICKS 2                  //range  1 8
 #define CONFIG_BUTTON_SHORT_PRESS_TIME_MS 180           //range  50-800
 #define CONFIG_BUTTON_LONG_PRESS_TIME_MS 1500           //range  500-5000
 #define CONFIG_BUTTON_PERIOD_TIME_MS 5                  // range  2-20
 #define CONFIG_BUTTON_SERIAL_TIME_MS 20                 //range  2-1000
 #define CONFIG_BUTTON_LONG_PRESS_TOLERANCE_MS 20
+#define CONFIG_BUTTON_GPIO_EDGE_WAKEUP 1                // 1: gpio buttons wake the button timer on edges, 0: poll them
+#define CONFIG_BUTTON_MATRIX_SCAN_PERIOD_MS 5           // range  CONFIG_BUTTON_PERIOD_TIME_MS-100
+#define CONFIG_BUTTON_MATRIX_DEBOUNCE_SCANS 2           // range  1-8
 
 #define BUTTON_VER_MINOR  (1)   // ignore this
 #define BUTTON_VER_PATCH  (1)   // ignore this
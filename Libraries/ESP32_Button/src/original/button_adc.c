@@ -11,6 +11,7 @@
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
 #include "soc/soc_caps.h"
 #include "esp_adc/adc_oneshot.h"
+#include "esp_adc/adc_continuous.h"
 #include "esp_adc/adc_cali.h"
 #include "esp_adc/adc_cali_scheme.h"
 #else
@@ -19,6 +20,7 @@
 #include "esp_adc_cal.h"
 #endif
 #include "button_adc.h"
+#include "button_adc_filter.h"
 #include "arduino_config.h"
 
 
@@ -46,16 +48,36 @@ static const char *TAG = "adc button";
 #define ADC_BUTTON_ADC_UNIT     ADC_UNIT_1
 #define ADC_BUTTON_MAX_CHANNEL  CONFIG_ADC_BUTTON_MAX_CHANNEL
 #define ADC_BUTTON_MAX_BUTTON   CONFIG_ADC_BUTTON_MAX_BUTTON_PER_CHANNEL
+#define ADC_BUTTON_SAMPLE_PERIOD_US 1000    /* channels are sampled at most once per period */
 
-typedef struct {
-    uint16_t min;
-    uint16_t max;
-} button_data_t;
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0) && CONFIG_ADC_BUTTON_CONTINUOUS_MODE
+#define ADC_BUTTON_CONTINUOUS   1
+#define ADC_BUTTON_CONV_FRAME_SIZE  (SOC_ADC_DIGI_RESULT_BYTES * 64)
+#if CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S2
+#define ADC_BUTTON_OUTPUT_TYPE      ADC_DIGI_OUTPUT_FORMAT_TYPE1
+#define ADC_BUTTON_GET_CHANNEL(p)   ((p)->type1.channel)
+#define ADC_BUTTON_GET_DATA(p)      ((p)->type1.data)
+#else
+#define ADC_BUTTON_OUTPUT_TYPE      ADC_DIGI_OUTPUT_FORMAT_TYPE2
+#define ADC_BUTTON_GET_CHANNEL(p)   ((p)->type2.channel)
+#define ADC_BUTTON_GET_DATA(p)      ((p)->type2.data)
+#endif
+/* The calibration scheme expects raw data of ADC_BUTTON_WIDTH bits */
+#if SOC_ADC_DIGI_MAX_BITWIDTH > SOC_ADC_RTC_MAX_BITWIDTH
+#define ADC_BUTTON_DIGI_TO_RAW(data)    ((data) >> (SOC_ADC_DIGI_MAX_BITWIDTH - SOC_ADC_RTC_MAX_BITWIDTH))
+#else
+#define ADC_BUTTON_DIGI_TO_RAW(data)    ((data) << (SOC_ADC_RTC_MAX_BITWIDTH - SOC_ADC_DIGI_MAX_BITWIDTH))
+#endif
+#else
+#define ADC_BUTTON_CONTINUOUS   0
+#endif
 
 typedef struct {
     uint8_t channel;
     uint8_t is_init;
-    button_data_t btns[ADC_BUTTON_MAX_BUTTON];  /* all button on the channel */
+    button_adc_range_t btns[ADC_BUTTON_MAX_BUTTON];  /* all button on the channel */
+    button_adc_filter_t filter;  /* filter of the channel voltage */
+    uint32_t pressed_mask;  /* buttons pressed at the last sample, classified from the filtered voltage */
     uint64_t last_time;  /* the last time of adc sample */
 } btn_adc_channel_t;
 
@@ -64,7 +86,14 @@ typedef struct {
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
     adc_cali_handle_t adc1_cali_handle;
     adc_oneshot_unit_handle_t adc1_handle;
-#else
+    bool is_adc1_handle_owned;
+#endif
+#if ADC_BUTTON_CONTINUOUS
+    adc_continuous_handle_t adc1_continuous_handle;  /* all channels are sampled by DMA, NULL if oneshot is used */
+    bool is_continuous;
+    uint64_t last_time;  /* the last time the DMA results were read */
+#endif
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 0, 0)
     esp_adc_cal_characteristics_t adc_chars;
 #endif
     btn_adc_channel_t ch[ADC_BUTTON_MAX_CHANNEL];
@@ -141,6 +170,106 @@ static esp_err_t adc_calibration_init(adc_unit_t unit, adc_atten_t atten, adc_ca
 
     return calibrated?ESP_OK:ESP_FAIL;
 }
+
+static esp_err_t adc_calibration_deinit(adc_cali_handle_t handle)
+{
+    esp_err_t ret = ESP_OK;
+#if ADC_CALI_SCHEME_CURVE_FITTING_SUPPORTED
+    ret = adc_cali_delete_scheme_curve_fitting(handle);
+#elif ADC_CALI_SCHEME_LINE_FITTING_SUPPORTED
+    ret = adc_cali_delete_scheme_line_fitting(handle);
+#endif
+    return ret;
+}
+#endif
+
+static uint32_t adc_raw_to_voltage(uint32_t adc_reading)
+{
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+    int voltage = 0;
+    adc_cali_raw_to_voltage(g_button.adc1_cali_handle, adc_reading, &voltage);
+    ESP_LOGV(TAG, "Raw: %"PRIu32"\tVoltage: %dmV", adc_reading, voltage);
+#else
+    uint32_t voltage = esp_adc_cal_raw_to_voltage(adc_reading, &g_button.adc_chars);
+    ESP_LOGV(TAG, "Raw: %"PRIu32"\tVoltage: %"PRIu32"mV", adc_reading, voltage);
+#endif
+    return voltage;
+}
+
+/**
+ * @brief Filter a new voltage sample of the channel and classify all its buttons from the result
+ */
+static void adc_channel_update(int ch_index, uint32_t voltage)
+{
+    btn_adc_channel_t *ch = &g_button.ch[ch_index];
+    uint16_t filtered = button_adc_filter_push(&ch->filter, voltage);
+    ch->pressed_mask = button_adc_classify(ch->btns, ADC_BUTTON_MAX_BUTTON, filtered);
+}
+
+#if ADC_BUTTON_CONTINUOUS
+/**
+ * @brief Restart the DMA sampling with the pattern of all initialized channels
+ */
+static esp_err_t adc_continuous_reconfig(void)
+{
+    adc_continuous_stop(g_button.adc1_continuous_handle);
+
+    adc_digi_pattern_config_t pattern[ADC_BUTTON_MAX_CHANNEL] = {0};
+    uint32_t pattern_num = 0;
+    for (size_t i = 0; i < ADC_BUTTON_MAX_CHANNEL; i++) {
+        if (g_button.ch[i].is_init) {
+            pattern[pattern_num].atten = ADC_BUTTON_ATTEN;
+            pattern[pattern_num].channel = g_button.ch[i].channel;
+            pattern[pattern_num].unit = ADC_BUTTON_ADC_UNIT;
+            pattern[pattern_num].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+            pattern_num++;
+        }
+    }
+    if (0 == pattern_num) {
+        return ESP_OK;
+    }
+
+    adc_continuous_config_t dig_cfg = {
+        .pattern_num = pattern_num,
+        .adc_pattern = pattern,
+        .sample_freq_hz = SOC_ADC_SAMPLE_FREQ_THRES_LOW,
+        .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+        .format = ADC_BUTTON_OUTPUT_TYPE,
+    };
+    esp_err_t ret = adc_continuous_config(g_button.adc1_continuous_handle, &dig_cfg);
+    ADC_BTN_CHECK(ret == ESP_OK, "adc continuous config fail!", ESP_FAIL);
+    ret = adc_continuous_start(g_button.adc1_continuous_handle);
+    ADC_BTN_CHECK(ret == ESP_OK, "adc continuous start fail!", ESP_FAIL);
+    return ESP_OK;
+}
+
+/**
+ * @brief Read the DMA results since the last call and update every channel once with their average
+ */
+static void adc_continuous_update(void)
+{
+    uint8_t result[ADC_BUTTON_CONV_FRAME_SIZE];
+    uint32_t sum[ADC_BUTTON_MAX_CHANNEL] = {0};
+    uint32_t count[ADC_BUTTON_MAX_CHANNEL] = {0};
+    uint32_t size = 0;
+
+    while (ESP_OK == adc_continuous_read(g_button.adc1_continuous_handle, result, sizeof(result), &size, 0)) {
+        for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= size; i += SOC_ADC_DIGI_RESULT_BYTES) {
+            adc_digi_output_data_t *p = (adc_digi_output_data_t *)&result[i];
+            int ch_index = find_channel(ADC_BUTTON_GET_CHANNEL(p));
+            if (ch_index >= 0 && g_button.ch[ch_index].is_init) {
+                sum[ch_index] += ADC_BUTTON_GET_DATA(p);
+                count[ch_index]++;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < ADC_BUTTON_MAX_CHANNEL; i++) {
+        if (count[i] > 0) {
+            adc_channel_update(i, adc_raw_to_voltage(ADC_BUTTON_DIGI_TO_RAW(sum[i] / count[i])));
+        }
+    }
+}
 #endif
 
 esp_err_t button_adc_init(const button_adc_config_t *config)
@@ -163,6 +292,18 @@ esp_err_t button_adc_init(const button_adc_config_t *config)
     if (0 == g_button.is_configured) {
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
         esp_err_t ret;
+#if ADC_BUTTON_CONTINUOUS
+        if (NULL == config->adc_handle) {
+            //ADC1 DMA Init, only possible if ADC1 isn't used in oneshot mode by others
+            adc_continuous_handle_cfg_t handle_config = {
+                .max_store_buf_size = ADC_BUTTON_CONV_FRAME_SIZE * 4,
+                .conv_frame_size = ADC_BUTTON_CONV_FRAME_SIZE,
+            };
+            ret = adc_continuous_new_handle(&handle_config, &g_button.adc1_continuous_handle);
+            ADC_BTN_CHECK(ret == ESP_OK, "adc continuous new handle fail!", ESP_FAIL);
+            g_button.is_continuous = true;
+        } else
+#endif
         if (NULL == config->adc_handle) {
             //ADC1 Init
             adc_oneshot_unit_init_cfg_t init_config = {
@@ -170,6 +311,7 @@ esp_err_t button_adc_init(const button_adc_config_t *config)
             };
             ret = adc_oneshot_new_unit(&init_config, &g_button.adc1_handle);
             ADC_BTN_CHECK(ret == ESP_OK, "adc oneshot new unit fail!", ESP_FAIL);
+            g_button.is_adc1_handle_owned = true;
         } else {
             g_button.adc1_handle = *config->adc_handle ;
             ESP_LOGI(TAG, "ADC1 has been initialized");
@@ -193,22 +335,38 @@ esp_err_t button_adc_init(const button_adc_config_t *config)
     /** initialize adc channel */
     if (0 == g_button.ch[ch_index].is_init) {
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
-        //ADC1 Config
-        adc_oneshot_chan_cfg_t oneshot_config = {
-            .bitwidth = ADC_BUTTON_WIDTH,
-            .atten = ADC_BUTTON_ATTEN,
-        };
-        esp_err_t ret = adc_oneshot_config_channel(g_button.adc1_handle, config->adc_channel, &oneshot_config);
-        ADC_BTN_CHECK(ret == ESP_OK, "adc oneshot config channel fail!", ESP_FAIL);
+        esp_err_t ret = ESP_OK;
+#if ADC_BUTTON_CONTINUOUS
+        if (!g_button.is_continuous)
+#endif
+        {
+            //ADC1 Config
+            adc_oneshot_chan_cfg_t oneshot_config = {
+                .bitwidth = ADC_BUTTON_WIDTH,
+                .atten = ADC_BUTTON_ATTEN,
+            };
+            ret = adc_oneshot_config_channel(g_button.adc1_handle, config->adc_channel, &oneshot_config);
+            ADC_BTN_CHECK(ret == ESP_OK, "adc oneshot config channel fail!", ESP_FAIL);
+        }
         //-------------ADC1 Calibration Init---------------//
-        ret = adc_calibration_init(ADC_BUTTON_ADC_UNIT, ADC_BUTTON_ATTEN, &g_button.adc1_cali_handle);
-        ADC_BTN_CHECK(ret == ESP_OK, "ADC1 Calibration Init False", 0);
+        if (NULL == g_button.adc1_cali_handle) {
+            ret = adc_calibration_init(ADC_BUTTON_ADC_UNIT, ADC_BUTTON_ATTEN, &g_button.adc1_cali_handle);
+            ADC_BTN_CHECK(ret == ESP_OK, "ADC1 Calibration Init False", 0);
+        }
 #else
         adc1_config_channel_atten(config->adc_channel, ADC_BUTTON_ATTEN);
 #endif
         g_button.ch[ch_index].channel = config->adc_channel;
         g_button.ch[ch_index].is_init = 1;
         g_button.ch[ch_index].last_time = 0;
+        g_button.ch[ch_index].pressed_mask = 0;
+        button_adc_filter_init(&g_button.ch[ch_index].filter, CONFIG_ADC_BUTTON_FILTER_SIZE,
+                               CONFIG_ADC_BUTTON_FILTER_IIR_SHIFT, CONFIG_ADC_BUTTON_FILTER_SNAP_MV);
+#if ADC_BUTTON_CONTINUOUS
+        if (g_button.is_continuous) {
+            ADC_BTN_CHECK(ESP_OK == adc_continuous_reconfig(), "adc continuous reconfig fail!", ESP_FAIL);
+        }
+#endif
     }
     g_button.ch[ch_index].btns[config->button_index].max = config->max;
     g_button.ch[ch_index].btns[config->button_index].min = config->min;
@@ -236,9 +394,14 @@ esp_err_t button_adc_deinit(uint8_t channel, int button_index)
         }
     }
     if (unused_button == ADC_BUTTON_MAX_BUTTON && g_button.ch[ch_index].is_init) {  /**< if all button is unused, deinit the channel */
+        ESP_LOGD(TAG, "all button is unused on channel%d, deinit the channel", g_button.ch[ch_index].channel);
         g_button.ch[ch_index].is_init = 0;
         g_button.ch[ch_index].channel = ADC1_BUTTON_CHANNEL_MAX;
-        ESP_LOGD(TAG, "all button is unused on channel%d, deinit the channel", g_button.ch[ch_index].channel);
+#if ADC_BUTTON_CONTINUOUS
+        if (g_button.is_continuous) {
+            ADC_BTN_CHECK(ESP_OK == adc_continuous_reconfig(), "adc continuous reconfig fail!", ESP_FAIL);
+        }
+#endif
     }
 
     /** check channel usage on the adc*/
@@ -249,14 +412,27 @@ esp_err_t button_adc_deinit(uint8_t channel, int button_index)
         }
     }
     if (unused_ch == ADC_BUTTON_MAX_CHANNEL && g_button.is_configured) { /**< if all channel is unused, deinit the adc */
+#if ADC_BUTTON_CONTINUOUS
+        if (g_button.is_continuous) {
+            esp_err_t ret = adc_continuous_deinit(g_button.adc1_continuous_handle);
+            ADC_BTN_CHECK(ret == ESP_OK, "adc continuous deinit fail", ESP_FAIL);
+        }
+#endif
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+        if (g_button.is_adc1_handle_owned) {
+            esp_err_t ret = adc_oneshot_del_unit(g_button.adc1_handle);
+            ADC_BTN_CHECK(ret == ESP_OK, "adc oneshot deinit fail", ESP_FAIL);
+        }
+        /* The calibration handle is created once, delete it before the state is cleared */
+        if (NULL != g_button.adc1_cali_handle) {
+            esp_err_t ret = adc_calibration_deinit(g_button.adc1_cali_handle);
+            ADC_BTN_CHECK(ret == ESP_OK, "adc calibration deinit fail", ESP_FAIL);
+        }
+#endif
         g_button.is_configured = false;
         memset(&g_button, 0, sizeof(adc_button_t));
         ESP_LOGD(TAG, "all channel is unused, , deinit adc");
     }
-#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
-    esp_err_t ret = adc_oneshot_del_unit(g_button.adc1_handle);
-    ADC_BTN_CHECK(ret == ESP_OK, "adc oneshot deinit fail", ESP_FAIL);
-#endif
     return ESP_OK;
 }
 
@@ -270,26 +446,19 @@ static uint32_t get_adc_volatge(uint8_t channel)
         adc_reading += adc_raw;
     }
     adc_reading /= NO_OF_SAMPLES;
-    //Convert adc_reading to voltage in mV
-    int voltage = 0;
-    adc_cali_raw_to_voltage(g_button.adc1_cali_handle, adc_reading, &voltage);
-    ESP_LOGV(TAG, "Raw: %"PRIu32"\tVoltage: %dmV", adc_reading, voltage);
 #else
     //Multisampling
     for (int i = 0; i < NO_OF_SAMPLES; i++) {
         adc_reading += adc1_get_raw(channel);
     }
     adc_reading /= NO_OF_SAMPLES;
-    //Convert adc_reading to voltage in mV
-    uint32_t voltage = esp_adc_cal_raw_to_voltage(adc_reading, &g_button.adc_chars);
-    ESP_LOGV(TAG, "Raw: %"PRIu32"\tVoltage: %"PRIu32"mV", adc_reading, voltage);
 #endif
-    return voltage;
+    //Convert adc_reading to voltage in mV
+    return adc_raw_to_voltage(adc_reading);
 }
 
 uint8_t button_adc_get_key_level(void *button_index)
 {
-    static uint16_t vol = 0;
     uint32_t ch = ADC_BUTTON_SPLIT_CHANNEL(button_index);
     uint32_t index = ADC_BUTTON_SPLIT_INDEX(button_index);
     ADC_BTN_CHECK(ch < ADC1_BUTTON_CHANNEL_MAX, "channel out of range", 0);
@@ -297,15 +466,20 @@ uint8_t button_adc_get_key_level(void *button_index)
     int ch_index = find_channel(ch);
     ADC_BTN_CHECK(ch_index >= 0, "The button_index is not init", 0);
 
-    /** It starts only when the elapsed time is more than 1ms */
-    if ((esp_timer_get_time() - g_button.ch[ch_index].last_time) > 1000) {
-        vol = get_adc_volatge(ch);
-        g_button.ch[ch_index].last_time = esp_timer_get_time();
+    /** Sample once per period for all the buttons, it starts only when the elapsed time is more than 1ms */
+    uint64_t now = esp_timer_get_time();
+#if ADC_BUTTON_CONTINUOUS
+    if (g_button.is_continuous) {
+        if ((now - g_button.last_time) > ADC_BUTTON_SAMPLE_PERIOD_US) {
+            adc_continuous_update();
+            g_button.last_time = now;
+        }
+    } else
+#endif
+    if ((now - g_button.ch[ch_index].last_time) > ADC_BUTTON_SAMPLE_PERIOD_US) {
+        adc_channel_update(ch_index, get_adc_volatge(ch));
+        g_button.ch[ch_index].last_time = now;
     }
 
-    if (vol <= g_button.ch[ch_index].btns[index].max &&
-            vol > g_button.ch[ch_index].btns[index].min) {
-        return 1;
-    }
-    return 0;
+    return (g_button.ch[ch_index].pressed_mask >> index) & 1;
 }
@@ -0,0 +1,73 @@
+/* SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "button_adc_filter.h"
+
+static uint16_t get_median(const uint16_t *samples, size_t num)
+{
+    uint16_t sorted[BUTTON_ADC_FILTER_SIZE_MAX];
+    for (size_t i = 0; i < num; i++) {
+        uint16_t sample = samples[i];
+        size_t j = i;
+        for (; j > 0 && sorted[j - 1] > sample; j--) {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = sample;
+    }
+    return sorted[num / 2];
+}
+
+void button_adc_filter_init(button_adc_filter_t *filter, uint8_t size, uint8_t iir_shift, uint16_t snap)
+{
+    memset(filter, 0, sizeof(button_adc_filter_t));
+    if (size < 1) {
+        size = 1;
+    } else if (size > BUTTON_ADC_FILTER_SIZE_MAX) {
+        size = BUTTON_ADC_FILTER_SIZE_MAX;
+    }
+    filter->size = size;
+    filter->iir_shift = (iir_shift > 8) ? 8 : iir_shift;
+    filter->snap = snap;
+}
+
+uint16_t button_adc_filter_push(button_adc_filter_t *filter, uint16_t voltage)
+{
+    /* The first sample fills the window, so the output doesn't ramp up from 0 */
+    if (!filter->is_primed) {
+        for (size_t i = 0; i < filter->size; i++) {
+            filter->ring[i] = voltage;
+        }
+        filter->value = (uint32_t)voltage << filter->iir_shift;
+        filter->is_primed = true;
+        return voltage;
+    }
+
+    filter->ring[filter->index] = voltage;
+    filter->index = (filter->index + 1) % filter->size;
+    uint16_t median = get_median(filter->ring, filter->size);
+
+    int32_t error = ((int32_t)median << filter->iir_shift) - (int32_t)filter->value;
+    int32_t step = error >> filter->iir_shift;
+    if ((step > filter->snap) || (-step > filter->snap)) {
+        filter->value = (uint32_t)median << filter->iir_shift;
+    } else {
+        filter->value += error >> filter->iir_shift;
+    }
+
+    /* Round to the nearest mv */
+    return (uint16_t)((filter->value + ((1U << filter->iir_shift) >> 1)) >> filter->iir_shift);
+}
+
+uint32_t button_adc_classify(const button_adc_range_t *ranges, size_t num, uint16_t voltage)
+{
+    uint32_t mask = 0;
+    for (size_t i = 0; i < num && i < 32; i++) {
+        if (voltage <= ranges[i].max && voltage > ranges[i].min) {
+            mask |= (1UL << i);
+        }
+    }
+    return mask;
+}
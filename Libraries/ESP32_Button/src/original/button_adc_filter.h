@@ -0,0 +1,79 @@
+/* SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BUTTON_ADC_FILTER_SIZE_MAX  7   /**< max number of samples of the median window */
+
+/**
+ * @brief Voltage range of an adc button, the button is pressed when min < voltage <= max
+ *
+ */
+typedef struct {
+    uint16_t min;   /**< min voltage in mv, exclusive */
+    uint16_t max;   /**< max voltage in mv, inclusive, 0 if the button is unused */
+} button_adc_range_t;
+
+/**
+ * @brief Filter of the voltage of an adc channel
+ *
+ * Each sample goes through a median over the last `size` samples, which removes the spikes without creating
+ * intermediate values, then through an IIR low-pass which smooths the noise. A median step larger than `snap` mv
+ * bypasses the IIR, so a resistor ladder going from one button to another never passes through the voltage range of
+ * a third one.
+ *
+ */
+typedef struct {
+    uint16_t ring[BUTTON_ADC_FILTER_SIZE_MAX];
+    uint8_t size;
+    uint8_t index;
+    uint8_t iir_shift;
+    uint16_t snap;
+    bool is_primed;
+    uint32_t value;     /**< output of the IIR, scaled by `1 << iir_shift` */
+} button_adc_filter_t;
+
+/**
+ * @brief Initialize a filter
+ *
+ * @param filter pointer of filter
+ * @param size number of samples of the median window, 1 .. BUTTON_ADC_FILTER_SIZE_MAX
+ * @param iir_shift the IIR moves by 1 / (1 << iir_shift) of the error for each sample, 0 disables the IIR
+ * @param snap median step in mv above which the IIR is bypassed
+ */
+void button_adc_filter_init(button_adc_filter_t *filter, uint8_t size, uint8_t iir_shift, uint16_t snap);
+
+/**
+ * @brief Push a sample into the filter
+ *
+ * @param filter pointer of filter
+ * @param voltage sample in mv
+ *
+ * @return Filtered voltage in mv
+ */
+uint16_t button_adc_filter_push(button_adc_filter_t *filter, uint16_t voltage);
+
+/**
+ * @brief Classify all buttons of a channel from one voltage
+ *
+ * @param ranges voltage range of each button
+ * @param num number of buttons, up to 32
+ * @param voltage voltage of the channel in mv
+ *
+ * @return Bit mask of the pressed buttons, bit `i` is set if `ranges[i]` contains the voltage
+ */
+uint32_t button_adc_classify(const button_adc_range_t *ranges, size_t num, uint16_t voltage);
+
+#ifdef __cplusplus
+}
+#endif
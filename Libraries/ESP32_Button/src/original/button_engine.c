@@ -0,0 +1,203 @@
+/* SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "button_engine.h"
+
+enum {
+    STATE_IDLE = 0,
+    STATE_PRESSED,          /*!< pressed, waiting for release or long press */
+    STATE_RELEASED,         /*!< released, waiting for a repeat press or the end of the clicks */
+    STATE_REPEAT_PRESSED,   /*!< pressed again within the short press time */
+    STATE_LONG_PRESSED,     /*!< long pressed, waiting for release */
+};
+
+static void engine_emit(button_engine_t *engine, button_event_t event, int64_t time, button_engine_emit_t emit, void *ctx)
+{
+    engine->event = event;
+    engine->event_time = time;
+    if (emit) {
+        emit(ctx, event);
+    }
+}
+
+static int64_t engine_get_hold_time(const button_engine_t *engine)
+{
+    return engine->press_time + engine->config.long_press_time +
+           (int64_t)engine->config.serial_time * (engine->long_press_hold_cnt + 1);
+}
+
+static int64_t engine_get_long_press_time(const button_engine_t *engine)
+{
+    if (engine->long_press_index >= engine->config.long_press_times_num) {
+        return BUTTON_ENGINE_NO_DEADLINE;
+    }
+    return engine->press_time + engine->config.long_press_times[engine->long_press_index];
+}
+
+static void engine_skip_long_press_times(button_engine_t *engine, int64_t time)
+{
+    while (engine_get_long_press_time(engine) <= time) {
+        engine->long_press_index++;
+    }
+}
+
+static int64_t engine_get_timeout(const button_engine_t *engine)
+{
+    switch (engine->state) {
+    case STATE_PRESSED:
+        return engine->press_time + engine->config.long_press_time;
+    case STATE_RELEASED:
+        return engine->anchor_time + engine->config.short_press_time;
+    case STATE_LONG_PRESSED: {
+        int64_t hold_time = engine_get_hold_time(engine);
+        int64_t long_press_time = engine_get_long_press_time(engine);
+        return (hold_time < long_press_time) ? hold_time : long_press_time;
+    }
+    default:
+        return BUTTON_ENGINE_NO_DEADLINE;
+    }
+}
+
+static void engine_on_press(button_engine_t *engine, int64_t time, button_engine_emit_t emit, void *ctx)
+{
+    switch (engine->state) {
+    case STATE_IDLE:
+        engine->repeat = 1;
+        engine->press_time = time;
+        engine->anchor_time = time;
+        engine->long_press_index = 0;
+        engine_emit(engine, BUTTON_PRESS_DOWN, time, emit, ctx);
+        engine->state = STATE_PRESSED;
+        break;
+    case STATE_RELEASED:
+        engine_emit(engine, BUTTON_PRESS_DOWN, time, emit, ctx);
+        engine->repeat++;
+        engine_emit(engine, BUTTON_PRESS_REPEAT, time, emit, ctx);
+        engine->press_time = time;
+        engine->anchor_time = time;
+        engine->state = STATE_REPEAT_PRESSED;
+        break;
+    default:
+        break;
+    }
+}
+
+static void engine_on_release(button_engine_t *engine, int64_t time, button_engine_emit_t emit, void *ctx)
+{
+    switch (engine->state) {
+    case STATE_PRESSED:
+        engine_emit(engine, BUTTON_PRESS_UP, time, emit, ctx);
+        engine->anchor_time = time;
+        engine->state = STATE_RELEASED;
+        break;
+    case STATE_REPEAT_PRESSED:
+        engine_emit(engine, BUTTON_PRESS_UP, time, emit, ctx);
+        if (time - engine->press_time < engine->config.short_press_time) {
+            engine->anchor_time = time;
+            engine->state = STATE_RELEASED;
+        } else {
+            engine->state = STATE_IDLE;
+        }
+        break;
+    case STATE_LONG_PRESSED:
+        engine_emit(engine, BUTTON_LONG_PRESS_UP, time, emit, ctx);
+        engine_emit(engine, BUTTON_PRESS_UP, time, emit, ctx);
+        engine->long_press_hold_cnt = 0;
+        engine->state = STATE_IDLE;
+        break;
+    default:
+        break;
+    }
+}
+
+static void engine_on_timeout(button_engine_t *engine, int64_t time, button_engine_emit_t emit, void *ctx)
+{
+    switch (engine->state) {
+    case STATE_PRESSED:
+        engine->state = STATE_LONG_PRESSED;
+        engine_skip_long_press_times(engine, time);
+        engine_emit(engine, BUTTON_LONG_PRESS_START, time, emit, ctx);
+        break;
+    case STATE_RELEASED:
+        if (engine->repeat == 1) {
+            engine_emit(engine, BUTTON_SINGLE_CLICK, time, emit, ctx);
+        } else if (engine->repeat == 2) {
+            engine_emit(engine, BUTTON_DOUBLE_CLICK, time, emit, ctx);
+        }
+        engine_emit(engine, BUTTON_MULTIPLE_CLICK, time, emit, ctx);
+        engine_emit(engine, BUTTON_PRESS_REPEAT_DONE, time, emit, ctx);
+        engine->repeat = 0;
+        engine->state = STATE_IDLE;
+        break;
+    case STATE_LONG_PRESSED:
+        if (engine_get_hold_time(engine) == time) {
+            engine->long_press_hold_cnt++;
+            engine_emit(engine, BUTTON_LONG_PRESS_HOLD, time, emit, ctx);
+        }
+        if (engine_get_long_press_time(engine) == time) {
+            engine_skip_long_press_times(engine, time);
+            engine_emit(engine, BUTTON_LONG_PRESS_START, time, emit, ctx);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void button_engine_init(button_engine_t *engine, const button_engine_config_t *config)
+{
+    memset(engine, 0, sizeof(button_engine_t));
+    engine->config = *config;
+    if (engine->config.serial_time == 0) {
+        engine->config.serial_time = 1;
+    }
+    engine->event = BUTTON_NONE_PRESS;
+    engine->raw_last_edge_time = INT64_MIN / 2;
+}
+
+void button_engine_edge(button_engine_t *engine, bool pressed, int64_t first_edge_time, int64_t last_edge_time)
+{
+    /* A level back to stable for less than the debounce time is a bounce, the transition started earlier */
+    if ((engine->raw_pressed == engine->pressed) &&
+            (first_edge_time - engine->raw_last_edge_time >= engine->config.debounce_time)) {
+        engine->raw_first_edge_time = first_edge_time;
+    }
+    engine->raw_pressed = pressed;
+    engine->raw_last_edge_time = last_edge_time;
+}
+
+int64_t button_engine_process(button_engine_t *engine, int64_t now, button_engine_emit_t emit, void *ctx)
+{
+    while (true) {
+        int64_t timeout = engine_get_timeout(engine);
+        bool is_edge_pending = (engine->raw_pressed != engine->pressed);
+        int64_t edge_accept_time = engine->raw_last_edge_time + engine->config.debounce_time;
+
+        /* A timeout after a pending edge waits for the edge to be accepted or rejected */
+        if ((timeout <= now) && (!is_edge_pending || (timeout < engine->raw_first_edge_time))) {
+            engine_on_timeout(engine, timeout, emit, ctx);
+            continue;
+        }
+        if (is_edge_pending && (edge_accept_time <= now)) {
+            /* The transition happened at the first edge, the bounces are only filtered out */
+            engine->pressed = engine->raw_pressed;
+            if (engine->pressed) {
+                engine_on_press(engine, engine->raw_first_edge_time, emit, ctx);
+            } else {
+                engine_on_release(engine, engine->raw_first_edge_time, emit, ctx);
+            }
+            continue;
+        }
+
+        if (engine->state == STATE_IDLE) {
+            engine->event = BUTTON_NONE_PRESS;
+        }
+        if (is_edge_pending && (timeout >= engine->raw_first_edge_time)) {
+            return edge_accept_time;
+        }
+        return timeout;
+    }
+}
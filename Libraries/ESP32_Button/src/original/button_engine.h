@@ -0,0 +1,122 @@
+/* SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "button_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BUTTON_ENGINE_NO_DEADLINE   INT64_MAX   /**< Returned by `button_engine_process()` when the button is idle */
+
+/**
+ * @brief Callback to report an event, `button_engine_get_event_time()` returns its timestamp
+ *
+ */
+typedef void (*button_engine_emit_t)(void *ctx, button_event_t event);
+
+/**
+ * @brief Button engine configuration, all times are in microseconds
+ *
+ */
+typedef struct {
+    uint32_t debounce_time;             /**< the level must be stable for this time before a transition is accepted */
+    uint32_t short_press_time;          /**< max time between a release and the next press to count as a repeat */
+    uint32_t long_press_time;           /**< press time to start a long press */
+    uint32_t serial_time;               /**< interval of BUTTON_LONG_PRESS_HOLD events */
+    const uint32_t *long_press_times;   /**< additional press times (sorted ascending) reporting BUTTON_LONG_PRESS_START again, can be NULL */
+    size_t long_press_times_num;        /**< number of additional press times */
+} button_engine_config_t;
+
+/**
+ * @brief Button engine state machine
+ *
+ * The engine only works on timestamped level edges. It is fed with the raw edges (e.g. from a GPIO interrupt), filters
+ * the bounces, derives the click / double-click / long-press events from the edge timestamps and returns the time of
+ * the next timeout, so the caller only needs to wake up at that time instead of polling the button. It doesn't access
+ * any hardware or timer, so the test app drives it with synthetic timestamps.
+ *
+ */
+typedef struct {
+    button_engine_config_t config;
+    uint8_t state;
+    bool pressed;                       /**< debounced level */
+    bool raw_pressed;                   /**< level of the last raw edge */
+    int64_t raw_first_edge_time;        /**< time of the first raw edge since the level was last stable */
+    int64_t raw_last_edge_time;         /**< time of the last raw edge */
+    int64_t anchor_time;                /**< time of the last press down or release */
+    int64_t press_time;                 /**< time of the last press down */
+    int64_t event_time;                 /**< time of the last event */
+    uint8_t repeat;
+    uint16_t long_press_hold_cnt;
+    size_t long_press_index;            /**< index of the next press time in `config.long_press_times` */
+    button_event_t event;
+} button_engine_t;
+
+/**
+ * @brief Initialize a button engine, the button is released
+ *
+ * @param engine pointer of engine
+ * @param config pointer of configuration, copied into the engine
+ */
+void button_engine_init(button_engine_t *engine, const button_engine_config_t *config);
+
+/**
+ * @brief Report raw level edges, bounces included
+ *
+ * @param engine pointer of engine
+ * @param pressed level after the edges
+ * @param first_edge_time time of the first edge since the last report
+ * @param last_edge_time time of the last edge since the last report
+ */
+void button_engine_edge(button_engine_t *engine, bool pressed, int64_t first_edge_time, int64_t last_edge_time);
+
+/**
+ * @brief Run the state machine until `now`, emitting the events in time order
+ *
+ * @param engine pointer of engine
+ * @param now current time
+ * @param emit callback for each event, can be NULL
+ * @param ctx context passed to `emit`
+ *
+ * @return Time at which it should be called again, or BUTTON_ENGINE_NO_DEADLINE if it only needs to run on edges
+ */
+int64_t button_engine_process(button_engine_t *engine, int64_t now, button_engine_emit_t emit, void *ctx);
+
+/**
+ * @brief Get the time of the last event
+ *
+ */
+static inline int64_t button_engine_get_event_time(const button_engine_t *engine)
+{
+    return engine->event_time;
+}
+
+/**
+ * @brief Get the time from the last press down or release to the last event, e.g. the press time in BUTTON_LONG_PRESS_UP
+ *
+ */
+static inline uint32_t button_engine_get_ticks_time(const button_engine_t *engine)
+{
+    return (uint32_t)(engine->event_time - engine->anchor_time);
+}
+
+/**
+ * @brief Get the time from the last press down to the last event
+ *
+ */
+static inline uint32_t button_engine_get_press_time(const button_engine_t *engine)
+{
+    return (uint32_t)(engine->event_time - engine->press_time);
+}
+
+#ifdef __cplusplus
+}
+#endif
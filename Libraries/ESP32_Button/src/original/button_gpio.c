@@ -39,10 +39,31 @@ esp_err_t button_gpio_init(const button_gpio_config_t *config)
 
 esp_err_t button_gpio_deinit(int gpio_num)
 {
-    return gpio_reset_pin(gpio_num);;
+    gpio_isr_handler_remove(gpio_num);
+    return gpio_reset_pin(gpio_num);
 }
 
 uint8_t button_gpio_get_key_level(void *gpio_num)
 {
     return (uint8_t)gpio_get_level((uint32_t)gpio_num);
 }
+
+esp_err_t button_gpio_set_intr(int gpio_num, gpio_isr_t isr_handler, void *args)
+{
+    GPIO_BTN_CHECK(GPIO_IS_VALID_GPIO(gpio_num), "GPIO number error", ESP_ERR_INVALID_ARG);
+
+    if (NULL == isr_handler) {
+        gpio_set_intr_type(gpio_num, GPIO_INTR_DISABLE);
+        gpio_isr_handler_remove(gpio_num);
+        return ESP_OK;
+    }
+
+    /* The service may already be installed by others, e.g. `attachInterrupt()` of Arduino */
+    esp_err_t ret = gpio_install_isr_service(0);
+    GPIO_BTN_CHECK(ESP_OK == ret || ESP_ERR_INVALID_STATE == ret, "GPIO ISR service install failed", ret);
+    ret = gpio_isr_handler_add(gpio_num, isr_handler, args);
+    GPIO_BTN_CHECK(ESP_OK == ret, "GPIO ISR handler add failed", ret);
+    gpio_set_intr_type(gpio_num, GPIO_INTR_ANYEDGE);
+
+    return ESP_OK;
+}
@@ -49,6 +49,19 @@ esp_err_t button_gpio_deinit(int gpio_num);
  */
 uint8_t button_gpio_get_key_level(void *gpio_num);
 
+/**
+ * @brief Call a handler on both edges of the button gpio
+ * 
+ * @param gpio_num gpio number of button
+ * @param isr_handler interrupt handler, NULL to remove the handler
+ * @param args argument passed to the handler
+ * 
+ * @return
+ *      - ESP_OK on success
+ *      - Others if the gpio ISR service can't be installed or the handler can't be added
+ */
+esp_err_t button_gpio_set_intr(int gpio_num, gpio_isr_t isr_handler, void *args);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,12 +1,18 @@
 /*
- * SPDX-FileCopyrightText: 2023-2024 Espressif Systems (Shanghai) CO LTD
+ * SPDX-FileCopyrightText: 2023-2025 Espressif Systems (Shanghai) CO LTD
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <stdbool.h>
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "driver/gpio.h"
+#include "soc/soc.h"
+#include "soc/gpio_reg.h"
 #include "button_matrix.h"
+#include "button_matrix_scan.h"
+#include "arduino_config.h"
 
 static const char *TAG = "matrix button";
 
@@ -17,43 +23,167 @@ static const char *TAG = "matrix button";
         return (ret_val);                                         \
     }
 
+#define MATRIX_BUTTON_ROW_MAX   BUTTON_MATRIX_SCAN_ROW_MAX
+#define MATRIX_BUTTON_COL_MAX   BUTTON_MATRIX_SCAN_COL_MAX
+/* Buttons are polled every CONFIG_BUTTON_PERIOD_TIME_MS, the half period margin lets all the polls of one period share
+ * a scan while the next period always scans again */
+#define MATRIX_SCAN_PERIOD_US   ((CONFIG_BUTTON_MATRIX_SCAN_PERIOD_MS * 1000) - (CONFIG_BUTTON_PERIOD_TIME_MS * 1000 / 2))
+
+typedef struct {
+    int32_t gpio_num;
+    uint16_t ref_count;     /* number of buttons on the line, 0 if the slot is free */
+} matrix_line_t;
+
+typedef struct {
+    matrix_line_t rows[MATRIX_BUTTON_ROW_MAX];
+    matrix_line_t cols[MATRIX_BUTTON_COL_MAX];
+    button_matrix_scan_t scan;
+    int64_t last_scan_time;
+    bool is_init;
+} matrix_button_t;
+
+static matrix_button_t g_matrix = {0};
+
+static int find_line(const matrix_line_t *lines, int num, int32_t gpio_num)
+{
+    for (int i = 0; i < num; i++) {
+        if (lines[i].ref_count > 0 && lines[i].gpio_num == gpio_num) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int find_unused_line(const matrix_line_t *lines, int num)
+{
+    for (int i = 0; i < num; i++) {
+        if (0 == lines[i].ref_count) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Read the level of all gpios at once
+ */
+static inline uint64_t matrix_read_inputs(void)
+{
+    uint64_t level = REG_READ(GPIO_IN_REG);
+#ifdef GPIO_IN1_REG
+    level |= (uint64_t)REG_READ(GPIO_IN1_REG) << 32;
+#endif
+    return level;
+}
+
+/**
+ * @brief Drive each row once and read all columns of it
+ */
+static void matrix_scan(void)
+{
+    uint32_t rows[MATRIX_BUTTON_ROW_MAX] = {0};
+    uint8_t row_num = 0;
+
+    for (int i = 0; i < MATRIX_BUTTON_ROW_MAX; i++) {
+        if (0 == g_matrix.rows[i].ref_count) {
+            continue;
+        }
+        gpio_set_level(g_matrix.rows[i].gpio_num, 1);
+        uint64_t level = matrix_read_inputs();
+        gpio_set_level(g_matrix.rows[i].gpio_num, 0);
+
+        for (int j = 0; j < MATRIX_BUTTON_COL_MAX; j++) {
+            if (g_matrix.cols[j].ref_count > 0 && ((level >> g_matrix.cols[j].gpio_num) & 1)) {
+                rows[i] |= (1UL << j);
+            }
+        }
+        row_num = i + 1;
+    }
+
+    bool was_ghosting = g_matrix.scan.is_ghosting;
+    button_matrix_scan_update(&g_matrix.scan, rows, row_num);
+    if (g_matrix.scan.is_ghosting != was_ghosting) {
+        ESP_LOGD(TAG, "%s", g_matrix.scan.is_ghosting ? "ghosting, some keys are ignored" : "ghosting released");
+    }
+}
+
 esp_err_t button_matrix_init(const button_matrix_config_t *config)
 {
     MATRIX_BTN_CHECK(NULL != config, "Pointer of config is invalid", ESP_ERR_INVALID_ARG);
     MATRIX_BTN_CHECK(GPIO_IS_VALID_GPIO(config->row_gpio_num), "row GPIO number error", ESP_ERR_INVALID_ARG);
     MATRIX_BTN_CHECK(GPIO_IS_VALID_GPIO(config->col_gpio_num), "col GPIO number error", ESP_ERR_INVALID_ARG);
 
-    // set row gpio as output
+    if (!g_matrix.is_init) {
+        button_matrix_scan_init(&g_matrix.scan, CONFIG_BUTTON_MATRIX_DEBOUNCE_SCANS);
+        g_matrix.is_init = true;
+    }
+
+    int row = find_line(g_matrix.rows, MATRIX_BUTTON_ROW_MAX, config->row_gpio_num);
+    int col = find_line(g_matrix.cols, MATRIX_BUTTON_COL_MAX, config->col_gpio_num);
+    if (row < 0) {
+        row = find_unused_line(g_matrix.rows, MATRIX_BUTTON_ROW_MAX);
+        MATRIX_BTN_CHECK(row >= 0, "too many rows", ESP_ERR_NO_MEM);
+    }
+    if (col < 0) {
+        col = find_unused_line(g_matrix.cols, MATRIX_BUTTON_COL_MAX);
+        MATRIX_BTN_CHECK(col >= 0, "too many columns", ESP_ERR_NO_MEM);
+    }
+
     gpio_config_t gpio_conf = {0};
     gpio_conf.intr_type = GPIO_INTR_DISABLE;
-    gpio_conf.mode = GPIO_MODE_OUTPUT;
     gpio_conf.pull_down_en = GPIO_PULLDOWN_ENABLE;
-    gpio_conf.pin_bit_mask = (1ULL << config->row_gpio_num);
-    gpio_config(&gpio_conf);
-
-    // set col gpio as input
-    gpio_conf.mode = GPIO_MODE_INPUT;
-    gpio_conf.pin_bit_mask = (1ULL << config->col_gpio_num);
-    gpio_config(&gpio_conf);
+    if (0 == g_matrix.rows[row].ref_count) {
+        // set row gpio as output
+        gpio_conf.mode = GPIO_MODE_OUTPUT;
+        gpio_conf.pin_bit_mask = (1ULL << config->row_gpio_num);
+        gpio_config(&gpio_conf);
+        gpio_set_level(config->row_gpio_num, 0);
+        g_matrix.rows[row].gpio_num = config->row_gpio_num;
+        button_matrix_scan_reset_row(&g_matrix.scan, row);
+    }
+    if (0 == g_matrix.cols[col].ref_count) {
+        // set col gpio as input
+        gpio_conf.mode = GPIO_MODE_INPUT;
+        gpio_conf.pin_bit_mask = (1ULL << config->col_gpio_num);
+        gpio_config(&gpio_conf);
+        g_matrix.cols[col].gpio_num = config->col_gpio_num;
+        button_matrix_scan_reset_col(&g_matrix.scan, col);
+    }
+    g_matrix.rows[row].ref_count++;
+    g_matrix.cols[col].ref_count++;
 
     return ESP_OK;
 }
 
 esp_err_t button_matrix_deinit(int row_gpio_num, int col_gpio_num)
 {
-    //Reset an gpio to default state (select gpio function, enable pullup and disable input and output).
-    gpio_reset_pin(row_gpio_num);
-    gpio_reset_pin(col_gpio_num);
+    int row = find_line(g_matrix.rows, MATRIX_BUTTON_ROW_MAX, row_gpio_num);
+    int col = find_line(g_matrix.cols, MATRIX_BUTTON_COL_MAX, col_gpio_num);
+    MATRIX_BTN_CHECK(row >= 0 && col >= 0, "button not found", ESP_ERR_INVALID_ARG);
+
+    //Reset an gpio to default state (select gpio function, enable pullup and disable input and output),
+    //once no other button uses it.
+    if (0 == --g_matrix.rows[row].ref_count) {
+        gpio_reset_pin(row_gpio_num);
+    }
+    if (0 == --g_matrix.cols[col].ref_count) {
+        gpio_reset_pin(col_gpio_num);
+    }
     return ESP_OK;
 }
 
 uint8_t button_matrix_get_key_level(void *hardware_data)
 {
-    uint32_t row = MATRIX_BUTTON_SPLIT_ROW(hardware_data);
-    uint32_t col = MATRIX_BUTTON_SPLIT_COL(hardware_data);
-    gpio_set_level(row, 1);
-    uint8_t level = gpio_get_level(col);
-    gpio_set_level(row, 0);
+    int row = find_line(g_matrix.rows, MATRIX_BUTTON_ROW_MAX, MATRIX_BUTTON_SPLIT_ROW(hardware_data));
+    int col = find_line(g_matrix.cols, MATRIX_BUTTON_COL_MAX, MATRIX_BUTTON_SPLIT_COL(hardware_data));
+    if (row < 0 || col < 0) {
+        return 0;
+    }
 
-    return level;
+    int64_t now = esp_timer_get_time();
+    if ((now - g_matrix.last_scan_time) >= MATRIX_SCAN_PERIOD_US) {
+        matrix_scan();
+        g_matrix.last_scan_time = now;
+    }
+    return button_matrix_scan_get(&g_matrix.scan, row, col);
 }
@@ -29,9 +29,13 @@ extern "C" {
  *        |  (R3-C1)   |  (R3-C2)   |  (R3-C3)   |
  *        ----------------------------------------
  * 
- *        - Button matrix key is driven using row scanning.
+ *        - Button matrix key is driven using row scanning. All buttons share one scan of the whole matrix,
+ *          each row is driven once and all columns are read with a single register read.
+ *        - The scan is debounced by CONFIG_BUTTON_MATRIX_DEBOUNCE_SCANS and runs at most every
+ *          CONFIG_BUTTON_MATRIX_SCAN_PERIOD_MS.
  *        - Buttons within the same column cannot be detected simultaneously,
  *          but buttons within the same row can be detected without conflicts.
+ *        - Rows sharing two or more pressed columns (ghosting) keep their last state until released.
  */
 typedef struct {
     int32_t row_gpio_num;        /**< GPIO number associated with the row */
@@ -45,6 +49,7 @@ typedef struct {
  * @return
  *      - ESP_OK on success
  *      - ESP_ERR_INVALID_ARG if the argument is NULL.
+ *      - ESP_ERR_NO_MEM if the matrix has too many rows or columns.
  * 
  * @note When initializing the button matrix keyboard, the row GPIO pins will be set as outputs,
  *       and the column GPIO pins will be set as inputs, both with pull-down resistors enabled.
@@ -58,8 +63,9 @@ esp_err_t button_matrix_init(const button_matrix_config_t *config);
  * @param col_gpio_num GPIO number of the column where the button is located.
  * @return
  *      - ESP_OK if the button is successfully deinitialized
+ *      - ESP_ERR_INVALID_ARG if the button is not initialized
  * 
- * @note When deinitializing a button, please exercise caution and avoid deinitializing a button individually, as it may affect the proper functioning of other buttons in the same row or column.
+ * @note The row and column GPIOs are reset once no other button of the matrix uses them.
  */
 esp_err_t button_matrix_deinit(int row_gpio_num, int col_gpio_num);
 
@@ -69,7 +75,8 @@ esp_err_t button_matrix_deinit(int row_gpio_num, int col_gpio_num);
  * @param hardware_data Pointer to hardware-specific data containing information about row GPIO and column GPIO.
  * @return uint8_t[out] The key level read from the hardware.
  * 
- * @note This function retrieves the key level from the button matrix hardware.
+ * @note This function retrieves the debounced key level from the last scan of the matrix, and scans it again
+ *       if the scan is older than CONFIG_BUTTON_MATRIX_SCAN_PERIOD_MS.
  *       The `hardware_data` parameter should contain information about the row and column GPIO pins,
  *       and you can access this information using the `MATRIX_BUTTON_SPLIT_COL` and `MATRIX_BUTTON_SPLIT_ROW` macros.
  */
@@ -0,0 +1,72 @@
+/* SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "button_matrix_scan.h"
+
+static bool has_multiple_bits(uint32_t value)
+{
+    return (value & (value - 1)) != 0;
+}
+
+void button_matrix_scan_init(button_matrix_scan_t *scan, uint8_t debounce_scans)
+{
+    memset(scan, 0, sizeof(button_matrix_scan_t));
+    scan->debounce_scans = (debounce_scans > 0) ? debounce_scans : 1;
+}
+
+bool button_matrix_scan_update(button_matrix_scan_t *scan, const uint32_t *rows, uint8_t row_num)
+{
+    uint32_t ghost_rows = 0;
+    bool is_changed = false;
+
+    if (row_num > BUTTON_MATRIX_SCAN_ROW_MAX) {
+        row_num = BUTTON_MATRIX_SCAN_ROW_MAX;
+    }
+    for (uint8_t i = 0; i < row_num; i++) {
+        for (uint8_t j = i + 1; j < row_num; j++) {
+            if (has_multiple_bits(rows[i] & rows[j])) {
+                ghost_rows |= (1UL << i) | (1UL << j);
+            }
+        }
+    }
+    scan->is_ghosting = (ghost_rows != 0);
+
+    for (uint8_t i = 0; i < row_num; i++) {
+        if (ghost_rows & (1UL << i)) {
+            /* Wait for the combination to be released, it then has to be stable again */
+            scan->count[i] = 0;
+            continue;
+        }
+        if (rows[i] != scan->raw[i]) {
+            scan->raw[i] = rows[i];
+            scan->count[i] = 0;
+        }
+        if (scan->count[i] < scan->debounce_scans) {
+            scan->count[i]++;
+        }
+        if ((scan->count[i] >= scan->debounce_scans) && (scan->stable[i] != scan->raw[i])) {
+            scan->stable[i] = scan->raw[i];
+            is_changed = true;
+        }
+    }
+    return is_changed;
+}
+
+void button_matrix_scan_reset_row(button_matrix_scan_t *scan, uint8_t row)
+{
+    scan->count[row] = 0;
+    scan->raw[row] = 0;
+    scan->stable[row] = 0;
+}
+
+void button_matrix_scan_reset_col(button_matrix_scan_t *scan, uint8_t col)
+{
+    for (uint8_t i = 0; i < BUTTON_MATRIX_SCAN_ROW_MAX; i++) {
+        scan->count[i] = 0;
+        scan->raw[i] &= ~(1UL << col);
+        scan->stable[i] &= ~(1UL << col);
+    }
+}
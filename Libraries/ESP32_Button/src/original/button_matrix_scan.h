@@ -0,0 +1,77 @@
+/* SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BUTTON_MATRIX_SCAN_ROW_MAX  16  /**< max number of rows of a matrix */
+#define BUTTON_MATRIX_SCAN_COL_MAX  32  /**< max number of columns of a matrix, one bit of a row bitmap each */
+
+/**
+ * @brief Debounced state of a button matrix
+ *
+ * The matrix is fed with one raw scan at a time, a bitmap of the columns read high for each row. A row is accepted
+ * once it read the same for `debounce_scans` consecutive scans. A scan in which two rows share two or more columns
+ * can't be resolved: the fourth corner of a rectangle of three pressed keys reads pressed as well (ghosting), so the
+ * rows involved keep their last debounced state until the combination is released.
+ *
+ */
+typedef struct {
+    uint8_t debounce_scans;
+    bool is_ghosting;                               /**< the last scan contained an unresolvable key combination */
+    uint8_t count[BUTTON_MATRIX_SCAN_ROW_MAX];      /**< number of consecutive scans with the same raw row */
+    uint32_t raw[BUTTON_MATRIX_SCAN_ROW_MAX];       /**< raw row of the last scan */
+    uint32_t stable[BUTTON_MATRIX_SCAN_ROW_MAX];    /**< debounced row */
+} button_matrix_scan_t;
+
+/**
+ * @brief Initialize the state of a matrix, all keys are released
+ *
+ * @param scan pointer of state
+ * @param debounce_scans number of identical scans to accept a row, at least 1
+ */
+void button_matrix_scan_init(button_matrix_scan_t *scan, uint8_t debounce_scans);
+
+/**
+ * @brief Feed a raw scan
+ *
+ * @param scan pointer of state
+ * @param rows bitmap of the columns read high for each row
+ * @param row_num number of rows, up to BUTTON_MATRIX_SCAN_ROW_MAX
+ *
+ * @return true if the debounced state changed
+ */
+bool button_matrix_scan_update(button_matrix_scan_t *scan, const uint32_t *rows, uint8_t row_num);
+
+/**
+ * @brief Reset a row to released, e.g. when its gpio is reused by another row
+ *
+ */
+void button_matrix_scan_reset_row(button_matrix_scan_t *scan, uint8_t row);
+
+/**
+ * @brief Reset a column to released in all rows, e.g. when its gpio is reused by another column
+ *
+ */
+void button_matrix_scan_reset_col(button_matrix_scan_t *scan, uint8_t col);
+
+/**
+ * @brief Get the debounced level of a key
+ *
+ */
+static inline bool button_matrix_scan_get(const button_matrix_scan_t *scan, uint8_t row, uint8_t col)
+{
+    return (scan->stable[row] >> col) & 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -6,12 +6,14 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <sys/param.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/timers.h"
 #include "esp_log.h"
 #include "driver/gpio.h"
 #include "iot_button.h"
+#include "button_engine.h"
 #include "esp_timer.h"
 #include "sdkconfig.h"
 #include "arduino_config.h"
@@ -20,6 +22,8 @@ static const char *TAG = "button";
 static portMUX_TYPE s_button_lock = portMUX_INITIALIZER_UNLOCKED;
 #define BUTTON_ENTER_CRITICAL()           portENTER_CRITICAL(&s_button_lock)
 #define BUTTON_EXIT_CRITICAL()            portEXIT_CRITICAL(&s_button_lock)
+#define BUTTON_ENTER_CRITICAL_ISR()       portENTER_CRITICAL_ISR(&s_button_lock)
+#define BUTTON_EXIT_CRITICAL_ISR()        portEXIT_CRITICAL_ISR(&s_button_lock)
 
 #define BTN_CHECK(a, str, ret_val)                                \
     if (!(a)) {                                                   \
@@ -37,29 +41,38 @@ typedef struct {
     button_event_data_t event_data;
 } button_cb_info_t;
 
+/**
+ * @brief Press times of the BUTTON_LONG_PRESS_START callbacks, freed by the button timer once it can't read them
+ *
+ */
+typedef struct button_press_times {
+    struct button_press_times *next;                /*! Next retired press times*/
+    uint32_t            times[];                    /*! Press time(us) of each callback*/
+} button_press_times_t;
+
 /**
  * @brief Structs to record individual key parameters
  *
  */
 typedef struct Button {
-    uint16_t            ticks;
-    uint16_t            long_press_ticks;     /*! Trigger ticks for long press*/
-    uint16_t            short_press_ticks;    /*! Trigger ticks for repeat press*/
-    uint16_t            long_press_hold_cnt;  /*! Record long press hold count*/
-    uint16_t            long_press_ticks_default;
-    uint8_t             repeat;
-    uint8_t             state: 3;
-    uint8_t             debounce_cnt: 3;
+    button_engine_t     engine;
+    uint16_t            long_press_time_default;    /*! Default long press time(ms) for callbacks without press time*/
     uint8_t             active_level: 1;
-    uint8_t             button_level: 1;
-    button_event_t      event;
+    uint8_t             is_polled: 1;               /*! Level is sampled every TICKS_INTERVAL instead of on edges*/
+    struct {
+        bool            pending;
+        bool            pressed;
+        int64_t         first_time;
+        int64_t         last_time;
+    } edge;                                         /*! Raw edges recorded by the gpio interrupt*/
+    button_press_times_t *long_press_times;         /*! Press times the engine wakes up at*/
+    size_t              long_press_start_index;     /*! Next BUTTON_LONG_PRESS_START callback of the press*/
     uint8_t             (*hal_button_Level)(void *hardware_data);
     esp_err_t           (*hal_button_deinit)(void *hardware_data);
     void                *hardware_data;
     button_type_t       type;
     button_cb_info_t    *cb_info[BUTTON_EVENT_MAX];
     size_t              size[BUTTON_EVENT_MAX];
-    int                 count[2];
     struct Button       *next;
 } button_dev_t;
 
@@ -67,13 +80,12 @@ typedef struct Button {
 static button_dev_t *g_head_handle = NULL;
 static esp_timer_handle_t g_button_timer_handle = NULL;
 static bool g_is_timer_running = false;
+static uint32_t g_edge_seq = 0;                                 /*! Incremented on each gpio edge*/
+static button_press_times_t *g_retired_press_times = NULL;      /*! Press times replaced since the last timer run*/
 
 #define TICKS_INTERVAL    CONFIG_BUTTON_PERIOD_TIME_MS
-#define DEBOUNCE_TICKS    CONFIG_BUTTON_DEBOUNCE_TICKS //MAX 8
-#define SHORT_TICKS       (CONFIG_BUTTON_SHORT_PRESS_TIME_MS /TICKS_INTERVAL)
-#define LONG_TICKS        (CONFIG_BUTTON_LONG_PRESS_TIME_MS /TICKS_INTERVAL)
-#define SERIAL_TICKS      (CONFIG_BUTTON_SERIAL_TIME_MS /TICKS_INTERVAL)
-#define TOLERANCE         CONFIG_BUTTON_LONG_PRESS_TOLERANCE_MS
+#define DEBOUNCE_TIME_US  (CONFIG_BUTTON_DEBOUNCE_TICKS * TICKS_INTERVAL * 1000)
+#define MS_TO_US(ms)      ((uint32_t)(ms) * 1000)
 
 #define CALL_EVENT_CB(ev)                                                   \
     if (btn->cb_info[ev]) {                                                 \
@@ -82,261 +94,306 @@ static bool g_is_timer_running = false;
         }                                                                   \
     }                                                                       \
 
-#define TIME_TO_TICKS(time, congfig_time)  (0 == (time))?congfig_time:(((time) / TICKS_INTERVAL))?((time) / TICKS_INTERVAL):1
+/**
+  * @brief  Get the sort key of a callback, callbacks of BUTTON_LONG_PRESS_START, BUTTON_LONG_PRESS_UP and
+  *         BUTTON_MULTIPLE_CLICK are sorted by it.
+  */
+static uint16_t button_cb_get_key(const button_cb_info_t *cb_info, button_event_t event)
+{
+    if (event == BUTTON_MULTIPLE_CLICK) {
+        return cb_info->event_data.multiple_clicks.clicks;
+    }
+    return cb_info->event_data.long_press.press_time;
+}
 
 /**
-  * @brief  Button driver core function, driver state machine.
+  * @brief  Find the first callback of a sorted event whose key is greater than `value`.
   */
-static void button_handler(button_dev_t *btn)
+static size_t button_cb_upper_bound(const button_dev_t *btn, button_event_t event, uint32_t value)
 {
-    uint8_t read_gpio_level = btn->hal_button_Level(btn->hardware_data);
+    size_t low = 0;
+    size_t high = btn->size[event];
+    while (low < high) {
+        size_t mid = (low + high) / 2;
+        if (button_cb_get_key(&btn->cb_info[event][mid], event) <= value) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
 
-    /** ticks counter working.. */
-    if ((btn->state) > 0) {
-        btn->ticks++;
+static void button_call_cb_range(button_dev_t *btn, button_event_t event, size_t start, size_t end)
+{
+    for (size_t i = start; i < end; i++) {
+        btn->cb_info[event][i].cb(btn, btn->cb_info[event][i].usr_data);
     }
+}
 
-    /**< button debounce handle */
-    if (read_gpio_level != btn->button_level) {
-        if (++(btn->debounce_cnt) >= DEBOUNCE_TICKS) {
-            btn->button_level = read_gpio_level;
-            btn->debounce_cnt = 0;
+/**
+  * @brief  Dispatch an event of the engine to the callbacks.
+  */
+static void button_dispatch(void *ctx, button_event_t event)
+{
+    button_dev_t *btn = (button_dev_t *)ctx;
+    uint32_t press_time = button_engine_get_press_time(&btn->engine) / 1000;
+
+    switch (event) {
+    case BUTTON_PRESS_DOWN:
+        btn->long_press_start_index = 0;
+        CALL_EVENT_CB(event);
+        break;
+    case BUTTON_LONG_PRESS_START: {
+        /** Calling callbacks whose press_time has been reached */
+        size_t end = button_cb_upper_bound(btn, event, press_time);
+        if (end > btn->long_press_start_index) {
+            button_call_cb_range(btn, event, btn->long_press_start_index, end);
+            btn->long_press_start_index = end;
         }
-    } else {
-        btn->debounce_cnt = 0;
-    }
-
-    /** State machine */
-    switch (btn->state) {
-    case 0:
-        if (btn->button_level == btn->active_level) {
-            btn->event = (uint8_t)BUTTON_PRESS_DOWN;
-            CALL_EVENT_CB(BUTTON_PRESS_DOWN);
-            btn->ticks = 0;
-            btn->repeat = 1;
-            btn->state = 1;
-        } else {
-            btn->event = (uint8_t)BUTTON_NONE_PRESS;
+    } break;
+    case BUTTON_LONG_PRESS_UP: {
+        /** Calling callbacks with the longest press_time reached */
+        size_t end = button_cb_upper_bound(btn, event, press_time);
+        if (end > 0) {
+            uint16_t time = button_cb_get_key(&btn->cb_info[event][end - 1], event);
+            button_call_cb_range(btn, event, button_cb_upper_bound(btn, event, time - 1), end);
         }
+    } break;
+    case BUTTON_MULTIPLE_CLICK: {
+        /** Calling the callbacks for MULTIPLE BUTTON CLICKS */
+        uint8_t repeat = btn->engine.repeat;
+        button_call_cb_range(
+            btn, event, button_cb_upper_bound(btn, event, repeat - 1), button_cb_upper_bound(btn, event, repeat)
+        );
+    } break;
+    default:
+        CALL_EVENT_CB(event);
         break;
+    }
+}
 
-    case 1:
-        if (btn->button_level != btn->active_level) {
-            btn->event = (uint8_t)BUTTON_PRESS_UP;
-            CALL_EVENT_CB(BUTTON_PRESS_UP);
-            btn->ticks = 0;
-            btn->state = 2;
-
-        } else if (btn->ticks > btn->long_press_ticks) {
-            btn->event = (uint8_t)BUTTON_LONG_PRESS_START;
-            btn->state = 4;
-            /** Calling callbacks for BUTTON_LONG_PRESS_START */
-            uint16_t ticks_time = iot_button_get_ticks_time(btn);
-            if (btn->cb_info[btn->event] && btn->count[0] == 0) {
-                if (abs(ticks_time - (btn->long_press_ticks * TICKS_INTERVAL)) <= TOLERANCE && btn->cb_info[btn->event][btn->count[0]].event_data.long_press.press_time == (btn->long_press_ticks * TICKS_INTERVAL)) {
-                    do {
-                        btn->cb_info[btn->event][btn->count[0]].cb(btn, btn->cb_info[btn->event][btn->count[0]].usr_data);
-                        btn->count[0]++;
-                        if (btn->count[0] >= btn->size[btn->event])
-                            break;
-                    } while (btn->cb_info[btn->event][btn->count[0]].event_data.long_press.press_time == btn->long_press_ticks * TICKS_INTERVAL);
-                }
-            }
-        }
-        break;
+static void button_free_press_times(button_press_times_t *press_times)
+{
+    while (press_times) {
+        button_press_times_t *next = press_times->next;
+        free(press_times);
+        press_times = next;
+    }
+}
 
-    case 2:
-        if (btn->button_level == btn->active_level) {
-            btn->event = (uint8_t)BUTTON_PRESS_DOWN;
-            CALL_EVENT_CB(BUTTON_PRESS_DOWN);
-            btn->event = (uint8_t)BUTTON_PRESS_REPEAT;
-            btn->repeat++;
-            CALL_EVENT_CB(BUTTON_PRESS_REPEAT); // repeat hit
-            btn->ticks = 0;
-            btn->state = 3;
-        } else if (btn->ticks > btn->short_press_ticks) {
-            if (btn->repeat == 1) {
-                btn->event = (uint8_t)BUTTON_SINGLE_CLICK;
-                CALL_EVENT_CB(BUTTON_SINGLE_CLICK);
-            } else if (btn->repeat == 2) {
-                btn->event = (uint8_t)BUTTON_DOUBLE_CLICK;
-                CALL_EVENT_CB(BUTTON_DOUBLE_CLICK); // repeat hit
-            }
+/**
+  * @brief  Free the press times later, the button timer may be reading them. Must be called in critical section.
+  */
+static void button_retire_press_times(button_press_times_t *press_times)
+{
+    if (press_times) {
+        press_times->next = g_retired_press_times;
+        g_retired_press_times = press_times;
+    }
+}
 
-            btn->event = (uint8_t)BUTTON_MULTIPLE_CLICK;
-
-            /** Calling the callbacks for MULTIPLE BUTTON CLICKS */
-            for (int i = 0; i < btn->size[btn->event]; i++) {
-                if (btn->repeat == btn->cb_info[btn->event][i].event_data.multiple_clicks.clicks) {
-                    do {
-                        btn->cb_info[btn->event][i].cb(btn, btn->cb_info[btn->event][i].usr_data);
-                        i++;
-                        if (i >= btn->size[btn->event])
-                            break;
-                    } while (btn->cb_info[btn->event][i].event_data.multiple_clicks.clicks == btn->repeat);
-                }
-            }
+/**
+  * @brief  Arm the button timer at `deadline`, or leave it stopped if there is none. Must not be called in critical
+  *         section, returns ESP_ERR_INVALID_STATE if the timer has been armed by another context meanwhile.
+  */
+static esp_err_t button_timer_schedule(int64_t deadline, int64_t now)
+{
+    esp_err_t ret = esp_timer_stop(g_button_timer_handle);
+    if (ESP_ERR_INVALID_STATE == ret) {
+        /* The timer wasn't armed */
+        ret = ESP_OK;
+    }
+    if (ESP_OK == ret && deadline != BUTTON_ENGINE_NO_DEADLINE) {
+        ret = esp_timer_start_once(g_button_timer_handle, (deadline > now) ? (deadline - now) : 0);
+    }
+    return ret;
+}
 
-            btn->event = (uint8_t)BUTTON_PRESS_REPEAT_DONE;
-            CALL_EVENT_CB(BUTTON_PRESS_REPEAT_DONE); // repeat hit
-            btn->repeat = 0;
-            btn->state = 0;
+/**
+  * @brief  Arm the button timer at the earliest of `deadline` and the end of the debounce of the recorded edges,
+  *         again if a gpio edge is recorded meanwhile. Must not be called in critical section.
+  */
+static void button_timer_update(int64_t deadline)
+{
+    bool again;
+    do {
+        int64_t next = deadline;
+        BUTTON_ENTER_CRITICAL();
+        bool running = (NULL != g_button_timer_handle) && g_is_timer_running;
+        uint32_t edge_seq = g_edge_seq;
+        for (button_dev_t *target = g_head_handle; target; target = target->next) {
+            if (!target->is_polled && target->edge.pending) {
+                next = MIN(next, target->edge.last_time + DEBOUNCE_TIME_US);
+            }
+        }
+        BUTTON_EXIT_CRITICAL();
+        if (!running) {
+            return;
         }
-        break;
 
-    case 3:
-        if (btn->button_level != btn->active_level) {
-            btn->event = (uint8_t)BUTTON_PRESS_UP;
-            CALL_EVENT_CB(BUTTON_PRESS_UP);
-            if (btn->ticks < SHORT_TICKS) {
-                btn->ticks = 0;
-                btn->state = 2; //repeat press
-            } else {
-                btn->state = 0;
-            }
+        esp_err_t ret = button_timer_schedule(next, esp_timer_get_time());
+        if (ESP_OK != ret && ESP_ERR_INVALID_STATE != ret) {
+            ESP_LOGE(TAG, "Button timer schedule failed(%s)", esp_err_to_name(ret));
         }
-        break;
 
-    case 4:
-        if (btn->button_level == btn->active_level) {
-            //continue hold trigger
-            if (btn->ticks >= (btn->long_press_hold_cnt + 1) * SERIAL_TICKS + btn->long_press_ticks) {
-                btn->event = (uint8_t)BUTTON_LONG_PRESS_HOLD;
-                btn->long_press_hold_cnt++;
-                CALL_EVENT_CB(BUTTON_LONG_PRESS_HOLD);
-
-                /** Calling callbacks for BUTTON_LONG_PRESS_START based on press_time */
-                uint16_t ticks_time = iot_button_get_ticks_time(btn);
-                if (btn->cb_info[BUTTON_LONG_PRESS_START]) {
-                    button_cb_info_t *cb_info = btn->cb_info[BUTTON_LONG_PRESS_START];
-                    uint16_t time = cb_info[btn->count[0]].event_data.long_press.press_time;
-                    if (btn->long_press_ticks * TICKS_INTERVAL > time) {
-                        for (int i = btn->count[0] + 1; i < btn->size[BUTTON_LONG_PRESS_START]; i++) {
-                            time = cb_info[i].event_data.long_press.press_time;
-                            if (btn->long_press_ticks * TICKS_INTERVAL <= time) {
-                                btn->count[0] = i;
-                                break;
-                            }
-                        }
-                    }
-                    if (btn->count[0] < btn->size[BUTTON_LONG_PRESS_START] && abs(ticks_time - time) <= TOLERANCE) {
-                        do {
-                            cb_info[btn->count[0]].cb(btn, cb_info[btn->count[0]].usr_data);
-                            btn->count[0]++;
-                            if (btn->count[0] >= btn->size[BUTTON_LONG_PRESS_START])
-                                break;
-                        } while (time == cb_info[btn->count[0]].event_data.long_press.press_time);
-                    }
-                }
+        BUTTON_ENTER_CRITICAL();
+        again = (edge_seq != g_edge_seq);
+        BUTTON_EXIT_CRITICAL();
+    } while (again);
+}
 
-                /** Updating counter for BUTTON_LONG_PRESS_UP press_time */
-                if (btn->cb_info[BUTTON_LONG_PRESS_UP]) {
-                    button_cb_info_t *cb_info = btn->cb_info[BUTTON_LONG_PRESS_UP];
-                    uint16_t time = cb_info[btn->count[1] + 1].event_data.long_press.press_time;
-                    if (btn->long_press_ticks * TICKS_INTERVAL > time) {
-                        for (int i = btn->count[1] + 1; i < btn->size[BUTTON_LONG_PRESS_UP]; i++) {
-                            time = cb_info[i].event_data.long_press.press_time;
-                            if (btn->long_press_ticks * TICKS_INTERVAL <= time) {
-                                btn->count[1] = i;
-                                break;
-                            }
-                        }
-                    }
-                    if(btn->count[1] + 1 < btn->size[BUTTON_LONG_PRESS_UP] && abs(ticks_time - time) <= TOLERANCE) {
-                        do {
-                            btn->count[1]++;
-                            if (btn->count[1] + 1 >= btn->size[BUTTON_LONG_PRESS_UP])
-                                break;
-                        } while (time == cb_info[btn->count[1] + 1].event_data.long_press.press_time);
-                    }
-                }
-            }
-        } else { //releasd
-
-            btn->event = BUTTON_LONG_PRESS_UP;
-
-            /** calling callbacks for BUTTON_LONG_PRESS_UP press_time */
-            if (btn->cb_info[btn->event] && btn->count[1] >= 0) {
-                button_cb_info_t *cb_info = btn->cb_info[btn->event];
-                do {
-                    cb_info[btn->count[1]].cb(btn, cb_info[btn->count[1]].usr_data);
-                    if (!btn->count[1])
-                        break;
-                    btn->count[1]--;
-                } while (cb_info[btn->count[1]].event_data.long_press.press_time == cb_info[btn->count[1] + 1].event_data.long_press.press_time);
-
-                /** Reset the counter */
-                btn->count[1] = -1;
+/**
+  * @brief  Button timer callback, runs the engine of each button and sleeps until the next deadline.
+  */
+static void button_cb(void *args)
+{
+    /* The previous run is over, so the press times replaced before this one aren't read anymore */
+    BUTTON_ENTER_CRITICAL();
+    bool running = g_is_timer_running;
+    button_press_times_t *retired = g_retired_press_times;
+    g_retired_press_times = NULL;
+    BUTTON_EXIT_CRITICAL();
+    button_free_press_times(retired);
+    if (!running) {
+        /* Armed by a gpio edge while being stopped */
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
+    int64_t deadline = BUTTON_ENGINE_NO_DEADLINE;
+    button_dev_t *target;
+    for (target = g_head_handle; target; target = target->next) {
+        if (target->is_polled) {
+            bool pressed = (target->hal_button_Level(target->hardware_data) == target->active_level);
+            if (pressed != target->engine.raw_pressed) {
+                button_engine_edge(&target->engine, pressed, now, now);
             }
-            /** Reset counter */
-            if (btn->cb_info[BUTTON_LONG_PRESS_START]) {
-                btn->count[0] = 0;
+            deadline = MIN(deadline, now + MS_TO_US(TICKS_INTERVAL));
+        } else {
+            BUTTON_ENTER_CRITICAL();
+            bool pending = target->edge.pending;
+            bool pressed = target->edge.pressed;
+            int64_t first_time = target->edge.first_time;
+            int64_t last_time = target->edge.last_time;
+            target->edge.pending = false;
+            BUTTON_EXIT_CRITICAL();
+            if (pending) {
+                button_engine_edge(&target->engine, pressed, first_time, last_time);
             }
-
-            btn->event = (uint8_t)BUTTON_PRESS_UP;
-            CALL_EVENT_CB(BUTTON_PRESS_UP);
-            btn->state = 0; //reset
-            btn->long_press_hold_cnt = 0;
         }
-        break;
+        deadline = MIN(deadline, button_engine_process(&target->engine, now, button_dispatch, target));
     }
+
+    /* Edges recorded while running haven't been processed yet */
+    button_timer_update(deadline);
 }
 
-static void button_cb(void *args)
+static void button_gpio_isr_handler(void *arg)
 {
-    button_dev_t *target;
-    for (target = g_head_handle; target; target = target->next) {
-        button_handler(target);
+    button_dev_t *btn = (button_dev_t *)arg;
+    int64_t now = esp_timer_get_time();
+    bool pressed = (btn->hal_button_Level(btn->hardware_data) == btn->active_level);
+
+    BUTTON_ENTER_CRITICAL_ISR();
+    if (!btn->edge.pending) {
+        btn->edge.pending = true;
+        btn->edge.first_time = now;
+    }
+    btn->edge.pressed = pressed;
+    btn->edge.last_time = now;
+    g_edge_seq++;
+    bool running = (NULL != g_button_timer_handle) && g_is_timer_running;
+    BUTTON_EXIT_CRITICAL_ISR();
+
+    /* Wake up once the level is stable. If the timer is armed by a task meanwhile, that task sees the new edge */
+    if (running) {
+        esp_err_t ret = button_timer_schedule(now + DEBOUNCE_TIME_US, now);
+        if (ESP_OK != ret && ESP_ERR_INVALID_STATE != ret) {
+            ESP_EARLY_LOGE(TAG, "Button timer schedule failed(%d)", ret);
+        }
     }
 }
 
-static button_dev_t *button_create_com(uint8_t active_level, uint8_t (*hal_get_key_state)(void *hardware_data), void *hardware_data, uint16_t long_press_ticks, uint16_t short_press_ticks)
+static button_dev_t *button_create_com(uint8_t active_level, uint8_t (*hal_get_key_state)(void *hardware_data), void *hardware_data, uint16_t long_press_time, uint16_t short_press_time)
 {
     BTN_CHECK(NULL != hal_get_key_state, "Function pointer is invalid", NULL);
 
+    if (NULL == g_button_timer_handle) {
+        esp_timer_create_args_t button_timer = {0};
+        button_timer.arg = NULL;
+        button_timer.callback = button_cb;
+        button_timer.dispatch_method = ESP_TIMER_TASK;
+        button_timer.name = "button_timer";
+        BTN_CHECK(ESP_OK == esp_timer_create(&button_timer, &g_button_timer_handle), "Button timer create failed", NULL);
+        g_is_timer_running = true;
+    }
+
     button_dev_t *btn = (button_dev_t *) calloc(1, sizeof(button_dev_t));
     BTN_CHECK(NULL != btn, "Button memory alloc failed", NULL);
+    button_engine_config_t engine_config = {
+        .debounce_time = DEBOUNCE_TIME_US,
+        .short_press_time = MS_TO_US(short_press_time),
+        .long_press_time = MS_TO_US(long_press_time),
+        .serial_time = MS_TO_US(CONFIG_BUTTON_SERIAL_TIME_MS),
+    };
+    button_engine_init(&btn->engine, &engine_config);
     btn->hardware_data = hardware_data;
-    btn->event = BUTTON_NONE_PRESS;
     btn->active_level = active_level;
     btn->hal_button_Level = hal_get_key_state;
-    btn->button_level = !active_level;
-    btn->long_press_ticks = long_press_ticks;
-    btn->long_press_ticks_default = btn->long_press_ticks;
-    btn->short_press_ticks = short_press_ticks;
+    btn->long_press_time_default = long_press_time;
 
     /** Add handle to list */
+    BUTTON_ENTER_CRITICAL();
     btn->next = g_head_handle;
     g_head_handle = btn;
+    BUTTON_EXIT_CRITICAL();
 
-    if (false == g_is_timer_running) {
-        esp_timer_create_args_t button_timer;
-        button_timer.arg = NULL;
-        button_timer.callback = button_cb;
-        button_timer.dispatch_method = ESP_TIMER_TASK;
-        button_timer.name = "button_timer";
-        esp_timer_create(&button_timer, &g_button_timer_handle);
-        esp_timer_start_periodic(g_button_timer_handle, TICKS_INTERVAL * 1000U);
-        g_is_timer_running = true;
+    return btn;
+}
+
+/**
+  * @brief  Start sampling a created button, on gpio edges if possible, periodically otherwise.
+  */
+static void button_start_com(button_dev_t *btn)
+{
+    btn->is_polled = true;
+#if CONFIG_BUTTON_GPIO_EDGE_WAKEUP
+    if (btn->type == BUTTON_TYPE_GPIO) {
+        btn->is_polled = (ESP_OK != button_gpio_set_intr((int)btn->hardware_data, button_gpio_isr_handler, btn));
     }
+#endif
 
-    return btn;
+    /* Sample the current level, the button may already be pressed */
+    int64_t now = esp_timer_get_time();
+    BUTTON_ENTER_CRITICAL();
+    if (!btn->is_polled && !btn->edge.pending) {
+        btn->edge.pending = true;
+        btn->edge.first_time = now;
+        btn->edge.last_time = now;
+        btn->edge.pressed = (btn->hal_button_Level(btn->hardware_data) == btn->active_level);
+    }
+    BUTTON_EXIT_CRITICAL();
+    button_timer_update(now);
 }
 
 static esp_err_t button_delete_com(button_dev_t *btn)
 {
     BTN_CHECK(NULL != btn, "Pointer of handle is invalid", ESP_ERR_INVALID_ARG);
 
+    BUTTON_ENTER_CRITICAL();
     button_dev_t **curr;
     for (curr = &g_head_handle; *curr; ) {
         button_dev_t *entry = *curr;
         if (entry == btn) {
             *curr = entry->next;
-            free(entry);
         } else {
             curr = &entry->next;
         }
     }
+    button_retire_press_times(btn->long_press_times);
+    BUTTON_EXIT_CRITICAL();
+    free(btn);
 
     /* count button number */
     uint16_t number = 0;
@@ -347,14 +404,43 @@ static esp_err_t button_delete_com(button_dev_t *btn)
     }
     ESP_LOGD(TAG, "remain btn number=%d", number);
 
-    if (0 == number && g_is_timer_running) { /**<  if all button is deleted, stop the timer */
+    if (0 == number && g_button_timer_handle) { /**<  if all button is deleted, delete the timer */
         esp_timer_stop(g_button_timer_handle);
         esp_timer_delete(g_button_timer_handle);
+        g_button_timer_handle = NULL;
         g_is_timer_running = false;
+        button_free_press_times(g_retired_press_times);
+        g_retired_press_times = NULL;
     }
     return ESP_OK;
 }
 
+/**
+  * @brief  Update the press times the engine wakes up at for BUTTON_LONG_PRESS_START callbacks.
+  */
+static esp_err_t button_update_long_press_times(button_dev_t *btn)
+{
+    size_t num = btn->size[BUTTON_LONG_PRESS_START];
+    button_press_times_t *press_times = NULL;
+    if (num > 0) {
+        press_times = calloc(1, sizeof(button_press_times_t) + num * sizeof(uint32_t));
+        BTN_CHECK(NULL != press_times, "calloc long press times failed", ESP_ERR_NO_MEM);
+        for (size_t i = 0; i < num; i++) {
+            press_times->times[i] = MS_TO_US(btn->cb_info[BUTTON_LONG_PRESS_START][i].event_data.long_press.press_time);
+        }
+    }
+
+    BUTTON_ENTER_CRITICAL();
+    /* The engine may be processing the button in the timer task, free the old times on its next run */
+    button_retire_press_times(btn->long_press_times);
+    btn->long_press_times = press_times;
+    btn->engine.config.long_press_times = press_times ? press_times->times : NULL;
+    btn->engine.config.long_press_times_num = num;
+    BUTTON_EXIT_CRITICAL();
+
+    return ESP_OK;
+}
+
 button_handle_t iot_button_create(const button_config_t *config)
 {
     ESP_LOGI(TAG, "IoT Button Version: %d.%d.%d", BUTTON_VER_MAJOR, BUTTON_VER_MINOR, BUTTON_VER_PATCH);
@@ -362,10 +448,8 @@ button_handle_t iot_button_create(const button_config_t *config)
 
     esp_err_t ret = ESP_OK;
     button_dev_t *btn = NULL;
-    uint16_t long_press_time = 0;
-    uint16_t short_press_time = 0;
-    long_press_time = TIME_TO_TICKS(config->long_press_time, LONG_TICKS);
-    short_press_time = TIME_TO_TICKS(config->short_press_time, SHORT_TICKS);
+    uint16_t long_press_time = config->long_press_time ? config->long_press_time : CONFIG_BUTTON_LONG_PRESS_TIME_MS;
+    uint16_t short_press_time = config->short_press_time ? config->short_press_time : CONFIG_BUTTON_SHORT_PRESS_TIME_MS;
     switch (config->type) {
     case BUTTON_TYPE_GPIO: {
         const button_gpio_config_t *cfg = &(config->gpio_button_config);
@@ -384,6 +468,10 @@ button_handle_t iot_button_create(const button_config_t *config)
         ret = button_matrix_init(cfg);
         BTN_CHECK(ESP_OK == ret, "matrix button init failed", NULL);
         btn = button_create_com(1, button_matrix_get_key_level, (void *)MATRIX_BUTTON_COMBINE(cfg->row_gpio_num, cfg->col_gpio_num), long_press_time, short_press_time);
+        if (btn) {
+            /* The matrix scan is already debounced */
+            btn->engine.config.debounce_time = 0;
+        }
     } break;
     case BUTTON_TYPE_CUSTOM: {
         if (config->custom_button_config.button_custom_init) {
@@ -406,6 +494,7 @@ button_handle_t iot_button_create(const button_config_t *config)
     }
     BTN_CHECK(NULL != btn, "button create failed", NULL);
     btn->type = config->type;
+    button_start_com(btn);
     return (button_handle_t)btn;
 }
 
@@ -453,7 +542,7 @@ esp_err_t iot_button_register_cb(button_handle_t btn_handle, button_event_t even
     };
 
     if ((event == BUTTON_LONG_PRESS_START || event == BUTTON_LONG_PRESS_UP) && !event_cfg.event_data.long_press.press_time) {
-        event_cfg.event_data.long_press.press_time = btn->long_press_ticks_default * TICKS_INTERVAL;
+        event_cfg.event_data.long_press.press_time = btn->long_press_time_default;
     }
 
     return iot_button_register_event_cb(btn_handle, event_cfg, cb, usr_data);
@@ -465,17 +554,12 @@ esp_err_t iot_button_register_event_cb(button_handle_t btn_handle, button_event_
     button_dev_t *btn = (button_dev_t *) btn_handle;
     button_event_t event = event_cfg.event;
     BTN_CHECK(event < BUTTON_EVENT_MAX, "event is invalid", ESP_ERR_INVALID_ARG);
-    BTN_CHECK(!(event == BUTTON_LONG_PRESS_START || event == BUTTON_LONG_PRESS_UP) || event_cfg.event_data.long_press.press_time > btn->short_press_ticks * TICKS_INTERVAL, "event_data is invalid", ESP_ERR_INVALID_ARG);
+    BTN_CHECK(!(event == BUTTON_LONG_PRESS_START || event == BUTTON_LONG_PRESS_UP) || MS_TO_US(event_cfg.event_data.long_press.press_time) > btn->engine.config.short_press_time, "event_data is invalid", ESP_ERR_INVALID_ARG);
     BTN_CHECK(event != BUTTON_MULTIPLE_CLICK || event_cfg.event_data.multiple_clicks.clicks, "event_data is invalid", ESP_ERR_INVALID_ARG);
 
     if (!btn->cb_info[event]) {
         btn->cb_info[event] = calloc(1, sizeof(button_cb_info_t));
         BTN_CHECK(NULL != btn->cb_info[event], "calloc cb_info failed", ESP_ERR_NO_MEM);
-        if (event == BUTTON_LONG_PRESS_START) {
-            btn->count[0] = 0;
-        } else if (event == BUTTON_LONG_PRESS_UP) {
-            btn->count[1] = -1;
-        }
     }
     else {
         button_cb_info_t *p = realloc(btn->cb_info[event], sizeof(button_cb_info_t) * (btn->size[event] + 1));
@@ -490,7 +574,6 @@ esp_err_t iot_button_register_event_cb(button_handle_t btn_handle, button_event_
     /** Inserting the event_data in sorted manner */
     if (event == BUTTON_LONG_PRESS_START || event == BUTTON_LONG_PRESS_UP) {
         uint16_t press_time = event_cfg.event_data.long_press.press_time;
-        BTN_CHECK(press_time / TICKS_INTERVAL > btn->short_press_ticks, "press_time event_data is less than short_press_ticks", ESP_ERR_INVALID_ARG);
         if (btn->size[event] >= 2) {
             for (int i = btn->size[event] - 2; i >= 0; i--) {
                 if (btn->cb_info[event][i].event_data.long_press.press_time > press_time) {
@@ -510,10 +593,12 @@ esp_err_t iot_button_register_event_cb(button_handle_t btn_handle, button_event_
             btn->cb_info[event][btn->size[event] - 1].event_data.long_press.press_time = press_time;
         }
 
-        int32_t press_ticks = press_time / TICKS_INTERVAL;
-        if (btn->short_press_ticks < press_ticks && press_ticks < btn->long_press_ticks) {
+        if (MS_TO_US(press_time) < btn->engine.config.long_press_time) {
             iot_button_set_param(btn, BUTTON_LONG_PRESS_TIME_MS, (void*)(intptr_t)press_time);
         }
+        if (event == BUTTON_LONG_PRESS_START) {
+            return button_update_long_press_times(btn);
+        }
     }
 
     if (event == BUTTON_MULTIPLE_CLICK) {
@@ -549,18 +634,13 @@ esp_err_t iot_button_unregister_cb(button_handle_t btn_handle, button_event_t ev
 
     if (btn->cb_info[event]) {
         free(btn->cb_info[event]);
-
-        /** Reset the counter */
-        if (event == BUTTON_LONG_PRESS_START) {
-            btn->count[0] = 0;
-        } else if (event == BUTTON_LONG_PRESS_UP) {
-            btn->count[1] = -1;
-        }
-
     }
 
     btn->cb_info[event] = NULL;
     btn->size[event] = 0;
+    if (event == BUTTON_LONG_PRESS_START) {
+        return button_update_long_press_times(btn);
+    }
     return ESP_OK;
 }
 
@@ -609,6 +689,9 @@ esp_err_t iot_button_unregister_event(button_handle_t btn_handle, button_event_c
 
     BTN_CHECK(check != -1, "No such callback registered for the event", ESP_ERR_INVALID_STATE);
 
+    if (event == BUTTON_LONG_PRESS_START) {
+        return button_update_long_press_times(btn);
+    }
     return ESP_OK;
 }
 
@@ -636,28 +719,28 @@ button_event_t iot_button_get_event(button_handle_t btn_handle)
 {
     BTN_CHECK(NULL != btn_handle, "Pointer of handle is invalid", BUTTON_NONE_PRESS);
     button_dev_t *btn = (button_dev_t *) btn_handle;
-    return btn->event;
+    return btn->engine.event;
 }
 
 uint8_t iot_button_get_repeat(button_handle_t btn_handle)
 {
     BTN_CHECK(NULL != btn_handle, "Pointer of handle is invalid", 0);
     button_dev_t *btn = (button_dev_t *) btn_handle;
-    return btn->repeat;
+    return btn->engine.repeat;
 }
 
 uint16_t iot_button_get_ticks_time(button_handle_t btn_handle)
 {
     BTN_CHECK(NULL != btn_handle, "Pointer of handle is invalid", 0);
     button_dev_t *btn = (button_dev_t *) btn_handle;
-    return (btn->ticks * TICKS_INTERVAL);
+    return button_engine_get_ticks_time(&btn->engine) / 1000;
 }
 
 uint16_t iot_button_get_long_press_hold_cnt(button_handle_t btn_handle)
 {
     BTN_CHECK(NULL != btn_handle, "Pointer of handle is invalid", 0);
     button_dev_t *btn = (button_dev_t *) btn_handle;
-    return btn->long_press_hold_cnt;
+    return btn->engine.long_press_hold_cnt;
 }
 
 esp_err_t iot_button_set_param(button_handle_t btn_handle, button_param_t param, void *value)
@@ -667,10 +750,10 @@ esp_err_t iot_button_set_param(button_handle_t btn_handle, button_param_t param,
     BUTTON_ENTER_CRITICAL();
     switch (param) {
     case BUTTON_LONG_PRESS_TIME_MS:
-        btn->long_press_ticks = (int32_t)value / TICKS_INTERVAL;
+        btn->engine.config.long_press_time = MS_TO_US((int32_t)value);
         break;
     case BUTTON_SHORT_PRESS_TIME_MS:
-        btn->short_press_ticks = (int32_t)value / TICKS_INTERVAL;
+        btn->engine.config.short_press_time = MS_TO_US((int32_t)value);
         break;
     default:
         break;
@@ -684,9 +767,11 @@ esp_err_t iot_button_resume(void)
     BTN_CHECK(g_button_timer_handle, "Button timer handle is invalid", ESP_ERR_INVALID_STATE);
     BTN_CHECK(!g_is_timer_running, "Button timer is already running", ESP_ERR_INVALID_STATE);
 
-    esp_err_t err = esp_timer_start_periodic(g_button_timer_handle, TICKS_INTERVAL * 1000U);
-    BTN_CHECK(ESP_OK == err, "Button timer start failed", ESP_FAIL);
+    /* Catch up with the edges and timeouts missed while stopped */
+    BUTTON_ENTER_CRITICAL();
     g_is_timer_running = true;
+    BUTTON_EXIT_CRITICAL();
+    button_timer_update(esp_timer_get_time());
     return ESP_OK;
 }
 
@@ -695,8 +780,11 @@ esp_err_t iot_button_stop(void)
     BTN_CHECK(g_button_timer_handle, "Button timer handle is invalid", ESP_ERR_INVALID_STATE);
     BTN_CHECK(g_is_timer_running, "Button timer is not running", ESP_ERR_INVALID_STATE);
 
-    esp_err_t err = esp_timer_stop(g_button_timer_handle);
-    BTN_CHECK(ESP_OK == err, "Button timer stop failed", ESP_FAIL);
+    /* The timer is only armed while some button is busy */
+    BUTTON_ENTER_CRITICAL();
     g_is_timer_running = false;
+    BUTTON_EXIT_CRITICAL();
+    /* A gpio edge may still arm it, the timer callback then returns at once */
+    esp_timer_stop(g_button_timer_handle);
     return ESP_OK;
 }
@@ -8,6 +8,7 @@
 #include "button_adc.h"
 #include "button_gpio.h"
 #include "button_matrix.h"
+#include "button_types.h"
 #include "esp_err.h"
 
 #ifdef __cplusplus
@@ -17,25 +18,6 @@ extern "C" {
 typedef void (* button_cb_t)(void *button_handle, void *usr_data);
 typedef void *button_handle_t;
 
-/**
- * @brief Button events
- *
- */
-typedef enum {
-    BUTTON_PRESS_DOWN = 0,
-    BUTTON_PRESS_UP,
-    BUTTON_PRESS_REPEAT,
-    BUTTON_PRESS_REPEAT_DONE,
-    BUTTON_SINGLE_CLICK,
-    BUTTON_DOUBLE_CLICK,
-    BUTTON_MULTIPLE_CLICK,
-    BUTTON_LONG_PRESS_START,
-    BUTTON_LONG_PRESS_HOLD,
-    BUTTON_LONG_PRESS_UP,
-    BUTTON_EVENT_MAX,
-    BUTTON_NONE_PRESS,
-} button_event_t;
-
 /**
  * @brief Button events data
  *
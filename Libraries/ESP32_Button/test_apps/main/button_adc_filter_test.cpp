@@ -0,0 +1,110 @@
+/* SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "unity.h"
+#include "original/button_adc_filter.h"
+
+#define BUTTON_NUM 3
+
+/* Resistor ladder: button 0 at ~380mv, button 1 at ~820mv, button 2 at ~1650mv, released at ~3100mv */
+static const button_adc_range_t ranges[BUTTON_NUM] = {
+    {.min = 190, .max = 600},
+    {.min = 600, .max = 1000},
+    {.min = 1000, .max = 2200},
+};
+
+/* Deterministic noise in [-amplitude, amplitude] */
+static int get_noise(uint32_t *seed, int amplitude)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (int)((*seed >> 16) % (2 * amplitude + 1)) - amplitude;
+}
+
+static uint32_t push_and_classify(button_adc_filter_t *filter, uint16_t voltage)
+{
+    return button_adc_classify(ranges, BUTTON_NUM, button_adc_filter_push(filter, voltage));
+}
+
+TEST_CASE("adc button filter rejects spikes on a noisy idle channel", "[button][adc]")
+{
+    button_adc_filter_t filter;
+    button_adc_filter_init(&filter, 3, 1, 100);
+    uint32_t seed = 1;
+
+    for (int i = 0; i < 1000; i++) {
+        int voltage = 3100 + get_noise(&seed, 40);
+        /* Single sample spikes down to the range of each button */
+        if (i % 97 == 50) {
+            voltage = 400;
+        } else if (i % 89 == 30) {
+            voltage = 800;
+        }
+        TEST_ASSERT_EQUAL_UINT32(0, push_and_classify(&filter, voltage));
+    }
+}
+
+TEST_CASE("adc button filter classifies a bouncy press", "[button][adc]")
+{
+    static const uint16_t trace[] = {3100, 3090, 820, 3050, 830, 815, 2900, 822, 818, 825, 821};
+    button_adc_filter_t filter;
+    button_adc_filter_init(&filter, 3, 1, 100);
+
+    uint32_t mask = 0;
+    size_t i = 0;
+    for (; i < sizeof(trace) / sizeof(trace[0]) && mask == 0; i++) {
+        mask = push_and_classify(&filter, trace[i]);
+        /* Never classified as the other buttons while bouncing */
+        TEST_ASSERT_EQUAL_UINT32(0, mask & ~(1UL << 1));
+    }
+    TEST_ASSERT_EQUAL_UINT32(1UL << 1, mask);
+    TEST_ASSERT_LESS_THAN(9, i);
+    for (; i < sizeof(trace) / sizeof(trace[0]); i++) {
+        TEST_ASSERT_EQUAL_UINT32(1UL << 1, push_and_classify(&filter, trace[i]));
+    }
+}
+
+TEST_CASE("adc button filter never passes through the range of another button", "[button][adc]")
+{
+    button_adc_filter_t filter;
+    button_adc_filter_init(&filter, 5, 3, 100);
+
+    /* From button 2 straight to button 0, button 1 lies between them */
+    for (int i = 0; i < 20; i++) {
+        TEST_ASSERT_EQUAL_UINT32(1UL << 2, push_and_classify(&filter, 1650));
+    }
+    for (int i = 0; i < 20; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, push_and_classify(&filter, 380) & (1UL << 1));
+    }
+    TEST_ASSERT_EQUAL_UINT32(1UL << 0, push_and_classify(&filter, 380));
+
+    /* Released from button 0, the ladder voltage jumps up through the other ranges */
+    for (int i = 0; i < 20; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, push_and_classify(&filter, 3100) & ((1UL << 1) | (1UL << 2)));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, push_and_classify(&filter, 3100));
+}
+
+TEST_CASE("adc button filter smooths noise with the IIR", "[button][adc]")
+{
+    button_adc_filter_t median_only;
+    button_adc_filter_t filter;
+    button_adc_filter_init(&median_only, 3, 0, 100);
+    button_adc_filter_init(&filter, 3, 3, 100);
+    uint32_t seed = 7;
+
+    int error_median_only = 0;
+    int error_filter = 0;
+    for (int i = 0; i < 1000; i++) {
+        uint16_t voltage = 820 + get_noise(&seed, 60);
+        int out_median_only = button_adc_filter_push(&median_only, voltage);
+        int out_filter = button_adc_filter_push(&filter, voltage);
+        if (i >= 50) {
+            error_median_only += (out_median_only > 820) ? out_median_only - 820 : 820 - out_median_only;
+            error_filter += (out_filter > 820) ? out_filter - 820 : 820 - out_filter;
+            TEST_ASSERT_LESS_THAN(40, (out_filter > 820) ? out_filter - 820 : 820 - out_filter);
+        }
+    }
+    TEST_ASSERT_LESS_THAN(error_median_only / 2, error_filter);
+}
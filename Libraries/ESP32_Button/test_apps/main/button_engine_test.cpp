@@ -0,0 +1,154 @@
+/* SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "unity.h"
+#include "original/button_engine.h"
+
+#define MS(ms) ((int64_t)(ms) * 1000)
+#define EVENTS_MAX 64
+
+typedef struct {
+    button_engine_t *engine;
+    int num;
+    button_event_t events[EVENTS_MAX];
+    int64_t times[EVENTS_MAX];
+} event_recorder_t;
+
+static void record_event(void *ctx, button_event_t event)
+{
+    event_recorder_t *recorder = (event_recorder_t *)ctx;
+    TEST_ASSERT_LESS_THAN(EVENTS_MAX, recorder->num);
+    recorder->events[recorder->num] = event;
+    recorder->times[recorder->num] = button_engine_get_event_time(recorder->engine);
+    recorder->num++;
+}
+
+static const button_engine_config_t engine_config = {
+    .debounce_time = MS(10),
+    .short_press_time = MS(180),
+    .long_press_time = MS(1500),
+    .serial_time = MS(20),
+    .long_press_times = NULL,
+    .long_press_times_num = 0,
+};
+
+/* Wake up at each deadline until `until`, like the button timer does */
+static void run_until(button_engine_t *engine, event_recorder_t *recorder, int64_t now, int64_t until)
+{
+    int64_t deadline = button_engine_process(engine, now, record_event, recorder);
+    while (deadline <= until) {
+        TEST_ASSERT_GREATER_OR_EQUAL(now, deadline);
+        now = deadline;
+        deadline = button_engine_process(engine, now, record_event, recorder);
+    }
+}
+
+static void expect_event(const event_recorder_t *recorder, int index, button_event_t event, int64_t time)
+{
+    TEST_ASSERT_GREATER_THAN(index, recorder->num);
+    TEST_ASSERT_EQUAL(event, recorder->events[index]);
+    TEST_ASSERT_EQUAL_INT64(time, recorder->times[index]);
+}
+
+TEST_CASE("button engine derives clicks from edge timestamps", "[button][engine]")
+{
+    button_engine_t engine;
+    event_recorder_t recorder = {.engine = &engine, .num = 0, .events = {}, .times = {}};
+    button_engine_init(&engine, &engine_config);
+    TEST_ASSERT_EQUAL_INT64(BUTTON_ENGINE_NO_DEADLINE, button_engine_process(&engine, 0, record_event, &recorder));
+
+    /* Bouncing press, the transition is dated at the first edge */
+    button_engine_edge(&engine, true, 1000, 1000);
+    button_engine_edge(&engine, false, 1200, 1200);
+    button_engine_edge(&engine, true, 1500, 1500);
+    TEST_ASSERT_EQUAL_INT64(1500 + MS(10), button_engine_process(&engine, 2000, record_event, &recorder));
+    TEST_ASSERT_EQUAL(0, recorder.num);
+    run_until(&engine, &recorder, 2000, MS(100));
+    TEST_ASSERT_EQUAL(1, recorder.num);
+    expect_event(&recorder, 0, BUTTON_PRESS_DOWN, 1000);
+
+    /* A glitch shorter than the debounce time is ignored */
+    button_engine_edge(&engine, false, MS(50), MS(50));
+    button_engine_edge(&engine, true, MS(52), MS(52));
+    run_until(&engine, &recorder, MS(53), MS(100));
+    TEST_ASSERT_EQUAL(1, recorder.num);
+
+    /* Release, then a second click within the short press time */
+    button_engine_edge(&engine, false, MS(100), MS(100));
+    run_until(&engine, &recorder, MS(110), MS(200));
+    expect_event(&recorder, 1, BUTTON_PRESS_UP, MS(100));
+    button_engine_edge(&engine, true, MS(200), MS(200));
+    run_until(&engine, &recorder, MS(210), MS(250));
+    expect_event(&recorder, 2, BUTTON_PRESS_DOWN, MS(200));
+    expect_event(&recorder, 3, BUTTON_PRESS_REPEAT, MS(200));
+    TEST_ASSERT_EQUAL(2, engine.repeat);
+    button_engine_edge(&engine, false, MS(250), MS(250));
+    run_until(&engine, &recorder, MS(260), MS(1000));
+    expect_event(&recorder, 4, BUTTON_PRESS_UP, MS(250));
+    expect_event(&recorder, 5, BUTTON_DOUBLE_CLICK, MS(250 + 180));
+    expect_event(&recorder, 6, BUTTON_MULTIPLE_CLICK, MS(250 + 180));
+    expect_event(&recorder, 7, BUTTON_PRESS_REPEAT_DONE, MS(250 + 180));
+    TEST_ASSERT_EQUAL(8, recorder.num);
+
+    /* Idle again, nothing to wake up for */
+    TEST_ASSERT_EQUAL_INT64(BUTTON_ENGINE_NO_DEADLINE, button_engine_process(&engine, MS(2000), record_event, &recorder));
+    TEST_ASSERT_EQUAL(BUTTON_NONE_PRESS, engine.event);
+}
+
+TEST_CASE("button engine schedules long press times", "[button][engine]")
+{
+    static const uint32_t long_press_times[] = {MS(1500), MS(1500), MS(1555)};
+    button_engine_config_t config = engine_config;
+    config.long_press_times = long_press_times;
+    config.long_press_times_num = sizeof(long_press_times) / sizeof(long_press_times[0]);
+
+    button_engine_t engine;
+    event_recorder_t recorder = {.engine = &engine, .num = 0, .events = {}, .times = {}};
+    button_engine_init(&engine, &config);
+
+    const int64_t press = 123457;
+    button_engine_edge(&engine, true, press, press);
+    TEST_ASSERT_EQUAL_INT64(press + MS(10), button_engine_process(&engine, press, record_event, &recorder));
+    TEST_ASSERT_EQUAL_INT64(press + MS(1500), button_engine_process(&engine, press + MS(10), record_event, &recorder));
+    run_until(&engine, &recorder, press + MS(10), press + MS(1570));
+    expect_event(&recorder, 0, BUTTON_PRESS_DOWN, press);
+    expect_event(&recorder, 1, BUTTON_LONG_PRESS_START, press + MS(1500));
+    expect_event(&recorder, 2, BUTTON_LONG_PRESS_HOLD, press + MS(1520));
+    expect_event(&recorder, 3, BUTTON_LONG_PRESS_HOLD, press + MS(1540));
+    expect_event(&recorder, 4, BUTTON_LONG_PRESS_START, press + MS(1555));
+    expect_event(&recorder, 5, BUTTON_LONG_PRESS_HOLD, press + MS(1560));
+    TEST_ASSERT_EQUAL(6, recorder.num);
+    TEST_ASSERT_EQUAL(3, engine.long_press_hold_cnt);
+
+    /* The release wakes up late, the missed hold events are still dated exactly */
+    button_engine_edge(&engine, false, press + MS(1601) + 7, press + MS(1601) + 7);
+    TEST_ASSERT_EQUAL_INT64(BUTTON_ENGINE_NO_DEADLINE,
+                            button_engine_process(&engine, press + MS(1700), record_event, &recorder));
+    expect_event(&recorder, 6, BUTTON_LONG_PRESS_HOLD, press + MS(1580));
+    expect_event(&recorder, 7, BUTTON_LONG_PRESS_HOLD, press + MS(1600));
+    expect_event(&recorder, 8, BUTTON_LONG_PRESS_UP, press + MS(1601) + 7);
+    TEST_ASSERT_EQUAL_UINT32(MS(1601) + 7, button_engine_get_press_time(&engine));
+    expect_event(&recorder, 9, BUTTON_PRESS_UP, press + MS(1601) + 7);
+    TEST_ASSERT_EQUAL(10, recorder.num);
+    TEST_ASSERT_EQUAL(0, engine.long_press_hold_cnt);
+}
+
+TEST_CASE("button engine handles a release before a pending timeout", "[button][engine]")
+{
+    button_engine_t engine;
+    event_recorder_t recorder = {.engine = &engine, .num = 0, .events = {}, .times = {}};
+    button_engine_init(&engine, &engine_config);
+
+    /* Released 1 ms before the long press time, the timer wakes up at the long press time before the debounce ends */
+    button_engine_edge(&engine, true, 0, 0);
+    run_until(&engine, &recorder, 0, MS(1000));
+    button_engine_edge(&engine, false, MS(1499), MS(1499));
+    TEST_ASSERT_EQUAL_INT64(MS(1509), button_engine_process(&engine, MS(1500), record_event, &recorder));
+    TEST_ASSERT_EQUAL(1, recorder.num);
+    run_until(&engine, &recorder, MS(1509), MS(3000));
+    expect_event(&recorder, 1, BUTTON_PRESS_UP, MS(1499));
+    expect_event(&recorder, 2, BUTTON_SINGLE_CLICK, MS(1499 + 180));
+    TEST_ASSERT_EQUAL(5, recorder.num);
+}
@@ -0,0 +1,78 @@
+/* SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "unity.h"
+#include "original/button_matrix_scan.h"
+
+#define ROW_NUM 3
+
+TEST_CASE("button matrix scan debounces each row", "[button][matrix]")
+{
+    button_matrix_scan_t scan;
+    button_matrix_scan_init(&scan, 2);
+
+    /* Bouncing key (1, 2), the other rows are stable */
+    const uint32_t bounce[][ROW_NUM] = {
+        {0, 1 << 2, 1 << 0},
+        {0, 0, 1 << 0},
+        {0, 1 << 2, 1 << 0},
+        {0, 1 << 2, 1 << 0},
+    };
+    TEST_ASSERT_FALSE(button_matrix_scan_update(&scan, bounce[0], ROW_NUM));
+    TEST_ASSERT_TRUE(button_matrix_scan_update(&scan, bounce[1], ROW_NUM));
+    TEST_ASSERT_TRUE(button_matrix_scan_get(&scan, 2, 0));
+    TEST_ASSERT_FALSE(button_matrix_scan_get(&scan, 1, 2));
+    TEST_ASSERT_FALSE(button_matrix_scan_update(&scan, bounce[2], ROW_NUM));
+    TEST_ASSERT_FALSE(button_matrix_scan_get(&scan, 1, 2));
+    TEST_ASSERT_TRUE(button_matrix_scan_update(&scan, bounce[3], ROW_NUM));
+    TEST_ASSERT_TRUE(button_matrix_scan_get(&scan, 1, 2));
+    TEST_ASSERT_TRUE(button_matrix_scan_get(&scan, 2, 0));
+    TEST_ASSERT_FALSE(scan.is_ghosting);
+}
+
+TEST_CASE("button matrix scan ignores ghosted rows", "[button][matrix]")
+{
+    button_matrix_scan_t scan;
+    button_matrix_scan_init(&scan, 1);
+
+    /* (0, 0) and (1, 0) pressed, two keys in a column are resolved */
+    const uint32_t two_keys[ROW_NUM] = {1 << 0, 1 << 0, 0};
+    button_matrix_scan_update(&scan, two_keys, ROW_NUM);
+    TEST_ASSERT_FALSE(scan.is_ghosting);
+    TEST_ASSERT_TRUE(button_matrix_scan_get(&scan, 0, 0));
+    TEST_ASSERT_TRUE(button_matrix_scan_get(&scan, 1, 0));
+
+    /* (1, 1) pressed as well, (0, 1) reads pressed too and can't be told apart from a real press */
+    const uint32_t ghost[ROW_NUM] = {(1 << 0) | (1 << 1), (1 << 0) | (1 << 1), 1 << 2};
+    TEST_ASSERT_TRUE(button_matrix_scan_update(&scan, ghost, ROW_NUM));
+    TEST_ASSERT_TRUE(scan.is_ghosting);
+    TEST_ASSERT_FALSE(button_matrix_scan_get(&scan, 0, 1));
+    TEST_ASSERT_FALSE(button_matrix_scan_get(&scan, 1, 1));
+    TEST_ASSERT_TRUE(button_matrix_scan_get(&scan, 0, 0));
+    /* The row out of the rectangle is still updated */
+    TEST_ASSERT_TRUE(button_matrix_scan_get(&scan, 2, 2));
+
+    /* Released back to a resolvable combination */
+    const uint32_t release[ROW_NUM] = {1 << 0, (1 << 0) | (1 << 1), 1 << 2};
+    TEST_ASSERT_TRUE(button_matrix_scan_update(&scan, release, ROW_NUM));
+    TEST_ASSERT_FALSE(scan.is_ghosting);
+    TEST_ASSERT_FALSE(button_matrix_scan_get(&scan, 0, 1));
+    TEST_ASSERT_TRUE(button_matrix_scan_get(&scan, 1, 1));
+}
+
+TEST_CASE("button matrix scan resets reused lines", "[button][matrix]")
+{
+    button_matrix_scan_t scan;
+    button_matrix_scan_init(&scan, 1);
+
+    const uint32_t pressed[ROW_NUM] = {(1 << 0) | (1 << 3), 1 << 3, 0};
+    button_matrix_scan_update(&scan, pressed, ROW_NUM);
+    button_matrix_scan_reset_col(&scan, 3);
+    TEST_ASSERT_FALSE(button_matrix_scan_get(&scan, 0, 3));
+    TEST_ASSERT_FALSE(button_matrix_scan_get(&scan, 1, 3));
+    TEST_ASSERT_TRUE(button_matrix_scan_get(&scan, 0, 0));
+    button_matrix_scan_reset_row(&scan, 0);
+    TEST_ASSERT_FALSE(button_matrix_scan_get(&scan, 0, 0));
+}
@@ -74,6 +74,16 @@ TEST_CASE("gpio button test", "[button][iot]")
     btn.del();
 }
 
+TEST_CASE("adc button deinit test", "[button][iot]")
+{
+    // The last deinit releases the ADC unit and its calibration handle, so the heap is checked by `tearDown()`
+    for (int i = 0; i < 3; i++) {
+        Button btn(GPIO_NUM_1, false, 0, 0, 0, 500);
+        vTaskDelay(pdMS_TO_TICKS(100));
+        btn.del();
+    }
+}
+
 static size_t before_free_8bit;
 static size_t before_free_32bit;
 
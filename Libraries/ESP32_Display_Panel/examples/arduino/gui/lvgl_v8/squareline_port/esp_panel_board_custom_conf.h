@@ -481,17 +481,27 @@
     /**
      * @brief Custom backlight control function
      *
-     * @param[in] percent    Brightness percentage (0-100)
+     * @param[in] level      Brightness level, the percentage (0-100) if `ESP_PANEL_BOARD_BACKLIGHT_CUSTOM_LEVEL_MAX` is
+     *                       `0`, otherwise the output level (0-`ESP_PANEL_BOARD_BACKLIGHT_CUSTOM_LEVEL_MAX`)
      * @param[in] user_data  User data pointer, typically points to Board instance.
      *
      * @return true on success, false on failure
      */
-    #define ESP_PANEL_BOARD_BACKLIGHT_CUSTOM_FUNCTION(percent, user_data)  \
+    #define ESP_PANEL_BOARD_BACKLIGHT_CUSTOM_FUNCTION(level, user_data)  \
         {  \
             auto board = static_cast<Board *>(user_data);  \
             return true; \
         }
 
+    /**
+     * @brief Maximum output level passed to the custom function
+     *
+     * Set to `0` to pass the brightness percentage. Otherwise, the function receives the output level (0-max) mapped
+     * through the brightness curve, and fades step through every level. For LCDs with the brightness command (0x51),
+     * like AMOLED, set it to `255` and call `board->getLCD()->setDisplayBrightness(level)` in the function.
+     */
+    #define ESP_PANEL_BOARD_BACKLIGHT_CUSTOM_LEVEL_MAX  (0)
+
 #endif // ESP_PANEL_BOARD_BACKLIGHT_TYPE
 
 /**
@@ -5,6 +5,11 @@
  */
 
 #include <memory>
+#include <thread>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_pthread.h"
+#include "esp_timer.h"
 #include "utils/esp_panel_utils_log.h"
 #include "drivers/io_expander/esp_panel_io_expander_adapter.hpp"
 #include "esp_panel_board.hpp"
@@ -21,6 +26,12 @@
 #define _TO_STR(name) #name
 #define TO_STR(name) _TO_STR(name)
 
+#define LCD_BEGIN_THREAD_NAME               "lcd_begin"
+// Same as the Arduino loop task, which runs the whole LCD begin in the sequential mode. It also runs the LCD stage
+// callbacks, so keep a margin for user code
+#define LCD_BEGIN_THREAD_STACK_SIZE         (8 * 1024)
+#define LCD_BEGIN_THREAD_STACK_MIN_FREE     (1024)
+
 namespace esp_panel::board {
 
 #if ESP_PANEL_BOARD_USE_DEFAULT
@@ -101,6 +112,12 @@ bool Board::init()
         }
 
         ESP_UTILS_CHECK_NULL_RETURN(lcd_device, false, "Create LCD failed");
+        if (lcd_config.vendor_program != nullptr) {
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                lcd_device->configVendorCommandProgram(lcd_config.vendor_program, lcd_config.vendor_program_size),
+                false, "LCD device config vendor command program failed"
+            );
+        }
         ESP_UTILS_LOGD("LCD create success");
     }
 
@@ -252,6 +269,9 @@ bool Board::begin()
 
     ESP_UTILS_LOGI("Beginning board (%s)", _config.name);
 
+    _begin_timeline = {};
+    _begin_timeline.start(BeginTimeline::PHASE_TOTAL);
+
     auto &config = getConfig();
     if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_BOARD_BEGIN] != nullptr) {
         ESP_UTILS_LOGD("Board pre-begin");
@@ -260,54 +280,161 @@ bool Board::begin()
         );
     }
 
-    // Begin the IO expander if it is used
-    // If the IO expander is already begun, it will not be begun again
-    auto io_expander = getIO_Expander();
-    if (io_expander != nullptr && !io_expander->isOverState(esp_expander::Base::State::BEGIN)) {
-        ESP_UTILS_LOGD("Beginning IO Expander");
+    // The IO expander is always begun first, since the other devices may depend on it
+    ESP_UTILS_CHECK_FALSE_RETURN(beginIO_Expander(), false, "IO expander begin failed");
+
+    // Overlap the touch and the backlight with the LCD, whose initialization mostly waits for the delays of the vendor
+    // init commands (e.g. sleep out)
+    bool backlight_overlap = isBacklightParallelSafe();
+    if (_is_parallel_begin && (getLCD() != nullptr) && ((getTouch() != nullptr) || backlight_overlap)) {
+        ESP_UTILS_LOGD("Begin LCD in parallel with touch%s", backlight_overlap ? " and backlight" : "");
+        _begin_timeline.parallel = true;
+
+        // The LCD is begun in a pthread, so size its stack explicitly instead of relying on the pthread defaults of
+        // the caller, and restore them right after the thread is created
+        esp_pthread_cfg_t caller_pthread_cfg = esp_pthread_get_default_config();
+        bool has_caller_pthread_cfg = (esp_pthread_get_cfg(&caller_pthread_cfg) == ESP_OK);
+        esp_pthread_cfg_t lcd_pthread_cfg = esp_pthread_get_default_config();
+        lcd_pthread_cfg.stack_size = LCD_BEGIN_THREAD_STACK_SIZE;
+        lcd_pthread_cfg.thread_name = LCD_BEGIN_THREAD_NAME;
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            esp_pthread_set_cfg(&lcd_pthread_cfg), false, "Set LCD begin thread config failed"
+        );
 
-        if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_EXPANDER_BEGIN] != nullptr) {
-            ESP_UTILS_LOGD("IO expander pre-begin");
-            ESP_UTILS_CHECK_FALSE_RETURN(
-                config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_EXPANDER_BEGIN](this), false,
-                "IO expander pre-begin failed"
-            );
+        bool lcd_ret = false;
+        int lcd_stack_free = 0;
+        std::thread lcd_thread;
+        ESP_UTILS_CHECK_EXCEPTION_GOTO(
+            lcd_thread = std::thread([this, &lcd_ret, &lcd_stack_free]() {
+                lcd_ret = beginLCD();
+                lcd_stack_free = static_cast<int>(uxTaskGetStackHighWaterMark(nullptr));
+            }), restore_pthread_cfg, "Create LCD begin thread failed"
+        );
+
+restore_pthread_cfg:
+        if (!has_caller_pthread_cfg) {
+            caller_pthread_cfg = esp_pthread_get_default_config();
+        }
+        if (esp_pthread_set_cfg(&caller_pthread_cfg) != ESP_OK) {
+            ESP_UTILS_LOGW("Restore pthread config failed");
         }
+        ESP_UTILS_CHECK_FALSE_RETURN(lcd_thread.joinable(), false, "Create LCD begin thread failed");
 
-        ESP_UTILS_CHECK_FALSE_RETURN(io_expander->begin(), false, "IO expander begin failed");
+        bool ret = beginTouch() && (!backlight_overlap || beginBacklight(false));
+        lcd_thread.join();
 
-        if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_EXPANDER_BEGIN] != nullptr) {
-            ESP_UTILS_LOGD("IO expander post-begin");
-            ESP_UTILS_CHECK_FALSE_RETURN(
-                config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_EXPANDER_BEGIN](this), false,
-                "IO expander post-begin failed"
+        ESP_UTILS_LOGD(
+            "LCD begin thread used %d/%d bytes of stack", LCD_BEGIN_THREAD_STACK_SIZE - lcd_stack_free,
+            LCD_BEGIN_THREAD_STACK_SIZE
+        );
+        if (lcd_stack_free < LCD_BEGIN_THREAD_STACK_MIN_FREE) {
+            ESP_UTILS_LOGW(
+                "LCD begin thread has only %d bytes of stack left, keep the LCD stage callbacks light",
+                lcd_stack_free
             );
         }
+        ESP_UTILS_CHECK_FALSE_RETURN(lcd_ret, false, "LCD begin failed");
+        ESP_UTILS_CHECK_FALSE_RETURN(ret, false, "Touch or backlight begin failed");
+        // Only turn on the backlight once the LCD shows valid content
+        if (backlight_overlap) {
+            ESP_UTILS_CHECK_FALSE_RETURN(finishBacklightBegin(), false, "Backlight finish begin failed");
+        } else {
+            ESP_UTILS_CHECK_FALSE_RETURN(beginBacklight(true), false, "Backlight begin failed");
+        }
+    } else {
+        ESP_UTILS_CHECK_FALSE_RETURN(beginLCD(), false, "LCD begin failed");
+        ESP_UTILS_CHECK_FALSE_RETURN(beginTouch(), false, "Touch begin failed");
+        ESP_UTILS_CHECK_FALSE_RETURN(beginBacklight(true), false, "Backlight begin failed");
+    }
 
-        ESP_UTILS_LOGD("IO expander begin success");
+    if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_BOARD_BEGIN] != nullptr) {
+        ESP_UTILS_LOGD("Board post-begin");
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_BOARD_BEGIN](this), false, "Board post-begin failed"
+        );
     }
 
-    // Begin the LCD if it is used
+    _begin_timeline.end(BeginTimeline::PHASE_TOTAL);
+    _begin_timeline.print();
+
+    setState(State::BEGIN);
+
+    ESP_UTILS_LOGI("Board begin success");
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Board::beginIO_Expander()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    // If the IO expander is already begun, it will not be begun again
+    auto &config = getConfig();
+    auto io_expander = getIO_Expander();
+    if ((io_expander == nullptr) || io_expander->isOverState(esp_expander::Base::State::BEGIN)) {
+        goto end;
+    }
+
+    ESP_UTILS_LOGD("Beginning IO Expander");
+    _begin_timeline.start(BeginTimeline::PHASE_IO_EXPANDER);
+
+    if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_EXPANDER_BEGIN] != nullptr) {
+        ESP_UTILS_LOGD("IO expander pre-begin");
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_EXPANDER_BEGIN](this), false,
+            "IO expander pre-begin failed"
+        );
+    }
+
+    ESP_UTILS_CHECK_FALSE_RETURN(io_expander->begin(), false, "IO expander begin failed");
+
+    if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_EXPANDER_BEGIN] != nullptr) {
+        ESP_UTILS_LOGD("IO expander post-begin");
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_EXPANDER_BEGIN](this), false,
+            "IO expander post-begin failed"
+        );
+    }
+
+    _begin_timeline.end(BeginTimeline::PHASE_IO_EXPANDER);
+    ESP_UTILS_LOGD("IO expander begin success");
+
+end:
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Board::beginLCD()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    auto &config = getConfig();
     auto lcd_device = getLCD();
-    if (lcd_device != nullptr) {
-        ESP_UTILS_LOGD("Beginning LCD");
+    if (lcd_device == nullptr) {
+        goto end;
+    }
 
-        if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_LCD_BEGIN] != nullptr) {
-            ESP_UTILS_LOGD("LCD pre-begin");
-            ESP_UTILS_CHECK_FALSE_RETURN(
-                config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_LCD_BEGIN](this), false, "LCD pre-begin failed"
-            );
-        }
+    ESP_UTILS_LOGD("Beginning LCD");
+    _begin_timeline.start(BeginTimeline::PHASE_LCD);
+
+    if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_LCD_BEGIN] != nullptr) {
+        ESP_UTILS_LOGD("LCD pre-begin");
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_LCD_BEGIN](this), false, "LCD pre-begin failed"
+        );
+    }
 
+    {
 #if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
         drivers::Bus *lcd_bus = lcd_device->getBus();
         // When using "3-wire SPI + RGB" LCD, the IO expander should be configured first
-        if ((lcd_bus->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_RGB) &&
-                std::get<drivers::BusRGB::Config>(config.lcd.value().bus_config).isControlPanelValid() &&
-                (_io_expander != nullptr)) {
+        if (isLCD_UsingIO_Expander()) {
             ESP_UTILS_CHECK_FALSE_RETURN(
                 static_cast<drivers::BusRGB *>(lcd_bus)->configSPI_IO_Expander(
-                    io_expander->getBase()->getDeviceHandle()
+                    getIO_Expander()->getBase()->getDeviceHandle()
                 ), false, "\"3-wire SPI + RGB \" LCD bus config IO expander failed"
             );
         }
@@ -358,30 +485,46 @@ bool Board::begin()
         } else {
             ESP_UTILS_LOGD("LCD device doesn't support gap function");
         }
+    }
 
-        if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_LCD_BEGIN] != nullptr) {
-            ESP_UTILS_LOGD("LCD post-begin");
-            ESP_UTILS_CHECK_FALSE_RETURN(
-                config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_LCD_BEGIN](this), false, "LCD post-begin failed"
-            );
-        }
-
-        ESP_UTILS_LOGD("LCD begin success");
+    if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_LCD_BEGIN] != nullptr) {
+        ESP_UTILS_LOGD("LCD post-begin");
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_LCD_BEGIN](this), false, "LCD post-begin failed"
+        );
     }
 
-    // Begin the touch if it is used
+    _begin_timeline.end(BeginTimeline::PHASE_LCD);
+    ESP_UTILS_LOGD("LCD begin success");
+
+end:
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Board::beginTouch()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    auto &config = getConfig();
     auto touch_device = getTouch();
-    if (touch_device != nullptr) {
-        ESP_UTILS_LOGD("Beginning touch");
+    if (touch_device == nullptr) {
+        goto end;
+    }
 
-        if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_TOUCH_BEGIN] != nullptr) {
-            ESP_UTILS_LOGD("Touch pre-begin");
-            ESP_UTILS_CHECK_FALSE_RETURN(
-                config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_TOUCH_BEGIN](this), false,
-                "Touch pre-begin failed"
-            );
-        }
+    ESP_UTILS_LOGD("Beginning touch");
+    _begin_timeline.start(BeginTimeline::PHASE_TOUCH);
 
+    if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_TOUCH_BEGIN] != nullptr) {
+        ESP_UTILS_LOGD("Touch pre-begin");
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_TOUCH_BEGIN](this), false,
+            "Touch pre-begin failed"
+        );
+    }
+
+    {
         ESP_UTILS_CHECK_FALSE_RETURN(touch_device->begin(), false, "Touch device begin failed");
 
         auto &touch_config = _config.touch.value();
@@ -394,39 +537,56 @@ bool Board::begin()
         ESP_UTILS_CHECK_FALSE_RETURN(
             touch_device->mirrorY(touch_config.pre_process.mirror_y), false, "Touch device mirror Y failed"
         );
+    }
 
-        if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_TOUCH_BEGIN] != nullptr) {
-            ESP_UTILS_LOGD("Touch post-begin");
-            ESP_UTILS_CHECK_FALSE_RETURN(
-                config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_TOUCH_BEGIN](this), false,
-                "Touch post-begin failed"
-            );
-        }
-
-        ESP_UTILS_LOGD("Touch begin success");
+    if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_TOUCH_BEGIN] != nullptr) {
+        ESP_UTILS_LOGD("Touch post-begin");
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_TOUCH_BEGIN](this), false,
+            "Touch post-begin failed"
+        );
     }
 
-    // Begin the backlight if it is used
+    _begin_timeline.end(BeginTimeline::PHASE_TOUCH);
+    ESP_UTILS_LOGD("Touch begin success");
+
+end:
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Board::beginBacklight(bool apply_idle_state)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    auto &config = getConfig();
     auto backlight = getBacklight();
-    if (backlight != nullptr) {
-        ESP_UTILS_LOGD("Beginning backlight");
+    if (backlight == nullptr) {
+        goto end;
+    }
 
-        if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_BACKLIGHT_BEGIN] != nullptr) {
-            ESP_UTILS_LOGD("Backlight pre-begin");
-            ESP_UTILS_CHECK_FALSE_RETURN(
-                config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_BACKLIGHT_BEGIN](this), false,
-                "Backlight pre-begin failed"
-            );
-        }
+    ESP_UTILS_LOGD("Beginning backlight");
+    _begin_timeline.start(BeginTimeline::PHASE_BACKLIGHT);
 
-        auto &backlight_config = _config.backlight.value();
+    if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_BACKLIGHT_BEGIN] != nullptr) {
+        ESP_UTILS_LOGD("Backlight pre-begin");
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_BACKLIGHT_BEGIN](this), false,
+            "Backlight pre-begin failed"
+        );
+    }
+
+    {
 #if ESP_PANEL_DRIVERS_BACKLIGHT_ENABLE_SWITCH_EXPANDER
+        auto &backlight_config = _config.backlight.value();
         // If the backlight is a switch expander, the IO expander should be configured
         if (drivers::BacklightFactory::getConfigType(backlight_config.config) ==
                 ESP_PANEL_BACKLIGHT_TYPE_SWITCH_EXPANDER) {
             auto *temp_backlight = static_cast<drivers::BacklightSwitchExpander *>(backlight);
             // Only configure the IO expander if it is not already configured
             if (temp_backlight->getIO_Expander() == nullptr) {
+                auto io_expander = getIO_Expander();
                 ESP_UTILS_CHECK_NULL_RETURN(io_expander, false, "Need IO expander to control backlight");
                 temp_backlight->configIO_Expander(io_expander->getBase());
             }
@@ -434,39 +594,101 @@ bool Board::begin()
 #endif // ESP_PANEL_DRIVERS_BACKLIGHT_ENABLE_SWITCH_EXPANDER
 
         ESP_UTILS_CHECK_FALSE_RETURN(backlight->begin(), false, "Backlight begin failed");
-        if (backlight_config.pre_process.idle_off) {
-            ESP_UTILS_CHECK_FALSE_RETURN(backlight->off(), false, "Backlight off failed");
-        } else {
-            ESP_UTILS_CHECK_FALSE_RETURN(backlight->on(), false, "Backlight on failed");
-        }
+    }
 
-        if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_BACKLIGHT_BEGIN] != nullptr) {
-            ESP_UTILS_LOGD("Backlight post-begin");
-            ESP_UTILS_CHECK_FALSE_RETURN(
-                config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_BACKLIGHT_BEGIN](this), false,
-                "Backlight post-begin failed"
-            );
-        }
+    // Keep the backlight off until the LCD is ready, `finishBacklightBegin()` will be called later
+    if (!apply_idle_state) {
+        ESP_UTILS_CHECK_FALSE_RETURN(backlight->off(), false, "Backlight off failed");
+        goto end;
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(finishBacklightBegin(), false, "Backlight finish begin failed");
+
+end:
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
-        ESP_UTILS_LOGD("Backlight begin success");
+    return true;
+}
+
+bool Board::finishBacklightBegin()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    auto &config = getConfig();
+    if (getBacklight() == nullptr) {
+        goto end;
     }
 
-    if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_BOARD_BEGIN] != nullptr) {
-        ESP_UTILS_LOGD("Board post-begin");
+    ESP_UTILS_CHECK_FALSE_RETURN(applyBacklightIdleState(), false, "Backlight apply idle state failed");
+
+    // The backlight is in its final state now, including when it was begun in parallel with the LCD
+    if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_BACKLIGHT_BEGIN] != nullptr) {
+        ESP_UTILS_LOGD("Backlight post-begin");
         ESP_UTILS_CHECK_FALSE_RETURN(
-            config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_BOARD_BEGIN](this), false, "Board post-begin failed"
+            config.stage_callbacks[BoardConfig::STAGE_CALLBACK_POST_BACKLIGHT_BEGIN](this), false,
+            "Backlight post-begin failed"
         );
     }
 
-    setState(State::BEGIN);
-
-    ESP_UTILS_LOGI("Board begin success");
+    _begin_timeline.end(BeginTimeline::PHASE_BACKLIGHT);
+    ESP_UTILS_LOGD("Backlight begin success");
 
+end:
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
     return true;
 }
 
+bool Board::applyBacklightIdleState()
+{
+    auto backlight = getBacklight();
+    if (backlight == nullptr) {
+        return true;
+    }
+
+    if (_config.backlight.value().pre_process.idle_off) {
+        ESP_UTILS_CHECK_FALSE_RETURN(backlight->off(), false, "Backlight off failed");
+    } else {
+        ESP_UTILS_CHECK_FALSE_RETURN(backlight->on(), false, "Backlight on failed");
+    }
+
+    return true;
+}
+
+bool Board::isLCD_UsingIO_Expander()
+{
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
+    auto lcd_device = getLCD();
+    if ((lcd_device == nullptr) || (_io_expander == nullptr)) {
+        return false;
+    }
+
+    return (lcd_device->getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_RGB) &&
+           std::get<drivers::BusRGB::Config>(_config.lcd.value().bus_config).isControlPanelValid();
+#else
+    return false;
+#endif // ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
+}
+
+bool Board::isBacklightParallelSafe()
+{
+    if (getBacklight() == nullptr) {
+        return false;
+    }
+
+    // A custom backlight may drive the LCD (e.g. brightness command), and the IO expander must not be shared with the
+    // "3-wire SPI + RGB" LCD while it is initializing
+    auto type = drivers::BacklightFactory::getConfigType(_config.backlight.value().config);
+    switch (type) {
+    case ESP_PANEL_BACKLIGHT_TYPE_SWITCH_GPIO:
+    case ESP_PANEL_BACKLIGHT_TYPE_PWM_LEDC:
+        return true;
+    case ESP_PANEL_BACKLIGHT_TYPE_SWITCH_EXPANDER:
+        return !isLCD_UsingIO_Expander();
+    default:
+        return false;
+    }
+}
+
 bool Board::del()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -539,4 +761,47 @@ bool Board::configCallback(board::BoardConfig::StageCallbackType type, BoardConf
     return true;
 }
 
+bool Board::configParallelBegin(bool enable)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::BEGIN), false, "Already begun");
+
+    ESP_UTILS_LOGD("Param: enable(%d)", enable);
+    _is_parallel_begin = enable;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+void Board::BeginTimeline::start(PhaseType type)
+{
+    phases[type].start_us = esp_timer_get_time();
+}
+
+void Board::BeginTimeline::end(PhaseType type)
+{
+    phases[type].end_us = esp_timer_get_time();
+}
+
+void Board::BeginTimeline::print() const
+{
+    static const char *phase_names[PHASE_MAX] = {"IO expander", "LCD", "touch", "backlight", "total"};
+
+    auto origin = phases[PHASE_TOTAL].start_us;
+    ESP_UTILS_LOGD("\n\t{Board begin timeline}(%s)", parallel ? "parallel" : "sequential");
+    for (int i = 0; i < PHASE_MAX; i++) {
+        auto &phase = phases[i];
+        if ((phase.start_us < 0) || (phase.end_us < 0)) {
+            continue;
+        }
+        ESP_UTILS_LOGD(
+            "\t\t-> [%s]: %d ms -> %d ms (%d ms)", phase_names[i],
+            static_cast<int>((phase.start_us - origin) / 1000), static_cast<int>((phase.end_us - origin) / 1000),
+            static_cast<int>(phase.getDurationUs() / 1000)
+        );
+    }
+}
+
 } // namespace esp_panel
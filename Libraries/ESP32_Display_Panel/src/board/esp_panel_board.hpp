@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
 #include "esp_panel_types.h"
@@ -30,6 +31,58 @@ public:
         BEGIN,         /*!< Board is started */
     };
 
+    /**
+     * @brief Startup timeline of `begin()`, for measuring the cold boot time
+     */
+    struct BeginTimeline {
+        /**
+         * @brief Phase type enumeration
+         */
+        enum PhaseType : uint8_t {
+            PHASE_IO_EXPANDER = 0,  /*!< IO expander begin, including its stage callbacks */
+            PHASE_LCD,              /*!< LCD begin, including the vendor init commands and its stage callbacks */
+            PHASE_TOUCH,            /*!< Touch begin, including its stage callbacks */
+            PHASE_BACKLIGHT,        /*!< Backlight begin until it's turned on, including its stage callbacks */
+            PHASE_TOTAL,            /*!< Whole `begin()` */
+            PHASE_MAX,
+        };
+
+        /**
+         * @brief Single phase, timestamps are from `esp_timer_get_time()`, `-1` if the phase didn't run
+         */
+        struct Phase {
+            int64_t getDurationUs() const
+            {
+                return ((start_us < 0) || (end_us < 0)) ? 0 : (end_us - start_us);
+            }
+
+            int64_t start_us = -1;  /*!< Start timestamp in microseconds */
+            int64_t end_us = -1;    /*!< End timestamp in microseconds */
+        };
+
+        /**
+         * @brief Mark the start of a phase
+         *
+         * @param[in] type Phase type
+         */
+        void start(PhaseType type);
+
+        /**
+         * @brief Mark the end of a phase
+         *
+         * @param[in] type Phase type
+         */
+        void end(PhaseType type);
+
+        /**
+         * @brief Print the timeline at debug log level, relative to the start of `begin()`
+         */
+        void print() const;
+
+        std::array<Phase, PHASE_MAX> phases = {};   /*!< Phases indexed by `PhaseType` */
+        bool parallel = false;                      /*!< `true` if the LCD was begun in parallel with other devices */
+    };
+
     /**
      * @brief Default constructor, initializes the board with default configuration.
      *
@@ -71,6 +124,22 @@ public:
      */
     bool configCallback(board::BoardConfig::StageCallbackType type, BoardConfig::FunctionStageCallback callback);
 
+    /**
+     * @brief Configure whether to begin the LCD in parallel with the touch and the backlight
+     *
+     * When enabled, the LCD is begun in a separate thread, so the touch and the backlight are begun while the LCD is
+     * waiting for the delays of its vendor init commands. The backlight is only turned on once the LCD is ready, and the
+     * backlight post-begin callback is called after that. The backlight is begun after the LCD if it may access the LCD
+     * or the IO expander used by the LCD.
+     *
+     * @param[in] enable `true` to enable, `false` to disable
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called before `begin()`
+     * @note The stage callbacks of the LCD run in the separate thread (8 KB stack), concurrently with the ones of the
+     *       touch and the backlight
+     */
+    bool configParallelBegin(bool enable);
+
     /**
      * @brief Initialize the panel device
      *
@@ -84,7 +153,8 @@ public:
     /**
      * @brief Startup the panel device
      *
-     * Initializes and configures all enabled devices in the following order: `IO Expander -> LCD -> Touch -> Backlight`
+     * Initializes and configures all enabled devices in the following order: `IO Expander -> LCD -> Touch -> Backlight`.
+     * See `configParallelBegin()` to overlap the LCD with the touch and the backlight.
      *
      * @return `true` if successful, `false` otherwise
      * @note Will automatically call `init()` if not already initialized
@@ -152,6 +222,16 @@ public:
         return _io_expander.get();
     }
 
+    /**
+     * @brief Get the startup timeline of the last `begin()`
+     *
+     * @return Reference to the timeline
+     */
+    const BeginTimeline &getBeginTimeline() const
+    {
+        return _begin_timeline;
+    }
+
     /**
      * @brief Get the current board configuration
      *
@@ -263,8 +343,19 @@ private:
         return _config.io_expander.has_value();
     }
 
+    bool beginIO_Expander();
+    bool beginLCD();
+    bool beginTouch();
+    bool beginBacklight(bool apply_idle_state);
+    bool finishBacklightBegin();
+    bool applyBacklightIdleState();
+    bool isLCD_UsingIO_Expander();
+    bool isBacklightParallelSafe();
+
     BoardConfig _config = {};
     bool _use_default_config = false;
+    bool _is_parallel_begin = false;
+    BeginTimeline _begin_timeline = {};
     State _state = State::DEINIT;
     std::shared_ptr<drivers::Bus> _lcd_bus = nullptr;
     std::shared_ptr<drivers::LCD> _lcd_device = nullptr;
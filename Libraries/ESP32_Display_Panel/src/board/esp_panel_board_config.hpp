@@ -56,6 +56,9 @@ struct BoardConfig {
         drivers::BusFactory::Config bus_config;     /*!< LCD bus configuration */
         const char *device_name = "";               /*!< LCD device name */
         drivers::LCD::Config device_config;         /*!< LCD device configuration */
+        const uint8_t *vendor_program = nullptr;    /*!< LCD vendor command program, replaces the vendor
+                                                     *   initialization commands if set (SPI/QSPI/I80 only) */
+        size_t vendor_program_size = 0;             /*!< Size of the LCD vendor command program in bytes */
         struct PreProcess {
             int invert_color: 1;                    /*!< Invert color if set to 1 */
             int swap_xy: 1;                         /*!< Swap X and Y coordinates if set to 1 */
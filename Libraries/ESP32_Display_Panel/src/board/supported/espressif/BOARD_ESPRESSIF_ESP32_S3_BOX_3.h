@@ -106,21 +106,26 @@
  * 2. Helper macros:
  *    - ESP_PANEL_LCD_CMD_WITH_8BIT_PARAM(delay_ms, command, {data0, data1, ...})
  *    - ESP_PANEL_LCD_CMD_WITH_NONE_PARAM(delay_ms, command)
+ *
+ * For the SPI/QSPI/I80 buses, `ESP_PANEL_BOARD_LCD_VENDOR_INIT_PROGRAM()` can be defined instead, with the commands
+ * written as `ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM()` / `ESP_PANEL_LCD_PROGRAM_CMD_WITH_NONE_PARAM()`. The
+ * commands are validated and packed into a compact program at compile time. They can't contain the MADCTL(36h) and
+ * COLMOD(3Ah) commands.
  */
-#define ESP_PANEL_BOARD_LCD_VENDOR_INIT_CMD()                       \
+#define ESP_PANEL_BOARD_LCD_VENDOR_INIT_PROGRAM()                   \
     {                                                               \
-        ESP_PANEL_LCD_CMD_WITH_8BIT_PARAM(0, 0xC8, {0xFF, 0x93, 0x42}), \
-        ESP_PANEL_LCD_CMD_WITH_8BIT_PARAM(0, 0xC0, {0x0E, 0x0E}), \
-        ESP_PANEL_LCD_CMD_WITH_8BIT_PARAM(0, 0xC5, {0xD0}), \
-        ESP_PANEL_LCD_CMD_WITH_8BIT_PARAM(0, 0xC1, {0x02}), \
-        ESP_PANEL_LCD_CMD_WITH_8BIT_PARAM(0, 0xB4, {0x02}), \
-        ESP_PANEL_LCD_CMD_WITH_8BIT_PARAM(0, 0xE0, {0x00, 0x03, 0x08, 0x06, 0x13, 0x09, 0x39, 0x39, 0x48, 0x02, 0x0a, \
-                                             0x08, 0x17, 0x17, 0x0F}), \
-        ESP_PANEL_LCD_CMD_WITH_8BIT_PARAM(0, 0xE1, {0x00, 0x28, 0x29, 0x01, 0x0d, 0x03, 0x3f, 0x33, 0x52, 0x04, 0x0f, \
-                                             0x0e, 0x37, 0x38, 0x0F}), \
-        ESP_PANEL_LCD_CMD_WITH_8BIT_PARAM(0, 0xB1, {00, 0x1B}), \
-        ESP_PANEL_LCD_CMD_WITH_8BIT_PARAM(0, 0xB7, {0x06}), \
-        ESP_PANEL_LCD_CMD_WITH_NONE_PARAM(100, 0x11), \
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0xC8, {0xFF, 0x93, 0x42}), \
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0xC0, {0x0E, 0x0E}), \
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0xC5, {0xD0}), \
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0xC1, {0x02}), \
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0xB4, {0x02}), \
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0xE0, {0x00, 0x03, 0x08, 0x06, 0x13, 0x09, 0x39, 0x39, 0x48, \
+                                                     0x02, 0x0a, 0x08, 0x17, 0x17, 0x0F}), \
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0xE1, {0x00, 0x28, 0x29, 0x01, 0x0d, 0x03, 0x3f, 0x33, 0x52, \
+                                                     0x04, 0x0f, 0x0e, 0x37, 0x38, 0x0F}), \
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0xB1, {00, 0x1B}), \
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0xB7, {0x06}), \
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_NONE_PARAM(100, 0x11), \
     }
 
 /**
@@ -182,7 +182,6 @@
         {0x36, (uint8_t []){0x00}, 1, 0},\
         {0x35, (uint8_t []){0x00}, 1, 0},\
         {0x29, (uint8_t []){0x00}, 1, 0},\
-        {0x00, (uint8_t []){0x00}, 0xff},\
     }
 
 /**
@@ -1,14 +1,35 @@
 /*
- * SPDX-FileCopyrightText: 2023-2024 Espressif Systems (Shanghai) CO LTD
+ * SPDX-FileCopyrightText: 2023-2025 Espressif Systems (Shanghai) CO LTD
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <cstring>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
 #include "utils/esp_panel_utils_log.h"
 #include "esp_panel_backlight_factory.hpp"
 
+#define FADE_TIMER_TASK_NAME    "esp_timer"
+
 namespace esp_panel::drivers {
 
+Backlight::~Backlight()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    // The derived part is already destroyed here, so release the timer first and only then drop the fade without
+    // aborting the segment
+    if (_fade_timer != nullptr) {
+        ESP_UTILS_LOGW("Fade timer is not deleted by `del()`, delete it now");
+        ESP_UTILS_CHECK_FALSE_EXIT(releaseFadeTimer(), "Release fade timer failed");
+    }
+    _fade.stop();
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
 bool Backlight::on()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -35,4 +56,185 @@ bool Backlight::off()
     return true;
 }
 
+bool Backlight::configCurve(Curve curve)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_LOGD("Param: curve(%d)", static_cast<int>(curve));
+    ESP_UTILS_CHECK_FALSE_RETURN(!isFading(), false, "Should be called while not fading");
+    _curve = curve;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Backlight::fadeBrightness(int percent, uint32_t duration_ms)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+
+    ESP_UTILS_LOGD("Param: percent(%d), duration_ms(%d)", percent, static_cast<int>(duration_ms));
+    percent = std::clamp(percent, 0, 100);
+    ESP_UTILS_CHECK_FALSE_RETURN(stopFade(), false, "Stop fade failed");
+    if (duration_ms == 0) {
+        ESP_UTILS_CHECK_FALSE_RETURN(setBrightness(percent), false, "Set brightness failed");
+        return true;
+    }
+
+    if (_fade_timer == nullptr) {
+        esp_timer_create_args_t timer_args = {
+            .callback = onFadeTimer,
+            .arg = this,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "backlight_fade",
+            .skip_unhandled_events = true,
+        };
+        ESP_UTILS_CHECK_ERROR_RETURN(esp_timer_create(&timer_args, &_fade_timer), false, "Create fade timer failed");
+    }
+
+    {
+        std::lock_guard<std::recursive_mutex> lock(_fade_mutex);
+        auto attributes = getFadeAttributes();
+        _fade.start(
+            _brightness_permille, percent * 10, duration_ms, attributes.segment_ms, attributes.curve,
+            attributes.level_max
+        );
+        ESP_UTILS_CHECK_FALSE_RETURN(processFadeSegment(), false, "Start fade failed");
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Backlight::stopFade()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    std::lock_guard<std::recursive_mutex> lock(_fade_mutex);
+    if (isFading()) {
+        esp_timer_stop(_fade_timer);
+        _fade.stop();
+        ESP_UTILS_CHECK_FALSE_RETURN(abortFadeSegment(), false, "Abort fade segment failed");
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Backlight::delFade()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(stopFade(), false, "Stop fade failed");
+    ESP_UTILS_CHECK_FALSE_RETURN(releaseFadeTimer(), false, "Release fade timer failed");
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Backlight::isFading()
+{
+    std::lock_guard<std::recursive_mutex> lock(_fade_mutex);
+
+    return _fade.isActive() || ((_fade_timer != nullptr) && esp_timer_is_active(_fade_timer));
+}
+
+bool Backlight::startFadeSegment(const BacklightFade::Segment &segment)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(setBrightness((segment.permille + 5) / 10), false, "Set brightness failed");
+
+    return true;
+}
+
+void Backlight::onFadeTimer(void *arg)
+{
+    auto backlight = static_cast<Backlight *>(arg);
+    std::lock_guard<std::recursive_mutex> lock(backlight->_fade_mutex);
+    // The timer may be deleted by `delFade()` while this callback is waiting for the lock
+    if (backlight->_fade_timer == nullptr) {
+        return;
+    }
+    ESP_UTILS_CHECK_FALSE_EXIT(backlight->processFadeSegment(), "Process fade segment failed");
+}
+
+bool Backlight::releaseFadeTimer()
+{
+    // Stop and detach the timer under the lock, a callback already waiting for the lock then returns early
+    esp_timer_handle_t timer = nullptr;
+    {
+        std::lock_guard<std::recursive_mutex> lock(_fade_mutex);
+        if (_fade_timer == nullptr) {
+            return true;
+        }
+        esp_timer_stop(_fade_timer);
+        timer = _fade_timer;
+        _fade_timer = nullptr;
+    }
+
+    // The timer task runs the callbacks one by one, so once a callback started after the stop has run, the callback
+    // of the fade timer doesn't reference this object anymore. Not needed (and it would never finish) if called from
+    // the timer task itself
+    if (strcmp(pcTaskGetName(nullptr), FADE_TIMER_TASK_NAME) != 0) {
+        SemaphoreHandle_t done = xSemaphoreCreateBinary();
+        ESP_UTILS_CHECK_NULL_RETURN(done, false, "Create semaphore failed");
+
+        esp_timer_create_args_t sync_args = {
+            .callback = [](void *arg) {
+                xSemaphoreGive(static_cast<SemaphoreHandle_t>(arg));
+            },
+            .arg = done,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "backlight_sync",
+            .skip_unhandled_events = false,
+        };
+        esp_timer_handle_t sync_timer = nullptr;
+        esp_err_t ret = esp_timer_create(&sync_args, &sync_timer);
+        if (ret == ESP_OK) {
+            ret = esp_timer_start_once(sync_timer, 0);
+            if (ret == ESP_OK) {
+                xSemaphoreTake(done, portMAX_DELAY);
+            }
+            esp_timer_delete(sync_timer);
+        }
+        vSemaphoreDelete(done);
+        ESP_UTILS_CHECK_ERROR_RETURN(ret, false, "Wait for the fade timer callback failed");
+    }
+
+    ESP_UTILS_CHECK_ERROR_RETURN(esp_timer_delete(timer), false, "Delete fade timer failed");
+
+    return true;
+}
+
+bool Backlight::processFadeSegment()
+{
+    BacklightFade::Segment segment;
+    if (!_fade.getNextSegment(segment)) {
+        return true;
+    }
+
+    ESP_UTILS_LOGD(
+        "Fade segment: permille(%d), level(%d), duration_ms(%d)", segment.permille, static_cast<int>(segment.level),
+        static_cast<int>(segment.duration_ms)
+    );
+    bool ret = startFadeSegment(segment);
+    if (!ret) {
+        _fade.stop();
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(ret, false, "Start fade segment failed");
+    setBrightnessPermilleValue(segment.permille);
+
+    // Wake up again once the segment is over, even for the last one, so that `isFading()` covers the whole fade
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_timer_start_once(_fade_timer, static_cast<uint64_t>(segment.duration_ms) * 1000), false,
+        "Start fade timer failed"
+    );
+
+    return true;
+}
+
 } // namespace esp_panel::drivers
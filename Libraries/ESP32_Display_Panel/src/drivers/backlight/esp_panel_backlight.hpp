@@ -6,8 +6,11 @@
 #pragma once
 
 #include <algorithm>
+#include <mutex>
 #include <string>
+#include "esp_timer.h"
 #include "esp_panel_backlight_conf_internal.h"
+#include "esp_panel_backlight_fade.hpp"
 
 namespace esp_panel::drivers {
 
@@ -35,6 +38,11 @@ public:
         BEGIN,         ///< Driver is initialized and ready
     };
 
+    /**
+     * @brief The brightness curve, see `BacklightFade::Curve`
+     */
+    using Curve = BacklightFade::Curve;
+
     /**
      * @brief Construct a new backlight device
      *
@@ -45,7 +53,7 @@ public:
     /**
      * @brief Destroy the backlight device
      */
-    virtual ~Backlight() = default;
+    virtual ~Backlight();
 
     /**
      * @brief Initialize and start the backlight device
@@ -94,6 +102,47 @@ public:
      */
     bool off();
 
+    /**
+     * @brief Configure the brightness curve
+     *
+     * @param[in] curve The curve mapping the brightness percent to the output level, default is `Curve::LINEAR`
+     *
+     * @return `true` if successful, `false` otherwise
+     *
+     * @note Only devices with more than on/off levels (e.g. PWM(LEDC), Custom with `level_max`) apply the curve
+     */
+    bool configCurve(Curve curve);
+
+    /**
+     * @brief Fade the brightness to the target percent without blocking
+     *
+     * The fade is linear in perceived brightness. It's split into segments driven by a dedicated `esp_timer`, and the
+     * device either steps to the level of each segment or lets its hardware ramp over it (e.g. the LEDC fade)
+     *
+     * @param[in] percent The target brightness percent (0-100)
+     * @param[in] duration_ms The fade duration, `0` sets the brightness immediately
+     *
+     * @return `true` if successful, `false` otherwise
+     *
+     * @note This function should be called after `begin()`
+     * @note A running fade is replaced by the new one, call `stopFade()` before `setBrightness()` to cancel it
+     */
+    bool fadeBrightness(int percent, uint32_t duration_ms);
+
+    /**
+     * @brief Stop the running fade, the brightness stays where it is
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool stopFade();
+
+    /**
+     * @brief Check whether a fade is running
+     *
+     * @return `true` if a fade is running, `false` otherwise
+     */
+    bool isFading();
+
     /**
      * @brief Check if the driver has reached or passed the specified state
      *
@@ -123,10 +172,70 @@ public:
      */
     int getBrightness() const
     {
-        return _brightness;
+        return (_brightness_permille + 5) / 10;
+    }
+
+    /**
+     * @brief Get the brightness curve
+     *
+     * @return The brightness curve
+     */
+    Curve getCurve() const
+    {
+        return _curve;
     }
 
 protected:
+    /**
+     * @brief Fade attributes of the device
+     */
+    struct FadeAttributes {
+        Curve curve = Curve::LINEAR;    ///< Curve used to compute the level of each segment
+        uint32_t level_max = 100;       ///< Maximum output level, segments with the same level are merged
+        uint32_t segment_ms = 20;       ///< Nominal segment duration
+    };
+
+    /**
+     * @brief Get the fade attributes, the default steps through `setBrightness()` by percent
+     *
+     * @return The fade attributes
+     */
+    virtual FadeAttributes getFadeAttributes()
+    {
+        return FadeAttributes{};
+    }
+
+    /**
+     * @brief Start a fade segment, called from the fade timer
+     *
+     * The default implementation sets the brightness to the end of the segment immediately
+     *
+     * @param[in] segment The segment
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    virtual bool startFadeSegment(const BacklightFade::Segment &segment);
+
+    /**
+     * @brief Abort the fade segment in progress, called when the fade is stopped or replaced
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    virtual bool abortFadeSegment()
+    {
+        return true;
+    }
+
+    /**
+     * @brief Stop the fade and delete its timer
+     *
+     * The fade timer calls the virtual functions of the device, so derived classes should call this at the beginning
+     * of `del()`, before any of their resources are released
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool delFade();
+
     /**
      * @brief Set the current driver state
      *
@@ -144,13 +253,31 @@ protected:
      */
     void setBrightnessValue(int percent)
     {
-        _brightness = std::clamp(percent, 0, 100);
+        _brightness_permille = std::clamp(percent, 0, 100) * 10;
+    }
+
+    /**
+     * @brief Set the current brightness in permille, used by fades which are finer than percent
+     *
+     * @param[in] permille The brightness permille (0-1000)
+     */
+    void setBrightnessPermilleValue(int permille)
+    {
+        _brightness_permille = std::clamp(permille, 0, BacklightFade::PERMILLE_MAX);
     }
 
 private:
+    static void onFadeTimer(void *arg);
+    bool releaseFadeTimer();
+    bool processFadeSegment();
+
     State _state = State::DEINIT;               ///< Current driver state
     BasicAttributes _basic_attributes = {};     ///< Device basic attributes
-    int _brightness = 0;                        ///< Current brightness percent (0-100)
+    int _brightness_permille = 0;               ///< Current brightness permille (0-1000)
+    Curve _curve = Curve::LINEAR;               ///< Brightness curve
+    BacklightFade _fade;                        ///< Fade scheduler
+    esp_timer_handle_t _fade_timer = nullptr;   ///< Timer driving the fade segments
+    std::recursive_mutex _fade_mutex;           ///< Protects the fade scheduler
 };
 
 } // namespace esp_panel::drivers
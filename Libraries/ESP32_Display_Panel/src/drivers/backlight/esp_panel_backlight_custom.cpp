@@ -51,6 +51,8 @@ bool BacklightCustom::del()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
+    ESP_UTILS_CHECK_FALSE_RETURN(delFade(), false, "Delete fade failed");
+
     setState(State::DEINIT);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
@@ -68,7 +70,11 @@ bool BacklightCustom::setBrightness(int percent)
 
     percent = std::clamp(percent, 0, 100);
     if (_config.callback != nullptr) {
-        ESP_UTILS_CHECK_FALSE_RETURN(_config.callback(percent, _config.user_data), false, "Run callback failed");
+        int value = percent;
+        if (_config.level_max > 0) {
+            value = static_cast<int>(BacklightFade::toLevel(getCurve(), percent * 10, _config.level_max));
+        }
+        ESP_UTILS_CHECK_FALSE_RETURN(_config.callback(value, _config.user_data), false, "Run callback failed");
     }
 
     setBrightnessValue(percent);
@@ -78,6 +84,33 @@ bool BacklightCustom::setBrightness(int percent)
     return true;
 }
 
+BacklightCustom::FadeAttributes BacklightCustom::getFadeAttributes()
+{
+    if (_config.level_max <= 0) {
+        return FadeAttributes{};
+    }
+
+    return FadeAttributes{
+        .curve = getCurve(),
+        .level_max = static_cast<uint32_t>(_config.level_max),
+    };
+}
+
+bool BacklightCustom::startFadeSegment(const BacklightFade::Segment &segment)
+{
+    if (_config.level_max <= 0) {
+        return Backlight::startFadeSegment(segment);
+    }
+
+    if (_config.callback != nullptr) {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            _config.callback(static_cast<int>(segment.level), _config.user_data), false, "Run callback failed"
+        );
+    }
+
+    return true;
+}
+
 } // namespace esp_panel::drivers
 
 #endif // ESP_PANEL_DRIVERS_BACKLIGHT_ENABLE_CUSTOM
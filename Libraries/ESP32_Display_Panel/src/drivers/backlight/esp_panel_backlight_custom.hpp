@@ -41,6 +41,10 @@ public:
     struct Config {
         FunctionSetBrightnessCallback callback = nullptr;  ///< Callback function to set brightness, default is `nullptr`
         void *user_data = nullptr;                        ///< User data passed to callback function, default is `nullptr`
+        int level_max = 0;                                ///< If not `0`, the callback receives the output level
+                                                          ///< (0-`level_max`) mapped through the curve instead of the
+                                                          ///< percent, e.g. `255` for the brightness register (0x51)
+                                                          ///< of AMOLED panels, see `LCD::setDisplayBrightness()`
     };
 
     /**
@@ -103,6 +107,13 @@ public:
      */
     bool setBrightness(int percent) override;
 
+protected:
+    /**
+     * @brief Fade by output level if `level_max` is set, otherwise by percent
+     */
+    FadeAttributes getFadeAttributes() override;
+    bool startFadeSegment(const BacklightFade::Segment &segment) override;
+
 private:
     Config _config = {};     ///< Custom backlight configuration
 };
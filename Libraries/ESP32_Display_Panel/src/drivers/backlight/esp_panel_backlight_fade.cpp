@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "esp_panel_backlight_fade.hpp"
+
+namespace esp_panel::drivers {
+
+uint32_t BacklightFade::toLevel(Curve curve, int permille, uint32_t level_max)
+{
+    permille = std::clamp(permille, 0, PERMILLE_MAX);
+    if (permille == 0) {
+        return 0;
+    }
+
+    float luminance = 0;
+    float brightness = static_cast<float>(permille) / PERMILLE_MAX;
+    switch (curve) {
+    case Curve::GAMMA_2_2:
+        luminance = powf(brightness, 2.2f);
+        break;
+    case Curve::CIE1931: {
+        // `brightness` is the CIE lightness L* (0-100) scaled to 0-1
+        float lightness = brightness * 100;
+        if (lightness <= 8) {
+            luminance = lightness / 903.3f;
+        } else {
+            luminance = powf((lightness + 16) / 116, 3);
+        }
+        break;
+    }
+    case Curve::LINEAR:
+    default:
+        return (static_cast<uint64_t>(level_max) * permille) / PERMILLE_MAX;
+    }
+
+    uint32_t level = static_cast<uint32_t>(luminance * level_max + 0.5f);
+
+    return std::clamp<uint32_t>(level, 1, level_max);
+}
+
+void BacklightFade::start(
+    int from_permille, int to_permille, uint32_t duration_ms, uint32_t segment_ms, Curve curve, uint32_t level_max
+)
+{
+    _curve = curve;
+    _level_max = level_max;
+    _from_permille = std::clamp(from_permille, 0, PERMILLE_MAX);
+    _to_permille = std::clamp(to_permille, 0, PERMILLE_MAX);
+    _duration_ms = duration_ms;
+    _segments_num = (segment_ms > 0) ? std::max<int>(duration_ms / segment_ms, 1) : 1;
+    _index = 0;
+}
+
+void BacklightFade::stop()
+{
+    _segments_num = 0;
+    _index = 0;
+}
+
+bool BacklightFade::getNextSegment(Segment &segment)
+{
+    if (!isActive()) {
+        return false;
+    }
+
+    // Extend the segment while the next one ends at the same output level
+    int start = _index;
+    int permille = getPermille(_index + 1);
+    uint32_t level = toLevel(_curve, permille, _level_max);
+    _index++;
+    while (isActive() && (toLevel(_curve, getPermille(_index + 1), _level_max) == level)) {
+        permille = getPermille(_index + 1);
+        _index++;
+    }
+
+    segment = {
+        .permille = permille,
+        .level = level,
+        .duration_ms = getElapsedMs(_index) - getElapsedMs(start),
+        .is_last = !isActive(),
+    };
+
+    return true;
+}
+
+int BacklightFade::getPermille(int index) const
+{
+    return _from_permille + ((_to_permille - _from_permille) * index) / _segments_num;
+}
+
+uint32_t BacklightFade::getElapsedMs(int index) const
+{
+    return (static_cast<uint64_t>(_duration_ms) * index) / _segments_num;
+}
+
+} // namespace esp_panel::drivers
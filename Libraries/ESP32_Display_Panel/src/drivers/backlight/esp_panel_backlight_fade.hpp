@@ -0,0 +1,116 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Brightness fade scheduler
+ *
+ * A fade is linear in perceived brightness, expressed in permille (0-1000), and is split into segments. Each segment
+ * ends at an output level (PWM duty, brightness register value, ...) obtained through the brightness curve. The device
+ * either jumps to that level at the start of the segment, or lets hardware ramp to it over the segment duration.
+ * Consecutive segments ending at the same output level are merged, so no write is issued for a step the output can't
+ * show.
+ *
+ * @note The scheduler doesn't depend on any timer or hardware, it's driven by the backlight device
+ */
+class BacklightFade {
+public:
+    static constexpr int PERMILLE_MAX = 1000;
+
+    /**
+     * @brief Brightness curve, mapping perceived brightness to output level
+     */
+    enum class Curve : uint8_t {
+        LINEAR = 0,     /*!< Output level is proportional to the brightness, the historical behavior */
+        GAMMA_2_2,      /*!< Output level follows `brightness ^ 2.2` */
+        CIE1931,        /*!< Output level follows the CIE 1931 lightness formula */
+    };
+
+    /**
+     * @brief A fade segment
+     */
+    struct Segment {
+        int permille = 0;           /*!< Perceived brightness at the end of the segment */
+        uint32_t level = 0;         /*!< Output level at the end of the segment */
+        uint32_t duration_ms = 0;   /*!< Segment duration */
+        bool is_last = false;       /*!< Whether it's the last segment of the fade */
+    };
+
+    /**
+     * @brief Convert a perceived brightness to an output level
+     *
+     * @param[in] curve Brightness curve
+     * @param[in] permille Perceived brightness (0-1000)
+     * @param[in] level_max Maximum output level
+     * @return Output level (0-`level_max`), a non-zero brightness never maps to `0`
+     */
+    static uint32_t toLevel(Curve curve, int permille, uint32_t level_max);
+
+    /**
+     * @brief Start a fade
+     *
+     * @param[in] from_permille Current brightness (0-1000)
+     * @param[in] to_permille Target brightness (0-1000)
+     * @param[in] duration_ms Fade duration
+     * @param[in] segment_ms Nominal segment duration, the fade is split into `duration_ms / segment_ms` segments
+     * @param[in] curve Brightness curve
+     * @param[in] level_max Maximum output level
+     */
+    void start(
+        int from_permille, int to_permille, uint32_t duration_ms, uint32_t segment_ms, Curve curve, uint32_t level_max
+    );
+
+    /**
+     * @brief Stop the fade
+     */
+    void stop();
+
+    /**
+     * @brief Get the next segment of the fade
+     *
+     * @param[out] segment Next segment
+     * @return `true` if there is a segment, `false` if the fade is finished or stopped
+     */
+    bool getNextSegment(Segment &segment);
+
+    /**
+     * @brief Check whether a fade is in progress
+     *
+     * @return `true` if some segments are left, `false` otherwise
+     */
+    bool isActive() const
+    {
+        return _index < _segments_num;
+    }
+
+    /**
+     * @brief Get the target brightness of the fade
+     *
+     * @return Target brightness (0-1000)
+     */
+    int getTargetPermille() const
+    {
+        return _to_permille;
+    }
+
+private:
+    int getPermille(int index) const;
+    uint32_t getElapsedMs(int index) const;
+
+    Curve _curve = Curve::LINEAR;
+    uint32_t _level_max = 0;
+    int _from_permille = 0;
+    int _to_permille = 0;
+    uint32_t _duration_ms = 0;
+    int _segments_num = 0;
+    int _index = 0;
+};
+
+} // namespace esp_panel::drivers
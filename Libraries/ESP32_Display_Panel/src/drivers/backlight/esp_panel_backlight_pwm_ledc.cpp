@@ -183,6 +183,8 @@ bool BacklightPWM_LEDC::del()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
+    ESP_UTILS_CHECK_FALSE_RETURN(delFade(), false, "Delete fade failed");
+
     if (isOverState(State::BEGIN)) {
 #if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 3, 0)
         auto &channel_config = getLEDC_ChannelConfig();
@@ -218,9 +220,10 @@ bool BacklightPWM_LEDC::setBrightness(int percent)
     ESP_UTILS_LOGD("Param: percent(%d)", percent);
 
     percent = std::clamp(percent, 0, 100);
+    ESP_UTILS_CHECK_FALSE_RETURN(abortFadeSegment(), false, "Stop LEDC fade failed");
+
     auto &channel_config = getLEDC_ChannelConfig();
-    auto &timer_config = getLEDC_TimerConfig();
-    uint32_t duty = ((1ULL << timer_config.duty_resolution) * percent) / 100;
+    uint32_t duty = BacklightFade::toLevel(getCurve(), percent * 10, getDutyMax());
 
     ESP_UTILS_CHECK_ERROR_RETURN(
         ledc_set_duty(channel_config.speed_mode, channel_config.channel, duty),
@@ -237,6 +240,58 @@ bool BacklightPWM_LEDC::setBrightness(int percent)
     return true;
 }
 
+BacklightPWM_LEDC::FadeAttributes BacklightPWM_LEDC::getFadeAttributes()
+{
+    return FadeAttributes{
+        .curve = getCurve(),
+        .level_max = getDutyMax(),
+        .segment_ms = FADE_SEGMENT_MS_DEFAULT,
+    };
+}
+
+bool BacklightPWM_LEDC::startFadeSegment(const BacklightFade::Segment &segment)
+{
+    // The fade function is shared by all LEDC channels, it may have been installed by others
+    esp_err_t ret = ledc_fade_func_install(0);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (ret == ESP_OK) || (ret == ESP_ERR_INVALID_STATE), false, "LEDC fade function install failed"
+    );
+
+    auto &channel_config = getLEDC_ChannelConfig();
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        ledc_set_fade_with_time(
+            channel_config.speed_mode, channel_config.channel, segment.level, static_cast<int>(segment.duration_ms)
+        ), false, "LEDC set fade failed"
+    );
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        ledc_fade_start(channel_config.speed_mode, channel_config.channel, LEDC_FADE_NO_WAIT), false,
+        "LEDC start fade failed"
+    );
+    _is_fade_started = true;
+
+    return true;
+}
+
+bool BacklightPWM_LEDC::abortFadeSegment()
+{
+    if (!_is_fade_started) {
+        return true;
+    }
+
+    auto &channel_config = getLEDC_ChannelConfig();
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        ledc_fade_stop(channel_config.speed_mode, channel_config.channel), false, "LEDC stop fade failed"
+    );
+    _is_fade_started = false;
+
+    return true;
+}
+
+uint32_t BacklightPWM_LEDC::getDutyMax()
+{
+    return 1UL << getLEDC_TimerConfig().duty_resolution;
+}
+
 BacklightPWM_LEDC::LEDC_TimerFullConfig &BacklightPWM_LEDC::getLEDC_TimerConfig()
 {
     if (std::holds_alternative<LEDC_TimerPartialConfig>(_config.ledc_timer)) {
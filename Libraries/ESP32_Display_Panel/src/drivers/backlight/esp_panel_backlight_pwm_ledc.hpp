@@ -31,6 +31,7 @@ public:
     static constexpr int LEDC_TIMER_BIT_DEFAULT = 10;
     static constexpr ledc_timer_t LEDC_TIMER_NUM_DEFAULT = LEDC_TIMER_0;
     static constexpr ledc_mode_t LEDC_SPEED_MODE_DEFAULT = LEDC_LOW_SPEED_MODE;
+    static constexpr uint32_t FADE_SEGMENT_MS_DEFAULT = 50;
 
     /**
      * @brief Partial LEDC timer configuration structure
@@ -143,6 +144,7 @@ public:
      * @return `true` if successful, `false` otherwise
      *
      * @note This function should be called after `begin()`
+     * @note The duty cycle follows the curve set by `configCurve()`
      */
     bool setBrightness(int percent) override;
 
@@ -153,7 +155,22 @@ public:
     [[deprecated("Use other constructors instead")]]
     BacklightPWM_LEDC(int io_num, bool light_up_level, bool use_pwm): BacklightPWM_LEDC(io_num, light_up_level) {}
 
+protected:
+    /**
+     * @brief Fade through the LEDC fade hardware, each segment is a linear duty ramp approximating the curve
+     */
+    FadeAttributes getFadeAttributes() override;
+    bool startFadeSegment(const BacklightFade::Segment &segment) override;
+    bool abortFadeSegment() override;
+
 private:
+    /**
+     * @brief Get the duty cycle of full brightness
+     *
+     * @return The maximum duty cycle
+     */
+    uint32_t getDutyMax();
+
     /**
      * @brief Get mutable reference to LEDC timer configuration
      *
@@ -168,7 +185,8 @@ private:
      */
     LEDC_ChannelFullConfig &getLEDC_ChannelConfig();
 
-    Config _config = {};     ///< PWM(LEDC) backlight configuration
+    Config _config = {};                ///< PWM(LEDC) backlight configuration
+    bool _is_fade_started = false;      ///< Whether the LEDC fade hardware may be running
 };
 
 } // namespace esp_panel::drivers
@@ -266,6 +266,17 @@ public:
         return static_cast<uint8_t>(getConfig().control_panel.dev_addr);
     }
 
+    /**
+     * @brief Get the transaction scheduler of the I2C host
+     *
+     * @return Shared pointer to the scheduler if the host exists and its scheduler is started, `nullptr` otherwise.
+     *         The host doesn't need to be owned by this bus
+     */
+    std::shared_ptr<HostI2C_Scheduler> getScheduler() const
+    {
+        return HostI2C::findScheduler(getConfig().host_id);
+    }
+
     /**
      * @brief Alias for backward compatibility
      * @deprecated Use `configI2C_PullupEnable()` instead
@@ -13,6 +13,8 @@ HostI2C::~HostI2C()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
+    ESP_UTILS_CHECK_FALSE_EXIT(stopScheduler(), "Stop scheduler failed");
+
     if (isOverState(State::BEGIN)) {
         int id = getID();
         ESP_UTILS_CHECK_ERROR_EXIT(
@@ -53,6 +55,48 @@ end:
     return true;
 }
 
+bool HostI2C::startScheduler(const HostI2C_Scheduler::Config &config)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Host is not begun");
+
+    if (_scheduler != nullptr) {
+        ESP_UTILS_LOGD("Scheduler is already started");
+        goto end;
+    }
+
+    {
+        std::shared_ptr<HostI2C_Scheduler> scheduler = nullptr;
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(
+            scheduler = utils::make_shared<HostI2C_Scheduler>(config), false, "Create scheduler failed"
+        );
+        ESP_UTILS_CHECK_FALSE_RETURN(scheduler->begin(), false, "Scheduler begin failed");
+        _scheduler = scheduler;
+        ESP_UTILS_LOGD("Start scheduler of I2C host(%d)", getID());
+    }
+
+end:
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool HostI2C::stopScheduler()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    if (_scheduler != nullptr) {
+        ESP_UTILS_CHECK_FALSE_RETURN(_scheduler->del(), false, "Scheduler delete failed");
+        _scheduler = nullptr;
+        ESP_UTILS_LOGD("Stop scheduler of I2C host(%d)", getID());
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool HostI2C::calibrateConfig(const i2c_config_t &config)
 {
     if (memcmp(&config, &this->config, sizeof(i2c_config_t))) {
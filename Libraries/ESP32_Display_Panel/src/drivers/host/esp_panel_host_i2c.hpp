@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <memory>
 #include "driver/i2c.h"
 #include "esp_panel_host.hpp"
+#include "esp_panel_host_i2c_scheduler.hpp"
 
 namespace esp_panel::drivers {
 
@@ -34,6 +36,55 @@ public:
      */
     bool begin() override;
 
+    /**
+     * @brief Start the transaction scheduler of the host
+     *
+     * Once started, the devices on this host which support it (touch and IO expander) route their transactions through
+     * the scheduler, so latency-critical reads are not delayed by other traffic on the same bus
+     *
+     * @param[in] config Scheduler configuration
+     * @return `true` if successful, `false` otherwise
+     */
+    bool startScheduler(const HostI2C_Scheduler::Config &config);
+    bool startScheduler()
+    {
+        return startScheduler(HostI2C_Scheduler::Config{});
+    }
+
+    /**
+     * @brief Stop the transaction scheduler, pending transactions are cancelled
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool stopScheduler();
+
+    /**
+     * @brief Get the transaction scheduler of the host
+     *
+     * @return Shared pointer to the scheduler if started, `nullptr` otherwise. Devices should not keep it, use
+     *         `HostI2C_Scheduler::Client` to follow the restarts of the scheduler
+     */
+    std::shared_ptr<HostI2C_Scheduler> getScheduler()
+    {
+        return _scheduler;
+    }
+
+    /**
+     * @brief Find the transaction scheduler of an I2C host
+     *
+     * All the devices on a host use this lookup, since the host can be owned by any of them (e.g. a device which
+     * skips the host initialization doesn't own it)
+     *
+     * @param[in] id Host ID
+     * @return Shared pointer to the scheduler if the host exists and its scheduler is started, `nullptr` otherwise
+     */
+    static std::shared_ptr<HostI2C_Scheduler> findScheduler(int id)
+    {
+        auto host = getInstance(id);
+
+        return (host != nullptr) ? host->getScheduler() : nullptr;
+    }
+
 private:
     /**
      * @brief Private constructor to prevent direct instantiation
@@ -51,6 +102,8 @@ private:
      * @return `true` if successful, `false` otherwise
      */
     bool calibrateConfig(const i2c_config_t &config) override;
+
+    std::shared_ptr<HostI2C_Scheduler> _scheduler;
 };
 
 } // namespace esp_panel::drivers
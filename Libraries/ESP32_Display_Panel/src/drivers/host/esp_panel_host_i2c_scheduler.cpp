@@ -0,0 +1,432 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include "utils/esp_panel_utils_log.h"
+#include "esp_panel_host_i2c_scheduler.hpp"
+
+namespace esp_panel::drivers {
+
+void HostI2C_Scheduler::LatencyHistogram::add(int64_t latency_us)
+{
+    int index = 0;
+    while ((index < (BUCKETS_NUM - 1)) && (latency_us >= (static_cast<int64_t>(BUCKET_BASE_US) << index))) {
+        index++;
+    }
+    buckets[index]++;
+    count++;
+    sum_us += latency_us;
+    if (latency_us > max_us) {
+        max_us = latency_us;
+    }
+}
+
+void HostI2C_Scheduler::LatencyHistogram::print(const char *name) const
+{
+    ESP_UTILS_LOGI(
+        "\n\t{I2C latency}[%s]"
+        "\n\t\t-> [count]: %d"
+        "\n\t\t-> [errors]: %d"
+        "\n\t\t-> [avg_us]: %d"
+        "\n\t\t-> [max_us]: %d"
+        , name
+        , static_cast<int>(count)
+        , static_cast<int>(errors)
+        , static_cast<int>((count > 0) ? (sum_us / count) : 0)
+        , static_cast<int>(max_us)
+    );
+    for (int i = 0; i < BUCKETS_NUM; i++) {
+        if (buckets[i] == 0) {
+            continue;
+        }
+        if (i == (BUCKETS_NUM - 1)) {
+            ESP_UTILS_LOGI("\t\t-> [>= %d us]: %d", BUCKET_BASE_US << (i - 1), static_cast<int>(buckets[i]));
+        } else {
+            ESP_UTILS_LOGI("\t\t-> [< %d us]: %d", BUCKET_BASE_US << i, static_cast<int>(buckets[i]));
+        }
+    }
+}
+
+HostI2C_Scheduler::HostI2C_Scheduler(const Config &config):
+    _config(config)
+{
+}
+
+HostI2C_Scheduler::~HostI2C_Scheduler()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_EXIT(del(), "Delete failed");
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+bool HostI2C_Scheduler::begin()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!_thread.joinable(), false, "Already begun");
+
+    _stop = false;
+    if (_config.start_thread) {
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(
+            _thread = std::thread(&HostI2C_Scheduler::run, this), false, "Create worker thread failed"
+        );
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool HostI2C_Scheduler::del()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+    cancelAll();
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+int HostI2C_Scheduler::registerDevice(const char *name)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_LOGD("Param: name(%s)", name);
+    std::lock_guard<std::mutex> lock(_mutex);
+    ESP_UTILS_CHECK_EXCEPTION_RETURN(
+        _devices.push_back(Device{(name != nullptr) ? name : "", {}}), -1, "Register device failed"
+    );
+    int device_id = static_cast<int>(_devices.size()) - 1;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return device_id;
+}
+
+bool HostI2C_Scheduler::submit(Priority priority, Transaction transaction)
+{
+    utils::vector<Transaction> transactions;
+    ESP_UTILS_CHECK_EXCEPTION_RETURN(
+        transactions.push_back(std::move(transaction)), false, "Create transaction failed"
+    );
+
+    return submitBatch(priority, std::move(transactions));
+}
+
+bool HostI2C_Scheduler::submitBatch(Priority priority, utils::vector<Transaction> transactions)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(priority < Priority::MAX, false, "Invalid priority");
+    ESP_UTILS_CHECK_FALSE_RETURN(!transactions.empty(), false, "Empty batch");
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    for (auto &transaction : transactions) {
+        ESP_UTILS_CHECK_FALSE_RETURN(isDeviceValid(transaction.device_id), false, "Invalid device ID");
+        ESP_UTILS_CHECK_FALSE_RETURN(transaction.operation != nullptr, false, "Invalid operation");
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(!_stop, false, "Scheduler is stopped");
+
+    auto &queue = _queues[static_cast<int>(priority)];
+    ESP_UTILS_CHECK_FALSE_RETURN(static_cast<int>(queue.size()) < _config.queue_depth, false, "Queue is full");
+    ESP_UTILS_CHECK_EXCEPTION_RETURN(
+        queue.push_back(Batch{std::move(transactions), Clock::now()}), false, "Enqueue batch failed"
+    );
+    lock.unlock();
+    _cv.notify_one();
+
+    return true;
+}
+
+esp_err_t HostI2C_Scheduler::Client::execute(
+    const std::shared_ptr<HostI2C_Scheduler> &scheduler, const char *name, Priority priority, Operation operation
+)
+{
+    if (scheduler == nullptr) {
+        return operation();
+    }
+
+    int device_id = -1;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // The first transaction, or the host has started a new scheduler since the last one
+        if ((_device_id < 0) || (_scheduler.lock() != scheduler)) {
+            _device_id = scheduler->registerDevice(name);
+            ESP_UTILS_CHECK_FALSE_RETURN(_device_id >= 0, ESP_ERR_NO_MEM, "Register device failed");
+            _scheduler = scheduler;
+        }
+        device_id = _device_id;
+    }
+
+    return scheduler->execute(priority, device_id, std::move(operation));
+}
+
+void HostI2C_Scheduler::Client::reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _scheduler.reset();
+    _device_id = -1;
+}
+
+esp_err_t HostI2C_Scheduler::execute(Priority priority, int device_id, Operation operation)
+{
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        ESP_UTILS_CHECK_FALSE_RETURN(isDeviceValid(device_id), ESP_ERR_INVALID_ARG, "Invalid device ID");
+
+        // Nested call from a running transaction, the bus is already owned by the caller
+        if (_busy && (_busy_owner == std::this_thread::get_id())) {
+            lock.unlock();
+            return operation();
+        }
+
+        // Nothing to overtake, execute directly without switching to the worker thread
+        if (!_stop && isIdle()) {
+            _busy = true;
+            _busy_owner = std::this_thread::get_id();
+            lock.unlock();
+
+            auto start_time = Clock::now();
+            esp_err_t ret = operation();
+            int64_t latency_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                     Clock::now() - start_time
+                                 ).count();
+
+            lock.lock();
+            addLatency(device_id, latency_us, ret);
+            _busy = false;
+            lock.unlock();
+            _cv.notify_all();
+
+            return ret;
+        }
+    }
+
+    struct Completion {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool done = false;
+        esp_err_t ret = ESP_OK;
+    };
+    auto completion = std::make_shared<Completion>();
+
+    Transaction transaction = {
+        .device_id = device_id,
+        .operation = std::move(operation),
+        .on_complete = [completion](esp_err_t ret) {
+            std::lock_guard<std::mutex> lock(completion->mutex);
+            completion->ret = ret;
+            completion->done = true;
+            completion->cv.notify_one();
+        },
+    };
+    ESP_UTILS_CHECK_FALSE_RETURN(submit(priority, std::move(transaction)), ESP_ERR_INVALID_STATE, "Submit failed");
+
+    // Without a worker thread, drive the scheduler from the caller. Another caller might own the bus, so retry.
+    if (!_thread.joinable()) {
+        while (!completion->done) {
+            if (!processOnce()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(completion->mutex);
+    completion->cv.wait(lock, [&completion] { return completion->done; });
+
+    return completion->ret;
+}
+
+bool HostI2C_Scheduler::processOnce()
+{
+    Batch batch;
+    if (!popBatch(batch)) {
+        return false;
+    }
+
+    for (auto &transaction : batch.transactions) {
+        esp_err_t ret = transaction.operation();
+        int64_t latency_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                 Clock::now() - batch.submit_time
+                             ).count();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            addLatency(transaction.device_id, latency_us, ret);
+        }
+        if (transaction.on_complete != nullptr) {
+            transaction.on_complete(ret);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _busy = false;
+    }
+    _cv.notify_all();
+
+    return true;
+}
+
+bool HostI2C_Scheduler::getLatencyHistogram(int device_id, LatencyHistogram &histogram)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    ESP_UTILS_CHECK_FALSE_RETURN(isDeviceValid(device_id), false, "Invalid device ID");
+
+    histogram = _devices[device_id].histogram;
+
+    return true;
+}
+
+void HostI2C_Scheduler::resetLatencyHistograms()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto &device : _devices) {
+        device.histogram = {};
+    }
+}
+
+void HostI2C_Scheduler::printLatencyHistograms()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto &device : _devices) {
+        device.histogram.print(device.name.c_str());
+    }
+}
+
+int HostI2C_Scheduler::getPendingCount()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    int count = 0;
+    for (auto &queue : _queues) {
+        count += queue.size();
+    }
+
+    return count;
+}
+
+bool HostI2C_Scheduler::isDeviceValid(int device_id) const
+{
+    return (device_id >= 0) && (device_id < static_cast<int>(_devices.size()));
+}
+
+bool HostI2C_Scheduler::hasPending() const
+{
+    for (auto &queue : _queues) {
+        if (!queue.empty()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool HostI2C_Scheduler::isIdle() const
+{
+    // A pending batch of any priority class goes first, the worker is only about to pop it
+    return !_busy && !hasPending();
+}
+
+void HostI2C_Scheduler::addLatency(int device_id, int64_t latency_us, esp_err_t ret)
+{
+    auto &histogram = _devices[device_id].histogram;
+    histogram.add(latency_us);
+    if (ret != ESP_OK) {
+        histogram.errors++;
+    }
+}
+
+bool HostI2C_Scheduler::popBatch(Batch &batch)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Only one transaction can own the bus
+    if (_busy) {
+        return false;
+    }
+
+    // Pick the head batch with the highest effective priority, a batch is promoted by one class per `aging_us` of
+    // waiting
+    auto now = Clock::now();
+    int selected = -1;
+    int selected_level = 0;
+    for (int i = 0; i < static_cast<int>(_queues.size()); i++) {
+        if (_queues[i].empty()) {
+            continue;
+        }
+        int level = i;
+        if (_config.aging_us > 0) {
+            auto waited_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                 now - _queues[i].front().submit_time
+                             ).count();
+            level -= static_cast<int>(std::min<int64_t>(waited_us / _config.aging_us, i));
+        }
+        // Within the same effective class, the oldest batch goes first
+        if ((selected < 0) || (level < selected_level) || ((level == selected_level) &&
+                (_queues[i].front().submit_time < _queues[selected].front().submit_time))) {
+            selected = i;
+            selected_level = level;
+        }
+    }
+    if (selected < 0) {
+        return false;
+    }
+
+    batch = std::move(_queues[selected].front());
+    _queues[selected].pop_front();
+    _busy = true;
+    _busy_owner = std::this_thread::get_id();
+
+    return true;
+}
+
+void HostI2C_Scheduler::cancelAll()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto queues = std::move(_queues);
+    _queues = {};
+    lock.unlock();
+
+    for (auto &queue : queues) {
+        for (auto &batch : queue) {
+            for (auto &transaction : batch.transactions) {
+                if (transaction.on_complete != nullptr) {
+                    transaction.on_complete(ESP_ERR_INVALID_STATE);
+                }
+            }
+        }
+    }
+}
+
+void HostI2C_Scheduler::run()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this] {
+                return _stop || (!_busy && hasPending());
+            });
+            if (_stop) {
+                break;
+            }
+        }
+        processOnce();
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,276 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "esp_err.h"
+#include "utils/esp_panel_utils_cxx.hpp"
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief I2C transaction scheduler shared by all devices on the same I2C host
+ *
+ * Every device (touch, IO expander, sensors, ...) submits its transactions to the scheduler of its host instead of
+ * accessing the bus directly. A single worker executes them one at a time, always picking the highest priority class
+ * first, so a latency-critical touch read never waits behind a queue of background expander traffic. Transactions of
+ * a batch are executed back-to-back without any other transaction in between. When the bus is idle and the queues of
+ * all priority classes are empty, `execute()` runs the transaction directly in the caller's context to avoid the
+ * thread switch, so it never overtakes queued work of any priority.
+ *
+ * @note The scheduler does not depend on the I2C driver, a transaction is just an operation returning `esp_err_t`
+ */
+class HostI2C_Scheduler {
+public:
+    /**
+     * @brief Priority classes, lower value means higher priority
+     */
+    enum class Priority : uint8_t {
+        REALTIME = 0,   /*!< Latency-critical traffic, like touch reads */
+        NORMAL,         /*!< Regular traffic, like IO expander writes during bring-up */
+        BACKGROUND,     /*!< Traffic that only fills the gaps, like sensor polling */
+        MAX,
+    };
+
+    /**
+     * @brief Operation of a transaction, typically one or more bus accesses of a single device
+     */
+    using Operation = std::function<esp_err_t()>;
+
+    /**
+     * @brief Completion callback, called from the worker thread once the transaction is executed
+     */
+    using CompletionCallback = std::function<void(esp_err_t ret)>;
+
+    /**
+     * @brief Transaction descriptor
+     */
+    struct Transaction {
+        int device_id = -1;                         /*!< Device ID returned by `registerDevice()` */
+        Operation operation = nullptr;              /*!< Operation to execute */
+        CompletionCallback on_complete = nullptr;   /*!< Optional completion callback */
+    };
+
+    /**
+     * @brief Latency histogram of a device, the latency includes the queueing and the execution time
+     *
+     * Bucket `i` counts latencies in `[BUCKET_BASE_US << (i - 1), BUCKET_BASE_US << i)`, bucket `0` counts latencies
+     * below `BUCKET_BASE_US`, and the last bucket also counts all larger latencies.
+     */
+    struct LatencyHistogram {
+        static constexpr int BUCKETS_NUM = 12;
+        static constexpr int BUCKET_BASE_US = 50;
+
+        /**
+         * @brief Add a latency sample
+         *
+         * @param[in] latency_us Latency in microseconds
+         */
+        void add(int64_t latency_us);
+
+        /**
+         * @brief Print information for debugging
+         *
+         * @param[in] name Device name
+         */
+        void print(const char *name) const;
+
+        std::array<uint32_t, BUCKETS_NUM> buckets = {};  /*!< Sample counts of each bucket */
+        uint32_t count = 0;                             /*!< Total number of samples */
+        uint32_t errors = 0;                            /*!< Number of failed transactions */
+        int64_t sum_us = 0;                             /*!< Sum of all latencies */
+        int64_t max_us = 0;                             /*!< Maximum latency */
+    };
+
+    /**
+     * @brief Scheduler configuration
+     */
+    struct Config {
+        int queue_depth = 32;           /*!< Maximum number of pending batches per priority class */
+        int aging_us = 100000;          /*!< A pending batch is promoted by one priority class after waiting this
+                                         *   long, to avoid starving lower classes. Set to `0` to disable */
+        bool start_thread = true;       /*!< Create the worker thread, otherwise `processOnce()` must be called */
+    };
+
+    /**
+     * @brief Registration of a device to a scheduler which follows the restarts of the scheduler
+     *
+     * The client only keeps a weak reference, so it doesn't keep a stopped scheduler alive, and the device is
+     * registered again when the host starts a new scheduler.
+     */
+    class Client {
+    public:
+        /**
+         * @brief Execute an operation through a scheduler and wait for its completion
+         *
+         * @param[in] scheduler Scheduler of the host, the operation is executed directly if it's `nullptr`
+         * @param[in] name Device name, used for the registration
+         * @param[in] priority Priority class
+         * @param[in] operation Operation to execute
+         * @return Return value of the operation, or an error if it could not be scheduled
+         */
+        esp_err_t execute(
+            const std::shared_ptr<HostI2C_Scheduler> &scheduler, const char *name, Priority priority,
+            Operation operation
+        );
+
+        /**
+         * @brief Forget the registration
+         */
+        void reset();
+
+    private:
+        std::mutex _mutex;
+        std::weak_ptr<HostI2C_Scheduler> _scheduler;
+        int _device_id = -1;
+    };
+
+    /**
+     * @brief Construct a scheduler
+     *
+     * @param[in] config Scheduler configuration
+     */
+    explicit HostI2C_Scheduler(const Config &config);
+    HostI2C_Scheduler(): HostI2C_Scheduler(Config{}) {}
+
+    /**
+     * @brief Destroy the scheduler, pending transactions are completed with `ESP_ERR_INVALID_STATE`
+     */
+    ~HostI2C_Scheduler();
+
+    /**
+     * @brief Start the worker thread
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool begin();
+
+    /**
+     * @brief Stop the worker thread and cancel all pending transactions
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool del();
+
+    /**
+     * @brief Register a device to get its ID and latency histogram
+     *
+     * @param[in] name Device name, used for debugging
+     * @return Device ID if successful, -1 otherwise
+     */
+    int registerDevice(const char *name);
+
+    /**
+     * @brief Submit a transaction asynchronously
+     *
+     * @param[in] priority Priority class
+     * @param[in] transaction Transaction to submit
+     * @return `true` if successful, `false` if the queue is full or the transaction is invalid
+     */
+    bool submit(Priority priority, Transaction transaction);
+
+    /**
+     * @brief Submit several transactions that are executed back-to-back
+     *
+     * @param[in] priority Priority class
+     * @param[in] transactions Transactions to submit, executed in order
+     * @return `true` if successful, `false` if the queue is full or a transaction is invalid
+     */
+    bool submitBatch(Priority priority, utils::vector<Transaction> transactions);
+
+    /**
+     * @brief Submit a transaction and wait for its completion
+     *
+     * @param[in] priority Priority class
+     * @param[in] device_id Device ID
+     * @param[in] operation Operation to execute
+     * @return Return value of the operation, or an error if it could not be scheduled
+     *
+     * @note If called from the worker thread (e.g. inside another transaction), or if the bus is idle and no batch of
+     *       any priority class is pending, the operation is executed directly in the caller's context. Otherwise it's
+     *       queued, even if its priority is higher than the pending ones, and executed by priority
+     */
+    esp_err_t execute(Priority priority, int device_id, Operation operation);
+
+    /**
+     * @brief Execute the most urgent pending batch in the caller's context
+     *
+     * @return `true` if a batch was executed, `false` if there was nothing to do
+     *
+     * @note This is what the worker thread runs, it's public so that the scheduler can be driven without a thread
+     */
+    bool processOnce();
+
+    /**
+     * @brief Get the latency histogram of a device
+     *
+     * @param[in] device_id Device ID
+     * @param[out] histogram Histogram copy
+     * @return `true` if successful, `false` otherwise
+     */
+    bool getLatencyHistogram(int device_id, LatencyHistogram &histogram);
+
+    /**
+     * @brief Reset the latency histograms of all devices
+     */
+    void resetLatencyHistograms();
+
+    /**
+     * @brief Print the latency histograms of all devices
+     */
+    void printLatencyHistograms();
+
+    /**
+     * @brief Get the number of pending batches
+     *
+     * @return Number of pending batches of all priority classes
+     */
+    int getPendingCount();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Batch {
+        utils::vector<Transaction> transactions;
+        Clock::time_point submit_time;
+    };
+
+    struct Device {
+        std::string name;
+        LatencyHistogram histogram;
+    };
+
+    bool isDeviceValid(int device_id) const;
+    bool hasPending() const;
+    bool isIdle() const;
+    void addLatency(int device_id, int64_t latency_us, esp_err_t ret);
+    bool popBatch(Batch &batch);
+    void cancelAll();
+    void run();
+
+    Config _config = {};
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::array<std::deque<Batch>, static_cast<int>(Priority::MAX)> _queues;
+    utils::vector<Device> _devices;
+    std::thread _thread;
+    std::atomic<bool> _stop = false;
+    bool _busy = false;                 /*!< A transaction is being executed, protected by `_mutex` */
+    std::thread::id _busy_owner;        /*!< Thread executing the transaction, protected by `_mutex` */
+};
+
+} // namespace esp_panel::drivers
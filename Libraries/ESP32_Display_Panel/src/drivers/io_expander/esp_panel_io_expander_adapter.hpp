@@ -85,6 +85,11 @@ public:
 
 public:
     std::shared_ptr<HostI2C> _host = nullptr;  /*!< I2C host interface */
+
+private:
+    esp_err_t runTransaction(const esp_expander::Base::Operation &operation);
+
+    HostI2C_Scheduler::Client _scheduler_client;   /*!< Registration to the I2C host scheduler */
 };
 
 template <class T>
@@ -147,6 +152,11 @@ bool IO_ExpanderAdapter<T>::begin()
 
     ESP_UTILS_CHECK_FALSE_RETURN(T::begin(), false, "Begin base failed");
 
+    // Share the bus with the other devices (e.g. touch) through the scheduler of the I2C host once it's started
+    T::setTransactionRunner([this](const esp_expander::Base::Operation &operation) {
+        return runTransaction(operation);
+    });
+
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
     return true;
@@ -157,6 +167,9 @@ bool IO_ExpanderAdapter<T>::del()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
+    T::setTransactionRunner(nullptr);
+    _scheduler_client.reset();
+
     if (_host != nullptr) {
         _host = nullptr;
         int host_id = this->getConfig().host_id;
@@ -172,4 +185,16 @@ bool IO_ExpanderAdapter<T>::del()
     return true;
 }
 
+template <class T>
+esp_err_t IO_ExpanderAdapter<T>::runTransaction(const esp_expander::Base::Operation &operation)
+{
+    // Same lookup as the touch, the host can also be owned by another device if the initialization of the host is
+    // skipped
+    auto scheduler = HostI2C::findScheduler(this->getConfig().host_id);
+
+    return _scheduler_client.execute(
+               scheduler, this->getBasicAttributes().name, HostI2C_Scheduler::Priority::NORMAL, operation
+           );
+}
+
 } // namespace esp_panel::drivers
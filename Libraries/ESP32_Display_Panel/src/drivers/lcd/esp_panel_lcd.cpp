@@ -9,15 +9,24 @@
 #include <numeric>
 #include "sdkconfig.h"
 #include "esp_heap_caps.h"
+#include "esp_lcd_panel_commands.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_io.h"
+#include "freertos/task.h"
 #include "esp_memory_utils.h"
 #include "driver/spi_master.h"
 #include "utils/esp_panel_utils_log.h"
 #include "esp_panel_lcd.hpp"
 
+#define LCD_CMD_WRDISBV         (0x51)
+#define QSPI_OPCODE_WRITE_CMD   (0x02UL)
+
 namespace esp_panel::drivers {
 
+// Passed to the driver instead of the vendor commands when a vendor command program is used. The driver only skips
+// its default commands if the table is not `nullptr`
+static const esp_panel_lcd_vendor_init_cmd_t VENDOR_INIT_CMDS_NONE[1] = {};
+
 void LCD::BasicBusSpecification::print(utils::string bus_name) const
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -269,6 +278,40 @@ bool LCD::configVendorCommands(const esp_panel_lcd_vendor_init_cmd_t init_cmd[],
     auto &vendor_config = getVendorFullConfig();
     vendor_config.init_cmds = init_cmd;
     vendor_config.init_cmds_size = init_cmd_size;
+    _vendor_program = nullptr;
+    _vendor_program_size = 0;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::configVendorCommandProgram(const uint8_t *program, size_t program_size)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+    ESP_UTILS_CHECK_FALSE_RETURN(isBusValid(), false, "Invalid bus");
+
+    // The program is sent after the driver has initialized the panel, which only matches the driver sequence when
+    // the vendor commands are the last step of the driver initialization
+    auto bus_type = getBus()->getBasicAttributes().type;
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (bus_type == ESP_PANEL_BUS_TYPE_SPI) || (bus_type == ESP_PANEL_BUS_TYPE_QSPI) ||
+        (bus_type == ESP_PANEL_BUS_TYPE_I80), false, "Only valid for SPI, QSPI and I80 bus"
+    );
+
+    ESP_UTILS_LOGD("Param: program(@%p), program_size(%d)", program, static_cast<int>(program_size));
+    ESP_UTILS_CHECK_FALSE_RETURN(program_size > 0, false, "Empty program");
+    // The driver keeps its own MADCTL and COLMOD values, they should be set through the device configuration
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        LCD_VendorProgram::execute(program, program_size, [](int cmd, const uint8_t *, size_t, uint32_t) {
+            return (cmd != LCD_CMD_MADCTL) && (cmd != LCD_CMD_COLMOD);
+        }), false, "Invalid program, or it contains the MADCTL(36h)/COLMOD(3Ah) commands"
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(configVendorCommands(nullptr, 0), false, "Config vendor commands failed");
+    _vendor_program = program;
+    _vendor_program_size = program_size;
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -411,6 +454,11 @@ bool LCD::begin()
     ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_panel_init(refresh_panel), false, "Init panel failed");
     ESP_UTILS_LOGD("Refresh panel(@%p) initialized", refresh_panel);
 
+    /* Send the vendor command program, the driver has been given an empty table */
+    if (_vendor_program != nullptr) {
+        ESP_UTILS_CHECK_FALSE_RETURN(sendVendorProgram(), false, "Send vendor command program failed");
+    }
+
     auto bus_type = getBus()->getBasicAttributes().type;
     /* If the panel is reset, goto end directly */
     if (isOverState(State::RESET)) {
@@ -745,6 +793,27 @@ bool LCD::setDisplayOnOff(bool enable_on)
     return true;
 }
 
+bool LCD::setDisplayBrightness(uint8_t level)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::INIT), false, "Not initialized");
+
+    ESP_UTILS_LOGD("Param: level(%d)", level);
+    uint32_t address = LCD_CMD_WRDISBV;
+    if (getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_QSPI) {
+        // QSPI LCDs expect the command wrapped as `[opcode(0x02)] [0x00] [command] [0x00]`
+        address = (QSPI_OPCODE_WRITE_CMD << 24) | (address << 8);
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        getBus()->writeRegisterData(address, &level, sizeof(level)), false, "Write brightness failed"
+    );
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool LCD::attachDrawBitmapFinishCallback(FunctionDrawBitmapFinishCallback callback, void *user_data)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -1091,6 +1160,11 @@ bool LCD::processDeviceOnInit(const BasicBusSpecificationMap &bus_specs)
     // Load the vendor configuration from the bus to the device
     ESP_UTILS_LOGD("Load vendor configuration from the bus");
     auto &vendor_config = getVendorFullConfig();
+    // The vendor command program is sent by `begin()` itself, the driver only sends its internal commands
+    if (_vendor_program != nullptr) {
+        vendor_config.init_cmds = VENDOR_INIT_CMDS_NONE;
+        vendor_config.init_cmds_size = 0;
+    }
     switch (bus_type) {
     case ESP_PANEL_BUS_TYPE_SPI:
         vendor_config.flags.use_spi_interface = 1;
@@ -1218,6 +1292,41 @@ const BusDSI::RefreshPanelFullConfig *LCD::getBusDSI_RefreshPanelFullConfig()
 }
 #endif
 
+bool LCD::sendVendorProgram()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    auto io = getBus()->getControlPanelHandle();
+    bool is_qspi = (getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_QSPI);
+    int cmds_num = 0;
+    // Commands without delay are streamed back-to-back, only the commands with a delay give up the CPU
+    auto send = [&](int cmd, const uint8_t *data, size_t data_bytes, uint32_t delay_ms) {
+        int lcd_cmd = cmd;
+        if (is_qspi) {
+            // QSPI LCDs expect the command wrapped as `[opcode(0x02)] [0x00] [command] [0x00]`
+            lcd_cmd = static_cast<int>((QSPI_OPCODE_WRITE_CMD << 24) | (cmd << 8));
+        }
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            esp_lcd_panel_io_tx_param(io, lcd_cmd, (data_bytes > 0) ? data : nullptr, data_bytes), false,
+            "Send command(0x%02X) failed", cmd
+        );
+        if (delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(delay_ms));
+        }
+        cmds_num++;
+
+        return true;
+    };
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        LCD_VendorProgram::execute(_vendor_program, _vendor_program_size, send), false, "Execute program failed"
+    );
+    ESP_UTILS_LOGD("Vendor command program sent (%d commands)", cmds_num);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 IRAM_ATTR bool LCD::onDrawBitmapFinish(void *panel_io, void *edata, void *user_ctx)
 {
     Interruption::CallbackData *callback_data = (Interruption::CallbackData *)user_ctx;
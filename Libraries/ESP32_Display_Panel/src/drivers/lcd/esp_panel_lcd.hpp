@@ -17,6 +17,7 @@
 #include "utils/esp_panel_utils_cxx.hpp"
 #include "drivers/bus/esp_panel_bus_factory.hpp"
 #include "port/esp_panel_lcd_vendor_types.h"
+#include "esp_panel_lcd_vendor_program.hpp"
 #include "esp_panel_lcd_conf_internal.h"
 
 namespace esp_panel::drivers {
@@ -328,6 +329,20 @@ public:
      */
     bool configVendorCommands(const esp_panel_lcd_vendor_init_cmd_t init_cmd[], uint32_t init_cmd_size);
 
+    /**
+     * @brief Configure the vendor initialization commands from a compiled program
+     *
+     * @param[in] program The program compiled by `LCD_VendorProgram::compile()`, must stay valid as long as the
+     *                    device is used
+     * @param[in] program_size The size of the program in bytes
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called before `init()`
+     * @note This function is only valid for the SPI, QSPI and I80 buses. The driver is given an empty command table,
+     *       and `begin()` sends the program itself right after the driver has initialized the panel
+     * @note The program can't contain the MADCTL(36h) and COLMOD(3Ah) commands, use the device configuration instead
+     */
+    bool configVendorCommandProgram(const uint8_t *program, size_t program_size);
+
     /**
      * @brief Configure driver to mirror by command
      *
@@ -510,6 +525,18 @@ public:
      */
     bool setDisplayOnOff(bool enable_on);
 
+    /**
+     * @brief Set the display brightness through the `WRDISBV` (0x51) command
+     *
+     * @param[in] level Brightness level (0-255)
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called after `begin()`
+     * @note Only LCDs with internal brightness control (like AMOLED controllers SH8601, RM67162, ...) support this
+     *       command. To drive it from a backlight device (so that it fades too), use `BacklightCustom` with
+     *       `level_max = 255` and call this function in the callback, e.g. `ESP_PANEL_BOARD_BACKLIGHT_CUSTOM_LEVEL_MAX`
+     */
+    bool setDisplayBrightness(uint8_t level);
+
     /**
      * @brief Attach a callback function to be called when bitmap drawing finishes
      *
@@ -930,6 +957,13 @@ private:
     const BusDSI::RefreshPanelFullConfig *getBusDSI_RefreshPanelFullConfig();
 #endif
 
+    /**
+     * @brief Send the vendor command program through the control panel
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool sendVendorProgram();
+
     IRAM_ATTR static bool onDrawBitmapFinish(void *panel_io, void *edata, void *user_ctx);
     IRAM_ATTR static bool onRefreshFinish(void *panel_io, void *edata, void *user_ctx);
 
@@ -939,6 +973,8 @@ private:
     State _state = State::DEINIT;               /*!< Current driver state */
     Transformation _transformation = {};        /*!< Coordinate transformation settings */
     Interruption _interruption = {};            /*!< Interrupt handling */
+    const uint8_t *_vendor_program = nullptr;   /*!< Vendor command program, sent on `begin()` */
+    size_t _vendor_program_size = 0;            /*!< Size of the vendor command program in bytes */
 };
 
 } // namespace esp_panel::drivers
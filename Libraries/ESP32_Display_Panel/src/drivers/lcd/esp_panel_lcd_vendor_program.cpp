@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "utils/esp_panel_utils_log.h"
+#include "esp_panel_lcd_vendor_program.hpp"
+
+namespace esp_panel::drivers {
+
+size_t LCD_VendorProgram::getProgramSize(const esp_panel_lcd_vendor_init_cmd_t cmds[], size_t num)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(cmds, 0, "Invalid commands");
+
+    return compileCommands(cmds, num, nullptr, 0);
+}
+
+size_t LCD_VendorProgram::compile(
+    const esp_panel_lcd_vendor_init_cmd_t cmds[], size_t num, uint8_t *program, size_t size
+)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(cmds, 0, "Invalid commands");
+    ESP_UTILS_CHECK_NULL_RETURN(program, 0, "Invalid program");
+
+    return compileCommands(cmds, num, program, size);
+}
+
+bool LCD_VendorProgram::execute(const uint8_t *program, size_t size, const Handler &handler)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(program, false, "Invalid program");
+    ESP_UTILS_CHECK_FALSE_RETURN(handler != nullptr, false, "Invalid handler");
+
+    size_t pos = 0;
+    while (pos < size) {
+        ESP_UTILS_CHECK_FALSE_RETURN((size - pos) >= 2, false, "Truncated command header");
+        int cmd = program[pos];
+        size_t data_bytes = program[pos + 1];
+        pos += 2;
+
+        ESP_UTILS_CHECK_FALSE_RETURN((size - pos) >= data_bytes, false, "Truncated command data");
+        const uint8_t *data = program + pos;
+        pos += data_bytes;
+
+        ESP_UTILS_CHECK_FALSE_RETURN((size - pos) >= 1, false, "Truncated command delay");
+        uint32_t delay_ms = program[pos++];
+        if (delay_ms & DELAY_LONG_FLAG) {
+            ESP_UTILS_CHECK_FALSE_RETURN((size - pos) >= 1, false, "Truncated command delay");
+            delay_ms = ((delay_ms & ~DELAY_LONG_FLAG) << 8) | program[pos++];
+        }
+
+        if (!handler(cmd, data, data_bytes, delay_ms)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void LCD_VendorProgram::reportInvalid(size_t index, const char *reason)
+{
+    ESP_UTILS_LOGE("Invalid vendor command(%d): %s", static_cast<int>(index), reason);
+}
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,255 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include "port/esp_panel_lcd_vendor_types.h"
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Compact bytecode for LCD vendor initialization commands
+ *
+ * A command table (`esp_panel_lcd_vendor_init_cmd_t[]`) costs a 16-byte descriptor plus a separate data array per
+ * command. The program packs every command into a few bytes:
+ *
+ *   [command] [data_bytes] [data0 ... dataN] [delay_ms]
+ *
+ * The delay takes one byte if it is below `DELAY_LONG_FLAG`, otherwise two bytes (high byte first, with
+ * `DELAY_LONG_FLAG` set). Every command of the table is kept in order, including repeated commands and NOPs.
+ *
+ * Tables written with `ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM()` / `ESP_PANEL_LCD_PROGRAM_CMD_WITH_NONE_PARAM()`
+ * are compiled and validated at compile time, an invalid command (command > 0xFF, more than `DATA_BYTES_MAX` data
+ * bytes or a delay > `DELAY_MS_MAX`) fails the build:
+ *
+ * @code{.cpp}
+ * constexpr LCD_VendorProgram::Command cmds[] = {
+ *     ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0x3A, {0x55}),
+ *     ESP_PANEL_LCD_PROGRAM_CMD_WITH_NONE_PARAM(120, 0x11),
+ * };
+ * constexpr auto program = LCD_VendorProgram::compile<LCD_VendorProgram::getProgramSize(cmds)>(cmds);
+ * @endcode
+ *
+ * Existing tables can be compiled at runtime with `compile()`. A program is sent by `LCD::begin()` itself (see
+ * `LCD::configVendorCommandProgram()`), runs of commands without delay are streamed back-to-back and only the
+ * commands with a delay give up the CPU.
+ *
+ * @note Each command is still transmitted in its own bus transaction, since the command phase of the LCD protocols
+ *       (SPI/QSPI/I80/DCS) can't carry more than one command
+ */
+class LCD_VendorProgram {
+public:
+    static constexpr uint8_t DELAY_LONG_FLAG = 0x80;    /*!< Set in the first delay byte if the delay takes two bytes */
+    static constexpr size_t DATA_BYTES_MAX = 0xFF;      /*!< Maximum number of data bytes of a command */
+    static constexpr uint32_t DELAY_MS_MAX = 0x7FFF;    /*!< Maximum delay after a command */
+    static constexpr int COMMAND_MAX = 0xFF;            /*!< Maximum command value */
+    static constexpr int COMMAND_NOP = 0x00;            /*!< No-operation command */
+
+    /**
+     * @brief Command descriptor which can be evaluated at compile time
+     */
+    struct Command {
+        int cmd;                                /*!< The specific LCD command */
+        std::initializer_list<uint8_t> data;    /*!< Command specific data */
+        unsigned int delay_ms;                  /*!< Delay in milliseconds after this command */
+    };
+
+    /**
+     * @brief Handler called by `execute()` for each command of a program
+     *
+     * @param[in] cmd Command
+     * @param[in] data Command data, points into the program
+     * @param[in] data_bytes Number of data bytes
+     * @param[in] delay_ms Delay in milliseconds after the command
+     * @return `true` to continue, `false` to abort
+     */
+    using Handler = std::function<bool(int cmd, const uint8_t *data, size_t data_bytes, uint32_t delay_ms)>;
+
+    /**
+     * @brief Get the program size of a table, at compile time
+     *
+     * @param[in] cmds Command table
+     * @return Program size in bytes
+     */
+    template <size_t N>
+    static constexpr size_t getProgramSize(const Command (&cmds)[N])
+    {
+        return compileCommands(cmds, N, nullptr, 0);
+    }
+
+    /**
+     * @brief Compile a table into a program, at compile time
+     *
+     * @tparam Size Program size, should be `getProgramSize(cmds)`
+     * @param[in] cmds Command table
+     * @return Program
+     */
+    template <size_t Size, size_t N>
+    static constexpr std::array<uint8_t, Size> compile(const Command (&cmds)[N])
+    {
+        std::array<uint8_t, Size> program = {};
+        if (compileCommands(cmds, N, program.data(), Size) != Size) {
+            reportInvalid(N, "program size mismatch");
+        }
+        return program;
+    }
+
+    /**
+     * @brief Get the program size of a table
+     *
+     * @param[in] cmds Command table
+     * @param[in] num Number of commands
+     * @return Program size in bytes if successful, `0` if the table is invalid
+     */
+    static size_t getProgramSize(const esp_panel_lcd_vendor_init_cmd_t cmds[], size_t num);
+
+    /**
+     * @brief Compile a table into a program
+     *
+     * @param[in] cmds Command table
+     * @param[in] num Number of commands
+     * @param[out] program Program buffer
+     * @param[in] size Size of the program buffer, use `getProgramSize()` to get the required size
+     * @return Program size in bytes if successful, `0` if the table is invalid or the buffer is too small
+     */
+    static size_t compile(const esp_panel_lcd_vendor_init_cmd_t cmds[], size_t num, uint8_t *program, size_t size);
+
+    /**
+     * @brief Execute a program
+     *
+     * @param[in] program Program
+     * @param[in] size Program size in bytes
+     * @param[in] handler Handler called for each command
+     * @return `true` if successful, `false` if the program is malformed or the handler aborted
+     */
+    static bool execute(const uint8_t *program, size_t size, const Handler &handler);
+
+private:
+    static constexpr int getCommand(const Command &cmd)
+    {
+        return cmd.cmd;
+    }
+
+    static constexpr size_t getDataBytes(const Command &cmd)
+    {
+        return cmd.data.size();
+    }
+
+    static constexpr uint8_t getData(const Command &cmd, size_t index)
+    {
+        return cmd.data.begin()[index];
+    }
+
+    static constexpr uint32_t getDelay(const Command &cmd)
+    {
+        return cmd.delay_ms;
+    }
+
+    static int getCommand(const esp_panel_lcd_vendor_init_cmd_t &cmd)
+    {
+        return cmd.cmd;
+    }
+
+    static size_t getDataBytes(const esp_panel_lcd_vendor_init_cmd_t &cmd)
+    {
+        return cmd.data_bytes;
+    }
+
+    static uint8_t getData(const esp_panel_lcd_vendor_init_cmd_t &cmd, size_t index)
+    {
+        return static_cast<const uint8_t *>(cmd.data)[index];
+    }
+
+    static uint32_t getDelay(const esp_panel_lcd_vendor_init_cmd_t &cmd)
+    {
+        return cmd.delay_ms;
+    }
+
+    /**
+     * @brief Report an invalid command. It's not `constexpr` on purpose, reaching it at compile time fails the build
+     */
+    static void reportInvalid(size_t index, const char *reason);
+
+    /**
+     * @brief Compile commands, only measure the size if `program` is `nullptr`
+     */
+    template <typename T>
+    static constexpr size_t compileCommands(const T *cmds, size_t num, uint8_t *program, size_t size)
+    {
+        size_t pos = 0;
+        auto put = [&](uint8_t value) {
+            if ((program != nullptr) && (pos < size)) {
+                program[pos] = value;
+            }
+            pos++;
+        };
+
+        if (num == 0) {
+            reportInvalid(0, "empty table");
+            return 0;
+        }
+        for (size_t i = 0; i < num; i++) {
+            const T &cmd = cmds[i];
+            if ((getCommand(cmd) < 0) || (getCommand(cmd) > COMMAND_MAX)) {
+                reportInvalid(i, "command out of range");
+                return 0;
+            }
+            if (getDataBytes(cmd) > DATA_BYTES_MAX) {
+                reportInvalid(i, "too many data bytes");
+                return 0;
+            }
+            if (getDelay(cmd) > DELAY_MS_MAX) {
+                reportInvalid(i, "delay out of range");
+                return 0;
+            }
+
+            put(static_cast<uint8_t>(getCommand(cmd)));
+            put(static_cast<uint8_t>(getDataBytes(cmd)));
+            for (size_t j = 0; j < getDataBytes(cmd); j++) {
+                put(getData(cmd, j));
+            }
+            if (getDelay(cmd) < DELAY_LONG_FLAG) {
+                put(static_cast<uint8_t>(getDelay(cmd)));
+            } else {
+                put(static_cast<uint8_t>(DELAY_LONG_FLAG | (getDelay(cmd) >> 8)));
+                put(static_cast<uint8_t>(getDelay(cmd) & 0xFF));
+            }
+        }
+
+        if ((program != nullptr) && (pos > size)) {
+            reportInvalid(num, "program buffer too small");
+            return 0;
+        }
+
+        return pos;
+    }
+};
+
+} // namespace esp_panel::drivers
+
+/**
+ * @brief Formatter for a single compile-time LCD vendor command with 8-bit parameter, same usage as
+ *        `ESP_PANEL_LCD_CMD_WITH_8BIT_PARAM()`
+ *
+ * @param[in] delay_ms Delay in milliseconds after this command
+ * @param[in] command  LCD command
+ * @param ...      Array of 8-bit command parameters, should be like `{data0, data1, data2, ...}`
+ */
+#define ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(delay_ms, command, ...) {command, __VA_ARGS__, delay_ms}
+
+/**
+ * @brief Formatter for a single compile-time LCD vendor command with no parameter, same usage as
+ *        `ESP_PANEL_LCD_CMD_WITH_NONE_PARAM()`
+ *
+ * @param[in] delay_ms Delay in milliseconds after this command
+ * @param[in] command  LCD command
+ */
+#define ESP_PANEL_LCD_PROGRAM_CMD_WITH_NONE_PARAM(delay_ms, command) {command, {}, delay_ms}
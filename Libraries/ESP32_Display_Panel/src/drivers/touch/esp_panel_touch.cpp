@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include "esp_timer.h"
 #include "utils/esp_panel_utils_log.h"
 #include "esp_panel_touch.hpp"
 
@@ -199,6 +200,10 @@ bool Touch::del()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
+    if (isPipelineRunning()) {
+        ESP_UTILS_CHECK_FALSE_RETURN(stopPipeline(), false, "Stop pipeline failed");
+    }
+
     if (touch_panel != nullptr) {
         ESP_UTILS_CHECK_ERROR_RETURN(
             esp_lcd_touch_del(touch_panel), false, "Delete touch panel(@%p) failed", touch_panel
@@ -211,6 +216,7 @@ bool Touch::del()
     _points.clear();
     _buttons.clear();
     _interruption = nullptr;
+    _scheduler_client.reset();
 
     setState(State::DEINIT);
 
@@ -298,8 +304,14 @@ bool Touch::readRawData(int points_num, int buttons_num, int timeout_ms)
         }
     }
 
-    // Read the raw data
-    ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_touch_read_data(touch_panel), false, "Read data failed");
+    // Read the raw data, through the transaction scheduler of the I2C host if it is started
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        _scheduler_client.execute(
+            getI2C_Scheduler(), getBasicAttributes().name, HostI2C_Scheduler::Priority::REALTIME, [this]() {
+                return esp_lcd_touch_read_data(touch_panel);
+            }
+        ), false, "Read data failed"
+    );
 
     // Get the points
     ESP_UTILS_CHECK_FALSE_RETURN(readRawDataPoints(points_num), false, "Read points failed");
@@ -524,6 +536,73 @@ int Touch::readButtonState(uint8_t index, int timeout_ms)
     return ret_state;
 }
 
+bool Touch::startPipeline(const TouchPipeline::Config &config)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+    ESP_UTILS_CHECK_FALSE_RETURN(isInterruptEnabled(), false, "Interruption is not enabled");
+    ESP_UTILS_CHECK_FALSE_RETURN(isPointsEnabled(), false, "Points are not supported");
+    ESP_UTILS_CHECK_FALSE_RETURN(!isPipelineRunning(), false, "Pipeline is already running");
+
+    auto pipeline_config = config;
+    auto &device_config = getDeviceFullConfig();
+    bool swap_xy = _transformation.swap_xy;
+    if (pipeline_config.x_max < 0) {
+        pipeline_config.x_max = swap_xy ? device_config.y_max : device_config.x_max;
+    }
+    if (pipeline_config.y_max < 0) {
+        pipeline_config.y_max = swap_xy ? device_config.x_max : device_config.y_max;
+    }
+
+    std::shared_ptr<TouchPipeline> pipeline = nullptr;
+    ESP_UTILS_CHECK_EXCEPTION_RETURN(
+        pipeline = utils::make_shared<TouchPipeline>(pipeline_config), false, "Create pipeline failed"
+    );
+    _pipeline_stop = false;
+
+    // Drop the stale interruption, the first sample should come from a new edge
+    xSemaphoreTake(_interruption->on_active_sem, 0);
+
+    ESP_UTILS_CHECK_EXCEPTION_RETURN(
+        _pipeline_thread = std::thread(&Touch::runPipeline, this, pipeline), false, "Create pipeline thread failed"
+    );
+    _pipeline = pipeline;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Touch::stopPipeline()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    _pipeline_stop = true;
+    if (_pipeline_thread.joinable()) {
+        _pipeline_thread.join();
+    }
+    _pipeline = nullptr;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+int Touch::readPipelinePoints(TouchPoint points[], int num)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(isPipelineRunning(), -1, "Pipeline is not running");
+    ESP_UTILS_CHECK_FALSE_RETURN((num == 0) || (points != nullptr), -1, "Invalid points or num");
+
+    TouchPipeline::Sample sample;
+    if ((num == 0) || !_pipeline->read(esp_timer_get_time(), sample)) {
+        return 0;
+    }
+    points[0] = TouchPoint(sample.x, sample.y, sample.strength);
+
+    return 1;
+}
+
 bool Touch::isInterruptEnabled() const
 {
     if (std::holds_alternative<DeviceFullConfig>(_config.device)) {
@@ -546,6 +625,15 @@ Touch::DeviceFullConfig &Touch::getDeviceFullConfig()
     return std::get<DeviceFullConfig>(_config.device);
 }
 
+std::shared_ptr<HostI2C_Scheduler> Touch::getI2C_Scheduler()
+{
+    if ((_bus == nullptr) || (_bus->getBasicAttributes().type != ESP_PANEL_BUS_TYPE_I2C)) {
+        return nullptr;
+    }
+
+    return static_cast<BusI2C *>(_bus.get())->getScheduler();
+}
+
 bool Touch::readRawDataPoints(int points_num)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -655,6 +743,36 @@ bool Touch::readRawDataButtons(int buttons_num)
     return true;
 }
 
+void Touch::runPipeline(std::shared_ptr<TouchPipeline> pipeline)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    TouchPoint point;
+    while (!_pipeline_stop) {
+        // Only talk to the controller when it signals new data, check the stop flag periodically
+        if (xSemaphoreTake(_interruption->on_active_sem, pdMS_TO_TICKS(THREAD_CHECK_STOP_INTERVAL_MS)) != pdTRUE) {
+            continue;
+        }
+
+        TouchPipeline::Sample sample = {
+            .timestamp_us = _interruption->active_time_us,
+        };
+        if (!readRawData(1, 0, 0)) {
+            ESP_UTILS_LOGE("Read raw data failed");
+            continue;
+        }
+        if (getPoints(&point, 1) > 0) {
+            sample.x = point.x;
+            sample.y = point.y;
+            sample.strength = point.strength;
+            sample.pressed = true;
+        }
+        pipeline->push(sample);
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
 void Touch::onInterruptActive(PanelHandle panel)
 {
     if ((panel == nullptr) || (panel->config.user_data == nullptr)) {
@@ -671,6 +789,8 @@ void Touch::onInterruptActive(PanelHandle panel)
         return;
     }
 
+    interruption->active_time_us = esp_timer_get_time();
+
     BaseType_t need_yield = pdFALSE;
     if (interruption->on_active_callback != nullptr) {
         need_yield = interruption->on_active_callback(interruption->data.user_data) ? pdTRUE : need_yield;
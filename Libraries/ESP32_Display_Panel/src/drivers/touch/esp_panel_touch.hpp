@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <thread>
 #include <variant>
 #include <vector>
@@ -17,6 +18,7 @@
 #include "drivers/bus/esp_panel_bus_factory.hpp"
 #include "port/esp_lcd_touch.h"
 #include "esp_panel_touch_conf_internal.h"
+#include "esp_panel_touch_pipeline.hpp"
 
 namespace esp_panel::drivers {
 
@@ -466,6 +468,64 @@ public:
      */
     int readButtonState(uint8_t index, int timeout_ms);
 
+    /**
+     * @brief Start the interrupt-driven touch pipeline
+     *
+     * A background thread reads the touch controller only when the interrupt pin is triggered and pushes
+     * timestamped samples into the pipeline. `readPipelinePoints()` then returns the coalesced state without any bus
+     * transaction, so reading while nothing is touched is free.
+     *
+     * @param[in] config Pipeline configuration, the clamping range defaults to the touch resolution
+     * @return `true` if successful, `false` otherwise
+     *
+     * @note This function should be called after `begin()` and requires the interrupt pin
+     * @note While the pipeline is running, don't use `readRawData()` and `readPoints()` with a non-zero timeout
+     */
+    bool startPipeline(const TouchPipeline::Config &config);
+    bool startPipeline()
+    {
+        return startPipeline(TouchPipeline::Config{});
+    }
+
+    /**
+     * @brief Stop the interrupt-driven touch pipeline and release its resources
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool stopPipeline();
+
+    /**
+     * @brief Read the coalesced touch point from the pipeline
+     *
+     * @param[out] points Buffer to store touch points
+     * @param[in] num Maximum number of points to store
+     * @return Number of points read (0 or 1) if successful, -1 on failure
+     *
+     * @note This function should be called after `startPipeline()`
+     * @note Only the first point is tracked by the pipeline
+     */
+    int readPipelinePoints(TouchPoint points[], int num);
+
+    /**
+     * @brief Check if the touch pipeline is running
+     *
+     * @return `true` if running, `false` otherwise
+     */
+    bool isPipelineRunning() const
+    {
+        return (_pipeline != nullptr);
+    }
+
+    /**
+     * @brief Get the touch pipeline
+     *
+     * @return Pointer to the pipeline, nullptr if not running
+     */
+    TouchPipeline *getPipeline()
+    {
+        return _pipeline.get();
+    }
+
     /**
      * @brief Reset touch points data
      */
@@ -698,14 +758,17 @@ private:
         };
 
         CallbackData data = {};                                 /*!< Callback data */
+        std::atomic<int64_t> active_time_us = 0;                /*!< Timestamp of the last interrupt */
         FunctionInterruptCallback on_active_callback = nullptr; /*!< Interrupt callback function */
         SemaphoreHandle_t on_active_sem = nullptr;              /*!< Semaphore for interrupt sync */
         StaticSemaphore_t on_active_sem_buffer = {};            /*!< Static buffer for semaphore */
     };
 
     DeviceFullConfig &getDeviceFullConfig();
+    std::shared_ptr<HostI2C_Scheduler> getI2C_Scheduler();
     bool readRawDataPoints(int points_num);
     bool readRawDataButtons(int max_buttons_num);
+    void runPipeline(std::shared_ptr<TouchPipeline> pipeline);
     static void onInterruptActive(PanelHandle handle);
 
     BasicAttributes _basic_attributes = {};                 /*!< Basic device attributes */
@@ -718,6 +781,10 @@ private:
     utils::vector<TouchPoint> _points;                      /*!< Touch points buffer */
     utils::vector<TouchButton> _buttons;                    /*!< Touch buttons buffer */
     std::shared_ptr<Interruption> _interruption = nullptr;  /*!< Interrupt handling */
+    std::shared_ptr<TouchPipeline> _pipeline = nullptr;     /*!< Interrupt-driven sample pipeline */
+    std::thread _pipeline_thread;                           /*!< Thread reading samples into the pipeline */
+    std::atomic<bool> _pipeline_stop = false;               /*!< Request the pipeline thread to exit */
+    HostI2C_Scheduler::Client _scheduler_client;            /*!< Registration to the I2C host scheduler */
 };
 
 } // namespace esp_panel::drivers
@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "utils/esp_panel_utils_log.h"
+#include "esp_panel_touch_pipeline.hpp"
+
+namespace esp_panel::drivers {
+
+void TouchPipeline::Statistics::print() const
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_LOGI(
+        "\n\t{Touch pipeline statistics}"
+        "\n\t\t-> [pushed]: %d"
+        "\n\t\t-> [overwritten]: %d"
+        "\n\t\t-> [coalesced]: %d"
+        "\n\t\t-> [reads]: %d"
+        "\n\t\t-> [idle_reads]: %d"
+        "\n\t\t-> [predicted]: %d"
+        , static_cast<int>(pushed)
+        , static_cast<int>(overwritten)
+        , static_cast<int>(coalesced)
+        , static_cast<int>(reads)
+        , static_cast<int>(idle_reads)
+        , static_cast<int>(predicted)
+    );
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+TouchPipeline::TouchPipeline(const Config &config):
+    _config(config)
+{
+    if (_config.ring_size < 2) {
+        ESP_UTILS_LOGW("Ring size(%d) is too small, use 2 instead", _config.ring_size);
+        _config.ring_size = 2;
+    }
+    _ring.resize(_config.ring_size);
+}
+
+void TouchPipeline::push(const Sample &sample)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _ring[_head] = sample;
+    _head = (_head + 1) % _config.ring_size;
+    if (_count < _config.ring_size) {
+        _count++;
+    }
+    if (_unread < _config.ring_size) {
+        _unread++;
+    } else {
+        _statistics.overwritten++;
+    }
+    _statistics.pushed++;
+}
+
+bool TouchPipeline::read(int64_t now_us, Sample &sample)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _statistics.reads++;
+    sample.timestamp_us = now_us;
+    sample.pressed = false;
+
+    // A tap was reported as pressed on the previous read, now report its release
+    if (_pending_release) {
+        _pending_release = false;
+        _reported_pressed = false;
+        return false;
+    }
+
+    if (_unread == 0) {
+        _statistics.idle_reads++;
+    } else {
+        _statistics.coalesced += _unread - 1;
+
+        // Find the newest pressed sample among the unread ones
+        const Sample *batch_pressed = nullptr;
+        for (int i = _count - _unread; i < _count; i++) {
+            if (at(i).pressed) {
+                batch_pressed = &at(i);
+            }
+        }
+        const Sample &newest = at(_count - 1);
+        _unread = 0;
+
+        if (newest.pressed) {
+            _last_pressed = newest;
+            _reported_pressed = true;
+        } else if (!_reported_pressed && (batch_pressed != nullptr)) {
+            // Pressed and released between two reads, don't lose the tap
+            _last_pressed = *batch_pressed;
+            _pending_release = true;
+            sample = _last_pressed;
+            return true;
+        } else {
+            _reported_pressed = false;
+        }
+    }
+
+    if (!_reported_pressed) {
+        return false;
+    }
+
+    // Recover from a missed release edge
+    if ((_config.release_timeout_us > 0) && ((now_us - _last_pressed.timestamp_us) > _config.release_timeout_us)) {
+        _reported_pressed = false;
+        return false;
+    }
+
+    sample = _last_pressed;
+    if (_config.enable_prediction && predict(now_us, sample)) {
+        _statistics.predicted++;
+    }
+
+    return true;
+}
+
+void TouchPipeline::reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _head = 0;
+    _count = 0;
+    _unread = 0;
+    _reported_pressed = false;
+    _pending_release = false;
+    _last_pressed = {};
+}
+
+TouchPipeline::Statistics TouchPipeline::getStatistics()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return _statistics;
+}
+
+const TouchPipeline::Sample &TouchPipeline::at(int index_from_oldest) const
+{
+    int index = _head - _count + index_from_oldest;
+    if (index < 0) {
+        index += _config.ring_size;
+    }
+
+    return _ring[index];
+}
+
+bool TouchPipeline::estimateVelocity(float &vx, float &vy) const
+{
+    if (_count < 2) {
+        return false;
+    }
+
+    const Sample &newest = at(_count - 1);
+    if (!newest.pressed) {
+        return false;
+    }
+
+    // Walk back through the continuous press inside the velocity window
+    const Sample *oldest = nullptr;
+    for (int i = _count - 2; i >= 0; i--) {
+        const Sample &s = at(i);
+        if (!s.pressed || ((newest.timestamp_us - s.timestamp_us) > _config.velocity_window_us)) {
+            break;
+        }
+        oldest = &s;
+    }
+    if ((oldest == nullptr) || (newest.timestamp_us <= oldest->timestamp_us)) {
+        return false;
+    }
+
+    float dt = static_cast<float>(newest.timestamp_us - oldest->timestamp_us);
+    vx = static_cast<float>(newest.x - oldest->x) / dt;
+    vy = static_cast<float>(newest.y - oldest->y) / dt;
+
+    return true;
+}
+
+bool TouchPipeline::predict(int64_t now_us, Sample &sample) const
+{
+    float vx = 0;
+    float vy = 0;
+    if (!estimateVelocity(vx, vy)) {
+        return false;
+    }
+
+    float horizon = static_cast<float>(now_us - sample.timestamp_us + _config.prediction_us);
+    float dx = vx * horizon;
+    float dy = vy * horizon;
+    float distance = std::sqrt(dx * dx + dy * dy);
+    if ((distance > _config.prediction_max_px) && (distance > 0)) {
+        float scale = static_cast<float>(_config.prediction_max_px) / distance;
+        dx *= scale;
+        dy *= scale;
+    }
+
+    int x = sample.x + static_cast<int>(std::lround(dx));
+    int y = sample.y + static_cast<int>(std::lround(dy));
+    if (_config.x_max > 0) {
+        x = std::clamp(x, 0, _config.x_max - 1);
+    }
+    if (_config.y_max > 0) {
+        y = std::clamp(y, 0, _config.y_max - 1);
+    }
+    sample.x = x;
+    sample.y = y;
+
+    return true;
+}
+
+} // namespace esp_panel::drivers
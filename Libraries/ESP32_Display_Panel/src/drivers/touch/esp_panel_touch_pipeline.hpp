@@ -0,0 +1,139 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include "utils/esp_panel_utils_cxx.hpp"
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Interrupt-driven touch sample pipeline
+ *
+ * Samples are pushed by the reader (typically a task woken by the INT edge of the touch controller) into a
+ * timestamped ring buffer. The consumer (typically the LVGL indev `read_cb`) pulls a single coalesced state which
+ * costs no bus transaction. Optionally, the reported position is extrapolated from the recent velocity to hide the
+ * bus and frame latency during drags.
+ *
+ * @note This class does not depend on any hardware, all timestamps are provided by the caller, so it can be driven
+ *       by recorded traces
+ */
+class TouchPipeline {
+public:
+    /**
+     * @brief Single timestamped touch sample
+     */
+    struct Sample {
+        int64_t timestamp_us = 0;   /*!< Timestamp of the sample in microseconds */
+        int x = -1;                 /*!< X coordinate, only valid when `pressed` is `true` */
+        int y = -1;                 /*!< Y coordinate, only valid when `pressed` is `true` */
+        int strength = -1;          /*!< Strength of the point, only valid when `pressed` is `true` */
+        bool pressed = false;       /*!< `true` if a point is reported, `false` if released */
+    };
+
+    /**
+     * @brief Configuration of the pipeline
+     */
+    struct Config {
+        int ring_size = 16;                 /*!< Number of samples held in the ring buffer */
+        int release_timeout_us = 60000;     /*!< Report released if no sample arrives within this time, to recover
+                                             *   from a missed release edge. Set to `0` to disable */
+        bool enable_prediction = false;     /*!< Enable velocity-based position prediction */
+        int prediction_us = 16000;          /*!< How far ahead of the newest sample to extrapolate */
+        int velocity_window_us = 40000;     /*!< Time window used to estimate the velocity */
+        int prediction_max_px = 24;         /*!< Maximum distance of the predicted point from the newest sample */
+        int x_max = -1;                     /*!< Clamp predicted X to `[0, x_max - 1]`, `-1` to disable */
+        int y_max = -1;                     /*!< Clamp predicted Y to `[0, y_max - 1]`, `-1` to disable */
+    };
+
+    /**
+     * @brief Runtime statistics of the pipeline
+     */
+    struct Statistics {
+        /**
+         * @brief Print information for debugging
+         */
+        void print() const;
+
+        uint32_t pushed = 0;        /*!< Number of samples pushed */
+        uint32_t overwritten = 0;   /*!< Number of samples overwritten before being read */
+        uint32_t coalesced = 0;     /*!< Number of samples merged into a later read */
+        uint32_t reads = 0;         /*!< Number of reads */
+        uint32_t idle_reads = 0;    /*!< Number of reads that found no new sample */
+        uint32_t predicted = 0;     /*!< Number of reads that returned a predicted point */
+    };
+
+    /**
+     * @brief Construct a pipeline
+     *
+     * @param[in] config Pipeline configuration
+     */
+    explicit TouchPipeline(const Config &config);
+    TouchPipeline(): TouchPipeline(Config{}) {}
+
+    /**
+     * @brief Push a new sample into the ring buffer
+     *
+     * @param[in] sample Sample to push, timestamps are expected to be monotonic
+     *
+     * @note The oldest sample is overwritten if the ring buffer is full
+     */
+    void push(const Sample &sample);
+
+    /**
+     * @brief Read the coalesced touch state at the given time
+     *
+     * All samples pushed since the last read are merged into a single state. A short tap that was both pressed and
+     * released between two reads is reported as pressed once, and the release is reported on the next read.
+     *
+     * @param[in]  now_us Current time in microseconds
+     * @param[out] sample Coalesced (and optionally predicted) sample, coordinates are only updated if pressed
+     * @return `true` if pressed, `false` if released
+     */
+    bool read(int64_t now_us, Sample &sample);
+
+    /**
+     * @brief Drop all samples and reset the reported state
+     */
+    void reset();
+
+    /**
+     * @brief Get the pipeline configuration
+     *
+     * @return Reference to the configuration
+     */
+    const Config &getConfig() const
+    {
+        return _config;
+    }
+
+    /**
+     * @brief Get a copy of the runtime statistics
+     *
+     * @return Statistics
+     */
+    Statistics getStatistics();
+
+private:
+    const Sample &at(int index_from_oldest) const;
+    bool estimateVelocity(float &vx, float &vy) const;
+    bool predict(int64_t now_us, Sample &sample) const;
+
+    Config _config = {};
+    std::mutex _mutex;
+    utils::vector<Sample> _ring;
+    int _head = 0;                      // Index of the next slot to write
+    int _count = 0;                     // Number of valid samples in the ring
+    int _unread = 0;                    // Number of samples pushed since the last read
+    bool _reported_pressed = false;
+    bool _pending_release = false;
+    Sample _last_pressed = {};
+    Statistics _statistics = {};
+};
+
+} // namespace esp_panel::drivers
@@ -26,6 +26,16 @@ using namespace esp_panel::board;
 #ifdef ESP_PANEL_BOARD_LCD_VENDOR_INIT_CMD
 static const esp_panel_lcd_vendor_init_cmd_t lcd_vendor_init_cmds[] = ESP_PANEL_BOARD_LCD_VENDOR_INIT_CMD();
 #endif // ESP_PANEL_BOARD_LCD_VENDOR_INIT_CMD
+#ifdef ESP_PANEL_BOARD_LCD_VENDOR_INIT_PROGRAM
+#ifdef ESP_PANEL_BOARD_LCD_VENDOR_INIT_CMD
+#error "`ESP_PANEL_BOARD_LCD_VENDOR_INIT_CMD` and `ESP_PANEL_BOARD_LCD_VENDOR_INIT_PROGRAM` can't be both defined"
+#endif
+static constexpr LCD_VendorProgram::Command lcd_vendor_init_program_cmds[] = ESP_PANEL_BOARD_LCD_VENDOR_INIT_PROGRAM();
+static constexpr auto lcd_vendor_init_program =
+    LCD_VendorProgram::compile<LCD_VendorProgram::getProgramSize(lcd_vendor_init_program_cmds)>(
+        lcd_vendor_init_program_cmds
+    );
+#endif // ESP_PANEL_BOARD_LCD_VENDOR_INIT_PROGRAM
 
 const BoardConfig BOARD_ESPRESSIF_ESP32_S3_BOX_3_CONFIG = {
 
@@ -186,6 +196,10 @@ const BoardConfig BOARD_ESPRESSIF_ESP32_S3_BOX_3_CONFIG = {
     #endif // ESP_PANEL_BOARD_LCD_FLAGS_ENABLE_IO_MULTIPLEX
             },
         },
+    #ifdef ESP_PANEL_BOARD_LCD_VENDOR_INIT_PROGRAM
+        .vendor_program = lcd_vendor_init_program.data(),
+        .vendor_program_size = lcd_vendor_init_program.size(),
+    #endif // ESP_PANEL_BOARD_LCD_VENDOR_INIT_PROGRAM
         .pre_process = {
             .invert_color = ESP_PANEL_BOARD_LCD_COLOR_INEVRT_BIT,
     #ifdef ESP_PANEL_BOARD_LCD_SWAP_XY
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+/**
+ * Undefine the macros of the supported board headers, so that another board header can be included in the same file.
+ * No include guard on purpose, this file is included once after each board header.
+ */
+
+// *INDENT-OFF*
+
+#undef ESP_PANEL_BOARD_BACKLIGHT_CUSTOM_FUNCTION
+#undef ESP_PANEL_BOARD_BACKLIGHT_CUSTOM_LEVEL_MAX
+#undef ESP_PANEL_BOARD_BACKLIGHT_IDLE_OFF
+#undef ESP_PANEL_BOARD_BACKLIGHT_IO
+#undef ESP_PANEL_BOARD_BACKLIGHT_ON_LEVEL
+#undef ESP_PANEL_BOARD_BACKLIGHT_POST_BEGIN_FUNCTION
+#undef ESP_PANEL_BOARD_BACKLIGHT_PRE_BEGIN_FUNCTION
+#undef ESP_PANEL_BOARD_BACKLIGHT_TYPE
+#undef ESP_PANEL_BOARD_CUSTOM_FILE_VERSION_MAJOR
+#undef ESP_PANEL_BOARD_CUSTOM_FILE_VERSION_MINOR
+#undef ESP_PANEL_BOARD_CUSTOM_FILE_VERSION_PATCH
+#undef ESP_PANEL_BOARD_EXPANDER_CHIP
+#undef ESP_PANEL_BOARD_EXPANDER_I2C_ADDRESS
+#undef ESP_PANEL_BOARD_EXPANDER_I2C_CLK_HZ
+#undef ESP_PANEL_BOARD_EXPANDER_I2C_HOST_ID
+#undef ESP_PANEL_BOARD_EXPANDER_I2C_IO_SCL
+#undef ESP_PANEL_BOARD_EXPANDER_I2C_IO_SDA
+#undef ESP_PANEL_BOARD_EXPANDER_I2C_SCL_PULLUP
+#undef ESP_PANEL_BOARD_EXPANDER_I2C_SDA_PULLUP
+#undef ESP_PANEL_BOARD_EXPANDER_POST_BEGIN_FUNCTION
+#undef ESP_PANEL_BOARD_EXPANDER_PRE_BEGIN_FUNCTION
+#undef ESP_PANEL_BOARD_EXPANDER_SKIP_INIT_HOST
+#undef ESP_PANEL_BOARD_HEIGHT
+#undef ESP_PANEL_BOARD_LCD_BUS_SKIP_INIT_HOST
+#undef ESP_PANEL_BOARD_LCD_BUS_TYPE
+#undef ESP_PANEL_BOARD_LCD_COLOR_BGR_ORDER
+#undef ESP_PANEL_BOARD_LCD_COLOR_BITS
+#undef ESP_PANEL_BOARD_LCD_COLOR_INEVRT_BIT
+#undef ESP_PANEL_BOARD_LCD_CONTROLLER
+#undef ESP_PANEL_BOARD_LCD_FLAGS_ENABLE_IO_MULTIPLEX
+#undef ESP_PANEL_BOARD_LCD_FLAGS_MIRROR_BY_CMD
+#undef ESP_PANEL_BOARD_LCD_GAP_X
+#undef ESP_PANEL_BOARD_LCD_GAP_Y
+#undef ESP_PANEL_BOARD_LCD_MIPI_DPI_CLK_MHZ
+#undef ESP_PANEL_BOARD_LCD_MIPI_DPI_HBP
+#undef ESP_PANEL_BOARD_LCD_MIPI_DPI_HFP
+#undef ESP_PANEL_BOARD_LCD_MIPI_DPI_HPW
+#undef ESP_PANEL_BOARD_LCD_MIPI_DPI_PIXEL_BITS
+#undef ESP_PANEL_BOARD_LCD_MIPI_DPI_VBP
+#undef ESP_PANEL_BOARD_LCD_MIPI_DPI_VFP
+#undef ESP_PANEL_BOARD_LCD_MIPI_DPI_VPW
+#undef ESP_PANEL_BOARD_LCD_MIPI_DSI_LANE_NUM
+#undef ESP_PANEL_BOARD_LCD_MIPI_DSI_LANE_RATE_MBPS
+#undef ESP_PANEL_BOARD_LCD_MIPI_PHY_LDO_ID
+#undef ESP_PANEL_BOARD_LCD_MIRROR_X
+#undef ESP_PANEL_BOARD_LCD_MIRROR_Y
+#undef ESP_PANEL_BOARD_LCD_POST_BEGIN_FUNCTION
+#undef ESP_PANEL_BOARD_LCD_PRE_BEGIN_FUNCTION
+#undef ESP_PANEL_BOARD_LCD_QSPI_CLK_HZ
+#undef ESP_PANEL_BOARD_LCD_QSPI_CMD_BITS
+#undef ESP_PANEL_BOARD_LCD_QSPI_HOST_ID
+#undef ESP_PANEL_BOARD_LCD_QSPI_IO_CS
+#undef ESP_PANEL_BOARD_LCD_QSPI_IO_DATA0
+#undef ESP_PANEL_BOARD_LCD_QSPI_IO_DATA1
+#undef ESP_PANEL_BOARD_LCD_QSPI_IO_DATA2
+#undef ESP_PANEL_BOARD_LCD_QSPI_IO_DATA3
+#undef ESP_PANEL_BOARD_LCD_QSPI_IO_SCK
+#undef ESP_PANEL_BOARD_LCD_QSPI_MODE
+#undef ESP_PANEL_BOARD_LCD_QSPI_PARAM_BITS
+#undef ESP_PANEL_BOARD_LCD_RGB_BOUNCE_BUF_SIZE
+#undef ESP_PANEL_BOARD_LCD_RGB_CLK_HZ
+#undef ESP_PANEL_BOARD_LCD_RGB_DATA_WIDTH
+#undef ESP_PANEL_BOARD_LCD_RGB_HBP
+#undef ESP_PANEL_BOARD_LCD_RGB_HFP
+#undef ESP_PANEL_BOARD_LCD_RGB_HPW
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA0
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA1
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA10
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA11
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA12
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA13
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA14
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA15
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA2
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA3
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA4
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA5
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA6
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA7
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA8
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DATA9
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DE
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_DISP
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_HSYNC
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_PCLK
+#undef ESP_PANEL_BOARD_LCD_RGB_IO_VSYNC
+#undef ESP_PANEL_BOARD_LCD_RGB_PCLK_ACTIVE_NEG
+#undef ESP_PANEL_BOARD_LCD_RGB_PIXEL_BITS
+#undef ESP_PANEL_BOARD_LCD_RGB_SPI_CMD_BYTES
+#undef ESP_PANEL_BOARD_LCD_RGB_SPI_CS_USE_EXPNADER
+#undef ESP_PANEL_BOARD_LCD_RGB_SPI_IO_CS
+#undef ESP_PANEL_BOARD_LCD_RGB_SPI_IO_SCK
+#undef ESP_PANEL_BOARD_LCD_RGB_SPI_IO_SDA
+#undef ESP_PANEL_BOARD_LCD_RGB_SPI_MODE
+#undef ESP_PANEL_BOARD_LCD_RGB_SPI_PARAM_BYTES
+#undef ESP_PANEL_BOARD_LCD_RGB_SPI_SCL_USE_EXPNADER
+#undef ESP_PANEL_BOARD_LCD_RGB_SPI_SDA_USE_EXPNADER
+#undef ESP_PANEL_BOARD_LCD_RGB_SPI_USE_DC_BIT
+#undef ESP_PANEL_BOARD_LCD_RGB_USE_CONTROL_PANEL
+#undef ESP_PANEL_BOARD_LCD_RGB_VBP
+#undef ESP_PANEL_BOARD_LCD_RGB_VFP
+#undef ESP_PANEL_BOARD_LCD_RGB_VPW
+#undef ESP_PANEL_BOARD_LCD_RST_IO
+#undef ESP_PANEL_BOARD_LCD_RST_LEVEL
+#undef ESP_PANEL_BOARD_LCD_SPI_CLK_HZ
+#undef ESP_PANEL_BOARD_LCD_SPI_CMD_BITS
+#undef ESP_PANEL_BOARD_LCD_SPI_HOST_ID
+#undef ESP_PANEL_BOARD_LCD_SPI_IO_CS
+#undef ESP_PANEL_BOARD_LCD_SPI_IO_DC
+#undef ESP_PANEL_BOARD_LCD_SPI_IO_MISO
+#undef ESP_PANEL_BOARD_LCD_SPI_IO_MOSI
+#undef ESP_PANEL_BOARD_LCD_SPI_IO_SCK
+#undef ESP_PANEL_BOARD_LCD_SPI_MODE
+#undef ESP_PANEL_BOARD_LCD_SPI_PARAM_BITS
+#undef ESP_PANEL_BOARD_LCD_SWAP_XY
+#undef ESP_PANEL_BOARD_LCD_VENDOR_INIT_CMD
+#undef ESP_PANEL_BOARD_LCD_VENDOR_INIT_PROGRAM
+#undef ESP_PANEL_BOARD_NAME
+#undef ESP_PANEL_BOARD_POST_BEGIN_FUNCTION
+#undef ESP_PANEL_BOARD_POST_DEL_FUNCTION
+#undef ESP_PANEL_BOARD_PRE_BEGIN_FUNCTION
+#undef ESP_PANEL_BOARD_PRE_DEL_FUNCTION
+#undef ESP_PANEL_BOARD_TOUCH_BUS_SKIP_INIT_HOST
+#undef ESP_PANEL_BOARD_TOUCH_BUS_TYPE
+#undef ESP_PANEL_BOARD_TOUCH_CONTROLLER
+#undef ESP_PANEL_BOARD_TOUCH_I2C_ADDRESS
+#undef ESP_PANEL_BOARD_TOUCH_I2C_CLK_HZ
+#undef ESP_PANEL_BOARD_TOUCH_I2C_HOST_ID
+#undef ESP_PANEL_BOARD_TOUCH_I2C_IO_SCL
+#undef ESP_PANEL_BOARD_TOUCH_I2C_IO_SDA
+#undef ESP_PANEL_BOARD_TOUCH_I2C_SCL_PULLUP
+#undef ESP_PANEL_BOARD_TOUCH_I2C_SDA_PULLUP
+#undef ESP_PANEL_BOARD_TOUCH_INT_IO
+#undef ESP_PANEL_BOARD_TOUCH_INT_LEVEL
+#undef ESP_PANEL_BOARD_TOUCH_MIRROR_X
+#undef ESP_PANEL_BOARD_TOUCH_MIRROR_Y
+#undef ESP_PANEL_BOARD_TOUCH_POST_BEGIN_FUNCTION
+#undef ESP_PANEL_BOARD_TOUCH_PRE_BEGIN_FUNCTION
+#undef ESP_PANEL_BOARD_TOUCH_RST_IO
+#undef ESP_PANEL_BOARD_TOUCH_RST_LEVEL
+#undef ESP_PANEL_BOARD_TOUCH_SWAP_XY
+#undef ESP_PANEL_BOARD_USE_BACKLIGHT
+#undef ESP_PANEL_BOARD_USE_EXPANDER
+#undef ESP_PANEL_BOARD_USE_LCD
+#undef ESP_PANEL_BOARD_USE_TOUCH
+#undef ESP_PANEL_BOARD_WIDTH
+
+// *INDENT-ON*
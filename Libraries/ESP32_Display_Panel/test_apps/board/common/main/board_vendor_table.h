@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+/**
+ * Define `<TEST_BOARD>_table` from the vendor commands of the board header included just before, then remove the
+ * macros of the board. `TEST_BOARD` should be defined to the board name, without the `BOARD_` prefix.
+ * No include guard on purpose, this file is included once after each board header.
+ */
+
+// *INDENT-OFF*
+
+#ifndef TEST_BOARD
+#error "`TEST_BOARD` should be defined before including this file"
+#endif
+#ifndef ESP_PANEL_BOARD_NAME
+#error "A board header should be included before this file"
+#endif
+
+#define TEST_BOARD_CONCAT_(a, b) a ## b
+#define TEST_BOARD_CONCAT(a, b) TEST_BOARD_CONCAT_(a, b)
+#define TEST_BOARD_STR_(name) #name
+#define TEST_BOARD_STR(name) TEST_BOARD_STR_(name)
+
+#ifdef ESP_PANEL_BOARD_LCD_BUS_TYPE
+#define TEST_BOARD_BUS_TYPE ESP_PANEL_BOARD_LCD_BUS_TYPE
+#else
+#define TEST_BOARD_BUS_TYPE (-1)
+#endif
+
+#if defined(ESP_PANEL_BOARD_LCD_VENDOR_INIT_CMD)
+static const esp_panel_lcd_vendor_init_cmd_t TEST_BOARD_CONCAT(TEST_BOARD, _cmds)[] =
+    ESP_PANEL_BOARD_LCD_VENDOR_INIT_CMD();
+static const BoardVendorTable TEST_BOARD_CONCAT(TEST_BOARD, _table) = {
+    TEST_BOARD_STR(TEST_BOARD), TEST_BOARD_BUS_TYPE, TEST_BOARD_CONCAT(TEST_BOARD, _cmds),
+    sizeof(TEST_BOARD_CONCAT(TEST_BOARD, _cmds)) / sizeof(TEST_BOARD_CONCAT(TEST_BOARD, _cmds)[0]), nullptr, 0,
+};
+#elif defined(ESP_PANEL_BOARD_LCD_VENDOR_INIT_PROGRAM)
+static constexpr LCD_VendorProgram::Command TEST_BOARD_CONCAT(TEST_BOARD, _program_cmds)[] =
+    ESP_PANEL_BOARD_LCD_VENDOR_INIT_PROGRAM();
+static constexpr auto TEST_BOARD_CONCAT(TEST_BOARD, _program) =
+    LCD_VendorProgram::compile<LCD_VendorProgram::getProgramSize(TEST_BOARD_CONCAT(TEST_BOARD, _program_cmds))>(
+        TEST_BOARD_CONCAT(TEST_BOARD, _program_cmds)
+    );
+static const BoardVendorTable TEST_BOARD_CONCAT(TEST_BOARD, _table) = {
+    TEST_BOARD_STR(TEST_BOARD), TEST_BOARD_BUS_TYPE, nullptr,
+    sizeof(TEST_BOARD_CONCAT(TEST_BOARD, _program_cmds)) / sizeof(TEST_BOARD_CONCAT(TEST_BOARD, _program_cmds)[0]),
+    TEST_BOARD_CONCAT(TEST_BOARD, _program).data(), TEST_BOARD_CONCAT(TEST_BOARD, _program).size(),
+};
+#else
+// The board relies on the default commands of the driver
+static const BoardVendorTable TEST_BOARD_CONCAT(TEST_BOARD, _table) = {
+    TEST_BOARD_STR(TEST_BOARD), TEST_BOARD_BUS_TYPE, nullptr, 0, nullptr, 0,
+};
+#endif
+
+#undef TEST_BOARD_BUS_TYPE
+#undef TEST_BOARD
+#include "board_undef.h"
+
+// *INDENT-ON*
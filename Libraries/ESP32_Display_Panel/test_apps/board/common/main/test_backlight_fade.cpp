@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <algorithm>
+#include "unity.h"
+#include "esp_display_panel.hpp"
+
+using namespace esp_panel::drivers;
+
+using Curve = BacklightFade::Curve;
+
+TEST_CASE("Test backlight fade curves", "[backlight][fade]")
+{
+    static constexpr Curve curves[] = {Curve::LINEAR, Curve::GAMMA_2_2, Curve::CIE1931};
+    static constexpr uint32_t level_max = 8191;
+
+    // The linear curve keeps the historical `percent * level_max / 100` mapping
+    for (int percent = 0; percent <= 100; percent++) {
+        TEST_ASSERT_EQUAL(level_max * percent / 100, BacklightFade::toLevel(Curve::LINEAR, percent * 10, level_max));
+    }
+
+    for (auto curve : curves) {
+        TEST_ASSERT_EQUAL(0, BacklightFade::toLevel(curve, 0, level_max));
+        TEST_ASSERT_EQUAL(level_max, BacklightFade::toLevel(curve, BacklightFade::PERMILLE_MAX, level_max));
+        TEST_ASSERT_EQUAL(level_max, BacklightFade::toLevel(curve, BacklightFade::PERMILLE_MAX + 1, level_max));
+        uint32_t last_level = 0;
+        for (int permille = 1; permille <= BacklightFade::PERMILLE_MAX; permille++) {
+            uint32_t level = BacklightFade::toLevel(curve, permille, level_max);
+            TEST_ASSERT_GREATER_OR_EQUAL(last_level, level);
+            last_level = level;
+        }
+        // A non-zero brightness never turns the output off
+        if (curve != Curve::LINEAR) {
+            TEST_ASSERT_EQUAL(1, BacklightFade::toLevel(curve, 1, 255));
+        }
+    }
+
+    // Perceptual curves spend more output levels on the dark end
+    TEST_ASSERT_LESS_THAN(level_max / 4, BacklightFade::toLevel(Curve::GAMMA_2_2, 500, level_max));
+    TEST_ASSERT_LESS_THAN(level_max / 4, BacklightFade::toLevel(Curve::CIE1931, 500, level_max));
+}
+
+static void test_fade(int from, int to, uint32_t duration_ms, uint32_t segment_ms, Curve curve, uint32_t level_max)
+{
+    BacklightFade fade;
+    fade.start(from, to, duration_ms, segment_ms, curve, level_max);
+    TEST_ASSERT_TRUE(fade.isActive());
+    TEST_ASSERT_EQUAL(to, fade.getTargetPermille());
+
+    BacklightFade::Segment segment;
+    uint32_t total_ms = 0;
+    uint32_t count = 0;
+    uint32_t last_level = BacklightFade::toLevel(curve, from, level_max);
+    while (fade.getNextSegment(segment)) {
+        // Every segment changes the output, except the single segment of a fade between two equal levels
+        TEST_ASSERT_TRUE((segment.level != last_level) || segment.is_last);
+        TEST_ASSERT_EQUAL(segment.is_last, !fade.isActive());
+        TEST_ASSERT_EQUAL(segment.level, BacklightFade::toLevel(curve, segment.permille, level_max));
+        last_level = segment.level;
+        total_ms += segment.duration_ms;
+        count++;
+    }
+    TEST_ASSERT_FALSE(fade.isActive());
+    TEST_ASSERT_EQUAL(to, segment.permille);
+    TEST_ASSERT_EQUAL(duration_ms, total_ms);
+    TEST_ASSERT_LESS_OR_EQUAL((segment_ms > 0) ? std::max<uint32_t>(duration_ms / segment_ms, 1) : 1, count);
+}
+
+TEST_CASE("Test backlight fade segments", "[backlight][fade]")
+{
+    test_fade(0, 1000, 1000, 20, Curve::LINEAR, 100);
+    test_fade(1000, 0, 1000, 20, Curve::CIE1931, 8191);
+    test_fade(200, 700, 333, 50, Curve::GAMMA_2_2, 255);
+    test_fade(500, 500, 100, 20, Curve::LINEAR, 100);
+    test_fade(0, 1000, 10, 20, Curve::LINEAR, 100);
+
+    // An on/off output only needs one write, at the end of the fade
+    BacklightFade fade;
+    BacklightFade::Segment segment;
+    fade.start(1000, 0, 500, 20, Curve::LINEAR, 1);
+    TEST_ASSERT_TRUE(fade.getNextSegment(segment));
+    TEST_ASSERT_EQUAL(500, segment.duration_ms);
+    TEST_ASSERT_TRUE(segment.is_last);
+    TEST_ASSERT_FALSE(fade.getNextSegment(segment));
+
+    // Stopped fades don't produce segments
+    fade.start(0, 1000, 500, 20, Curve::LINEAR, 100);
+    fade.stop();
+    TEST_ASSERT_FALSE(fade.isActive());
+    TEST_ASSERT_FALSE(fade.getNextSegment(segment));
+}
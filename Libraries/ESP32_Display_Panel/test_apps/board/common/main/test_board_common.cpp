@@ -128,6 +128,39 @@ TEST_CASE("Test common board with default config", "[board][common][default]")
     }
 }
 
+TEST_CASE("Test common board with default config and parallel begin", "[board][common][default][parallel]")
+{
+    shared_ptr<Board> board = make_shared<Board>();
+    TEST_ASSERT_NOT_NULL_MESSAGE(board, "Create board object failed");
+
+    TEST_ASSERT_TRUE_MESSAGE(board->configParallelBegin(true), "Config parallel begin failed");
+    board_common_init(board.get());
+
+    auto &timeline = board->getBeginTimeline();
+    timeline.print();
+    auto &total = timeline.phases[Board::BeginTimeline::PHASE_TOTAL];
+    TEST_ASSERT_GREATER_THAN(0, total.getDurationUs());
+    for (int i = 0; i < Board::BeginTimeline::PHASE_TOTAL; i++) {
+        auto &phase = timeline.phases[i];
+        if (phase.start_us < 0) {
+            continue;
+        }
+        TEST_ASSERT_GREATER_OR_EQUAL(total.start_us, phase.start_us);
+        TEST_ASSERT_LESS_OR_EQUAL(total.end_us, phase.end_us);
+    }
+
+    auto lcd = board->getLCD();
+    if (lcd) {
+        lcd_general_test(lcd);
+    }
+
+    auto touch = board->getTouch();
+    if (touch) {
+        touch_general_test(touch);
+        gpio_uninstall_isr_service();
+    }
+}
+
 #define CREATE_TEST_CASE(board_name) \
     TEST_CASE("Test common board with " #board_name " external config", "[board][common][external]") \
     { \
@@ -0,0 +1,402 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdio>
+#include <cstring>
+#include "unity.h"
+#include "esp_lcd_panel_commands.h"
+#include "esp_display_panel.hpp"
+
+using namespace esp_panel::drivers;
+
+TEST_CASE("Test LCD vendor program keeps every command at compile time", "[lcd][vendor_program]")
+{
+    static constexpr LCD_VendorProgram::Command cmds[] = {
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0xFF, {0x77, 0x01, 0x00, 0x00, 0x10}),
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0xFF, {0x77, 0x01, 0x00, 0x00, 0x10}),
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_NONE_PARAM(100, 0x11),
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_NONE_PARAM(20, 0x00),
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_8BIT_PARAM(0, 0x3A, {0x55}),
+        ESP_PANEL_LCD_PROGRAM_CMD_WITH_NONE_PARAM(300, 0x29),
+    };
+    static constexpr auto program = LCD_VendorProgram::compile<LCD_VendorProgram::getProgramSize(cmds)>(cmds);
+    static constexpr uint8_t expected[] = {
+        0xFF, 0x05, 0x77, 0x01, 0x00, 0x00, 0x10, 0x00,
+        0xFF, 0x05, 0x77, 0x01, 0x00, 0x00, 0x10, 0x00,
+        0x11, 0x00, 0x64,
+        0x00, 0x00, 0x14,
+        0x3A, 0x01, 0x55, 0x00,
+        0x29, 0x00, 0x81, 0x2C,
+    };
+    static_assert(program.size() == sizeof(expected), "Unexpected program size");
+    TEST_ASSERT_EQUAL_MEMORY(expected, program.data(), sizeof(expected));
+
+    int count = 0;
+    uint32_t delay_ms = 0;
+    TEST_ASSERT_TRUE(LCD_VendorProgram::execute(
+    program.data(), program.size(), [&](int cmd, const uint8_t *data, size_t data_bytes, uint32_t delay) {
+        count++;
+        delay_ms += delay;
+        return (cmd != 0x3A) || ((data_bytes == 1) && (data[0] == 0x55));
+    }));
+    TEST_ASSERT_EQUAL(6, count);
+    TEST_ASSERT_EQUAL(420, delay_ms);
+}
+
+TEST_CASE("Test LCD vendor program rejects invalid tables and programs", "[lcd][vendor_program]")
+{
+    static const uint8_t data[0x100] = {};
+    const esp_panel_lcd_vendor_init_cmd_t too_long[] = {
+        {0x2C, data, sizeof(data), 0},
+    };
+    const esp_panel_lcd_vendor_init_cmd_t bad_command[] = {
+        {0x100, data, 0, 0},
+    };
+    const esp_panel_lcd_vendor_init_cmd_t bad_delay[] = {
+        {0x11, data, 0, 0x8000},
+    };
+    TEST_ASSERT_EQUAL(0, LCD_VendorProgram::getProgramSize(too_long, 1));
+    TEST_ASSERT_EQUAL(0, LCD_VendorProgram::getProgramSize(bad_command, 1));
+    TEST_ASSERT_EQUAL(0, LCD_VendorProgram::getProgramSize(bad_delay, 1));
+
+    // Buffer too small
+    const esp_panel_lcd_vendor_init_cmd_t cmds[] = {
+        {0x3A, data, 4, 1000},
+    };
+    uint8_t program[8] = {};
+    TEST_ASSERT_EQUAL(8, LCD_VendorProgram::getProgramSize(cmds, 1));
+    TEST_ASSERT_EQUAL(0, LCD_VendorProgram::compile(cmds, 1, program, sizeof(program) - 1));
+    TEST_ASSERT_EQUAL(8, LCD_VendorProgram::compile(cmds, 1, program, sizeof(program)));
+
+    // Truncated programs
+    auto handler = [](int, const uint8_t *, size_t, uint32_t) {
+        return true;
+    };
+    for (size_t size = 1; size < sizeof(program); size++) {
+        TEST_ASSERT_FALSE(LCD_VendorProgram::execute(program, size, handler));
+    }
+    uint32_t delay_ms = 0;
+    TEST_ASSERT_TRUE(LCD_VendorProgram::execute(
+    program, sizeof(program), [&delay_ms](int, const uint8_t *, size_t, uint32_t delay) {
+        delay_ms = delay;
+        return true;
+    }));
+    TEST_ASSERT_EQUAL(1000, delay_ms);
+}
+
+struct BoardVendorTable {
+    const char *name;
+    int bus_type;
+    const esp_panel_lcd_vendor_init_cmd_t *cmds;    // Vendor commands of the board, or `nullptr`
+    size_t num;                                     // Number of commands of the table or of the program
+    const uint8_t *program;                         // Compile-time program of the board, or `nullptr`
+    size_t program_size;
+};
+
+/**
+ * Vendor commands of all the supported boards. The board headers are included one after another,
+ * `board_vendor_table.h` defines `<board>_table` and removes the macros of the board.
+ */
+// *INDENT-OFF*
+
+#define TEST_BOARD ELECROW_CROWPANEL_7_0
+#include "board/supported/elecrow/BOARD_ELECROW_CROWPANEL_7_0.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_C3_LCDKIT
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_C3_LCDKIT.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_P4_FUNCTION_EV_BOARD
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_P4_FUNCTION_EV_BOARD.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_S3_BOX
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_S3_BOX.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_S3_BOX_3
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_S3_BOX_3.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_S3_BOX_3_BETA
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_S3_BOX_3_BETA.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_S3_BOX_LITE
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_S3_BOX_LITE.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_S3_EYE
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_S3_EYE.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_S3_KORVO_2
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_S3_KORVO_2.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_S3_LCD_EV_BOARD
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_S3_LCD_EV_BOARD.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_S3_LCD_EV_BOARD_2
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_S3_LCD_EV_BOARD_2.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_S3_LCD_EV_BOARD_2_V1_5
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_S3_LCD_EV_BOARD_2_V1_5.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_S3_LCD_EV_BOARD_V1_5
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_S3_LCD_EV_BOARD_V1_5.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD ESPRESSIF_ESP32_S3_USB_OTG
+#include "board/supported/espressif/BOARD_ESPRESSIF_ESP32_S3_USB_OTG.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD JINGCAI_ESP32_4848S040C_I_Y_3
+#include "board/supported/jingcai/BOARD_JINGCAI_ESP32_4848S040C_I_Y_3.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD JINGCAI_JC8048W550C
+#include "board/supported/jingcai/BOARD_JINGCAI_JC8048W550C.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD M5STACK_M5CORE2
+#include "board/supported/m5stack/BOARD_M5STACK_M5CORE2.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD M5STACK_M5CORES3
+#include "board/supported/m5stack/BOARD_M5STACK_M5CORES3.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD M5STACK_M5DIAL
+#include "board/supported/m5stack/BOARD_M5STACK_M5DIAL.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_SMARTRING
+#include "board/supported/viewe/BOARD_VIEWE_SMARTRING.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX24240013_MD50E
+#include "board/supported/viewe/BOARD_VIEWE_UEDX24240013_MD50E.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX24320024E_WB_A
+#include "board/supported/viewe/BOARD_VIEWE_UEDX24320024E_WB_A.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX24320028E_WB_A
+#include "board/supported/viewe/BOARD_VIEWE_UEDX24320028E_WB_A.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX24320035E_WB_A
+#include "board/supported/viewe/BOARD_VIEWE_UEDX24320035E_WB_A.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX32480035E_WB_A
+#include "board/supported/viewe/BOARD_VIEWE_UEDX32480035E_WB_A.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX46460015_MD50ET
+#include "board/supported/viewe/BOARD_VIEWE_UEDX46460015_MD50ET.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX48270043E_WB_A
+#include "board/supported/viewe/BOARD_VIEWE_UEDX48270043E_WB_A.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX48480021_MD80E
+#include "board/supported/viewe/BOARD_VIEWE_UEDX48480021_MD80E.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX48480021_MD80ET
+#include "board/supported/viewe/BOARD_VIEWE_UEDX48480021_MD80ET.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX48480021_MD80E_V2
+#include "board/supported/viewe/BOARD_VIEWE_UEDX48480021_MD80E_V2.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX48480028_MD80ET
+#include "board/supported/viewe/BOARD_VIEWE_UEDX48480028_MD80ET.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX48480040E_WB_A
+#include "board/supported/viewe/BOARD_VIEWE_UEDX48480040E_WB_A.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX48800043E_WB_A
+#include "board/supported/viewe/BOARD_VIEWE_UEDX48800043E_WB_A.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX80480043E_WB_A
+#include "board/supported/viewe/BOARD_VIEWE_UEDX80480043E_WB_A.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX80480050E_AC_A
+#include "board/supported/viewe/BOARD_VIEWE_UEDX80480050E_AC_A.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX80480050E_WB_A
+#include "board/supported/viewe/BOARD_VIEWE_UEDX80480050E_WB_A.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX80480050E_WB_A_2
+#include "board/supported/viewe/BOARD_VIEWE_UEDX80480050E_WB_A_2.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD VIEWE_UEDX80480070E_WB_A
+#include "board/supported/viewe/BOARD_VIEWE_UEDX80480070E_WB_A.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD WAVESHARE_ESP32_P4_NANO
+#include "board/supported/waveshare/BOARD_WAVESHARE_ESP32_P4_NANO.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD WAVESHARE_ESP32_S3_TOUCH_LCD_1_85
+#include "board/supported/waveshare/BOARD_WAVESHARE_ESP32_S3_TOUCH_LCD_1_85.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD WAVESHARE_ESP32_S3_TOUCH_LCD_2_1
+#include "board/supported/waveshare/BOARD_WAVESHARE_ESP32_S3_TOUCH_LCD_2_1.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD WAVESHARE_ESP32_S3_TOUCH_LCD_4_3
+#include "board/supported/waveshare/BOARD_WAVESHARE_ESP32_S3_TOUCH_LCD_4_3.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD WAVESHARE_ESP32_S3_TOUCH_LCD_4_3_B
+#include "board/supported/waveshare/BOARD_WAVESHARE_ESP32_S3_TOUCH_LCD_4_3_B.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD WAVESHARE_ESP32_S3_TOUCH_LCD_5
+#include "board/supported/waveshare/BOARD_WAVESHARE_ESP32_S3_TOUCH_LCD_5.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD WAVESHARE_ESP32_S3_TOUCH_LCD_5_B
+#include "board/supported/waveshare/BOARD_WAVESHARE_ESP32_S3_TOUCH_LCD_5_B.h"
+#include "board_vendor_table.h"
+
+#define TEST_BOARD WAVESHARE_ESP32_S3_TOUCH_LCD_7
+#include "board/supported/waveshare/BOARD_WAVESHARE_ESP32_S3_TOUCH_LCD_7.h"
+#include "board_vendor_table.h"
+
+static const BoardVendorTable board_vendor_tables[] = {
+    ELECROW_CROWPANEL_7_0_table,
+    ESPRESSIF_ESP32_C3_LCDKIT_table,
+    ESPRESSIF_ESP32_P4_FUNCTION_EV_BOARD_table,
+    ESPRESSIF_ESP32_S3_BOX_table,
+    ESPRESSIF_ESP32_S3_BOX_3_table,
+    ESPRESSIF_ESP32_S3_BOX_3_BETA_table,
+    ESPRESSIF_ESP32_S3_BOX_LITE_table,
+    ESPRESSIF_ESP32_S3_EYE_table,
+    ESPRESSIF_ESP32_S3_KORVO_2_table,
+    ESPRESSIF_ESP32_S3_LCD_EV_BOARD_table,
+    ESPRESSIF_ESP32_S3_LCD_EV_BOARD_2_table,
+    ESPRESSIF_ESP32_S3_LCD_EV_BOARD_2_V1_5_table,
+    ESPRESSIF_ESP32_S3_LCD_EV_BOARD_V1_5_table,
+    ESPRESSIF_ESP32_S3_USB_OTG_table,
+    JINGCAI_ESP32_4848S040C_I_Y_3_table,
+    JINGCAI_JC8048W550C_table,
+    M5STACK_M5CORE2_table,
+    M5STACK_M5CORES3_table,
+    M5STACK_M5DIAL_table,
+    VIEWE_SMARTRING_table,
+    VIEWE_UEDX24240013_MD50E_table,
+    VIEWE_UEDX24320024E_WB_A_table,
+    VIEWE_UEDX24320028E_WB_A_table,
+    VIEWE_UEDX24320035E_WB_A_table,
+    VIEWE_UEDX32480035E_WB_A_table,
+    VIEWE_UEDX46460015_MD50ET_table,
+    VIEWE_UEDX48270043E_WB_A_table,
+    VIEWE_UEDX48480021_MD80E_table,
+    VIEWE_UEDX48480021_MD80ET_table,
+    VIEWE_UEDX48480021_MD80E_V2_table,
+    VIEWE_UEDX48480028_MD80ET_table,
+    VIEWE_UEDX48480040E_WB_A_table,
+    VIEWE_UEDX48800043E_WB_A_table,
+    VIEWE_UEDX80480043E_WB_A_table,
+    VIEWE_UEDX80480050E_AC_A_table,
+    VIEWE_UEDX80480050E_WB_A_table,
+    VIEWE_UEDX80480050E_WB_A_2_table,
+    VIEWE_UEDX80480070E_WB_A_table,
+    WAVESHARE_ESP32_P4_NANO_table,
+    WAVESHARE_ESP32_S3_TOUCH_LCD_1_85_table,
+    WAVESHARE_ESP32_S3_TOUCH_LCD_2_1_table,
+    WAVESHARE_ESP32_S3_TOUCH_LCD_4_3_table,
+    WAVESHARE_ESP32_S3_TOUCH_LCD_4_3_B_table,
+    WAVESHARE_ESP32_S3_TOUCH_LCD_5_table,
+    WAVESHARE_ESP32_S3_TOUCH_LCD_5_B_table,
+    WAVESHARE_ESP32_S3_TOUCH_LCD_7_table,
+};
+
+// *INDENT-ON*
+
+TEST_CASE("Test LCD vendor program compiles the board tables", "[lcd][vendor_program]")
+{
+    int tables_num = 0;
+    int programs_num = 0;
+    for (const auto &table : board_vendor_tables) {
+        if (table.program != nullptr) {
+            // Sent by `LCD::begin()` through the control panel, see `LCD::configVendorCommandProgram()`
+            printf("Board: %s, program(%d bytes)\n", table.name, static_cast<int>(table.program_size));
+            TEST_ASSERT_TRUE(
+                (table.bus_type == ESP_PANEL_BUS_TYPE_SPI) || (table.bus_type == ESP_PANEL_BUS_TYPE_QSPI) ||
+                (table.bus_type == ESP_PANEL_BUS_TYPE_I80)
+            );
+            size_t num = 0;
+            TEST_ASSERT_TRUE(LCD_VendorProgram::execute(
+            table.program, table.program_size, [&num](int cmd, const uint8_t *, size_t, uint32_t) {
+                num++;
+                return (cmd != LCD_CMD_MADCTL) && (cmd != LCD_CMD_COLMOD);
+            }));
+            TEST_ASSERT_EQUAL(table.num, num);
+            programs_num++;
+            continue;
+        }
+        if (table.cmds == nullptr) {
+            printf("Board: %s, no vendor commands\n", table.name);
+            continue;
+        }
+
+        printf("Board: %s\n", table.name);
+        size_t size = LCD_VendorProgram::getProgramSize(table.cmds, table.num);
+        TEST_ASSERT_GREATER_THAN(0, size);
+        esp_panel::utils::vector<uint8_t> compiled(size);
+        TEST_ASSERT_EQUAL(size, LCD_VendorProgram::compile(table.cmds, table.num, compiled.data(), compiled.size()));
+
+        // Every command comes back in order, including repeated commands and NOPs
+        size_t index = 0;
+        TEST_ASSERT_TRUE(LCD_VendorProgram::execute(
+            compiled.data(), compiled.size(),
+        [&](int cmd, const uint8_t *data, size_t data_bytes, uint32_t delay_ms) {
+            TEST_ASSERT_LESS_THAN(table.num, index);
+            auto &expected = table.cmds[index++];
+            TEST_ASSERT_EQUAL(expected.cmd, cmd);
+            TEST_ASSERT_EQUAL(expected.data_bytes, data_bytes);
+            TEST_ASSERT_EQUAL(expected.delay_ms, delay_ms);
+            if (data_bytes > 0) {
+                TEST_ASSERT_EQUAL_MEMORY(expected.data, data, data_bytes);
+            }
+            return true;
+        }));
+        TEST_ASSERT_EQUAL(table.num, index);
+
+        size_t table_size = table.num * sizeof(esp_panel_lcd_vendor_init_cmd_t);
+        for (size_t i = 0; i < table.num; i++) {
+            table_size += (table.cmds[i].data_bytes > 0) ? table.cmds[i].data_bytes : 1;
+        }
+        TEST_ASSERT_LESS_THAN(table_size, size);
+        printf(
+            "\t%d commands: table(%d bytes) -> program(%d bytes)\n", static_cast<int>(table.num),
+            static_cast<int>(table_size), static_cast<int>(size)
+        );
+        tables_num++;
+    }
+    TEST_ASSERT_GREATER_THAN(0, tables_num);
+    TEST_ASSERT_GREATER_THAN(0, programs_num);
+}
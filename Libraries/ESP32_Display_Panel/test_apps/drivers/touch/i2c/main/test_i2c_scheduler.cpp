@@ -0,0 +1,248 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <memory>
+#include <string>
+#include <thread>
+#include "unity.h"
+#include "esp_display_panel.hpp"
+
+using namespace esp_panel::drivers;
+
+using Scheduler = HostI2C_Scheduler;
+using Priority = HostI2C_Scheduler::Priority;
+
+static Scheduler::Config get_manual_config()
+{
+    Scheduler::Config config = {};
+    config.start_thread = false;
+    config.aging_us = 0;
+    return config;
+}
+
+static Scheduler::Transaction make_transaction(int device_id, std::string &log, char tag, esp_err_t ret = ESP_OK)
+{
+    return Scheduler::Transaction{
+        .device_id = device_id,
+        .operation = [&log, tag, ret]() {
+            log.push_back(tag);
+            return ret;
+        },
+    };
+}
+
+TEST_CASE("Test I2C scheduler executes by priority", "[i2c][scheduler]")
+{
+    Scheduler scheduler(get_manual_config());
+    TEST_ASSERT_TRUE(scheduler.begin());
+    int touch_id = scheduler.registerDevice("touch");
+    int expander_id = scheduler.registerDevice("expander");
+    std::string log;
+
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::BACKGROUND, make_transaction(expander_id, log, 'b')));
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::NORMAL, make_transaction(expander_id, log, 'n')));
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::REALTIME, make_transaction(touch_id, log, 'r')));
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::NORMAL, make_transaction(expander_id, log, 'm')));
+    TEST_ASSERT_EQUAL(4, scheduler.getPendingCount());
+
+    while (scheduler.processOnce()) {
+    }
+    TEST_ASSERT_TRUE(log == "rnmb");
+    TEST_ASSERT_EQUAL(0, scheduler.getPendingCount());
+}
+
+TEST_CASE("Test I2C scheduler doesn't execute inline ahead of pending transactions", "[i2c][scheduler]")
+{
+    Scheduler scheduler(get_manual_config());
+    TEST_ASSERT_TRUE(scheduler.begin());
+    int touch_id = scheduler.registerDevice("touch");
+    int expander_id = scheduler.registerDevice("expander");
+    std::string log;
+
+    // The bus is idle but transactions are pending, so the call is queued behind them by priority
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::REALTIME, make_transaction(touch_id, log, 'r')));
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::BACKGROUND, make_transaction(expander_id, log, 'b')));
+    TEST_ASSERT_EQUAL(ESP_OK, scheduler.execute(Priority::NORMAL, expander_id, [&log]() {
+        log.push_back('n');
+        return ESP_OK;
+    }));
+    TEST_ASSERT_TRUE(log == "rn");
+
+    // Inline once everything is done
+    TEST_ASSERT_TRUE(scheduler.processOnce());
+    TEST_ASSERT_EQUAL(ESP_OK, scheduler.execute(Priority::BACKGROUND, expander_id, [&log]() {
+        log.push_back('i');
+        return ESP_OK;
+    }));
+    TEST_ASSERT_TRUE(log == "rnbi");
+    TEST_ASSERT_EQUAL(0, scheduler.getPendingCount());
+}
+
+TEST_CASE("Test I2C scheduler keeps a batch together", "[i2c][scheduler]")
+{
+    Scheduler scheduler(get_manual_config());
+    TEST_ASSERT_TRUE(scheduler.begin());
+    int touch_id = scheduler.registerDevice("touch");
+    int expander_id = scheduler.registerDevice("expander");
+    std::string log;
+
+    esp_panel::utils::vector<Scheduler::Transaction> batch;
+    batch.push_back(make_transaction(expander_id, log, '1'));
+    batch.push_back(make_transaction(expander_id, log, '2'));
+    batch.push_back(make_transaction(expander_id, log, '3'));
+    TEST_ASSERT_TRUE(scheduler.submitBatch(Priority::NORMAL, std::move(batch)));
+
+    // The realtime transaction arrives once the batch has started, it must not be interleaved
+    TEST_ASSERT_TRUE(scheduler.processOnce());
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::REALTIME, make_transaction(touch_id, log, 'r')));
+    TEST_ASSERT_TRUE(scheduler.processOnce());
+    TEST_ASSERT_TRUE(log == "123r");
+    TEST_ASSERT_FALSE(scheduler.processOnce());
+}
+
+TEST_CASE("Test I2C scheduler promotes aged transactions", "[i2c][scheduler]")
+{
+    Scheduler::Config config = get_manual_config();
+    config.aging_us = 1000;
+    Scheduler scheduler(config);
+    TEST_ASSERT_TRUE(scheduler.begin());
+    int touch_id = scheduler.registerDevice("touch");
+    int sensor_id = scheduler.registerDevice("sensor");
+    std::string log;
+
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::BACKGROUND, make_transaction(sensor_id, log, 'b')));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::REALTIME, make_transaction(touch_id, log, 'r')));
+
+    // Both are now at the realtime class, the older one goes first
+    while (scheduler.processOnce()) {
+    }
+    TEST_ASSERT_TRUE(log == "br");
+}
+
+TEST_CASE("Test I2C scheduler rejects invalid and excess transactions", "[i2c][scheduler]")
+{
+    Scheduler::Config config = get_manual_config();
+    config.queue_depth = 2;
+    Scheduler scheduler(config);
+    TEST_ASSERT_TRUE(scheduler.begin());
+    int device_id = scheduler.registerDevice("expander");
+    std::string log;
+
+    TEST_ASSERT_FALSE(scheduler.submit(Priority::NORMAL, make_transaction(device_id + 1, log, 'x')));
+    TEST_ASSERT_FALSE(scheduler.submit(Priority::NORMAL, Scheduler::Transaction{ .device_id = device_id }));
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::NORMAL, make_transaction(device_id, log, 'a')));
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::NORMAL, make_transaction(device_id, log, 'b')));
+    TEST_ASSERT_FALSE(scheduler.submit(Priority::NORMAL, make_transaction(device_id, log, 'c')));
+    // The depth is per priority class
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::REALTIME, make_transaction(device_id, log, 'r')));
+}
+
+TEST_CASE("Test I2C scheduler records latency and completes cancelled transactions", "[i2c][scheduler]")
+{
+    Scheduler scheduler(get_manual_config());
+    TEST_ASSERT_TRUE(scheduler.begin());
+    int device_id = scheduler.registerDevice("touch");
+    std::string log;
+
+    TEST_ASSERT_EQUAL(ESP_OK, scheduler.execute(Priority::REALTIME, device_id, []() {
+        return ESP_OK;
+    }));
+    TEST_ASSERT_EQUAL(ESP_FAIL, scheduler.execute(Priority::REALTIME, device_id, []() {
+        return ESP_FAIL;
+    }));
+
+    Scheduler::LatencyHistogram histogram;
+    TEST_ASSERT_TRUE(scheduler.getLatencyHistogram(device_id, histogram));
+    TEST_ASSERT_EQUAL(2, histogram.count);
+    TEST_ASSERT_EQUAL(1, histogram.errors);
+    uint32_t total = 0;
+    for (auto bucket : histogram.buckets) {
+        total += bucket;
+    }
+    TEST_ASSERT_EQUAL(histogram.count, total);
+    scheduler.printLatencyHistograms();
+
+    esp_err_t cancelled_ret = ESP_OK;
+    auto transaction = make_transaction(device_id, log, 'x');
+    transaction.on_complete = [&cancelled_ret](esp_err_t ret) {
+        cancelled_ret = ret;
+    };
+    TEST_ASSERT_TRUE(scheduler.submit(Priority::BACKGROUND, std::move(transaction)));
+    TEST_ASSERT_TRUE(scheduler.del());
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, cancelled_ret);
+    TEST_ASSERT_TRUE(log.empty());
+}
+
+TEST_CASE("Test I2C scheduler serializes transactions from several threads", "[i2c][scheduler]")
+{
+    Scheduler scheduler;
+    TEST_ASSERT_TRUE(scheduler.begin());
+    int touch_id = scheduler.registerDevice("touch");
+    int expander_id = scheduler.registerDevice("expander");
+    std::atomic<int> active = 0;
+    std::atomic<int> overlaps = 0;
+    auto operation = [&]() {
+        if (active.fetch_add(1) != 0) {
+            overlaps++;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        active--;
+        return ESP_OK;
+    };
+
+    std::thread expander_thread([&]() {
+        for (int i = 0; i < 20; i++) {
+            scheduler.execute(Priority::BACKGROUND, expander_id, operation);
+        }
+    });
+    for (int i = 0; i < 20; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, scheduler.execute(Priority::REALTIME, touch_id, operation));
+    }
+    expander_thread.join();
+
+    TEST_ASSERT_EQUAL(0, overlaps.load());
+    Scheduler::LatencyHistogram histogram;
+    TEST_ASSERT_TRUE(scheduler.getLatencyHistogram(touch_id, histogram));
+    TEST_ASSERT_EQUAL(20, histogram.count);
+    scheduler.printLatencyHistograms();
+}
+
+TEST_CASE("Test I2C scheduler client registers again after a restart", "[i2c][scheduler]")
+{
+    Scheduler::Client client;
+    auto operation = []() {
+        return ESP_OK;
+    };
+
+    // Without a scheduler the operation is executed directly
+    TEST_ASSERT_EQUAL(ESP_OK, client.execute(nullptr, "expander", Priority::NORMAL, operation));
+
+    auto scheduler = std::make_shared<Scheduler>(get_manual_config());
+    TEST_ASSERT_TRUE(scheduler->begin());
+    TEST_ASSERT_EQUAL(ESP_OK, client.execute(scheduler, "expander", Priority::NORMAL, operation));
+
+    // A nested transaction runs in the context of the one owning the bus
+    TEST_ASSERT_EQUAL(ESP_FAIL, client.execute(scheduler, "expander", Priority::NORMAL, [&]() {
+        return client.execute(scheduler, "expander", Priority::REALTIME, []() {
+            return ESP_FAIL;
+        });
+    }));
+
+    Scheduler::LatencyHistogram histogram;
+    TEST_ASSERT_TRUE(scheduler->getLatencyHistogram(0, histogram));
+    TEST_ASSERT_EQUAL(2, histogram.count);
+    TEST_ASSERT_FALSE(scheduler->getLatencyHistogram(1, histogram));
+
+    // The client doesn't keep the stopped scheduler, and registers to the new one
+    std::weak_ptr<Scheduler> stopped = scheduler;
+    TEST_ASSERT_TRUE(scheduler->del());
+    scheduler = std::make_shared<Scheduler>(get_manual_config());
+    TEST_ASSERT_TRUE(stopped.expired());
+    TEST_ASSERT_TRUE(scheduler->begin());
+    TEST_ASSERT_EQUAL(ESP_OK, client.execute(scheduler, "expander", Priority::NORMAL, operation));
+    TEST_ASSERT_TRUE(scheduler->getLatencyHistogram(0, histogram));
+    TEST_ASSERT_EQUAL(1, histogram.count);
+}
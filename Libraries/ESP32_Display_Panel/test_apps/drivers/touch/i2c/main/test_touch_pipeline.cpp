@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdlib>
+#include "unity.h"
+#include "esp_display_panel.hpp"
+
+using namespace esp_panel::drivers;
+
+using Sample = TouchPipeline::Sample;
+
+/**
+ * Synthetic traces written by hand to mimic a CST816S-like controller, one sample per INT edge (~10 ms apart while
+ * touched), the last sample of a gesture is the release reported by the controller.
+ */
+static const Sample trace_tap[] = {
+    { .timestamp_us = 100000, .x = 233, .y = 240, .strength = 1, .pressed = true },
+    { .timestamp_us = 110000, .x = 233, .y = 241, .strength = 1, .pressed = true },
+    { .timestamp_us = 118000, .pressed = false },
+};
+
+static const Sample trace_drag[] = {
+    { .timestamp_us = 200000, .x = 100, .y = 233, .strength = 1, .pressed = true },
+    { .timestamp_us = 210000, .x = 110, .y = 233, .strength = 1, .pressed = true },
+    { .timestamp_us = 220000, .x = 120, .y = 233, .strength = 1, .pressed = true },
+    { .timestamp_us = 230000, .x = 130, .y = 233, .strength = 1, .pressed = true },
+    { .timestamp_us = 240000, .x = 140, .y = 233, .strength = 1, .pressed = true },
+    { .timestamp_us = 250000, .pressed = false },
+};
+
+static void push_trace(TouchPipeline &pipeline, const Sample *trace, size_t num, int64_t until_us)
+{
+    for (size_t i = 0; i < num; i++) {
+        if (trace[i].timestamp_us <= until_us) {
+            pipeline.push(trace[i]);
+        }
+    }
+}
+
+TEST_CASE("Test touch pipeline returns released while idle", "[touch][pipeline]")
+{
+    TouchPipeline pipeline;
+    Sample sample;
+
+    for (int64_t now_us = 0; now_us < 100000; now_us += 5000) {
+        TEST_ASSERT_FALSE(pipeline.read(now_us, sample));
+    }
+    auto statistics = pipeline.getStatistics();
+    TEST_ASSERT_EQUAL(0, statistics.pushed);
+    TEST_ASSERT_EQUAL(statistics.reads, statistics.idle_reads);
+}
+
+TEST_CASE("Test touch pipeline keeps a tap shorter than the read period", "[touch][pipeline]")
+{
+    TouchPipeline pipeline;
+    Sample sample;
+
+    // The whole tap happens between two LVGL reads
+    TEST_ASSERT_FALSE(pipeline.read(95000, sample));
+    push_trace(pipeline, trace_tap, sizeof(trace_tap) / sizeof(trace_tap[0]), 125000);
+    TEST_ASSERT_TRUE(pipeline.read(125000, sample));
+    TEST_ASSERT_EQUAL(233, sample.x);
+    TEST_ASSERT_EQUAL(241, sample.y);
+    TEST_ASSERT_FALSE(pipeline.read(155000, sample));
+    TEST_ASSERT_EQUAL(2, pipeline.getStatistics().coalesced);
+}
+
+TEST_CASE("Test touch pipeline coalesces samples between reads", "[touch][pipeline]")
+{
+    TouchPipeline pipeline;
+    Sample sample;
+
+    push_trace(pipeline, trace_drag, sizeof(trace_drag) / sizeof(trace_drag[0]), 235000);
+    TEST_ASSERT_TRUE(pipeline.read(235000, sample));
+    TEST_ASSERT_EQUAL(130, sample.x);
+    TEST_ASSERT_EQUAL(3, pipeline.getStatistics().coalesced);
+
+    pipeline.push(trace_drag[4]);
+    pipeline.push(trace_drag[5]);
+    TEST_ASSERT_FALSE(pipeline.read(255000, sample));
+}
+
+TEST_CASE("Test touch pipeline recovers from a missed release", "[touch][pipeline]")
+{
+    TouchPipeline::Config config = {};
+    config.release_timeout_us = 50000;
+    TouchPipeline pipeline(config);
+    Sample sample;
+
+    // Drop the release sample of the trace
+    push_trace(pipeline, trace_drag, 5, 240000);
+    TEST_ASSERT_TRUE(pipeline.read(245000, sample));
+    TEST_ASSERT_TRUE(pipeline.read(285000, sample));
+    TEST_ASSERT_FALSE(pipeline.read(295000, sample));
+}
+
+TEST_CASE("Test touch pipeline predicts the position during a drag", "[touch][pipeline]")
+{
+    TouchPipeline::Config config = {};
+    config.enable_prediction = true;
+    config.prediction_us = 10000;
+    config.prediction_max_px = 8;
+    config.x_max = 466;
+    config.y_max = 466;
+    TouchPipeline pipeline(config);
+    Sample sample;
+
+    // Velocity is 1 px/ms along X, the read happens 5 ms after the newest sample
+    push_trace(pipeline, trace_drag, sizeof(trace_drag) / sizeof(trace_drag[0]), 240000);
+    TEST_ASSERT_TRUE(pipeline.read(245000, sample));
+    // 15 ms ahead is clamped to 8 px
+    TEST_ASSERT_EQUAL(148, sample.x);
+    TEST_ASSERT_EQUAL(233, sample.y);
+    TEST_ASSERT_EQUAL(1, pipeline.getStatistics().predicted);
+
+    // No prediction from a single sample
+    pipeline.reset();
+    pipeline.push(trace_drag[0]);
+    TEST_ASSERT_TRUE(pipeline.read(200000, sample));
+    TEST_ASSERT_EQUAL(100, sample.x);
+}
+
+TEST_CASE("Test touch pipeline overwrites the oldest samples", "[touch][pipeline]")
+{
+    TouchPipeline::Config config = {};
+    config.ring_size = 4;
+    TouchPipeline pipeline(config);
+    Sample sample;
+
+    push_trace(pipeline, trace_drag, 5, 240000);
+    TEST_ASSERT_EQUAL(1, pipeline.getStatistics().overwritten);
+    TEST_ASSERT_TRUE(pipeline.read(240000, sample));
+    TEST_ASSERT_EQUAL(140, sample.x);
+}
@@ -151,13 +151,23 @@ bool Base::init(void)
     return true;
 }
 
+void Base::setTransactionRunner(TransactionRunner runner)
+{
+    std::lock_guard<std::mutex> lock(_runner_mutex);
+    _runner = std::move(runner);
+}
+
 bool Base::reset(void)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
 
-    ESP_UTILS_CHECK_ERROR_RETURN(esp_io_expander_reset(device_handle), false, "Reset failed");
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        runTransaction([&]() {
+            return esp_io_expander_reset(device_handle);
+        }), false, "Reset failed"
+    );
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -198,7 +208,11 @@ bool Base::pinMode(uint8_t pin, uint8_t mode)
     ESP_UTILS_CHECK_FALSE_RETURN((mode == INPUT) || (mode == OUTPUT), false, "Invalid mode");
 
     esp_io_expander_dir_t dir = (mode == INPUT) ? IO_EXPANDER_INPUT : IO_EXPANDER_OUTPUT;
-    ESP_UTILS_CHECK_ERROR_RETURN(esp_io_expander_set_dir(device_handle, BIT64(pin), dir), false, "Set dir failed");
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        runTransaction([&]() {
+            return esp_io_expander_set_dir(device_handle, BIT64(pin), dir);
+        }), false, "Set dir failed"
+    );
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -215,7 +229,9 @@ bool Base::digitalWrite(uint8_t pin, uint8_t value)
     ESP_UTILS_CHECK_FALSE_RETURN(IS_VALID_PIN(pin), false, "Invalid pin");
 
     ESP_UTILS_CHECK_ERROR_RETURN(
-        esp_io_expander_set_level(device_handle, BIT64(pin), value), false, "Set level failed"
+        runTransaction([&]() {
+            return esp_io_expander_set_level(device_handle, BIT64(pin), value);
+        }), false, "Set level failed"
     );
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
@@ -234,7 +250,9 @@ int Base::digitalRead(uint8_t pin)
 
     uint32_t level = 0;
     ESP_UTILS_CHECK_ERROR_RETURN(
-        esp_io_expander_get_level(device_handle, BIT64(pin), &level), -1, "Get level failed"
+        runTransaction([&]() {
+            return esp_io_expander_get_level(device_handle, BIT64(pin), &level);
+        }), -1, "Get level failed"
     );
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
@@ -252,7 +270,11 @@ bool Base::multiPinMode(uint32_t pin_mask, uint8_t mode)
     ESP_UTILS_CHECK_FALSE_RETURN((mode == INPUT) || (mode == OUTPUT), false, "Invalid mode");
 
     esp_io_expander_dir_t dir = (mode == INPUT) ? IO_EXPANDER_INPUT : IO_EXPANDER_OUTPUT;
-    ESP_UTILS_CHECK_ERROR_RETURN(esp_io_expander_set_dir(device_handle, pin_mask, dir), false, "Set dir failed");
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        runTransaction([&]() {
+            return esp_io_expander_set_dir(device_handle, pin_mask, dir);
+        }), false, "Set dir failed"
+    );
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -267,7 +289,11 @@ bool Base::multiDigitalWrite(uint32_t pin_mask, uint8_t value)
 
     ESP_UTILS_LOGD("Param: pin_mask(%0x), value(%d)", pin_mask, value);
 
-    ESP_UTILS_CHECK_ERROR_RETURN(esp_io_expander_set_level(device_handle, pin_mask, value), false, "Set level failed");
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        runTransaction([&]() {
+            return esp_io_expander_set_level(device_handle, pin_mask, value);
+        }), false, "Set level failed"
+    );
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -283,20 +309,58 @@ int64_t Base::multiDigitalRead(uint32_t pin_mask)
     ESP_UTILS_LOGD("Param: pin_mask(%0x)", pin_mask);
 
     uint32_t level = 0;
-    ESP_UTILS_CHECK_ERROR_RETURN(esp_io_expander_get_level(device_handle, pin_mask, &level), false, "Get level failed");
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        runTransaction([&]() {
+            return esp_io_expander_get_level(device_handle, pin_mask, &level);
+        }), false, "Get level failed"
+    );
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
     return level;
 }
 
+bool Base::holdOutput(void)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+
+    ESP_UTILS_CHECK_ERROR_RETURN(esp_io_expander_hold_output(device_handle), false, "Hold output failed");
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Base::flushOutput(void)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        runTransaction([&]() {
+            return esp_io_expander_flush_output(device_handle);
+        }), false, "Flush output failed"
+    );
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool Base::printStatus(void) const
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
 
-    ESP_UTILS_CHECK_ERROR_RETURN(esp_io_expander_print_state(device_handle), false, "Print state failed");
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        runTransaction([&]() {
+            return esp_io_expander_print_state(device_handle);
+        }), false, "Print state failed"
+    );
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -312,4 +376,15 @@ Base::HostFullConfig *Base::getHostFullConfig()
     return &std::get<HostFullConfig>(_config.host.value());
 }
 
+esp_err_t Base::runTransaction(const Operation &operation) const
+{
+    TransactionRunner runner;
+    {
+        std::lock_guard<std::mutex> lock(_runner_mutex);
+        runner = _runner;
+    }
+
+    return (runner != nullptr) ? runner(operation) : operation();
+}
+
 } // namespace esp_expander
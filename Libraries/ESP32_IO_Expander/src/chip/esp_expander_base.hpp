@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <functional>
+#include <mutex>
 #include <optional>
 #include <variant>
 #include "driver/i2c.h"
@@ -75,6 +77,12 @@ public:
         DeviceConfig device = {};           /*!< I2C device configuration */
     };
 
+    /**
+     * @brief Bus transaction of the device and the function executing it
+     */
+    using Operation = std::function<esp_err_t(void)>;
+    using TransactionRunner = std::function<esp_err_t(const Operation &operation)>;
+
     /**
      * @brief The driver state enumeration
      */
@@ -242,6 +250,33 @@ public:
      */
     int64_t multiDigitalRead(uint32_t pin_mask);
 
+    /**
+     * @brief Hold output level changes until `flushOutput()` is called
+     *
+     * @note  All `digitalWrite()` and `multiDigitalWrite()` calls in between are coalesced into a single write
+     *        transaction, e.g. to toggle several control pins during panel initialization.
+     *
+     * @return true if success, otherwise false
+     */
+    bool holdOutput(void);
+
+    /**
+     * @brief Write the held output levels to the device
+     *
+     * @return true if success, otherwise false
+     */
+    bool flushOutput(void);
+
+    /**
+     * @brief Route the bus transactions of the device through a runner, e.g. a scheduler shared with the other
+     *        devices on the same I2C bus
+     *
+     * @note  The runner must execute the operation and return its result. Set `nullptr` to access the bus directly.
+     *
+     * @param[in] runner Transaction runner
+     */
+    void setTransactionRunner(TransactionRunner runner);
+
     /**
      * @brief Print IO expander status, include pin index, direction, input level and output level
      *
@@ -308,10 +343,13 @@ protected:
 
 private:
     HostFullConfig *getHostFullConfig();
+    esp_err_t runTransaction(const Operation &operation) const;
 
     State _state = State::DEINIT;
     bool _is_host_skip_init = false;
     Config _config = {};
+    mutable std::mutex _runner_mutex;
+    TransactionRunner _runner = nullptr;
 };
 
 } // namespace esp_expander
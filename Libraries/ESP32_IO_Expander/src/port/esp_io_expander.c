@@ -30,6 +30,8 @@ static char *TAG = "io_expander";
 
 static esp_err_t write_reg(esp_io_expander_handle_t handle, reg_type_t reg, uint32_t value);
 static esp_err_t read_reg(esp_io_expander_handle_t handle, reg_type_t reg, uint32_t *value);
+static esp_err_t read_output_reg_held(esp_io_expander_handle_t handle, uint32_t *value);
+static esp_err_t write_output_reg_held(esp_io_expander_handle_t handle, uint32_t value);
 
 esp_err_t esp_io_expander_set_dir(esp_io_expander_handle_t handle, uint32_t pin_num_mask, esp_io_expander_dir_t direction)
 {
@@ -86,7 +88,7 @@ esp_err_t esp_io_expander_set_level(esp_io_expander_handle_t handle, uint32_t pi
 
     uint32_t output_reg, temp;
     /* Read the current output level */
-    ESP_RETURN_ON_ERROR(read_reg(handle, REG_OUTPUT, &output_reg), TAG, "Read Output reg failed");
+    ESP_RETURN_ON_ERROR(read_output_reg_held(handle, &output_reg), TAG, "Read Output reg failed");
     temp = output_reg;
     /* Set expected output level */
     if ((level && !handle->config.flags.output_high_bit_zero) || (!level && handle->config.flags.output_high_bit_zero)) {
@@ -100,7 +102,7 @@ esp_err_t esp_io_expander_set_level(esp_io_expander_handle_t handle, uint32_t pi
     }
     /* Write to reg only when different */
     if (output_reg != temp) {
-        ESP_RETURN_ON_ERROR(write_reg(handle, REG_OUTPUT, output_reg), TAG, "Write Output reg failed");
+        ESP_RETURN_ON_ERROR(write_output_reg_held(handle, output_reg), TAG, "Write Output reg failed");
     }
 
     return ESP_OK;
@@ -127,6 +129,28 @@ esp_err_t esp_io_expander_get_level(esp_io_expander_handle_t handle, uint32_t pi
     return ESP_OK;
 }
 
+esp_err_t esp_io_expander_hold_output(esp_io_expander_handle_t handle)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "Invalid handle");
+
+    handle->held.flags.hold = 1;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_io_expander_flush_output(esp_io_expander_handle_t handle)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "Invalid handle");
+
+    handle->held.flags.hold = 0;
+    if (handle->held.flags.output_dirty) {
+        ESP_RETURN_ON_ERROR(write_reg(handle, REG_OUTPUT, handle->held.output), TAG, "Write output reg failed");
+        handle->held.flags.output_dirty = 0;
+    }
+
+    return ESP_OK;
+}
+
 esp_err_t esp_io_expander_print_state(esp_io_expander_handle_t handle)
 {
     ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "Invalid handle");
@@ -162,6 +186,13 @@ esp_err_t esp_io_expander_reset(esp_io_expander_handle_t handle)
     ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "Invalid handle");
     ESP_RETURN_ON_FALSE(handle->reset, ESP_ERR_NOT_SUPPORTED, TAG, "reset isn't implemented");
 
+    /* The device goes back to its default registers, the held levels are dropped */
+    if (handle->held.flags.output_dirty) {
+        ESP_LOGW(TAG, "Discard held output levels");
+    }
+    handle->held.flags.output_dirty = 0;
+    handle->held.flags.hold = 0;
+
     return handle->reset(handle);
 }
 
@@ -227,3 +258,40 @@ static esp_err_t read_reg(esp_io_expander_handle_t handle, reg_type_t reg, uint3
 
     return ESP_OK;
 }
+
+/**
+ * @brief Read the value of the output register, including the levels held by `esp_io_expander_hold_output()`
+ *
+ * @param handle: IO Expander handle
+ * @param value: Register's value
+ * @return
+ *      - ESP_OK: Success, otherwise returns ESP_ERR_xxx
+ */
+static esp_err_t read_output_reg_held(esp_io_expander_handle_t handle, uint32_t *value)
+{
+    if (handle->held.flags.output_dirty) {
+        *value = handle->held.output;
+        return ESP_OK;
+    }
+
+    return read_reg(handle, REG_OUTPUT, value);
+}
+
+/**
+ * @brief Write the value of the output register, or only keep it until flushed while the output is held
+ *
+ * @param handle: IO Expander handle
+ * @param value: Expected register's value
+ * @return
+ *      - ESP_OK: Success, otherwise returns ESP_ERR_xxx
+ */
+static esp_err_t write_output_reg_held(esp_io_expander_handle_t handle, uint32_t value)
+{
+    if (handle->held.flags.hold) {
+        handle->held.output = value;
+        handle->held.flags.output_dirty = 1;
+        return ESP_OK;
+    }
+
+    return write_reg(handle, REG_OUTPUT, value);
+}
@@ -187,6 +187,20 @@ struct esp_io_expander_s {
      * @brief Configuration structure
      */
     esp_io_expander_config_t config;
+
+    /**
+     * @brief Output levels held by `esp_io_expander_hold_output()` and not written to the device yet
+     *
+     * @note This is managed by the common layer, drivers only need to zero it when creating the handle. Drivers keep
+     *       the values of their registers themselves, this only stores the pending write.
+     */
+    struct {
+        uint32_t output;                    /*!< Value to write to the output register */
+        struct {
+            uint8_t hold : 1;               /*!< Output writes are held until flushed */
+            uint8_t output_dirty : 1;       /*!< `output` differs from the device because of held writes */
+        } flags;
+    } held;
 };
 
 /**
@@ -229,6 +243,31 @@ esp_err_t esp_io_expander_set_level(esp_io_expander_handle_t handle, uint32_t pi
  */
 esp_err_t esp_io_expander_get_level(esp_io_expander_handle_t handle, uint32_t pin_num_mask, uint32_t *level_mask);
 
+/**
+ * @brief Hold output writes until `esp_io_expander_flush_output()` is called
+ *
+ * @note In between, `esp_io_expander_set_level()` only updates the held levels, so any number of level changes are
+ *       coalesced into a single write transaction. `esp_io_expander_reset()` discards the held levels.
+ *
+ * @param handle: IO Expander handle
+ *
+ * @return
+ *      - ESP_OK: Success, otherwise returns ESP_ERR_xxx
+ */
+esp_err_t esp_io_expander_hold_output(esp_io_expander_handle_t handle);
+
+/**
+ * @brief Write the held output levels to the device and stop holding
+ *
+ * @note Nothing is written if the output levels are unchanged
+ *
+ * @param handle: IO Expander handle
+ *
+ * @return
+ *      - ESP_OK: Success, otherwise returns ESP_ERR_xxx
+ */
+esp_err_t esp_io_expander_flush_output(esp_io_expander_handle_t handle);
+
 /**
  * @brief Print the current status of each IO of the device, including direction, input level and output level
  *
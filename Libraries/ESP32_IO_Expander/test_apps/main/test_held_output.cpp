@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstddef>
+#include "unity.h"
+#include "esp_io_expander.hpp"
+
+/**
+ * A RAM-backed 8-bit expander which counts its register accesses, every access stands for one bus transaction
+ */
+typedef struct {
+    esp_io_expander_t base;
+    uint32_t output;
+    uint32_t direction;
+    int reads;
+    int writes;
+} fake_expander_t;
+
+static fake_expander_t *to_fake(esp_io_expander_handle_t handle)
+{
+    return (fake_expander_t *)((char *)handle - offsetof(fake_expander_t, base));
+}
+
+static esp_err_t fake_read_input_reg(esp_io_expander_handle_t handle, uint32_t *value)
+{
+    to_fake(handle)->reads++;
+    *value = to_fake(handle)->output;
+    return ESP_OK;
+}
+
+static esp_err_t fake_write_output_reg(esp_io_expander_handle_t handle, uint32_t value)
+{
+    to_fake(handle)->writes++;
+    to_fake(handle)->output = value;
+    return ESP_OK;
+}
+
+static esp_err_t fake_read_output_reg(esp_io_expander_handle_t handle, uint32_t *value)
+{
+    to_fake(handle)->reads++;
+    *value = to_fake(handle)->output;
+    return ESP_OK;
+}
+
+static esp_err_t fake_write_direction_reg(esp_io_expander_handle_t handle, uint32_t value)
+{
+    to_fake(handle)->writes++;
+    to_fake(handle)->direction = value;
+    return ESP_OK;
+}
+
+static esp_err_t fake_read_direction_reg(esp_io_expander_handle_t handle, uint32_t *value)
+{
+    to_fake(handle)->reads++;
+    *value = to_fake(handle)->direction;
+    return ESP_OK;
+}
+
+static esp_err_t fake_reset(esp_io_expander_handle_t handle)
+{
+    to_fake(handle)->output = 0xff;
+    to_fake(handle)->direction = 0xff;
+    return ESP_OK;
+}
+
+static void fake_init(fake_expander_t *fake)
+{
+    *fake = {};
+    fake->base.config.io_count = 8;
+    fake->base.config.flags.dir_out_bit_zero = 1;
+    fake->base.read_input_reg = fake_read_input_reg;
+    fake->base.write_output_reg = fake_write_output_reg;
+    fake->base.read_output_reg = fake_read_output_reg;
+    fake->base.write_direction_reg = fake_write_direction_reg;
+    fake->base.read_direction_reg = fake_read_direction_reg;
+    fake->base.reset = fake_reset;
+    fake_reset(&fake->base);
+}
+
+TEST_CASE("test held output levels are coalesced into one write", "[io_expander][hold]")
+{
+    fake_expander_t fake;
+    fake_init(&fake);
+    esp_io_expander_handle_t handle = &fake.base;
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_set_dir(handle, 0x0f, IO_EXPANDER_OUTPUT));
+    fake.writes = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_hold_output(handle));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_set_level(handle, IO_EXPANDER_PIN_NUM_0, 0));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_set_level(handle, IO_EXPANDER_PIN_NUM_1 | IO_EXPANDER_PIN_NUM_2, 0));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_set_level(handle, IO_EXPANDER_PIN_NUM_2, 1));
+    TEST_ASSERT_EQUAL(0, fake.writes);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_flush_output(handle));
+    TEST_ASSERT_EQUAL(1, fake.writes);
+    TEST_ASSERT_EQUAL_HEX32(0xfc, fake.output);
+
+    // Nothing to write if the held levels are unchanged
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_hold_output(handle));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_flush_output(handle));
+    TEST_ASSERT_EQUAL(1, fake.writes);
+}
+
+TEST_CASE("test held output levels are discarded on reset", "[io_expander][hold]")
+{
+    fake_expander_t fake;
+    fake_init(&fake);
+    esp_io_expander_handle_t handle = &fake.base;
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_set_dir(handle, IO_EXPANDER_PIN_NUM_0, IO_EXPANDER_OUTPUT));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_hold_output(handle));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_set_level(handle, IO_EXPANDER_PIN_NUM_0, 0));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_reset(handle));
+
+    // The reset also stops holding, so the next level change is written directly
+    fake.writes = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_flush_output(handle));
+    TEST_ASSERT_EQUAL(0, fake.writes);
+    TEST_ASSERT_EQUAL_HEX32(0xff, fake.output);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_set_dir(handle, IO_EXPANDER_PIN_NUM_0, IO_EXPANDER_OUTPUT));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_io_expander_set_level(handle, IO_EXPANDER_PIN_NUM_0, 0));
+    TEST_ASSERT_EQUAL_HEX32(0xfe, fake.output);
+}
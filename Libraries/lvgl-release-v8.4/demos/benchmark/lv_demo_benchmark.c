@@ -691,6 +691,10 @@ static void benchmark_init(void)
     lv_style_init(&style_common);
 
     lv_obj_update_layout(scr);
+
+#if LV_USE_REFR_PROFILER
+    lv_refr_prof_reset();
+#endif
 }
 
 void lv_demo_benchmark(void)
@@ -939,6 +943,44 @@ static void generate_report(void)
         row++;
     }
 
+#if LV_USE_MEM_TELEMETRY
+    /*Log in chunks as the log messages are limited in length*/
+    uint32_t json_len = lv_mem_telemetry_to_json(NULL, 0);
+    char * json = lv_mem_alloc(json_len + 1);
+    if(json) {
+        lv_mem_telemetry_to_json(json, json_len + 1);
+        LV_LOG("Memory telemetry (in json format)\r\n");
+        for(i = 0; i < json_len; i += 256) {
+            LV_LOG("%.*s", (int)LV_MIN(256, json_len - i), &json[i]);
+        }
+        LV_LOG("\r\n");
+        lv_mem_free(json);
+    }
+#endif
+
+#if LV_USE_REFR_PROFILER
+    LV_LOG("Render profile: type, time [us], blended pixels, calls\r\n");
+    for(i = 0; i < _LV_REFR_PROF_TYPE_LAST; i++) {
+        lv_refr_prof_stats_t stats;
+        lv_refr_prof_get_stats((lv_refr_prof_type_t)i, &stats);
+        LV_LOG("%s, %"LV_PRIu32", %"LV_PRIu32", %"LV_PRIu32"\r\n", lv_refr_prof_get_type_name((lv_refr_prof_type_t)i),
+               stats.time, stats.px_cnt, stats.call_cnt);
+    }
+
+    /*The last events in Chrome trace format. Save it to a .json file and open it in chrome://tracing or Perfetto*/
+    uint32_t trace_len = lv_refr_prof_to_chrome_trace(NULL, 0);
+    char * trace = lv_mem_alloc(trace_len + 1);
+    if(trace) {
+        lv_refr_prof_to_chrome_trace(trace, trace_len + 1);
+        LV_LOG("Render trace (in Chrome trace format)\r\n");
+        for(i = 0; i < trace_len; i += 256) {
+            LV_LOG("%.*s", (int)LV_MIN(256, trace_len - i), &trace[i]);
+        }
+        LV_LOG("\r\n");
+        lv_mem_free(trace);
+    }
+#endif
+
     //        lv_page_set_scrl_layout(page, LV_LAYOUT_COLUMN_LEFT);
 }
 
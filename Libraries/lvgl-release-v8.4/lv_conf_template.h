@@ -70,6 +70,20 @@
  *You will see an error log message if there wasn't enough buffers. */
 #define LV_MEM_BUF_MAX_NUM 16
 
+/*Size of an arena in bytes for the scratch memory of a display refresh (e.g. `lv_mem_buf_get()`, layer buffers).
+ *The arena is reset at the end of each refresh, allocations which don't fit are served by `lv_mem_alloc()`.
+ *0: disable the arena*/
+#define LV_MEM_FRAME_ARENA_SIZE 0     /*[bytes]*/
+
+/*Size of a region in bytes for the pools of small fixed size blocks (list nodes, objects, event descriptors).
+ *Blocks are served from size classes up to 256 bytes in O(1), allocations which don't fit use the heap.
+ *0: disable the pools. Not used with `LV_ENABLE_GC`*/
+#define LV_MEM_SLAB_SIZE 0     /*[bytes]*/
+
+/*1: Count the allocations per subsystem (objects, styles, images, fonts, drawing) and their sizes.
+ *See `lv_mem_tag_monitor()` and `lv_mem_telemetry_to_json()`. Adds a small header to each allocation.*/
+#define LV_USE_MEM_TELEMETRY 0
+
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #define LV_MEMCPY_MEMSET_STD 0
 
@@ -172,6 +186,12 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*Max. number of opaque objects to collect in each refreshed area. The parts of the objects
+ *which are covered by an opaque object drawn later are not drawn (occlusion culling).
+ *The DRAW_MAIN/POST events are not sent to the fully covered objects.
+ *0: disable occlusion culling*/
+#define LV_REFR_OCCLUDER_CNT 0
+
 /*-------------
  * GPU
  *-----------*/
@@ -297,6 +317,25 @@
 /*1: Draw random colored rectangles over the redrawn areas*/
 #define LV_USE_REFR_DEBUG 0
 
+/*1: Count the dispatched and the skipped events per event code. See `lv_event_get_dispatch_cnt()`*/
+#define LV_USE_EVENT_STATS 0
+
+/*1: Measure the time, the blended pixels and the calls of each object and draw primitive while rendering.
+ *See `lv_refr_prof_get_obj_stats()` and `lv_refr_prof_to_chrome_trace()`*/
+#define LV_USE_REFR_PROFILER 0
+#if LV_USE_REFR_PROFILER
+    /*Header and expression to get the current time in [us]. The default has only 1 ms resolution.*/
+    #define LV_REFR_PROFILER_TIME_INCLUDE <stdint.h>
+    #define LV_REFR_PROFILER_TIME_GET (lv_tick_get() * 1000)
+    /*E.g. with ESP-IDF*/
+    // #define LV_REFR_PROFILER_TIME_INCLUDE "esp_timer.h"
+    // #define LV_REFR_PROFILER_TIME_GET esp_timer_get_time()
+    /*Number of the last events to keep in a ring buffer (~20 bytes each)*/
+    #define LV_REFR_PROFILER_EVENT_CNT 256
+    /*Number of the most expensive objects to track*/
+    #define LV_REFR_PROFILER_OBJ_CNT 16
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #define LV_SPRINTF_CUSTOM 0
 #if LV_SPRINTF_CUSTOM
@@ -494,6 +533,7 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1 /*Enable selecting text of the label*/
     #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
+    #define LV_LABEL_LAYOUT_CACHE 1   /*Keep the line breaks of the text to reuse them in drawing and position queries*/
 #endif
 
 #define LV_USE_LINE       1
@@ -611,6 +651,14 @@
 
 /*File system interfaces for common APIs */
 
+/*>0: Cache this number of bytes of the files in blocks shared by the drivers with `block_cache = 1`
+ *Blocks read in sequence are read ahead. See `lv_fs_get_stats()`*/
+#define LV_FS_BLOCK_CACHE_SIZE 0
+#if LV_FS_BLOCK_CACHE_SIZE
+    #define LV_FS_BLOCK_CACHE_BLOCK_SIZE 512  /*Size of a cached block in bytes*/
+    #define LV_FS_BLOCK_CACHE_READ_AHEAD 4    /*Number of blocks to read at once if the file is read sequentially*/
+#endif
+
 /*API for fopen, fread, etc*/
 #define LV_USE_FS_STDIO 0
 #if LV_USE_FS_STDIO
@@ -625,6 +673,7 @@
     #define LV_FS_POSIX_LETTER '\0'     /*Set an upper cased letter on which the drive will accessible (e.g. 'A')*/
     #define LV_FS_POSIX_PATH ""         /*Set the working directory. File/directory paths will be appended to it.*/
     #define LV_FS_POSIX_CACHE_SIZE 0    /*>0 to cache this number of bytes in lv_fs_read()*/
+    #define LV_FS_POSIX_BLOCK_CACHE 0   /*1: Use the shared block cache (LV_FS_BLOCK_CACHE_SIZE) instead of LV_FS_POSIX_CACHE_SIZE*/
 #endif
 
 /*API for CreateFile, ReadFile, etc*/
@@ -651,6 +700,16 @@
 
 /*PNG decoder library*/
 #define LV_USE_PNG 0
+#if LV_USE_PNG
+    /*1: Decode the images line by line instead of at once. Needs the zlib window (max. 32 kB) and a few rows
+     *instead of the whole image. Interlaced PNGs are still decoded at once. The images can't be zoomed or rotated.*/
+    #define LV_PNG_USE_STREAM 0
+    #if LV_PNG_USE_STREAM
+        /*>0: Keep this many bands of decoded rows per image to draw the image again without decoding it*/
+        #define LV_PNG_STREAM_BAND_CNT 0
+        #define LV_PNG_STREAM_BAND_HEIGHT 16  /*Number of rows in a band*/
+    #endif
+#endif
 
 /*BMP decoder library*/
 #define LV_USE_BMP 0
@@ -658,6 +717,17 @@
 /* JPG + split JPG decoder library.
  * Split JPG is a custom format optimized for embedded systems. */
 #define LV_USE_SJPG 0
+#if LV_USE_SJPG
+    /*Number of decoded frames (bands of the split JPG) kept per image in native color format.
+     *Frames are reused in LRU order while the image is opened, e.g. in the image cache.*/
+    #define LV_SJPG_CACHE_FRAME_CNT 1
+
+    /*Optimization level of the decoder
+     *0: Basic optimization. Suitable for 8/16-bit MCUs.
+     *1: + 32-bit barrel shifter. Suitable for 32-bit MCUs.
+     *2: + Table based huffman decoding. Needs 6 kB more RAM while an image is opened*/
+    #define LV_SJPG_FAST_DECODE 0
+#endif
 
 /*GIF decoder library*/
 #define LV_USE_GIF 0
@@ -706,6 +776,12 @@
 
 /*1: Enable API to take snapshot for object*/
 #define LV_USE_SNAPSHOT 0
+#if LV_USE_SNAPSHOT
+    /*1: Draw snapshots of the screens during `lv_scr_load_anim()` instead of redrawing them in every frame.
+     *Needs memory for a snapshot of both screens while the animation runs, else the screens are drawn normally.
+     *The screens don't change during the animation, e.g. a spinner stops until the new screen is loaded.*/
+    #define LV_SCR_LOAD_ANIM_SNAPSHOT 0
+#endif
 
 /*1: Enable Monkey test*/
 #define LV_USE_MONKEY 0
@@ -36,6 +36,7 @@ extern "C" {
 #include "src/core/lv_group.h"
 #include "src/core/lv_indev.h"
 #include "src/core/lv_refr.h"
+#include "src/core/lv_refr_prof.h"
 #include "src/core/lv_disp.h"
 #include "src/core/lv_theme.h"
 
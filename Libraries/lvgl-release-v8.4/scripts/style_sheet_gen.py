@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+
+'''
+Compiles the local style properties of generated UI code (e.g. SquareLine Studio screens) into
+constant styles.
+
+The constant `lv_obj_set_style_<prop>(obj, value, selector);` calls of every object and selector
+are collected into a `lv_style_const_prop_t` array sorted by property ID and attached to the object
+with a single `lv_obj_add_style()` call. Identical property sets are shared by the objects.
+The arrays are placed in flash and are searched with a binary search (see `LV_STYLE_CONST_SORTED_INIT`).
+
+Calls with non-constant values and the helper setters (e.g. `lv_obj_set_style_pad_all`) are kept as they are.
+
+Usage: style_sheet_gen.py [--dry-run] file.c [file2.c ...]
+'''
+
+import argparse
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(__file__)
+LV_STYLE_H = os.path.join(SCRIPT_DIR, "..", "src", "misc", "lv_style.h")
+
+BLOCK_BEGIN = "/*Constant styles generated by style_sheet_gen.py. Do not edit.*/"
+BLOCK_END = "/*End of the generated constant styles*/"
+
+ASSIGN_RE = re.compile(r"\b(\w+)\s*=[^=]")
+CALL_RE = re.compile(r"^(\s*)lv_obj_set_style_(\w+)\((.*)\);\s*(//.*)?$")
+NUM_RE = re.compile(r"^-?(0x[0-9a-fA-F]+|\d+)$")
+CONST_ID_RE = re.compile(r"^[A-Z][A-Z0-9_]*$")
+ADDR_RE = re.compile(r"^&\w+$")
+COLOR_HEX_RE = re.compile(r"^lv_color_hex\((0x[0-9a-fA-F]+)\)$")
+COLOR_MAKE_RE = re.compile(r"^lv_color_make\(([^,()]+),([^,()]+),([^,()]+)\)$")
+PCT_RE = re.compile(r"^lv_pct\((-?\d+)\)$")
+
+
+def load_prop_ids():
+    ids = {}
+    with open(LV_STYLE_H) as f:
+        for m in re.finditer(r"^\s*LV_STYLE_([A-Z0-9_]+)\s*=\s*(\d+),", f.read(), re.M):
+            ids[m.group(1)] = int(m.group(2))
+    return ids
+
+
+def split_args(s):
+    args = []
+    depth = 0
+    cur = ""
+    for c in s:
+        if c == "," and depth == 0:
+            args.append(cur.strip())
+            cur = ""
+            continue
+        if c == "(":
+            depth += 1
+        elif c == ")":
+            depth -= 1
+        cur += c
+    args.append(cur.strip())
+    return args
+
+
+def const_value(value):
+    '''Return the value usable in a static initializer or None if it's not constant'''
+    value = value.strip()
+    if NUM_RE.match(value) or CONST_ID_RE.match(value) or ADDR_RE.match(value):
+        return value
+
+    m = COLOR_HEX_RE.match(value)
+    if m:
+        c = int(m.group(1), 16)
+        return "LV_COLOR_MAKE(0x%02X, 0x%02X, 0x%02X)" % ((c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF)
+
+    m = COLOR_MAKE_RE.match(value)
+    if m and all(NUM_RE.match(v.strip()) for v in m.groups()):
+        return "LV_COLOR_MAKE(%s)" % ", ".join(v.strip() for v in m.groups())
+
+    m = PCT_RE.match(value)
+    if m:
+        return "LV_PCT(%s)" % m.group(1)
+
+    return None
+
+
+def selector_name(selector):
+    '''`LV_PART_MAIN | LV_STATE_PRESSED` -> `main_pressed`'''
+    tokens = [t.strip() for t in selector.split("|")]
+    parts = [t[len("LV_PART_"):].lower() for t in tokens if t.startswith("LV_PART_")] or ["main"]
+    states = [t[len("LV_STATE_"):].lower() for t in tokens if t.startswith("LV_STATE_")] or ["default"]
+    return "_".join(parts + states)
+
+
+def convert(src, prop_ids):
+    lines = src.split("\n")
+
+    # Collect the constant calls per function, object and selector.
+    # A variable can be reused for several objects (e.g. `obj` in EEZ Studio code) so count the assignments too.
+    groups = {}     # (func, obj, assignment, selector) -> {"line": first line, "props": {prop: value}}
+    remove = set()
+    assign_cnt = {}
+    func = 0
+    depth = 0
+    for i, line in enumerate(lines):
+        for name in ASSIGN_RE.findall(line):
+            assign_cnt[name] = assign_cnt.get(name, 0) + 1
+
+        m = CALL_RE.match(line)
+        if m and depth > 0:
+            args = split_args(m.group(3))
+            prop = m.group(2).upper()
+            if len(args) == 3 and prop in prop_ids:
+                value = const_value(args[1])
+                if value is not None:
+                    key = (func, args[0], assign_cnt.get(args[0], 0), re.sub(r"\s+", " ", args[2]))
+                    g = groups.setdefault(key, {"line": i, "indent": m.group(1), "props": {}})
+                    g["props"][prop] = value
+                    remove.add(i)
+
+        code = re.sub(r"//.*$", "", line)
+        code = re.sub(r'"(\\.|[^"\\])*"', '""', code)
+        depth += code.count("{") - code.count("}")
+        if depth == 0 and "}" in code:
+            func += 1
+
+    if not groups:
+        return None
+
+    if BLOCK_BEGIN in src:
+        raise RuntimeError("the file has both generated styles and style setters; regenerate it first")
+
+    # Share the identical property sets
+    styles = {}     # sorted props tuple -> name
+    add_calls = {}  # line -> add_style call
+    for (func, obj, assignment, selector), g in groups.items():
+        props = tuple(sorted(g["props"].items(), key=lambda p: prop_ids[p[0]]))
+        if props not in styles:
+            base = "style_%s_%s" % (obj, selector_name(selector))
+            name = base
+            n = 1
+            while name in styles.values():
+                name = "%s_%d" % (base, n)
+                n += 1
+            styles[props] = name
+        add_calls[g["line"]] = "%slv_obj_add_style(%s, (lv_style_t *)&%s, %s);" % (
+            g["indent"], obj, styles[props], selector)
+
+    block = [BLOCK_BEGIN]
+    for props, name in styles.items():
+        block.append("static const lv_style_const_prop_t %s_props[] = {" % name)
+        for prop, value in props:
+            block.append("    LV_STYLE_CONST_%s(%s)," % (prop, value))
+        block.append("};")
+        block.append("static LV_STYLE_CONST_SORTED_INIT(%s, %s_props);" % (name, name))
+        block.append("")
+    block[-1] = BLOCK_END
+
+    out = []
+    inserted = False
+    last_include = max([i for i, line in enumerate(lines) if line.startswith("#include")], default=-1)
+    for i, line in enumerate(lines):
+        if i in add_calls:
+            out.append(add_calls[i])
+        elif i not in remove:
+            out.append(line)
+        if i == last_include:
+            out += [""] + block
+            if i + 1 < len(lines) and lines[i + 1].strip():
+                out.append("")
+            inserted = True
+    if not inserted:
+        out = block + [""] + out
+
+    return "\n".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile the local style properties of UI files into constant styles")
+    parser.add_argument("--dry-run", action="store_true", help="print the result instead of overwriting the files")
+    parser.add_argument("files", nargs="+")
+    args = parser.parse_args()
+
+    prop_ids = load_prop_ids()
+    for path in args.files:
+        with open(path, encoding="utf-8") as f:
+            src = f.read()
+        try:
+            res = convert(src, prop_ids)
+        except RuntimeError as e:
+            print("%s: %s" % (path, e), file=sys.stderr)
+            return 1
+
+        if res is None:
+            print("%s: no constant style properties" % path)
+        elif args.dry_run:
+            print(res)
+        else:
+            with open(path, "w", encoding="utf-8") as f:
+                f.write(res)
+            print("%s: converted" % path)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
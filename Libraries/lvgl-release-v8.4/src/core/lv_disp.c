@@ -9,6 +9,9 @@
 #include "lv_disp.h"
 #include "../misc/lv_math.h"
 #include "../core/lv_refr.h"
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+    #include "../extra/others/snapshot/lv_snapshot.h"
+#endif
 
 /*********************
  *      DEFINES
@@ -28,6 +31,10 @@ static void set_x_anim(void * obj, int32_t v);
 static void set_y_anim(void * obj, int32_t v);
 static void scr_anim_ready(lv_anim_t * a);
 static bool is_out_anim(lv_scr_load_anim_t a);
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+    static void scr_snapshot_take(lv_disp_t * d);
+    static lv_img_dsc_t * scr_snapshot_create(lv_obj_t * scr);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -243,6 +250,11 @@ void lv_scr_load_anim(lv_obj_t * new_scr, lv_scr_load_anim_t anim_type, uint32_t
 
     d->scr_to_load = new_scr;
 
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+    _lv_disp_scr_snapshot_free(d);
+    d->scr_load_snapshot = anim_type != LV_SCR_LOAD_ANIM_NONE;
+#endif
+
     if(d->prev_scr && d->del_prev) {
         lv_obj_del(d->prev_scr);
         d->prev_scr = NULL;
@@ -465,6 +477,27 @@ lv_timer_t * _lv_disp_get_refr_timer(lv_disp_t * disp)
     return disp->refr_timer;
 }
 
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+void _lv_disp_scr_snapshot_free(lv_disp_t * disp)
+{
+    if(disp->scr_snapshot_act == NULL && disp->scr_snapshot_prev == NULL) return;
+
+    lv_img_dsc_t ** snapshots[2] = {&disp->scr_snapshot_act, &disp->scr_snapshot_prev};
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        if(*snapshots[i] == NULL) continue;
+        /*It might be in the image cache*/
+        lv_img_cache_invalidate_src(*snapshots[i]);
+        lv_snapshot_free(*snapshots[i]);
+        *snapshots[i] = NULL;
+    }
+
+    lv_area_t a;
+    lv_area_set(&a, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    _lv_inv_area(disp, &a);
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -496,6 +529,10 @@ static void scr_load_anim_start(lv_anim_t * a)
     d->act_scr = a->var;
 
     lv_event_send(d->act_scr, LV_EVENT_SCREEN_LOAD_START, NULL);
+
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+    if(d->scr_load_snapshot) scr_snapshot_take(d);
+#endif
 }
 
 static void opa_scale_anim(void * obj, int32_t v)
@@ -520,6 +557,10 @@ static void scr_anim_ready(lv_anim_t * a)
     lv_event_send(d->act_scr, LV_EVENT_SCREEN_LOADED, NULL);
     lv_event_send(d->prev_scr, LV_EVENT_SCREEN_UNLOADED, NULL);
 
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+    _lv_disp_scr_snapshot_free(d);
+#endif
+
     if(d->prev_scr && d->del_prev) lv_obj_del(d->prev_scr);
     d->prev_scr = NULL;
     d->draw_prev_over_act = false;
@@ -528,6 +569,49 @@ static void scr_anim_ready(lv_anim_t * a)
     lv_obj_invalidate(d->act_scr);
 }
 
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+/*Take a snapshot of both screens to draw them during the animation as images*/
+static void scr_snapshot_take(lv_disp_t * d)
+{
+    _lv_disp_scr_snapshot_free(d);
+
+    d->scr_snapshot_act = scr_snapshot_create(d->act_scr);
+    if(d->prev_scr) d->scr_snapshot_prev = scr_snapshot_create(d->prev_scr);
+
+    /*Fall back to the normal drawing if there is no memory for both snapshots*/
+    if(d->scr_snapshot_act == NULL || (d->prev_scr && d->scr_snapshot_prev == NULL)) {
+        LV_LOG_WARN("not enough memory for the snapshots of the screens");
+        _lv_disp_scr_snapshot_free(d);
+    }
+}
+
+static lv_img_dsc_t * scr_snapshot_create(lv_obj_t * scr)
+{
+    /*The alpha channel is required only to show the display's background through the screen*/
+    lv_img_cf_t cf = lv_obj_get_style_bg_opa(scr, LV_PART_MAIN) >= LV_OPA_MAX ?
+                     LV_IMG_CF_TRUE_COLOR : LV_IMG_CF_TRUE_COLOR_ALPHA;
+
+    /*The opacity of the fade animations is applied when the snapshot is drawn*/
+    lv_style_value_t opa;
+    bool has_opa = lv_obj_get_local_style_prop(scr, LV_STYLE_OPA, &opa, 0) == LV_STYLE_RES_FOUND;
+    if(has_opa) lv_obj_remove_local_style_prop(scr, LV_STYLE_OPA, 0);
+
+    /*Don't use `lv_snapshot_take()` as it asserts if there is not enough memory*/
+    uint32_t buf_size = lv_snapshot_buf_size_needed(scr, cf);
+    lv_img_dsc_t * dsc = lv_mem_alloc(sizeof(lv_img_dsc_t));
+    void * buf = dsc ? lv_mem_alloc(buf_size) : NULL;
+    if(buf == NULL || lv_snapshot_take_to_buf(scr, cf, dsc, buf, buf_size) != LV_RES_OK) {
+        if(buf) lv_mem_free(buf);
+        if(dsc) lv_mem_free(dsc);
+        dsc = NULL;
+    }
+
+    if(has_opa) lv_obj_set_local_style_prop(scr, LV_STYLE_OPA, opa, 0);
+
+    return dsc;
+}
+#endif
+
 static bool is_out_anim(lv_scr_load_anim_t anim_type)
 {
     return anim_type == LV_SCR_LOAD_ANIM_FADE_OUT  ||
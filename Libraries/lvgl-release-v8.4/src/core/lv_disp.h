@@ -170,6 +170,14 @@ bool lv_disp_is_invalidation_enabled(lv_disp_t * disp);
  */
 lv_timer_t * _lv_disp_get_refr_timer(lv_disp_t * disp);
 
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+/**
+ * Free the snapshots of the screens taken for a screen load animation and draw the screens normally again.
+ * @param disp pointer to a display
+ */
+void _lv_disp_scr_snapshot_free(lv_disp_t * disp);
+#endif
+
 /*------------------------------------------------
  * To improve backward compatibility
  * Recommended only if you have one display
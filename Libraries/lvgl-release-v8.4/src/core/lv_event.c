@@ -14,6 +14,14 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+/*Bit of an event code in the event masks. The custom event codes share the last bit.*/
+#define EVENT_BIT(code) ((uint64_t)1 << LV_MIN((uint32_t)(code), 63))
+
+/*Events sent only to let the user hook into the drawing*/
+#define DRAW_HOOK_EVENTS (EVENT_BIT(LV_EVENT_DRAW_MAIN_BEGIN) | EVENT_BIT(LV_EVENT_DRAW_MAIN_END) | \
+                          EVENT_BIT(LV_EVENT_DRAW_POST_BEGIN) | EVENT_BIT(LV_EVENT_DRAW_POST_END) | \
+                          EVENT_BIT(LV_EVENT_DRAW_PART_BEGIN) | EVENT_BIT(LV_EVENT_DRAW_PART_END))
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -29,12 +37,20 @@ typedef struct _lv_event_dsc_t {
 static lv_event_dsc_t * lv_obj_get_event_dsc(const lv_obj_t * obj, uint32_t id);
 static lv_res_t event_send_core(lv_event_t * e);
 static bool event_is_bubbled(lv_event_t * e);
+static bool has_event_cb(const lv_obj_t * obj, uint32_t code);
+static uint64_t get_filter_mask(uint8_t filter);
+static void update_event_mask(lv_obj_t * obj);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static lv_event_t * event_head;
 
+#if LV_USE_EVENT_STATS
+    static uint32_t dispatch_cnt[_LV_EVENT_LAST + 1];
+    static uint32_t skip_cnt[_LV_EVENT_LAST + 1];
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -44,6 +60,12 @@ static lv_event_t * event_head;
     #define EVENT_TRACE(...)
 #endif
 
+#if LV_USE_EVENT_STATS
+    #define EVENT_STAT_INC(cnt, code) cnt[LV_MIN((uint32_t)(code), _LV_EVENT_LAST)]++
+#else
+    #define EVENT_STAT_INC(cnt, code)
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -54,6 +76,12 @@ lv_res_t lv_event_send(lv_obj_t * obj, lv_event_code_t event_code, void * param)
 
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The draw hooks don't bubble, skip them if the object doesn't use them*/
+    if((DRAW_HOOK_EVENTS & EVENT_BIT(event_code)) && obj->draw_hooks == 0 && !has_event_cb(obj, event_code)) {
+        EVENT_STAT_INC(skip_cnt, event_code);
+        return LV_RES_OK;
+    }
+
     lv_event_t e;
     e.target = obj;
     e.current_target = obj;
@@ -154,6 +182,24 @@ void _lv_event_mark_deleted(lv_obj_t * obj)
     }
 }
 
+#if LV_USE_EVENT_STATS
+uint32_t lv_event_get_dispatch_cnt(lv_event_code_t code)
+{
+    return dispatch_cnt[LV_MIN((uint32_t)code, _LV_EVENT_LAST)];
+}
+
+uint32_t lv_event_get_skip_cnt(lv_event_code_t code)
+{
+    return skip_cnt[LV_MIN((uint32_t)code, _LV_EVENT_LAST)];
+}
+
+void lv_event_reset_stats(void)
+{
+    lv_memset_00(dispatch_cnt, sizeof(dispatch_cnt));
+    lv_memset_00(skip_cnt, sizeof(skip_cnt));
+}
+#endif
+
 struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb, lv_event_code_t filter,
                                              void * user_data)
 {
@@ -161,13 +207,14 @@ struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event
     lv_obj_allocate_spec_attr(obj);
 
     obj->spec_attr->event_dsc_cnt++;
-    obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
-                                               obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
+    obj->spec_attr->event_dsc = lv_mem_slab_realloc(obj->spec_attr->event_dsc,
+                                                    obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
     LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
 
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].cb = event_cb;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].filter = filter;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].user_data = user_data;
+    obj->spec_attr->event_mask |= get_filter_mask(filter);
 
     return &obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1];
 }
@@ -185,9 +232,10 @@ bool lv_obj_remove_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb)
                 obj->spec_attr->event_dsc[i] = obj->spec_attr->event_dsc[i + 1];
             }
             obj->spec_attr->event_dsc_cnt--;
-            obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
-                                                       obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
+            obj->spec_attr->event_dsc = lv_mem_slab_realloc(obj->spec_attr->event_dsc,
+                                                            obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            update_event_mask(obj);
             return true;
         }
     }
@@ -210,9 +258,10 @@ bool lv_obj_remove_event_cb_with_user_data(lv_obj_t * obj, lv_event_cb_t event_c
                 obj->spec_attr->event_dsc[i] = obj->spec_attr->event_dsc[i + 1];
             }
             obj->spec_attr->event_dsc_cnt--;
-            obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
-                                                       obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
+            obj->spec_attr->event_dsc = lv_mem_slab_realloc(obj->spec_attr->event_dsc,
+                                                            obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            update_event_mask(obj);
             return true;
         }
     }
@@ -234,9 +283,10 @@ bool lv_obj_remove_event_dsc(lv_obj_t * obj, struct _lv_event_dsc_t * event_dsc)
                 obj->spec_attr->event_dsc[i] = obj->spec_attr->event_dsc[i + 1];
             }
             obj->spec_attr->event_dsc_cnt--;
-            obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
-                                                       obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
+            obj->spec_attr->event_dsc = lv_mem_slab_realloc(obj->spec_attr->event_dsc,
+                                                            obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            update_event_mask(obj);
             return true;
         }
     }
@@ -429,8 +479,11 @@ static lv_res_t event_send_core(lv_event_t * e)
         if(e->deleted) return LV_RES_INV;
     }
 
+    EVENT_STAT_INC(dispatch_cnt, e->code);
+
     lv_res_t res = LV_RES_OK;
-    lv_event_dsc_t * event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
+    lv_event_dsc_t * event_dsc = NULL;
+    if(has_event_cb(e->current_target, e->code)) event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
 
     uint32_t i = 0;
     while(event_dsc && res == LV_RES_OK) {
@@ -451,7 +504,9 @@ static lv_res_t event_send_core(lv_event_t * e)
 
     res = lv_obj_event_base(NULL, e);
 
-    event_dsc = res == LV_RES_INV ? NULL : lv_obj_get_event_dsc(e->current_target, 0);
+    /*The class might have added event callbacks*/
+    if(res == LV_RES_INV || !has_event_cb(e->current_target, e->code)) event_dsc = NULL;
+    else event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
 
     i = 0;
     while(event_dsc && res == LV_RES_OK) {
@@ -519,3 +574,26 @@ static bool event_is_bubbled(lv_event_t * e)
             return true;
     }
 }
+
+static bool has_event_cb(const lv_obj_t * obj, uint32_t code)
+{
+    if(obj->spec_attr == NULL) return false;
+    return (obj->spec_attr->event_mask & EVENT_BIT(code)) != 0;
+}
+
+static uint64_t get_filter_mask(uint8_t filter)
+{
+    filter &= ~LV_EVENT_PREPROCESS;
+    if(filter == LV_EVENT_ALL) return UINT64_MAX;
+    else return EVENT_BIT(filter);
+}
+
+static void update_event_mask(lv_obj_t * obj)
+{
+    obj->spec_attr->event_mask = 0;
+
+    uint32_t i;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        obj->spec_attr->event_mask |= get_filter_mask(obj->spec_attr->event_dsc[i].filter);
+    }
+}
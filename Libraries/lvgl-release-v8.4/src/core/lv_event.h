@@ -222,6 +222,29 @@ uint32_t lv_event_register_id(void);
  */
 void _lv_event_mark_deleted(struct _lv_obj_t * obj);
 
+#if LV_USE_EVENT_STATS
+
+/**
+ * Get how many times an event was dispatched to an object. Bubbling to a parent counts as a new dispatch.
+ * @param code      an event code, the custom event codes are counted together
+ * @return          number of dispatches since the last `lv_event_reset_stats()`
+ */
+uint32_t lv_event_get_dispatch_cnt(lv_event_code_t code);
+
+/**
+ * Get how many times an event wasn't dispatched because neither the object's class nor an event callback uses it.
+ * @param code      an event code, the custom event codes are counted together
+ * @return          number of skipped events since the last `lv_event_reset_stats()`
+ */
+uint32_t lv_event_get_skip_cnt(lv_event_code_t code);
+
+/**
+ * Reset the dispatch and skip counters of all event codes
+ */
+void lv_event_reset_stats(void);
+
+#endif /*LV_USE_EVENT_STATS*/
+
 /**
  * Add an event handler function for an object.
  * Used by the user to react on event which happens with the object.
@@ -157,6 +157,8 @@ typedef struct {
     lv_group_t * group_p;
 
     struct _lv_event_dsc_t * event_dsc; /**< Dynamically allocated event callback and user data array*/
+    uint64_t event_mask;                /**< Bit `i` is set if there is an event callback for the event code `i`.
+                                             The custom event codes share the last bit.*/
     lv_point_t scroll;                  /**< The current X/Y scroll offset*/
 
     lv_coord_t ext_click_pad;           /**< Extra click padding in all direction*/
@@ -189,6 +191,8 @@ typedef struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t being_deleted   : 1;
+    uint16_t draw_hooks : 1;    /**< The class handles the draw hook events, see `no_draw_hooks` in ::lv_obj_class_t*/
+    uint16_t child_layout_inv : 1;  /**< A descendant needs layout update, i.e. the subtree can't be skipped*/
 } lv_obj_t;
 
 /**********************
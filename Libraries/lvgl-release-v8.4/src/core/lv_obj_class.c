@@ -27,6 +27,7 @@
  **********************/
 static void lv_obj_construct(lv_obj_t * obj);
 static uint32_t get_instance_size(const lv_obj_class_t * class_p);
+static bool has_draw_hooks(const lv_obj_class_t * class_p);
 
 /**********************
  *  STATIC VARIABLES
@@ -44,11 +45,14 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
 {
     LV_TRACE_OBJ_CREATE("Creating object with %p class on %p parent", (void *)class_p, (void *)parent);
     uint32_t s = get_instance_size(class_p);
-    lv_obj_t * obj = lv_mem_alloc(s);
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_OBJ);
+    lv_obj_t * obj = lv_mem_slab_alloc(s);
+    lv_mem_set_tag(tag_prev);
     if(obj == NULL) return NULL;
     lv_memset_00(obj, s);
     obj->class_p = class_p;
     obj->parent = parent;
+    obj->draw_hooks = has_draw_hooks(class_p);
 
     /*Create a screen*/
     if(parent == NULL) {
@@ -107,7 +111,10 @@ void lv_obj_class_init_obj(lv_obj_t * obj)
     lv_obj_enable_style_refresh(false);
 
     lv_theme_apply(obj);
+
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_OBJ);
     lv_obj_construct(obj);
+    lv_mem_set_tag(tag_prev);
 
     lv_obj_enable_style_refresh(true);
     lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
@@ -200,3 +207,15 @@ static uint32_t get_instance_size(const lv_obj_class_t * class_p)
 
     return base->instance_size;
 }
+
+static bool has_draw_hooks(const lv_obj_class_t * class_p)
+{
+    /*Any class which doesn't tell that it ignores them might use them*/
+    const lv_obj_class_t * base = class_p;
+    while(base) {
+        if(base->event_cb && base->no_draw_hooks == 0) return true;
+        base = base->base_class;
+    }
+
+    return false;
+}
@@ -58,6 +58,8 @@ typedef struct _lv_obj_class_t {
     lv_coord_t height_def;
     uint32_t editable : 2;             /**< Value from ::lv_obj_class_editable_t*/
     uint32_t group_def : 2;            /**< Value from ::lv_obj_class_group_def_t*/
+    uint32_t no_draw_hooks : 1;        /**< 1: `event_cb` doesn't handle `LV_EVENT_DRAW_MAIN/POST_BEGIN/END` and
+                                            `LV_EVENT_DRAW_PART_BEGIN/END`, skip them if there is no event callback for them*/
     uint32_t instance_size : 16;
 } lv_obj_class_t;
 
@@ -26,6 +26,7 @@
 static lv_coord_t calc_content_width(lv_obj_t * obj);
 static lv_coord_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static lv_obj_t * mark_child_layout_inv(lv_obj_t * obj);
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv);
 
 /**********************
@@ -200,7 +201,9 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     /*Invalidate the new area*/
     lv_obj_invalidate(obj);
 
+    /*Let the next layout update find the object*/
     obj->readjust_scroll_after_layout = 1;
+    mark_child_layout_inv(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -290,7 +293,7 @@ void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
     obj->layout_inv = 1;
 
     /*Mark the screen as dirty too to mark that there is something to do on this screen*/
-    lv_obj_t * scr = lv_obj_get_screen(obj);
+    lv_obj_t * scr = mark_child_layout_inv(obj);
     scr->scr_layout_inv = 1;
 
     /*Make the display refreshing*/
@@ -1123,11 +1126,17 @@ static lv_coord_t calc_content_height(lv_obj_t * obj)
 
 static void layout_update_core(lv_obj_t * obj)
 {
+    /*Clear it first as the children might be marked again while they are updated*/
+    obj->child_layout_inv = 0;
+
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+        /*Skip the subtrees where nothing has changed*/
+        if(child->layout_inv || child->child_layout_inv || child->readjust_scroll_after_layout) {
+            layout_update_core(child);
+        }
     }
 
     if(obj->layout_inv) {
@@ -1150,6 +1159,23 @@ static void layout_update_core(lv_obj_t * obj)
     }
 }
 
+/**
+ * Mark the ancestors of an object to let the layout update find the object
+ * @param obj       pointer to an object
+ * @return          the screen of the object
+ */
+static lv_obj_t * mark_child_layout_inv(lv_obj_t * obj)
+{
+    /*Go up to the screen even if an ancestor is already marked because
+     *the ancestors are cleared before their children while updating the layout*/
+    while(obj->parent) {
+        obj = obj->parent;
+        obj->child_layout_inv = 1;
+    }
+
+    return obj;
+}
+
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv)
 {
     int16_t angle = lv_obj_get_style_transform_angle(obj, 0);
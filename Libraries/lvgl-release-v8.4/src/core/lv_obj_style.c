@@ -95,7 +95,9 @@ void lv_obj_add_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t se
     /*Allocate space for the new style and shift the rest of the style to the end*/
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_STYLE);
     obj->styles = lv_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
+    lv_mem_set_tag(tag_prev);
     LV_ASSERT_MALLOC(obj->styles);
 
     uint32_t j;
@@ -554,6 +556,7 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
         }
     }
 
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_STYLE);
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
     obj->styles = lv_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
@@ -568,6 +571,7 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 
     lv_memset_00(&obj->styles[i], sizeof(_lv_obj_style_t));
     obj->styles[i].style = lv_mem_alloc(sizeof(lv_style_t));
+    lv_mem_set_tag(tag_prev);
     lv_style_init(obj->styles[i].style);
     obj->styles[i].is_local = 1;
     obj->styles[i].selector = selector;
@@ -591,6 +595,7 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t se
     /*Already have a transition style for it*/
     if(i != obj->style_cnt) return &obj->styles[i];
 
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_STYLE);
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
     obj->styles = lv_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
@@ -602,6 +607,7 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t se
 
     lv_memset_00(&obj->styles[0], sizeof(_lv_obj_style_t));
     obj->styles[0].style = lv_mem_alloc(sizeof(lv_style_t));
+    lv_mem_set_tag(tag_prev);
     lv_style_init(obj->styles[0].style);
     obj->styles[0].is_trans = 1;
     obj->styles[0].selector = selector;
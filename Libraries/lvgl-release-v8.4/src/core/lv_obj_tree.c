@@ -10,6 +10,7 @@
 
 #include "lv_obj.h"
 #include "lv_indev.h"
+#include "lv_disp.h"
 #include "../misc/lv_anim.h"
 #include "../misc/lv_gc.h"
 #include "../misc/lv_async.h"
@@ -56,6 +57,10 @@ void lv_obj_del(lv_obj_t * obj)
         disp = lv_obj_get_disp(obj);
         if(!disp) return;   /*Shouldn't happen*/
         if(disp->act_scr == obj) act_scr_del = true;
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+        /*Its snapshot can't be drawn anymore*/
+        if(disp->act_scr == obj || disp->prev_scr == obj) _lv_disp_scr_snapshot_free(disp);
+#endif
     }
 
     obj_del_core(obj);
@@ -73,6 +78,9 @@ void lv_obj_del(lv_obj_t * obj)
         disp->act_scr = NULL;
     }
 
+    /*Don't draw or delete the previous screen at the end of the screen load animation*/
+    if(disp && disp->prev_scr == obj) disp->prev_scr = NULL;
+
     LV_ASSERT_MEM_INTEGRITY();
     LV_LOG_TRACE("finished (delete %p)", (void *)obj);
 }
@@ -9,6 +9,7 @@
 #include <stddef.h>
 #include "lv_refr.h"
 #include "lv_disp.h"
+#include "lv_refr_prof.h"
 #include "../hal/lv_hal_tick.h"
 #include "../hal/lv_hal_disp.h"
 #include "../misc/lv_timer.h"
@@ -48,6 +49,12 @@ typedef struct {
 #endif
 } mem_monitor_t;
 
+typedef struct {
+    lv_area_t area;         /*Fully covered area*/
+    const lv_obj_t * obj;
+    bool drawn;             /*The object was reached, so it can't cover the next objects*/
+} occluder_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -56,9 +63,23 @@ static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
 static void refr_area_part(lv_draw_ctx_t * draw_ctx);
+static void refr_screens(lv_draw_ctx_t * draw_ctx);
+static void draw_disp_bg(lv_draw_ctx_t * draw_ctx);
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+    static void refr_scr_snapshots(lv_draw_ctx_t * draw_ctx);
+#endif
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+static void refr_obj_layer(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+#if LV_REFR_OCCLUDER_CNT
+    static void occlusion_collect(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
+    static void occlusion_collect_obj(lv_obj_t * obj, const lv_area_t * clip_area, const lv_obj_t * top_obj);
+    static void occlusion_add(const lv_obj_t * obj, const lv_area_t * area);
+    static void occlusion_set_drawn(const lv_obj_t * obj, bool descendants);
+    static bool occlusion_clip(lv_area_t * area, const lv_obj_t * obj, bool descendants);
+    static bool obj_is_descendant(const lv_obj_t * obj, const lv_obj_t * ancestor);
+#endif
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
 static void draw_buf_flush(lv_disp_t * disp);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
@@ -84,6 +105,11 @@ static lv_disp_t * disp_refr; /*Display being refreshed*/
     static mem_monitor_t    mem_monitor;
 #endif
 
+#if LV_REFR_OCCLUDER_CNT
+    static occluder_t occluders[LV_REFR_OCCLUDER_CNT];
+    static uint32_t occluder_cnt;   /*0 also while drawing into a layer*/
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -141,8 +167,29 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     /*If the object is visible on the current clip area OR has overflow visible draw it.
      *With overflow visible drawing should happen to apply the masks which might affect children */
     bool should_draw = com_clip_res || lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
-    if(should_draw) {
-        draw_ctx->clip_area = &clip_coords_for_obj;
+    bool should_draw_main = should_draw;
+    lv_area_t clip_coords_for_main = clip_coords_for_obj;
+
+#if LV_REFR_OCCLUDER_CNT
+    /*Don't draw the parts which are covered by opaque objects drawn later.
+     *With overflow visible the children can be anywhere so don't bother with these objects*/
+    if(occluder_cnt > 0) occlusion_set_drawn(obj, false);
+    bool occlusion = occluder_cnt > 0 && com_clip_res && !lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    lv_area_t clip_coords_visible = clip_coords_for_obj;
+    if(occlusion) {
+        /*The children are on the object too so skip all of them if the object is fully covered*/
+        if(occlusion_clip(&clip_coords_visible, obj, false) == false) {
+            occlusion_set_drawn(obj, true);
+            return;
+        }
+
+        /*The children are drawn later so they can cover the main part too*/
+        if(occlusion_clip(&clip_coords_for_main, obj, true) == false) should_draw_main = false;
+    }
+#endif
+
+    if(should_draw_main) {
+        draw_ctx->clip_area = &clip_coords_for_main;
 
         lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, draw_ctx);
         lv_event_send(obj, LV_EVENT_DRAW_MAIN, draw_ctx);
@@ -184,6 +231,10 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     }
 
     /*If the object was visible on the clip area call the post draw events too*/
+#if LV_REFR_OCCLUDER_CNT
+    /*Only the later objects can cover the post draw, so it's visible where the object was*/
+    if(occlusion) clip_coords_for_obj = clip_coords_visible;
+#endif
     if(should_draw) {
         draw_ctx->clip_area = &clip_coords_for_obj;
 
@@ -319,9 +370,14 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+    /*The scratch memory of the rendering is taken from the frame arena*/
+    _lv_mem_frame_begin();
+
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_DRAW);
     lv_refr_join_area();
     refr_sync_areas();
     refr_invalid_areas();
+    lv_mem_set_tag(tag_prev);
 
     /*If refresh happened ...*/
     if(disp_refr->inv_p != 0) {
@@ -359,6 +415,8 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     _lv_draw_mask_cleanup();
 #endif
 
+    _lv_mem_frame_end();
+
 #if LV_USE_PERF_MONITOR && LV_USE_LABEL
     lv_obj_t * perf_label = perf_monitor.perf_label;
     if(perf_label == NULL) {
@@ -606,6 +664,7 @@ static void refr_invalid_areas(void)
     disp_refr->driver->draw_buf->last_area = 0;
     disp_refr->driver->draw_buf->last_part = 0;
     disp_refr->rendering_in_progress = true;
+    LV_REFR_PROF_BEGIN(LV_REFR_PROF_FRAME, NULL);
 
     for(i = 0; i < disp_refr->inv_p; i++) {
         /*Refresh the unjoined areas*/
@@ -619,6 +678,7 @@ static void refr_invalid_areas(void)
         }
     }
 
+    LV_REFR_PROF_END();
     disp_refr->rendering_in_progress = false;
 }
 
@@ -723,6 +783,30 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
 #endif
     }
 
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+    if(disp_refr->scr_snapshot_act) {
+        refr_scr_snapshots(draw_ctx);
+    }
+    else {
+        refr_screens(draw_ctx);
+    }
+#else
+    refr_screens(draw_ctx);
+#endif
+
+    /*Also refresh top and sys layer unconditionally*/
+    refr_obj_and_children(draw_ctx, lv_disp_get_layer_top(disp_refr));
+    refr_obj_and_children(draw_ctx, lv_disp_get_layer_sys(disp_refr));
+
+    draw_buf_flush(disp_refr);
+}
+
+/**
+ * Draw the active and the previous screen
+ * @param draw_ctx pointer to a draw context
+ */
+static void refr_screens(lv_draw_ctx_t * draw_ctx)
+{
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
@@ -734,38 +818,7 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
 
     /*Draw a display background if there is no top object*/
     if(top_act_scr == NULL && top_prev_scr == NULL) {
-        lv_area_t a;
-        lv_area_set(&a, 0, 0,
-                    lv_disp_get_hor_res(disp_refr) - 1, lv_disp_get_ver_res(disp_refr) - 1);
-        if(draw_ctx->draw_bg) {
-            lv_draw_rect_dsc_t dsc;
-            lv_draw_rect_dsc_init(&dsc);
-            dsc.bg_img_src = disp_refr->bg_img;
-            dsc.bg_img_opa = disp_refr->bg_opa;
-            dsc.bg_color = disp_refr->bg_color;
-            dsc.bg_opa = disp_refr->bg_opa;
-            draw_ctx->draw_bg(draw_ctx, &dsc, &a);
-        }
-        else if(disp_refr->bg_img) {
-            lv_img_header_t header;
-            lv_res_t res = lv_img_decoder_get_info(disp_refr->bg_img, &header);
-            if(res == LV_RES_OK) {
-                lv_draw_img_dsc_t dsc;
-                lv_draw_img_dsc_init(&dsc);
-                dsc.opa = disp_refr->bg_opa;
-                lv_draw_img(draw_ctx, &dsc, &a, disp_refr->bg_img);
-            }
-            else {
-                LV_LOG_WARN("Can't draw the background image");
-            }
-        }
-        else {
-            lv_draw_rect_dsc_t dsc;
-            lv_draw_rect_dsc_init(&dsc);
-            dsc.bg_color = disp_refr->bg_color;
-            dsc.bg_opa = disp_refr->bg_opa;
-            lv_draw_rect(draw_ctx, &dsc, draw_ctx->buf_area);
-        }
+        draw_disp_bg(draw_ctx);
     }
 
     if(disp_refr->draw_prev_over_act) {
@@ -788,13 +841,109 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
         if(top_act_scr == NULL) top_act_scr = disp_refr->act_scr;
         refr_obj_and_children(draw_ctx, top_act_scr);
     }
+}
+
+/**
+ * Draw the background of the display
+ * @param draw_ctx pointer to a draw context
+ */
+static void draw_disp_bg(lv_draw_ctx_t * draw_ctx)
+{
+    lv_area_t a;
+    lv_area_set(&a, 0, 0,
+                lv_disp_get_hor_res(disp_refr) - 1, lv_disp_get_ver_res(disp_refr) - 1);
+    if(draw_ctx->draw_bg) {
+        lv_draw_rect_dsc_t dsc;
+        lv_draw_rect_dsc_init(&dsc);
+        dsc.bg_img_src = disp_refr->bg_img;
+        dsc.bg_img_opa = disp_refr->bg_opa;
+        dsc.bg_color = disp_refr->bg_color;
+        dsc.bg_opa = disp_refr->bg_opa;
+        draw_ctx->draw_bg(draw_ctx, &dsc, &a);
+    }
+    else if(disp_refr->bg_img) {
+        lv_img_header_t header;
+        lv_res_t res = lv_img_decoder_get_info(disp_refr->bg_img, &header);
+        if(res == LV_RES_OK) {
+            lv_draw_img_dsc_t dsc;
+            lv_draw_img_dsc_init(&dsc);
+            dsc.opa = disp_refr->bg_opa;
+            lv_draw_img(draw_ctx, &dsc, &a, disp_refr->bg_img);
+        }
+        else {
+            LV_LOG_WARN("Can't draw the background image");
+        }
+    }
+    else {
+        lv_draw_rect_dsc_t dsc;
+        lv_draw_rect_dsc_init(&dsc);
+        dsc.bg_color = disp_refr->bg_color;
+        dsc.bg_opa = disp_refr->bg_opa;
+        lv_draw_rect(draw_ctx, &dsc, draw_ctx->buf_area);
+    }
+}
 
-    /*Also refresh top and sys layer unconditionally*/
-    refr_obj_and_children(draw_ctx, lv_disp_get_layer_top(disp_refr));
-    refr_obj_and_children(draw_ctx, lv_disp_get_layer_sys(disp_refr));
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+/**
+ * Draw the snapshots of the screens during a screen load animation instead of the screens.
+ * Only the position and opacity of the screens are used.
+ * @param draw_ctx pointer to a draw context
+ */
+static void refr_scr_snapshots(lv_draw_ctx_t * draw_ctx)
+{
+    /*From bottom to top*/
+    lv_obj_t * scr[2];
+    const lv_img_dsc_t * snapshot[2];
+    if(disp_refr->draw_prev_over_act) {
+        scr[0] = disp_refr->act_scr;
+        snapshot[0] = disp_refr->scr_snapshot_act;
+        scr[1] = disp_refr->prev_scr;
+        snapshot[1] = disp_refr->scr_snapshot_prev;
+    }
+    else {
+        scr[0] = disp_refr->prev_scr;
+        snapshot[0] = disp_refr->scr_snapshot_prev;
+        scr[1] = disp_refr->act_scr;
+        snapshot[1] = disp_refr->scr_snapshot_act;
+    }
 
-    draw_buf_flush(disp_refr);
+    lv_area_t coords[2];
+    lv_opa_t opa[2];
+    int32_t first = -1;
+    int32_t i;
+    for(i = 0; i < 2; i++) {
+        if(scr[i] == NULL || snapshot[i] == NULL) {
+            opa[i] = LV_OPA_TRANSP;
+            continue;
+        }
+
+        /*The snapshot includes the extra draw area of the screen*/
+        lv_coord_t ext_size = (snapshot[i]->header.w - lv_obj_get_width(scr[i])) / 2;
+        lv_area_copy(&coords[i], &scr[i]->coords);
+        lv_area_increase(&coords[i], ext_size, ext_size);
+        opa[i] = lv_obj_get_style_opa(scr[i], LV_PART_MAIN);
+
+        /*Nothing is visible below an opaque snapshot covering the area*/
+        if(opa[i] >= LV_OPA_MAX && snapshot[i]->header.cf == LV_IMG_CF_TRUE_COLOR &&
+           _lv_area_is_in(draw_ctx->buf_area, &coords[i], 0)) {
+            first = i;
+        }
+    }
+
+    if(first < 0) {
+        draw_disp_bg(draw_ctx);
+        first = 0;
+    }
+
+    for(i = first; i < 2; i++) {
+        if(opa[i] <= LV_OPA_MIN) continue;
+        lv_draw_img_dsc_t dsc;
+        lv_draw_img_dsc_init(&dsc);
+        dsc.opa = opa[i];
+        lv_draw_img(draw_ctx, &dsc, &coords[i], snapshot[i]);
+    }
 }
+#endif
 
 /**
  * Search the most top object which fully covers an area
@@ -850,6 +999,10 @@ static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj)
     if(top_obj == NULL) top_obj = lv_disp_get_scr_act(disp_refr);
     if(top_obj == NULL) return;  /*Shouldn't happen*/
 
+#if LV_REFR_OCCLUDER_CNT
+    occlusion_collect(draw_ctx, top_obj);
+#endif
+
     /*Refresh the top object and its children*/
     refr_obj(draw_ctx, top_obj);
 
@@ -886,6 +1039,10 @@ static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj)
         /*Go a level deeper*/
         parent = lv_obj_get_parent(parent);
     }
+
+#if LV_REFR_OCCLUDER_CNT
+    occluder_cnt = 0;
+#endif
 }
 
 static lv_res_t layer_get_area(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, lv_layer_type_t layer_type,
@@ -965,6 +1122,19 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 {
     /*Do not refresh hidden objects*/
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    LV_REFR_PROF_BEGIN(LV_REFR_PROF_OBJ, obj);
+    refr_obj_layer(draw_ctx, obj);
+    LV_REFR_PROF_END();
+}
+
+/**
+ * Draw an object and its children directly or on a layer
+ * @param draw_ctx  pointer to an initialized draw context
+ * @param obj       the object to draw
+ */
+static void refr_obj_layer(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
+{
     lv_layer_type_t layer_type = _lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
         lv_obj_redraw(draw_ctx, obj);
@@ -1023,6 +1193,12 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
             if(layer_ctx->area_act.y2 > layer_ctx->area_full.y2) layer_ctx->area_act.y2 = layer_ctx->area_full.y2;
         }
 
+#if LV_REFR_OCCLUDER_CNT
+        /*The layer is blended with opacity or transformation so the objects can't cover each other on the screen*/
+        uint32_t occluder_cnt_ori = occluder_cnt;
+        occluder_cnt = 0;
+#endif
+
         while(layer_ctx->area_act.y1 <= layer_area_full.y2) {
             if(flags & LV_DRAW_LAYER_FLAG_CAN_SUBDIVIDE) {
                 layer_alpha_test(obj, draw_ctx, layer_ctx, flags);
@@ -1042,10 +1218,215 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
             layer_ctx->area_act.y2 = layer_ctx->area_act.y1 + layer_ctx->max_row_with_no_alpha - 1;
         }
 
+#if LV_REFR_OCCLUDER_CNT
+        occluder_cnt = occluder_cnt_ori;
+#endif
+
         lv_draw_layer_destroy(draw_ctx, layer_ctx);
     }
 }
 
+#if LV_REFR_OCCLUDER_CNT
+/**
+ * Collect the opaque objects which are drawn in the same order as in `refr_obj_and_children()`
+ * @param draw_ctx  pointer to the draw context with the refreshed area
+ * @param top_obj   the first object to draw
+ */
+static void occlusion_collect(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj)
+{
+    occluder_cnt = 0;
+    occlusion_collect_obj(top_obj, draw_ctx->clip_area, top_obj);
+
+    lv_obj_t * border_p = top_obj;
+    lv_obj_t * parent = lv_obj_get_parent(top_obj);
+    while(parent != NULL) {
+        /*Clip the younger siblings to the parents like the children of the parents would be clipped*/
+        lv_area_t clip_area = *draw_ctx->clip_area;
+        bool visible = true;
+        const lv_obj_t * p;
+        for(p = parent; p && visible; p = lv_obj_get_parent(p)) {
+            if(lv_obj_has_flag(p, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) continue;
+            visible = _lv_area_intersect(&clip_area, &clip_area, &p->coords);
+        }
+
+        bool go = false;
+        uint32_t i;
+        uint32_t child_cnt = lv_obj_get_child_cnt(parent);
+        for(i = 0; i < child_cnt && visible; i++) {
+            lv_obj_t * child = parent->spec_attr->children[i];
+            if(go) occlusion_collect_obj(child, &clip_area, top_obj);
+            else if(child == border_p) go = true;
+        }
+
+        border_p = parent;
+        parent = lv_obj_get_parent(parent);
+    }
+}
+
+/**
+ * Add an object and its children to the occluders if they are opaque
+ * @param obj           the object to check
+ * @param clip_area     the area where the object can be drawn
+ * @param top_obj       the first drawn object. It can't cover anything.
+ */
+static void occlusion_collect_obj(lv_obj_t * obj, const lv_area_t * clip_area, const lv_obj_t * top_obj)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    /*The layers are blended with opacity or transformation so they and their children are not opaque*/
+    if(_lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return;
+
+    lv_area_t coords;
+    bool visible = _lv_area_intersect(&coords, clip_area, &obj->coords);
+    if(visible) {
+        lv_cover_check_info_t info;
+        info.res = LV_COVER_RES_COVER;
+        info.area = &coords;
+        lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+
+        /*The masks of the object affect the children too*/
+        if(info.res == LV_COVER_RES_MASKED) return;
+
+        /*A rounded object can still cover its middle part*/
+        lv_area_t inner;
+        lv_coord_t r = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+        if(info.res == LV_COVER_RES_NOT_COVER && r > 0) {
+            lv_coord_t w = lv_obj_get_width(obj);
+            lv_coord_t h = lv_obj_get_height(obj);
+            lv_coord_t short_side = LV_MIN(w, h);
+            if(r > short_side / 2) r = short_side / 2;
+
+            inner = obj->coords;
+            if(w >= h) {
+                inner.x1 += r;
+                inner.x2 -= r;
+            }
+            else {
+                inner.y1 += r;
+                inner.y2 -= r;
+            }
+
+            if(_lv_area_intersect(&inner, &inner, clip_area)) {
+                info.res = LV_COVER_RES_COVER;
+                info.area = &inner;
+                lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+                if(info.res == LV_COVER_RES_MASKED) return;
+            }
+        }
+
+        /*The opacity of the parents is applied on the object too*/
+        if(info.res == LV_COVER_RES_COVER && obj != top_obj &&
+           lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN) >= LV_OPA_MAX) {
+            occlusion_add(obj, info.area);
+        }
+    }
+
+    lv_area_t clip_coords_for_children;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        clip_coords_for_children = *clip_area;
+    }
+    else {
+        if(!visible) return;
+        clip_coords_for_children = coords;
+    }
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        occlusion_collect_obj(child, &clip_coords_for_children, top_obj);
+    }
+}
+
+static void occlusion_add(const lv_obj_t * obj, const lv_area_t * area)
+{
+    uint32_t i = occluder_cnt;
+
+    /*If there is no more space keep the largest ones*/
+    if(occluder_cnt >= LV_REFR_OCCLUDER_CNT) {
+        uint32_t i_min = 0;
+        uint32_t j;
+        for(j = 1; j < occluder_cnt; j++) {
+            if(lv_area_get_size(&occluders[j].area) < lv_area_get_size(&occluders[i_min].area)) i_min = j;
+        }
+
+        if(lv_area_get_size(area) <= lv_area_get_size(&occluders[i_min].area)) return;
+        i = i_min;
+    }
+    else {
+        occluder_cnt++;
+    }
+
+    occluders[i].area = *area;
+    occluders[i].obj = obj;
+    occluders[i].drawn = false;
+}
+
+/**
+ * Mark the occluders of an object as drawn. The objects drawn after them are not covered by them.
+ * @param obj           the object which is being drawn or skipped
+ * @param descendants   true: mark the occluders of the children of `obj` too
+ */
+static void occlusion_set_drawn(const lv_obj_t * obj, bool descendants)
+{
+    uint32_t i;
+    for(i = 0; i < occluder_cnt; i++) {
+        occluder_t * o = &occluders[i];
+        if(o->drawn) continue;
+        if(o->obj == obj || (descendants && obj_is_descendant(o->obj, obj))) o->drawn = true;
+    }
+}
+
+/**
+ * Remove the covered sides of an area. Only the occluders which cover a whole side can be removed
+ * to keep the result a rectangle.
+ * @param area          the area to clip
+ * @param obj           the object drawn on `area`
+ * @param descendants   true: the children of `obj` can cover the area too
+ * @return              false: the area is fully covered
+ */
+static bool occlusion_clip(lv_area_t * area, const lv_obj_t * obj, bool descendants)
+{
+    /*Removing a side can make an other occluder cover a whole side, so repeat until there is no change*/
+    bool changed = true;
+    while(changed) {
+        changed = false;
+        uint32_t i;
+        for(i = 0; i < occluder_cnt; i++) {
+            const occluder_t * o = &occluders[i];
+            if(o->drawn) continue;
+
+            const lv_area_t * oa = &o->area;
+            bool cover_hor = oa->x1 <= area->x1 && oa->x2 >= area->x2;
+            bool cover_ver = oa->y1 <= area->y1 && oa->y2 >= area->y2;
+            lv_area_t res = *area;
+            if(cover_hor && oa->y1 <= area->y1 && oa->y2 >= area->y1) res.y1 = oa->y2 + 1;
+            else if(cover_hor && oa->y2 >= area->y2 && oa->y1 <= area->y2) res.y2 = oa->y1 - 1;
+            else if(cover_ver && oa->x1 <= area->x1 && oa->x2 >= area->x1) res.x1 = oa->x2 + 1;
+            else if(cover_ver && oa->x2 >= area->x2 && oa->x1 <= area->x2) res.x2 = oa->x1 - 1;
+            else continue;
+
+            if(!descendants && obj_is_descendant(o->obj, obj)) continue;
+
+            if(res.x1 > res.x2 || res.y1 > res.y2) return false;
+            *area = res;
+            changed = true;
+        }
+    }
+
+    return true;
+}
+
+static bool obj_is_descendant(const lv_obj_t * obj, const lv_obj_t * ancestor)
+{
+    const lv_obj_t * parent;
+    for(parent = lv_obj_get_parent(obj); parent; parent = lv_obj_get_parent(parent)) {
+        if(parent == ancestor) return true;
+    }
+    return false;
+}
+#endif /*LV_REFR_OCCLUDER_CNT*/
+
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h)
 {
     int32_t max_row = (uint32_t)disp->driver->draw_buf->size / area_w;
@@ -0,0 +1,278 @@
+/**
+ * @file lv_refr_prof.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_refr_prof.h"
+
+#if LV_USE_REFR_PROFILER
+
+#include "lv_obj.h"
+#include "../misc/lv_printf.h"
+#include LV_REFR_PROFILER_TIME_INCLUDE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t start;
+    uint32_t px_cnt;
+    uint32_t child_time;        /*Time of the child objects*/
+    uint32_t child_px_cnt;      /*Pixels of the child objects*/
+    const lv_obj_t * obj;
+    lv_refr_prof_type_t type;
+} scope_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void add_obj_stats(const lv_obj_t * obj, uint32_t time, uint32_t px_cnt);
+static void add_event(const scope_t * scope, uint32_t dur, uint8_t d);
+static uint32_t json_append(char * buf, uint32_t buf_size, uint32_t len, const char * fmt, ...);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static scope_t stack[LV_REFR_PROF_MAX_DEPTH];
+static uint32_t depth;
+
+static lv_refr_prof_stats_t type_stats[_LV_REFR_PROF_TYPE_LAST];
+static lv_refr_prof_obj_stats_t obj_stats[LV_REFR_PROFILER_OBJ_CNT];
+
+static lv_refr_prof_event_t events[LV_REFR_PROFILER_EVENT_CNT];
+static uint32_t event_next;
+static uint32_t event_cnt;
+
+static const char * type_names[] = {
+    [LV_REFR_PROF_FRAME] = "frame",
+    [LV_REFR_PROF_OBJ] = "obj",
+    [LV_REFR_PROF_RECT] = "rect",
+    [LV_REFR_PROF_IMG] = "img",
+    [LV_REFR_PROF_LETTER] = "letter",
+    [LV_REFR_PROF_ARC] = "arc",
+    [LV_REFR_PROF_LINE] = "line",
+    [LV_REFR_PROF_POLYGON] = "polygon",
+    [LV_REFR_PROF_BLEND] = "blend",
+};
+
+/**********************
+ *      MACROS
+ **********************/
+#define TIME_GET() ((uint32_t)(LV_REFR_PROFILER_TIME_GET))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_refr_prof_begin(lv_refr_prof_type_t type, const lv_obj_t * obj)
+{
+    if(depth < LV_REFR_PROF_MAX_DEPTH) {
+        scope_t * scope = &stack[depth];
+        scope->type = type;
+        scope->obj = obj;
+        scope->px_cnt = 0;
+        scope->child_time = 0;
+        scope->child_px_cnt = 0;
+        scope->start = TIME_GET();
+    }
+    depth++;
+}
+
+void _lv_refr_prof_add_px(uint32_t px_cnt)
+{
+    if(depth == 0 || depth > LV_REFR_PROF_MAX_DEPTH) return;
+    stack[depth - 1].px_cnt += px_cnt;
+}
+
+void _lv_refr_prof_end(void)
+{
+    if(depth == 0) {
+        LV_LOG_WARN("no measurement was started");
+        return;
+    }
+
+    depth--;
+    if(depth >= LV_REFR_PROF_MAX_DEPTH) return;
+
+    scope_t * scope = &stack[depth];
+    uint32_t dur = TIME_GET() - scope->start;
+
+    /*Count the objects without their children to make their sum the total time*/
+    lv_refr_prof_stats_t * stats = &type_stats[scope->type];
+    if(scope->type == LV_REFR_PROF_OBJ) {
+        uint32_t self_time = dur > scope->child_time ? dur - scope->child_time : 0;
+        uint32_t self_px_cnt = scope->px_cnt - scope->child_px_cnt;
+        stats->time += self_time;
+        stats->px_cnt += self_px_cnt;
+        add_obj_stats(scope->obj, self_time, self_px_cnt);
+    }
+    else {
+        stats->time += dur;
+        stats->px_cnt += scope->px_cnt;
+    }
+    stats->call_cnt++;
+
+    if(depth > 0) {
+        scope_t * parent = &stack[depth - 1];
+        parent->px_cnt += scope->px_cnt;
+        if(scope->type == LV_REFR_PROF_OBJ) {
+            parent->child_time += dur;
+            parent->child_px_cnt += scope->px_cnt;
+        }
+    }
+
+    add_event(scope, dur, depth);
+}
+
+void lv_refr_prof_get_stats(lv_refr_prof_type_t type, lv_refr_prof_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    if(type >= _LV_REFR_PROF_TYPE_LAST) {
+        lv_memset_00(stats, sizeof(lv_refr_prof_stats_t));
+        return;
+    }
+
+    *stats = type_stats[type];
+}
+
+uint32_t lv_refr_prof_get_obj_stats(lv_refr_prof_obj_stats_t * buf, uint32_t max)
+{
+    LV_ASSERT_NULL(buf);
+
+    /*Insertion sort by time into the buffer*/
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < LV_REFR_PROFILER_OBJ_CNT; i++) {
+        const lv_refr_prof_obj_stats_t * s = &obj_stats[i];
+        if(s->obj == NULL) continue;
+
+        uint32_t j = cnt;
+        while(j > 0 && buf[j - 1].stats.time < s->stats.time) {
+            if(j < max) buf[j] = buf[j - 1];
+            j--;
+        }
+        if(j < max) buf[j] = *s;
+        if(cnt < max) cnt++;
+    }
+
+    return cnt;
+}
+
+const lv_refr_prof_event_t * lv_refr_prof_get_event(uint32_t idx)
+{
+    if(idx >= event_cnt) return NULL;
+    return &events[(event_next + LV_REFR_PROFILER_EVENT_CNT - event_cnt + idx) % LV_REFR_PROFILER_EVENT_CNT];
+}
+
+uint32_t lv_refr_prof_get_event_cnt(void)
+{
+    return event_cnt;
+}
+
+const char * lv_refr_prof_get_type_name(lv_refr_prof_type_t type)
+{
+    if(type >= _LV_REFR_PROF_TYPE_LAST) return "unknown";
+    return type_names[type];
+}
+
+void lv_refr_prof_reset(void)
+{
+    lv_memset_00(type_stats, sizeof(type_stats));
+    lv_memset_00(obj_stats, sizeof(obj_stats));
+    event_next = 0;
+    event_cnt = 0;
+}
+
+uint32_t lv_refr_prof_to_chrome_trace(char * buf, uint32_t buf_size)
+{
+    uint32_t len = 0;
+    uint32_t i;
+
+    len = json_append(buf, buf_size, len, "{\"traceEvents\":[");
+    for(i = 0; i < event_cnt; i++) {
+        const lv_refr_prof_event_t * e = lv_refr_prof_get_event(i);
+        len = json_append(buf, buf_size, len,
+                          "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%"LV_PRIu32",\"dur\":%"LV_PRIu32","
+                          "\"pid\":1,\"tid\":1,\"args\":{\"px\":%"LV_PRIu32"",
+                          i == 0 ? "" : ",\n", type_names[e->type],
+                          e->type == LV_REFR_PROF_OBJ || e->type == LV_REFR_PROF_FRAME ? "refr" : "draw",
+                          e->start, e->dur, e->px_cnt);
+        if(e->obj) len = json_append(buf, buf_size, len, ",\"obj\":\"%p\"", (void *)e->obj);
+        len = json_append(buf, buf_size, len, "}}");
+    }
+    len = json_append(buf, buf_size, len, "],\"displayTimeUnit\":\"ms\"}");
+
+    return len;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void add_obj_stats(const lv_obj_t * obj, uint32_t time, uint32_t px_cnt)
+{
+    /*Find the object, or use a free slot or replace the least expensive object*/
+    lv_refr_prof_obj_stats_t * s = NULL;
+    lv_refr_prof_obj_stats_t * s_free = NULL;
+    lv_refr_prof_obj_stats_t * s_min = &obj_stats[0];
+    uint32_t i;
+    for(i = 0; i < LV_REFR_PROFILER_OBJ_CNT; i++) {
+        lv_refr_prof_obj_stats_t * s_act = &obj_stats[i];
+        /*A new object can get the address of a deleted one. It's surely different if its class is different*/
+        if(s_act->obj == obj && s_act->class_p == obj->class_p) {
+            s = s_act;
+            break;
+        }
+        if(s_act->obj == NULL) {
+            if(s_free == NULL) s_free = s_act;
+        }
+        else if(s_act->stats.time < s_min->stats.time) {
+            s_min = s_act;
+        }
+    }
+
+    if(s == NULL) {
+        s = s_free ? s_free : s_min;
+        s->obj = obj;
+        s->class_p = obj->class_p;
+        lv_memset_00(&s->stats, sizeof(s->stats));
+    }
+
+    s->stats.time += time;
+    s->stats.px_cnt += px_cnt;
+    s->stats.call_cnt++;
+}
+
+static void add_event(const scope_t * scope, uint32_t dur, uint8_t d)
+{
+    lv_refr_prof_event_t * e = &events[event_next];
+    e->start = scope->start;
+    e->dur = dur;
+    e->obj = scope->obj;
+    e->px_cnt = scope->px_cnt;
+    e->type = scope->type;
+    e->depth = d;
+
+    event_next++;
+    if(event_next >= LV_REFR_PROFILER_EVENT_CNT) event_next = 0;
+    if(event_cnt < LV_REFR_PROFILER_EVENT_CNT) event_cnt++;
+}
+
+static uint32_t json_append(char * buf, uint32_t buf_size, uint32_t len, const char * fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int ret = lv_vsnprintf(len < buf_size ? buf + len : NULL, len < buf_size ? buf_size - len : 0, fmt, args);
+    va_end(args);
+
+    return ret > 0 ? len + ret : len;
+}
+
+#endif /*LV_USE_REFR_PROFILER*/
@@ -0,0 +1,162 @@
+/**
+ * @file lv_refr_prof.h
+ * Measure the time, the pixels and the calls of the objects and the draw primitives during rendering
+ */
+
+#ifndef LV_REFR_PROF_H
+#define LV_REFR_PROF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include <stdint.h>
+
+#if LV_USE_REFR_PROFILER
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Max. nesting of the measured objects and primitives. The deeper ones are not measured.*/
+#define LV_REFR_PROF_MAX_DEPTH  16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_obj_t;
+struct _lv_obj_class_t;
+
+typedef enum {
+    LV_REFR_PROF_FRAME,     /*Rendering the invalidated areas of a display*/
+    LV_REFR_PROF_OBJ,       /*Drawing an object without its children*/
+    LV_REFR_PROF_RECT,
+    LV_REFR_PROF_IMG,
+    LV_REFR_PROF_LETTER,
+    LV_REFR_PROF_ARC,
+    LV_REFR_PROF_LINE,
+    LV_REFR_PROF_POLYGON,
+    LV_REFR_PROF_BLEND,     /*Software blending, also included in the other primitives*/
+    _LV_REFR_PROF_TYPE_LAST
+} lv_refr_prof_type_t;
+
+typedef struct {
+    uint32_t time;          /*Time spent [us]*/
+    uint32_t px_cnt;        /*Number of the pixels blended by the software renderer*/
+    uint32_t call_cnt;      /*Number of calls (redraws for the objects)*/
+} lv_refr_prof_stats_t;
+
+typedef struct {
+    const struct _lv_obj_t * obj;               /*Only for identification, the object might be deleted since then*/
+    const struct _lv_obj_class_t * class_p;
+    lv_refr_prof_stats_t stats;                 /*Without the children*/
+} lv_refr_prof_obj_stats_t;
+
+typedef struct {
+    uint32_t start;         /*[us]*/
+    uint32_t dur;           /*[us]*/
+    const struct _lv_obj_t * obj;
+    uint32_t px_cnt;
+    uint8_t type;           /*lv_refr_prof_type_t*/
+    uint8_t depth;
+} lv_refr_prof_event_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start measuring an object or a draw primitive. Every call has to be closed with `_lv_refr_prof_end()`.
+ * Used by the rendering, not by the user.
+ * @param type what is measured
+ * @param obj the object being drawn, NULL for the primitives
+ */
+void _lv_refr_prof_begin(lv_refr_prof_type_t type, const struct _lv_obj_t * obj);
+
+/**
+ * Add blended pixels to the measured primitive and its object
+ * @param px_cnt number of the pixels
+ */
+void _lv_refr_prof_add_px(uint32_t px_cnt);
+
+/**
+ * Finish the last started measurement
+ */
+void _lv_refr_prof_end(void);
+
+/**
+ * Get the statistics of a type since the last reset
+ * @param type the type
+ * @param stats pointer to a variable to store the result
+ */
+void lv_refr_prof_get_stats(lv_refr_prof_type_t type, lv_refr_prof_stats_t * stats);
+
+/**
+ * Get the objects taking the most time since the last reset.
+ * At most `LV_REFR_PROFILER_OBJ_CNT` objects are tracked, the least expensive ones are replaced by the new ones.
+ * @param buf buffer to store the objects, sorted by time, the most expensive first
+ * @param max size of `buf`
+ * @return number of the objects stored in `buf`
+ */
+uint32_t lv_refr_prof_get_obj_stats(lv_refr_prof_obj_stats_t * buf, uint32_t max);
+
+/**
+ * Get a recorded event
+ * @param idx index of the event, 0: the oldest
+ * @return pointer to the event or NULL if `idx` is out of the recorded events
+ */
+const lv_refr_prof_event_t * lv_refr_prof_get_event(uint32_t idx);
+
+/**
+ * Get the number of the recorded events. At most the last `LV_REFR_PROFILER_EVENT_CNT` events are kept.
+ * @return number of the events
+ */
+uint32_t lv_refr_prof_get_event_cnt(void);
+
+/**
+ * Get the name of a type
+ * @param type the type
+ * @return the name of the type, e.g. "rect"
+ */
+const char * lv_refr_prof_get_type_name(lv_refr_prof_type_t type);
+
+/**
+ * Clear the statistics and the recorded events
+ */
+void lv_refr_prof_reset(void);
+
+/**
+ * Write the recorded events in Chrome trace event format (JSON).
+ * It can be opened in `chrome://tracing` or on https://ui.perfetto.dev.
+ * @param buf the buffer to write to
+ * @param buf_size size of `buf`. The output is truncated if it's too small.
+ * @return length of the full JSON text without the terminating `'\0'`
+ */
+uint32_t lv_refr_prof_to_chrome_trace(char * buf, uint32_t buf_size);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define LV_REFR_PROF_BEGIN(type, obj)   _lv_refr_prof_begin(type, obj)
+#define LV_REFR_PROF_ADD_PX(px_cnt)     _lv_refr_prof_add_px(px_cnt)
+#define LV_REFR_PROF_END()              _lv_refr_prof_end()
+
+#else /*LV_USE_REFR_PROFILER*/
+
+#define LV_REFR_PROF_BEGIN(type, obj)
+#define LV_REFR_PROF_ADD_PX(px_cnt)
+#define LV_REFR_PROF_END()
+
+#endif /*LV_USE_REFR_PROFILER*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_REFR_PROF_H*/
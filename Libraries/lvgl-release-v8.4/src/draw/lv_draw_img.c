@@ -11,6 +11,7 @@
 #include "../hal/lv_hal_disp.h"
 #include "../misc/lv_log.h"
 #include "../core/lv_refr.h"
+#include "../core/lv_refr_prof.h"
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
 
@@ -72,6 +73,7 @@ void lv_draw_img(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const
 
     lv_res_t res = LV_RES_INV;
 
+    LV_REFR_PROF_BEGIN(LV_REFR_PROF_IMG, NULL);
     if(draw_ctx->draw_img) {
         res = draw_ctx->draw_img(draw_ctx, dsc, coords, src);
     }
@@ -79,6 +81,7 @@ void lv_draw_img(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const
     if(res != LV_RES_OK) {
         res = decode_and_draw(draw_ctx, dsc, coords, src);
     }
+    LV_REFR_PROF_END();
 
     if(res != LV_RES_OK) {
         LV_LOG_WARN("Image draw error");
@@ -11,6 +11,7 @@
 #include "../misc/lv_math.h"
 #include "../hal/lv_hal_disp.h"
 #include "../core/lv_refr.h"
+#include "../core/lv_refr_prof.h"
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_assert.h"
 
@@ -35,6 +36,10 @@ typedef uint8_t cmd_state_t;
  **********************/
 
 static uint8_t hex_char_to_num(char hex);
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const char * txt, uint32_t line_start,
+                             uint32_t line_id, lv_coord_t max_w);
+static lv_coord_t get_line_width(const lv_draw_label_dsc_t * dsc, const char * txt, uint32_t line_start,
+                                 uint32_t line_end, uint32_t line_id);
 
 /**********************
  *  STATIC VARIABLES
@@ -110,6 +115,9 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
     }
+    else if(dsc->layout) {
+        w = dsc->layout->width;
+    }
     else {
         /*If EXPAND is enabled then not limit the text's width to the object's width*/
         lv_point_t p;
@@ -134,10 +142,11 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_id        = 0;
     int32_t last_line_start = -1;
 
-    /*Check the hint to use the cached info*/
-    if(hint && y_ofs == 0 && coords->y1 < 0) {
+    /*Check the hint to use the cached info. Not required if the line breaks are known*/
+    if(hint && dsc->layout == NULL && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
         if(LV_ABS(hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
             hint->line_start = -1;
@@ -151,13 +160,14 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         pos.y += hint->y;
     }
 
-    uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+    uint32_t line_end = get_line_end(dsc, txt, line_start, line_id, w);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < draw_ctx->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_id++;
+        line_end = get_line_end(dsc, txt, line_start, line_id, w);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
@@ -172,14 +182,14 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(dsc, txt, line_start, line_end, line_id);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(dsc, txt, line_start, line_end, line_id);
         pos.x += lv_area_get_width(coords) - line_width;
     }
     uint32_t sel_start = dsc->sel_start;
@@ -334,21 +344,20 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_id++;
+        line_end = get_line_end(dsc, txt, line_start, line_id, w);
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(dsc, txt, line_start, line_end, line_id);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(dsc, txt, line_start, line_end, line_id);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -364,7 +373,9 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 void lv_draw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,  const lv_point_t * pos_p,
                     uint32_t letter)
 {
+    LV_REFR_PROF_BEGIN(LV_REFR_PROF_LETTER, NULL);
     draw_ctx->draw_letter(draw_ctx, dsc, pos_p, letter);
+    LV_REFR_PROF_END();
 }
 
 /**********************
@@ -413,3 +424,39 @@ static uint8_t hex_char_to_num(char hex)
 
     return result;
 }
+
+/**
+ * Get the end of a line from the layout of the descriptor, or by finding the line break
+ * @param dsc pointer to draw descriptor
+ * @param txt the text to draw
+ * @param line_start byte index of the start of the line
+ * @param line_id index of the line
+ * @param max_w max width of the lines
+ * @return byte index of the start of the next line
+ */
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const char * txt, uint32_t line_start,
+                             uint32_t line_id, lv_coord_t max_w)
+{
+    if(dsc->layout) {
+        return line_id < dsc->layout->line_cnt ? dsc->layout->line_start[line_id + 1] : line_start;
+    }
+    return line_start + _lv_txt_get_next_line(&txt[line_start], dsc->font, dsc->letter_space, max_w, NULL, dsc->flag);
+}
+
+/**
+ * Get the width of a line from the layout of the descriptor, or by measuring it
+ * @param dsc pointer to draw descriptor
+ * @param txt the text to draw
+ * @param line_start byte index of the start of the line
+ * @param line_end byte index of the start of the next line
+ * @param line_id index of the line
+ * @return width of the line
+ */
+static lv_coord_t get_line_width(const lv_draw_label_dsc_t * dsc, const char * txt, uint32_t line_start,
+                                 uint32_t line_end, uint32_t line_id)
+{
+    if(dsc->layout) {
+        return line_id < dsc->layout->line_cnt ? dsc->layout->line_width[line_id] : 0;
+    }
+    return lv_txt_get_width(&txt[line_start], line_end - line_start, dsc->font, dsc->letter_space, dsc->flag);
+}
@@ -44,6 +44,9 @@ typedef struct {
     lv_text_flag_t flag;
     lv_text_decor_t decor : 3;
     lv_blend_mode_t blend_mode: 3;
+    /** Line breaks of the text for the width of the coordinates, `font`, `letter_space` and `flag`.
+     * NULL to find them while drawing.*/
+    const lv_txt_layout_t * layout;
 } lv_draw_label_dsc_t;
 
 /** Store some info to speed up drawing of very large texts
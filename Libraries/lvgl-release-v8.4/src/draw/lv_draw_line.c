@@ -8,6 +8,7 @@
  *********************/
 #include <stdbool.h>
 #include "../core/lv_refr.h"
+#include "../core/lv_refr_prof.h"
 #include "../misc/lv_math.h"
 
 /*********************
@@ -48,7 +49,9 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_line(struct _lv_draw_ctx_t * draw_ctx, const
     if(dsc->width == 0) return;
     if(dsc->opa <= LV_OPA_MIN) return;
 
+    LV_REFR_PROF_BEGIN(LV_REFR_PROF_LINE, NULL);
     draw_ctx->draw_line(draw_ctx, dsc, point1, point2);
+    LV_REFR_PROF_END();
 }
 
 /**********************
@@ -119,12 +119,14 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
     dsc->src_type = src_type;
     dsc->frame_id = frame_id;
 
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_IMG);
     if(dsc->src_type == LV_IMG_SRC_FILE) {
         size_t fnlen = strlen(src);
         dsc->src = lv_mem_alloc(fnlen + 1);
         LV_ASSERT_MALLOC(dsc->src);
         if(dsc->src == NULL) {
             LV_LOG_WARN("lv_img_decoder_open: out of memory");
+            lv_mem_set_tag(tag_prev);
             return LV_RES_INV;
         }
         strcpy((char *)dsc->src, src);
@@ -147,7 +149,10 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
         res = decoder->open_cb(decoder, dsc);
 
         /*Opened successfully. It is a good decoder for this image source*/
-        if(res == LV_RES_OK) return res;
+        if(res == LV_RES_OK) {
+            lv_mem_set_tag(tag_prev);
+            return res;
+        }
 
         /*Prepare for the next loop*/
         lv_memset_00(&dsc->header, sizeof(lv_img_header_t));
@@ -161,6 +166,7 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
     if(dsc->src_type == LV_IMG_SRC_FILE)
         lv_mem_free((void *)dsc->src);
 
+    lv_mem_set_tag(tag_prev);
     return res;
 }
 
@@ -176,7 +182,9 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
 lv_res_t lv_img_decoder_read_line(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf)
 {
     lv_res_t res = LV_RES_INV;
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_IMG);
     if(dsc->decoder->read_line_cb) res = dsc->decoder->read_line_cb(dsc->decoder, dsc, x, y, len, buf);
+    lv_mem_set_tag(tag_prev);
 
     return res;
 }
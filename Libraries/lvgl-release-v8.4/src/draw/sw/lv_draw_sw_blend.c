@@ -10,6 +10,7 @@
 #include "../../misc/lv_math.h"
 #include "../../hal/lv_hal_disp.h"
 #include "../../core/lv_refr.h"
+#include "../../core/lv_refr_prof.h"
 
 /*********************
  *      DEFINES
@@ -102,7 +103,10 @@ void lv_draw_sw_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * d
 
     if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
 
+    LV_REFR_PROF_BEGIN(LV_REFR_PROF_BLEND, NULL);
+    LV_REFR_PROF_ADD_PX(lv_area_get_size(&blend_area));
     ((lv_draw_sw_ctx_t *)draw_ctx)->blend(draw_ctx, dsc);
+    LV_REFR_PROF_END();
 }
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_basic(lv_draw_ctx_t * draw_ctx,
@@ -72,6 +72,7 @@ void lv_fs_posix_init(void)
     /*Set up fields...*/
     fs_drv.letter = LV_FS_POSIX_LETTER;
     fs_drv.cache_size = LV_FS_POSIX_CACHE_SIZE;
+    fs_drv.block_cache = LV_FS_POSIX_BLOCK_CACHE;
 
     fs_drv.open_cb = fs_open;
     fs_drv.close_cb = fs_close;
@@ -2,6 +2,7 @@
 #include "../../../misc/lv_log.h"
 #include "../../../misc/lv_mem.h"
 #include "../../../misc/lv_color.h"
+#include "../../../draw/lv_img_buf.h"
 #if LV_USE_GIF
 
 #include <stdlib.h>
@@ -28,6 +29,9 @@ static bool f_gif_open(gd_GIF * gif, const void * path, bool is_file);
 static void f_gif_read(gd_GIF * gif, void * buf, size_t len);
 static int f_gif_seek(gd_GIF * gif, size_t pos, int k);
 static void f_gif_close(gd_GIF * gif);
+static void discard_sub_blocks(gd_GIF *gif);
+static bool scan_alpha(gd_GIF *gif);
+static void set_pixel(gd_GIF *gif, uint8_t *buffer, int i, const uint8_t *color, uint8_t opa);
 
 static uint16_t
 read_num(gd_GIF * gif)
@@ -73,6 +77,9 @@ static gd_GIF * gif_open(gd_GIF * gif_base)
     int i;
     uint8_t *bgcolor;
     int gct_sz;
+    int gct_start;
+    bool has_alpha;
+    uint32_t px_size;
     gd_GIF *gif = NULL;
 
     /* Header */
@@ -106,58 +113,35 @@ static gd_GIF * gif_open(gd_GIF * gif_base)
     f_gif_read(gif_base, &bgidx, 1);
     /* Aspect Ratio */
     f_gif_read(gif_base, &aspect, 1);
+    /* Check the frames behind the GCT, then go back to read it. */
+    gct_start = f_gif_seek(gif_base, 0, LV_FS_SEEK_CUR);
+    f_gif_seek(gif_base, 3 * gct_sz, LV_FS_SEEK_CUR);
+    has_alpha = scan_alpha(gif_base);
+    f_gif_seek(gif_base, gct_start, LV_FS_SEEK_SET);
     /* Create gd_GIF Structure. */
-#if LV_COLOR_DEPTH == 32
-    gif = lv_mem_alloc(sizeof(gd_GIF) + 5 * width * height);
-#elif LV_COLOR_DEPTH == 16
-    gif = lv_mem_alloc(sizeof(gd_GIF) + 4 * width * height);
-#elif LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1
-    gif = lv_mem_alloc(sizeof(gd_GIF) + 3 * width * height);
-#endif
+    px_size = has_alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    gif = lv_mem_alloc(sizeof(gd_GIF) + (px_size + 1) * width * height);
 
     if (!gif) goto fail;
     memcpy(gif, gif_base, sizeof(gd_GIF));
     gif->width  = width;
     gif->height = height;
     gif->depth  = depth;
+    gif->has_alpha = has_alpha;
     /* Read GCT */
     gif->gct.size = gct_sz;
     f_gif_read(gif, gif->gct.colors, 3 * gif->gct.size);
     gif->palette = &gif->gct;
     gif->bgindex = bgidx;
     gif->canvas = (uint8_t *) &gif[1];
-#if LV_COLOR_DEPTH == 32
-    gif->frame = &gif->canvas[4 * width * height];
-#elif LV_COLOR_DEPTH == 16
-    gif->frame = &gif->canvas[3 * width * height];
-#elif LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1
-    gif->frame = &gif->canvas[2 * width * height];
-#endif
+    gif->frame = &gif->canvas[px_size * width * height];
     if (gif->bgindex) {
         memset(gif->frame, gif->bgindex, gif->width * gif->height);
     }
     bgcolor = &gif->palette->colors[gif->bgindex*3];
 
     for (i = 0; i < gif->width * gif->height; i++) {
-#if LV_COLOR_DEPTH == 32
-        gif->canvas[i*4 + 0] = *(bgcolor + 2);
-        gif->canvas[i*4 + 1] = *(bgcolor + 1);
-        gif->canvas[i*4 + 2] = *(bgcolor + 0);
-        gif->canvas[i*4 + 3] = 0xff;
-#elif LV_COLOR_DEPTH == 16
-        lv_color_t c = lv_color_make(*(bgcolor + 0), *(bgcolor + 1), *(bgcolor + 2));
-        gif->canvas[i*3 + 0] = c.full & 0xff;
-        gif->canvas[i*3 + 1] = (c.full >> 8) & 0xff;
-        gif->canvas[i*3 + 2] = 0xff;
-#elif LV_COLOR_DEPTH == 8
-        lv_color_t c = lv_color_make(*(bgcolor + 0), *(bgcolor + 1), *(bgcolor + 2));
-        gif->canvas[i*2 + 0] = c.full;
-        gif->canvas[i*2 + 1] = 0xff;
-#elif LV_COLOR_DEPTH == 1
-        lv_color_t c = lv_color_make(*(bgcolor + 0), *(bgcolor + 1), *(bgcolor + 2));
-        gif->canvas[i*2 + 0] = c.ch.red > 128 ? 1 : 0;
-        gif->canvas[i*2 + 1] = 0xff;
-#endif
+        set_pixel(gif, gif->canvas, i, bgcolor, 0xff);
     }
     gif->anim_start = f_gif_seek(gif, 0, LV_FS_SEEK_CUR);
     gif->loop_count = -1;
@@ -179,6 +163,45 @@ discard_sub_blocks(gd_GIF *gif)
     } while (size);
 }
 
+/* Check whether any frame restores its area to a transparent background.
+ * Only these frames make the canvas transparent, so without them no alpha byte is needed. */
+static bool
+scan_alpha(gd_GIF *gif)
+{
+    uint8_t sep, label, rdit, fisrz;
+
+    while (1) {
+        sep = 0;
+        f_gif_read(gif, &sep, 1);
+        if (sep == ';') {
+            return false;
+        } else if (sep == '!') {
+            f_gif_read(gif, &label, 1);
+            if (label == 0xF9) {
+                /* Skip block size. */
+                f_gif_seek(gif, 1, LV_FS_SEEK_CUR);
+                f_gif_read(gif, &rdit, 1);
+                if (((rdit >> 2) & 3) == 2 && (rdit & 1)) return true;
+                /* Skip delay and transparent color index. */
+                f_gif_seek(gif, 3, LV_FS_SEEK_CUR);
+            }
+            discard_sub_blocks(gif);
+        } else if (sep == ',') {
+            /* Skip position and size. */
+            f_gif_seek(gif, 8, LV_FS_SEEK_CUR);
+            f_gif_read(gif, &fisrz, 1);
+            if (fisrz & 0x80)
+                f_gif_seek(gif, 3 * (1 << ((fisrz & 0x07) + 1)), LV_FS_SEEK_CUR);
+            /* Skip LZW minimum code size. */
+            f_gif_seek(gif, 1, LV_FS_SEEK_CUR);
+            discard_sub_blocks(gif);
+        } else {
+            /* Truncated or invalid, keep the alpha byte to be safe. */
+            return true;
+        }
+    }
+}
+
 static void
 read_plain_text_ext(gd_GIF *gif)
 {
@@ -498,31 +521,43 @@ render_frame_rect(gd_GIF *gif, uint8_t *buffer)
             index = gif->frame[(gif->fy + j) * gif->width + gif->fx + k];
             color = &gif->palette->colors[index*3];
             if (!gif->gce.transparency || index != gif->gce.tindex) {
-#if LV_COLOR_DEPTH == 32
-                buffer[(i+k)*4 + 0] = *(color + 2);
-                buffer[(i+k)*4 + 1] = *(color + 1);
-                buffer[(i+k)*4 + 2] = *(color + 0);
-                buffer[(i+k)*4 + 3] = 0xFF;
-#elif LV_COLOR_DEPTH == 16
-                lv_color_t c = lv_color_make(*(color + 0), *(color + 1), *(color + 2));
-                buffer[(i+k)*3 + 0] = c.full & 0xff;
-                buffer[(i+k)*3 + 1] = (c.full >> 8) & 0xff;
-                buffer[(i+k)*3 + 2] = 0xff;
-#elif LV_COLOR_DEPTH == 8
-                lv_color_t c = lv_color_make(*(color + 0), *(color + 1), *(color + 2));
-                buffer[(i+k)*2 + 0] = c.full;
-                buffer[(i+k)*2 + 1] = 0xff;
-#elif LV_COLOR_DEPTH == 1
-                uint8_t b = (*(color + 0)) | (*(color + 1)) | (*(color + 2));
-                buffer[(i+k)*2 + 0] = b > 128 ? 1 : 0;
-                buffer[(i+k)*2 + 1] = 0xff;
-#endif
+                set_pixel(gif, buffer, i + k, color, 0xFF);
             }
         }
         i += gif->width;
     }
 }
 
+/* Write the color of the i-th pixel in the canvas' format. */
+static void
+set_pixel(gd_GIF *gif, uint8_t *buffer, int i, const uint8_t *color, uint8_t opa)
+{
+#if LV_COLOR_DEPTH == 1
+    uint8_t b = (*(color + 0)) | (*(color + 1)) | (*(color + 2));
+    lv_color_t c;
+    c.full = b > 128 ? 1 : 0;
+#else
+    lv_color_t c = lv_color_make(*(color + 0), *(color + 1), *(color + 2));
+#endif
+
+    if (!gif->has_alpha) {
+        ((lv_color_t *) buffer)[i] = c;
+        return;
+    }
+
+#if LV_COLOR_DEPTH == 32
+    c.ch.alpha = opa;
+    ((lv_color_t *) buffer)[i] = c;
+#elif LV_COLOR_DEPTH == 16
+    buffer[i*3 + 0] = c.full & 0xff;
+    buffer[i*3 + 1] = (c.full >> 8) & 0xff;
+    buffer[i*3 + 2] = opa;
+#elif LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1
+    buffer[i*2 + 0] = c.full;
+    buffer[i*2 + 1] = opa;
+#endif
+}
+
 static void
 dispose(gd_GIF *gif)
 {
@@ -538,25 +573,7 @@ dispose(gd_GIF *gif)
         i = gif->fy * gif->width + gif->fx;
         for (j = 0; j < gif->fh; j++) {
             for (k = 0; k < gif->fw; k++) {
-#if LV_COLOR_DEPTH == 32
-                gif->canvas[(i+k)*4 + 0] = *(bgcolor + 2);
-                gif->canvas[(i+k)*4 + 1] = *(bgcolor + 1);
-                gif->canvas[(i+k)*4 + 2] = *(bgcolor + 0);
-                gif->canvas[(i+k)*4 + 3] = opa;
-#elif LV_COLOR_DEPTH == 16
-                lv_color_t c = lv_color_make(*(bgcolor + 0), *(bgcolor + 1), *(bgcolor + 2));
-                gif->canvas[(i+k)*3 + 0] = c.full & 0xff;
-                gif->canvas[(i+k)*3 + 1] = (c.full >> 8) & 0xff;
-                gif->canvas[(i+k)*3 + 2] = opa;
-#elif LV_COLOR_DEPTH == 8
-                lv_color_t c = lv_color_make(*(bgcolor + 0), *(bgcolor + 1), *(bgcolor + 2));
-                gif->canvas[(i+k)*2 + 0] = c.full;
-                gif->canvas[(i+k)*2 + 1] = opa;
-#elif LV_COLOR_DEPTH == 1
-                uint8_t b = (*(bgcolor + 0)) | (*(bgcolor + 1)) | (*(bgcolor + 2));
-                gif->canvas[(i+k)*2 + 0] = b > 128 ? 1 : 0;
-                gif->canvas[(i+k)*2 + 1] = opa;
-#endif
+                set_pixel(gif, gif->canvas, i + k, bgcolor, opa);
             }
             i += gif->width;
         }
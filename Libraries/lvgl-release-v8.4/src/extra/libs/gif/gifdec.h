@@ -42,6 +42,7 @@ typedef struct gd_GIF {
     void (*application)(struct gd_GIF *gif, char id[8], char auth[3]);
     uint16_t fx, fy, fw, fh;
     uint8_t bgindex;
+    uint8_t has_alpha; /* The canvas has an alpha byte, else it's an array of `lv_color_t` */
     uint8_t *canvas, *frame;
 } gd_GIF;
 
@@ -26,6 +26,7 @@
 static void lv_gif_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void next_frame_task_cb(lv_timer_t * t);
+static void invalidate_canvas_area(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h);
 
 /**********************
  *  STATIC VARIABLES
@@ -80,7 +81,7 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
 
     gifobj->imgdsc.data = gifobj->gif->canvas;
     gifobj->imgdsc.header.always_zero = 0;
-    gifobj->imgdsc.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    gifobj->imgdsc.header.cf = gifobj->gif->has_alpha ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
     gifobj->imgdsc.header.h = gifobj->gif->height;
     gifobj->imgdsc.header.w = gifobj->gif->width;
     gifobj->last_call = lv_tick_get();
@@ -136,7 +137,15 @@ static void next_frame_task_cb(lv_timer_t * t)
 
     gifobj->last_call = lv_tick_get();
 
-    int has_next = gd_get_frame(gifobj->gif);
+    /*The area of the previous frame is changed only if it's restored to the background*/
+    gd_GIF * gif = gifobj->gif;
+    bool disposed = gif->gce.disposal == 2;
+    lv_coord_t prev_x = gif->fx;
+    lv_coord_t prev_y = gif->fy;
+    lv_coord_t prev_w = gif->fw;
+    lv_coord_t prev_h = gif->fh;
+
+    int has_next = gd_get_frame(gif);
     if(has_next == 0) {
         /*It was the last repeat*/
         lv_res_t res = lv_event_send(obj, LV_EVENT_READY, NULL);
@@ -147,7 +156,37 @@ static void next_frame_task_cb(lv_timer_t * t)
     gd_render_frame(gifobj->gif, (uint8_t *)gifobj->imgdsc.data);
 
     lv_img_cache_invalidate_src(lv_img_get_src(obj));
-    lv_obj_invalidate(obj);
+    if(disposed) invalidate_canvas_area(obj, prev_x, prev_y, prev_w, prev_h);
+    invalidate_canvas_area(obj, gif->fx, gif->fy, gif->fw, gif->fh);
+}
+
+/**
+ * Invalidate only the area where a changed part of the canvas is drawn
+ * @param obj   pointer to a GIF object
+ * @param x     x coordinate of the changed area on the canvas
+ * @param y     y coordinate of the changed area on the canvas
+ * @param w     width of the changed area
+ * @param h     height of the changed area
+ */
+static void invalidate_canvas_area(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h)
+{
+    if(w == 0 || h == 0) return;
+
+    /*The canvas is drawn 1:1 to the content area only if it's not transformed or repeated*/
+    lv_img_t * img = (lv_img_t *)obj;
+    if(img->angle != 0 || img->zoom != LV_IMG_ZOOM_NONE || img->offset.x != 0 || img->offset.y != 0 ||
+       lv_obj_get_content_width(obj) > img->w || lv_obj_get_content_height(obj) > img->h) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_area_t a;
+    lv_obj_get_content_coords(obj, &a);
+    a.x1 += x;
+    a.y1 += y;
+    a.x2 = a.x1 + w - 1;
+    a.y2 = a.y1 + h - 1;
+    lv_obj_invalidate_area(obj, &a);
 }
 
 #endif /*LV_USE_GIF*/
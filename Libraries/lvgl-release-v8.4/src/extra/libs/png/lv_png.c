@@ -16,10 +16,97 @@
 /*********************
  *      DEFINES
  *********************/
+#if LV_PNG_USE_STREAM
+    #define STREAM_IN_BUF_SIZE  256     /*Bytes read at once from files*/
+    #define STREAM_WINDOW_MAX   32768   /*Largest zlib window*/
+    #define HUFFMAN_FAST_BITS   9       /*Codes up to this length are decoded with one table lookup*/
+
+    #if LV_PNG_STREAM_BAND_CNT
+        #define STREAM_BAND_CNT     LV_PNG_STREAM_BAND_CNT
+        #define STREAM_BAND_HEIGHT  LV_PNG_STREAM_BAND_HEIGHT
+    #else
+        /*Only the last decoded row*/
+        #define STREAM_BAND_CNT     1
+        #define STREAM_BAND_HEIGHT  1
+    #endif
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_PNG_USE_STREAM
+enum {
+    PNG_COLOR_GRAY = 0,
+    PNG_COLOR_RGB = 2,
+    PNG_COLOR_PALETTE = 3,
+    PNG_COLOR_GRAY_ALPHA = 4,
+    PNG_COLOR_RGBA = 6,
+};
+
+enum {
+    INFLATE_BLOCK_HEADER,
+    INFLATE_BLOCK_STORED,
+    INFLATE_BLOCK_HUFFMAN,
+};
+
+typedef struct {
+    uint16_t fast[1 << HUFFMAN_FAST_BITS];  /*symbol << 4 | code length for the short codes, 0 for the longer ones*/
+    uint16_t count[16];                     /*Number of codes of each length*/
+    uint16_t symbol[288];                   /*Symbols ordered by their codes*/
+} huffman_t;
+
+typedef struct {
+    int32_t index;          /*Index of the band in the image, -1 if unused*/
+    uint32_t last_use;
+} png_band_t;
+
+typedef struct {
+    /*Source: a buffer of the file or the whole PNG data of a variable*/
+    lv_fs_file_t file;
+    bool is_file;
+    const uint8_t * in;
+    uint32_t in_pos;
+    uint32_t in_len;
+    uint32_t in_offset;     /*Offset of `in[0]` in the source*/
+    uint32_t idat_offset;   /*Offset of the CRC before the first IDAT chunk*/
+    uint32_t chunk_rest;    /*Bytes left in the current IDAT chunk*/
+
+    /*Image*/
+    uint32_t w;
+    uint32_t h;
+    uint8_t depth;
+    uint8_t color_type;
+    uint8_t bpp;            /*Bytes per complete pixel, at least 1*/
+    bool has_key;           /*A tRNS chunk gives the transparent gray or RGB color*/
+    uint16_t key[3];
+    uint16_t palette_size;
+    uint8_t * palette;      /*RGBA*/
+    uint32_t stride;        /*Bytes in a row without the filter type byte*/
+    uint8_t * row_cur;
+    uint8_t * row_prev;
+    uint32_t next_y;        /*The next row to decode*/
+
+    /*Inflate*/
+    uint32_t bit_buf;
+    uint8_t bit_cnt;
+    uint8_t pad_cnt;        /*Zero bytes fed after the end of the data*/
+    uint8_t block_state;
+    bool block_final;
+    uint32_t stored_rest;
+    uint16_t match_len;
+    uint16_t match_dist;
+    huffman_t * lit;
+    huffman_t * dist;
+    uint8_t * window;
+    uint32_t window_mask;
+    uint32_t window_pos;    /*Number of bytes inflated so far*/
+
+    /*Decoded rows*/
+    uint8_t * band_buf;
+    png_band_t bands[STREAM_BAND_CNT];
+    uint32_t band_use_cnt;
+} png_stream_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -29,10 +116,42 @@ static lv_res_t decoder_open(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc)
 static void decoder_close(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc);
 static void convert_color_depth(uint8_t * img, uint32_t px_cnt);
 static inline lv_color_t lv_color_make_rounding(uint8_t r, uint8_t g, uint8_t b);
+#if LV_PNG_USE_STREAM
+    static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                      lv_coord_t len, uint8_t * buf);
+    static png_stream_t * stream_open(lv_img_decoder_dsc_t * dsc);
+    static void stream_close(png_stream_t * s);
+    static bool stream_read_header(png_stream_t * s);
+    static lv_res_t stream_restart(png_stream_t * s);
+    static png_band_t * stream_decode_band(png_stream_t * s, uint32_t index);
+    static lv_res_t stream_decode_row(png_stream_t * s);
+    static void stream_convert_row(png_stream_t * s, const uint8_t * raw, uint8_t * dst);
+    static bool src_read(png_stream_t * s, void * buf, uint32_t len);
+    static bool src_seek(png_stream_t * s, uint32_t offset);
+    static bool idat_byte(png_stream_t * s, uint8_t * b);
+    static bool bits_need(png_stream_t * s, uint8_t n);
+    static uint32_t bits_get(png_stream_t * s, uint8_t n);
+    static lv_res_t inflate_read(png_stream_t * s, uint8_t * dst, uint32_t len);
+    static lv_res_t inflate_block_header(png_stream_t * s);
+    static lv_res_t inflate_dynamic_tables(png_stream_t * s);
+    static bool huffman_build(huffman_t * h, const uint8_t * lengths, uint32_t n);
+    static int32_t huffman_decode(png_stream_t * s, const huffman_t * h);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_PNG_USE_STREAM
+static const uint16_t len_base[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59,
+                                      67, 83, 99, 115, 131, 163, 195, 227, 258
+                                     };
+static const uint8_t len_extra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const uint16_t dist_base[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769,
+                                       1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+                                      };
+static const uint8_t dist_extra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+static const uint8_t code_length_order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+#endif
 
 /**********************
  *      MACROS
@@ -51,6 +170,9 @@ void lv_png_init(void)
     lv_img_decoder_set_info_cb(dec, decoder_info);
     lv_img_decoder_set_open_cb(dec, decoder_open);
     lv_img_decoder_set_close_cb(dec, decoder_close);
+#if LV_PNG_USE_STREAM
+    lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
+#endif
 }
 
 /**********************
@@ -151,6 +273,15 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
 
     uint8_t * img_data = NULL;
 
+#if LV_PNG_USE_STREAM
+    /*Leave `img_data` NULL to get the lines with `decoder_read_line`*/
+    png_stream_t * stream = stream_open(dsc);
+    if(stream) {
+        dsc->user_data = stream;
+        return LV_RES_OK;
+    }
+#endif
+
     /*If it's a PNG file...*/
     if(dsc->src_type == LV_IMG_SRC_FILE) {
         const char * fn = dsc->src;
@@ -223,6 +354,13 @@ static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc
         lv_mem_free((uint8_t *)dsc->img_data);
         dsc->img_data = NULL;
     }
+
+#if LV_PNG_USE_STREAM
+    if(dsc->user_data) {
+        stream_close(dsc->user_data);
+        dsc->user_data = NULL;
+    }
+#endif
 }
 
 /**
@@ -284,4 +422,829 @@ static inline lv_color_t lv_color_make_rounding(uint8_t r, uint8_t g, uint8_t b)
     return lv_color_make(r, g, b);
 }
 
+#if LV_PNG_USE_STREAM
+
+/**
+ * Copy a part of a line of a streamed PNG
+ * @param x start x coordinate
+ * @param y y coordinate of the line
+ * @param len number of pixels to copy
+ * @param buf store the pixels here in `LV_IMG_CF_TRUE_COLOR_ALPHA` format
+ * @return LV_RES_OK: no error; LV_RES_INV: the image couldn't be decoded
+ */
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                  lv_coord_t len, uint8_t * buf)
+{
+    LV_UNUSED(decoder);
+    png_stream_t * s = dsc->user_data;
+    if(s == NULL) return LV_RES_INV;
+    if(x < 0 || y < 0 || len < 0 || (uint32_t)x + len > s->w || (uint32_t)y >= s->h) return LV_RES_INV;
+
+    uint32_t index = y / STREAM_BAND_HEIGHT;
+    png_band_t * band = NULL;
+    uint32_t i;
+    for(i = 0; i < STREAM_BAND_CNT; i++) {
+        if(s->bands[i].index == (int32_t)index) {
+            band = &s->bands[i];
+            break;
+        }
+    }
+
+    if(band == NULL) {
+        band = stream_decode_band(s, index);
+        if(band == NULL) return LV_RES_INV;
+    }
+    band->last_use = ++s->band_use_cnt;
+
+    uint32_t row = (uint32_t)(band - s->bands) * STREAM_BAND_HEIGHT + y % STREAM_BAND_HEIGHT;
+    lv_memcpy(buf, &s->band_buf[(row * s->w + x) * LV_IMG_PX_SIZE_ALPHA_BYTE], len * LV_IMG_PX_SIZE_ALPHA_BYTE);
+
+    return LV_RES_OK;
+}
+
+/**
+ * Parse the header of a PNG and prepare to decode it row by row
+ * @param dsc the decoder descriptor with a PNG file or variable source
+ * @return the new stream or NULL if the image can't or shouldn't be streamed (e.g. interlaced)
+ */
+static png_stream_t * stream_open(lv_img_decoder_dsc_t * dsc)
+{
+    png_stream_t * s = lv_mem_alloc(sizeof(png_stream_t));
+    LV_ASSERT_MALLOC(s);
+    if(s == NULL) return NULL;
+    lv_memset_00(s, sizeof(png_stream_t));
+
+    if(dsc->src_type == LV_IMG_SRC_FILE) {
+        if(strcmp(lv_fs_get_ext(dsc->src), "png") != 0) {
+            lv_mem_free(s);
+            return NULL;
+        }
+
+        if(lv_fs_open(&s->file, dsc->src, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+            lv_mem_free(s);
+            return NULL;
+        }
+        s->is_file = true;
+        s->in = lv_mem_alloc(STREAM_IN_BUF_SIZE);
+        LV_ASSERT_MALLOC(s->in);
+    }
+    else if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = dsc->src;
+        s->in = img_dsc->data;
+        s->in_len = img_dsc->data_size;
+    }
+
+    if(s->in == NULL || !stream_read_header(s)) {
+        stream_close(s);
+        return NULL;
+    }
+
+    /*Distances can't point before the first byte, so a smaller window is enough for small images*/
+    uint32_t raw_size = (s->stride + 1) * s->h;
+    uint32_t window_size = 256;
+    while(window_size < STREAM_WINDOW_MAX && window_size < raw_size) window_size <<= 1;
+    s->window_mask = window_size - 1;
+
+    uint32_t band_size = STREAM_BAND_HEIGHT * s->w * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    s->window = lv_mem_alloc(window_size);
+    s->lit = lv_mem_alloc(sizeof(huffman_t));
+    s->dist = lv_mem_alloc(sizeof(huffman_t));
+    s->row_cur = lv_mem_alloc(s->stride);
+    s->row_prev = lv_mem_alloc(s->stride);
+    s->band_buf = lv_mem_alloc(band_size * STREAM_BAND_CNT);
+    if(s->window == NULL || s->lit == NULL || s->dist == NULL || s->row_cur == NULL || s->row_prev == NULL ||
+       s->band_buf == NULL) {
+        LV_LOG_WARN("out of memory");
+        stream_close(s);
+        return NULL;
+    }
+
+    uint32_t i;
+    for(i = 0; i < STREAM_BAND_CNT; i++) s->bands[i].index = -1;
+
+    if(stream_restart(s) != LV_RES_OK) {
+        stream_close(s);
+        return NULL;
+    }
+
+    return s;
+}
+
+/**
+ * Free a stream and close its file
+ * @param s pointer to a stream
+ */
+static void stream_close(png_stream_t * s)
+{
+    if(s->is_file) {
+        lv_fs_close(&s->file);
+        if(s->in) lv_mem_free((uint8_t *)s->in);
+    }
+
+    if(s->palette) lv_mem_free(s->palette);
+    if(s->window) lv_mem_free(s->window);
+    if(s->lit) lv_mem_free(s->lit);
+    if(s->dist) lv_mem_free(s->dist);
+    if(s->row_cur) lv_mem_free(s->row_cur);
+    if(s->row_prev) lv_mem_free(s->row_prev);
+    if(s->band_buf) lv_mem_free(s->band_buf);
+    lv_mem_free(s);
+}
+
+/**
+ * Read the chunks before the image data and save the properties of the image
+ * @param s pointer to a stream
+ * @return true: the image can be streamed; false: invalid, unsupported or interlaced image
+ */
+static bool stream_read_header(png_stream_t * s)
+{
+    static const uint8_t magic[] = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
+    uint8_t buf[13];
+    if(!src_read(s, buf, 8) || memcmp(buf, magic, sizeof(magic))) return false;
+
+    bool has_header = false;
+    while(1) {
+        uint32_t chunk_offset = s->in_offset + s->in_pos;
+        if(!src_read(s, buf, 8)) return false;
+        uint32_t len = ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) | ((uint32_t)buf[2] << 8) | buf[3];
+        const char * type = (const char *)&buf[4];
+
+        if(memcmp(type, "IDAT", 4) == 0) {
+            if(!has_header) return false;
+            s->idat_offset = chunk_offset - 4;
+            return true;
+        }
+        else if(memcmp(type, "IHDR", 4) == 0) {
+            if(len != 13 || !src_read(s, buf, 13)) return false;
+            s->w = ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) | ((uint32_t)buf[2] << 8) | buf[3];
+            s->h = ((uint32_t)buf[4] << 24) | ((uint32_t)buf[5] << 16) | ((uint32_t)buf[6] << 8) | buf[7];
+            s->depth = buf[8];
+            s->color_type = buf[9];
+            /*buf[10] and buf[11]: compression and filter method, both must be 0. buf[12]: interlace*/
+            if(s->w == 0 || s->h == 0 || s->w > LV_COORD_MAX || s->h > LV_COORD_MAX) return false;
+            if(buf[10] != 0 || buf[11] != 0 || buf[12] != 0) return false;
+
+            uint8_t channels;
+            switch(s->color_type) {
+                case PNG_COLOR_GRAY:
+                    if(s->depth != 1 && s->depth != 2 && s->depth != 4 && s->depth != 8 && s->depth != 16) return false;
+                    channels = 1;
+                    break;
+                case PNG_COLOR_PALETTE:
+                    if(s->depth != 1 && s->depth != 2 && s->depth != 4 && s->depth != 8) return false;
+                    channels = 1;
+                    break;
+                case PNG_COLOR_RGB:
+                    channels = 3;
+                    break;
+                case PNG_COLOR_GRAY_ALPHA:
+                    channels = 2;
+                    break;
+                case PNG_COLOR_RGBA:
+                    channels = 4;
+                    break;
+                default:
+                    return false;
+            }
+            if(channels > 1 && s->depth != 8 && s->depth != 16) return false;
+
+            uint32_t px_bits = channels * s->depth;
+            s->stride = (s->w * px_bits + 7) / 8;
+            s->bpp = px_bits < 8 ? 1 : px_bits / 8;
+            has_header = true;
+        }
+        else if(memcmp(type, "PLTE", 4) == 0) {
+            if(len % 3 || len > 256 * 3 || s->palette) return false;
+            s->palette_size = len / 3;
+            s->palette = lv_mem_alloc(256 * 4);
+            LV_ASSERT_MALLOC(s->palette);
+            if(s->palette == NULL) return false;
+            lv_memset_00(s->palette, 256 * 4);
+            uint32_t i;
+            for(i = 0; i < s->palette_size; i++) {
+                if(!src_read(s, &s->palette[i * 4], 3)) return false;
+                s->palette[i * 4 + 3] = 0xff;
+            }
+        }
+        else if(memcmp(type, "tRNS", 4) == 0 && has_header) {
+            if(s->color_type == PNG_COLOR_PALETTE) {
+                if(s->palette == NULL || len > s->palette_size) return false;
+                uint32_t i;
+                for(i = 0; i < len; i++) {
+                    if(!src_read(s, &s->palette[i * 4 + 3], 1)) return false;
+                }
+            }
+            else if(s->color_type == PNG_COLOR_GRAY || s->color_type == PNG_COLOR_RGB) {
+                uint32_t key_cnt = s->color_type == PNG_COLOR_GRAY ? 1 : 3;
+                if(len != key_cnt * 2 || !src_read(s, buf, len)) return false;
+                uint32_t i;
+                for(i = 0; i < key_cnt; i++) s->key[i] = ((uint16_t)buf[i * 2] << 8) | buf[i * 2 + 1];
+                s->has_key = true;
+            }
+            else {
+                return false;
+            }
+        }
+        else {
+            /*Other chunks are ignored like in the full decoder*/
+            if(!src_seek(s, chunk_offset + 8 + len)) return false;
+        }
+
+        /*Skip the CRC*/
+        if(!src_seek(s, chunk_offset + 8 + len + 4)) return false;
+    }
+}
+
+/**
+ * Go back to the first row of the image
+ * @param s pointer to a stream
+ * @return LV_RES_OK: no error; LV_RES_INV: invalid zlib header or read error
+ */
+static lv_res_t stream_restart(png_stream_t * s)
+{
+    if(!src_seek(s, s->idat_offset)) return LV_RES_INV;
+    s->chunk_rest = 0;
+    s->bit_buf = 0;
+    s->bit_cnt = 0;
+    s->pad_cnt = 0;
+    s->block_state = INFLATE_BLOCK_HEADER;
+    s->block_final = false;
+    s->match_len = 0;
+    s->window_pos = 0;
+    s->next_y = 0;
+    lv_memset_00(s->row_prev, s->stride);
+
+    /*zlib header: deflate method, no preset dictionary*/
+    uint32_t cmf = bits_get(s, 8);
+    uint32_t flg = bits_get(s, 8);
+    if((cmf & 0x0f) != 8 || (cmf >> 4) > 7 || ((cmf << 8) | flg) % 31 || (flg & 0x20)) {
+        LV_LOG_WARN("invalid zlib header");
+        return LV_RES_INV;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Decode the rows of a band into the least recently used band.
+ * The image is decoded again from the start if the band is above the next row.
+ * @param s pointer to a stream
+ * @param index index of the band
+ * @return the band or NULL on error
+ */
+static png_band_t * stream_decode_band(png_stream_t * s, uint32_t index)
+{
+    uint32_t first = index * STREAM_BAND_HEIGHT;
+    if(s->next_y > first) {
+        if(stream_restart(s) != LV_RES_OK) return NULL;
+    }
+
+    while(s->next_y < first) {
+        if(stream_decode_row(s) != LV_RES_OK) return NULL;
+    }
+
+    png_band_t * band = &s->bands[0];
+    uint32_t i;
+    for(i = 1; i < STREAM_BAND_CNT; i++) {
+        if(s->bands[i].last_use < band->last_use) band = &s->bands[i];
+    }
+
+    /*Invalid until all of its rows are decoded*/
+    band->index = -1;
+
+    uint32_t row = (uint32_t)(band - s->bands) * STREAM_BAND_HEIGHT;
+    uint32_t last = LV_MIN(first + STREAM_BAND_HEIGHT, s->h);
+    while(s->next_y < last) {
+        if(stream_decode_row(s) != LV_RES_OK) return NULL;
+        stream_convert_row(s, s->row_cur, &s->band_buf[row * s->w * LV_IMG_PX_SIZE_ALPHA_BYTE]);
+        row++;
+    }
+
+    band->index = index;
+    return band;
+}
+
+/**
+ * Inflate and unfilter the next row into `row_cur`
+ * @param s pointer to a stream
+ * @return LV_RES_OK: no error; LV_RES_INV: invalid data
+ */
+static lv_res_t stream_decode_row(png_stream_t * s)
+{
+    uint8_t * tmp = s->row_prev;
+    s->row_prev = s->row_cur;
+    s->row_cur = tmp;
+
+    uint8_t filter;
+    if(inflate_read(s, &filter, 1) != LV_RES_OK) return LV_RES_INV;
+    if(inflate_read(s, s->row_cur, s->stride) != LV_RES_OK) return LV_RES_INV;
+
+    uint8_t * cur = s->row_cur;
+    const uint8_t * prev = s->row_prev;
+    uint32_t bpp = s->bpp;
+    uint32_t i;
+    switch(filter) {
+        case 0:
+            break;
+        case 1:
+            for(i = bpp; i < s->stride; i++) cur[i] += cur[i - bpp];
+            break;
+        case 2:
+            for(i = 0; i < s->stride; i++) cur[i] += prev[i];
+            break;
+        case 3:
+            for(i = 0; i < bpp; i++) cur[i] += prev[i] >> 1;
+            for(i = bpp; i < s->stride; i++) cur[i] += (cur[i - bpp] + prev[i]) >> 1;
+            break;
+        case 4:
+            for(i = 0; i < bpp; i++) cur[i] += prev[i];
+            for(i = bpp; i < s->stride; i++) {
+                int32_t a = cur[i - bpp];
+                int32_t b = prev[i];
+                int32_t c = prev[i - bpp];
+                int32_t pa = LV_ABS(b - c);
+                int32_t pb = LV_ABS(a - c);
+                int32_t pc = LV_ABS(a + b - 2 * c);
+                cur[i] += (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+            }
+            break;
+        default:
+            LV_LOG_WARN("invalid filter type: %d", filter);
+            return LV_RES_INV;
+    }
+
+    s->next_y++;
+    return LV_RES_OK;
+}
+
+/**
+ * Convert an unfiltered row to the same format as `convert_color_depth`
+ * @param s pointer to a stream
+ * @param raw the unfiltered row
+ * @param dst store the `LV_IMG_CF_TRUE_COLOR_ALPHA` pixels here
+ */
+static void stream_convert_row(png_stream_t * s, const uint8_t * raw, uint8_t * dst)
+{
+    uint8_t depth = s->depth;
+    uint32_t x;
+    for(x = 0; x < s->w; x++) {
+        uint8_t r;
+        uint8_t g;
+        uint8_t b;
+        uint8_t a = 0xff;
+
+        switch(s->color_type) {
+            case PNG_COLOR_GRAY:
+            case PNG_COLOR_PALETTE: {
+                    uint32_t v;
+                    if(depth == 16) v = ((uint32_t)raw[x * 2] << 8) | raw[x * 2 + 1];
+                    else if(depth == 8) v = raw[x];
+                    else v = (raw[x * depth / 8] >> (8 - depth - (x * depth) % 8)) & ((1 << depth) - 1);
+
+                    if(s->color_type == PNG_COLOR_PALETTE) {
+                        if(v < s->palette_size) {
+                            r = s->palette[v * 4];
+                            g = s->palette[v * 4 + 1];
+                            b = s->palette[v * 4 + 2];
+                            a = s->palette[v * 4 + 3];
+                        }
+                        else {
+                            r = g = b = 0;
+                        }
+                    }
+                    else {
+                        if(s->has_key && v == s->key[0]) a = 0x00;
+                        if(depth == 16) r = v >> 8;
+                        else r = v * 255 / ((1 << depth) - 1);
+                        g = b = r;
+                    }
+                    break;
+                }
+            case PNG_COLOR_RGB:
+                if(depth == 8) {
+                    r = raw[x * 3];
+                    g = raw[x * 3 + 1];
+                    b = raw[x * 3 + 2];
+                    if(s->has_key && r == s->key[0] && g == s->key[1] && b == s->key[2]) a = 0x00;
+                }
+                else {
+                    const uint8_t * px = &raw[x * 6];
+                    r = px[0];
+                    g = px[2];
+                    b = px[4];
+                    if(s->has_key && ((px[0] << 8) | px[1]) == s->key[0] && ((px[2] << 8) | px[3]) == s->key[1] &&
+                       ((px[4] << 8) | px[5]) == s->key[2]) a = 0x00;
+                }
+                break;
+            case PNG_COLOR_GRAY_ALPHA:
+                r = g = b = raw[x * 2 * (depth / 8)];
+                a = raw[x * 2 * (depth / 8) + depth / 8];
+                break;
+            default:    /*PNG_COLOR_RGBA*/
+                r = raw[x * 4 * (depth / 8)];
+                g = raw[x * 4 * (depth / 8) + depth / 8];
+                b = raw[x * 4 * (depth / 8) + 2 * (depth / 8)];
+                a = raw[x * 4 * (depth / 8) + 3 * (depth / 8)];
+                break;
+        }
+
+        uint8_t * px_out = &dst[x * LV_IMG_PX_SIZE_ALPHA_BYTE];
+#if LV_COLOR_DEPTH == 32
+        lv_color_t c = lv_color_make(r, g, b);
+        c.ch.alpha = a;
+        lv_memcpy(px_out, &c, sizeof(c));
+#elif LV_COLOR_DEPTH == 16
+        lv_color_t c = lv_color_make_rounding(r, g, b);
+        px_out[0] = c.full & 0xFF;
+        px_out[1] = c.full >> 8;
+        px_out[2] = a;
+#elif LV_COLOR_DEPTH == 8
+        lv_color_t c = lv_color_make_rounding(r, g, b);
+        px_out[0] = c.full;
+        px_out[1] = a;
+#elif LV_COLOR_DEPTH == 1
+        px_out[0] = (r | g | b) > 128 ? 1 : 0;
+        px_out[1] = a;
+#endif
+    }
+}
+
+/**
+ * Read bytes from the source
+ * @param s pointer to a stream
+ * @param buf store the bytes here
+ * @param len number of bytes to read
+ * @return true: `len` bytes were read; false: error or end of the source
+ */
+static bool src_read(png_stream_t * s, void * buf, uint32_t len)
+{
+    uint8_t * buf8 = buf;
+    while(len) {
+        if(s->in_pos == s->in_len) {
+            if(!s->is_file) return false;
+
+            s->in_offset += s->in_len;
+            s->in_pos = 0;
+            s->in_len = 0;
+            lv_fs_read(&s->file, (uint8_t *)s->in, STREAM_IN_BUF_SIZE, &s->in_len);
+            if(s->in_len == 0) return false;
+        }
+
+        uint32_t n = LV_MIN(len, s->in_len - s->in_pos);
+        lv_memcpy(buf8, &s->in[s->in_pos], n);
+        s->in_pos += n;
+        buf8 += n;
+        len -= n;
+    }
+
+    return true;
+}
+
+/**
+ * Set the position in the source
+ * @param s pointer to a stream
+ * @param offset the new position from the start of the source
+ * @return true: success; false: read error or after the end of a variable
+ */
+static bool src_seek(png_stream_t * s, uint32_t offset)
+{
+    if(offset >= s->in_offset && offset <= s->in_offset + s->in_len) {
+        s->in_pos = offset - s->in_offset;
+        return true;
+    }
+
+    if(!s->is_file) return false;
+    if(lv_fs_seek(&s->file, offset, LV_FS_SEEK_SET) != LV_FS_RES_OK) return false;
+    s->in_offset = offset;
+    s->in_pos = 0;
+    s->in_len = 0;
+    return true;
+}
+
+/**
+ * Read the next byte of the zlib stream. It's split into the data of the IDAT chunks.
+ * @param s pointer to a stream
+ * @param b store the byte here
+ * @return true: success; false: no more IDAT data
+ */
+static bool idat_byte(png_stream_t * s, uint8_t * b)
+{
+    while(s->chunk_rest == 0) {
+        /*CRC of the previous chunk, length and type of the next one*/
+        uint8_t buf[12];
+        if(!src_read(s, buf, 12)) return false;
+        if(memcmp(&buf[8], "IDAT", 4)) return false;
+        s->chunk_rest = ((uint32_t)buf[4] << 24) | ((uint32_t)buf[5] << 16) | ((uint32_t)buf[6] << 8) | buf[7];
+    }
+
+    if(!src_read(s, b, 1)) return false;
+    s->chunk_rest--;
+    return true;
+}
+
+/**
+ * Make sure at least `n` bits are in the bit buffer
+ * @param s pointer to a stream
+ * @param n number of bits, max. 24
+ * @return true: success; false: read too far after the end of the data
+ */
+static bool bits_need(png_stream_t * s, uint8_t n)
+{
+    while(s->bit_cnt < n) {
+        uint8_t b;
+        if(!idat_byte(s, &b)) {
+            /*Allow reading ahead a few bytes for the Huffman tables, but not more*/
+            if(s->pad_cnt >= 4) return false;
+            s->pad_cnt++;
+            b = 0;
+        }
+        s->bit_buf |= (uint32_t)b << s->bit_cnt;
+        s->bit_cnt += 8;
+    }
+
+    return true;
+}
+
+/**
+ * Read bits, the least significant first
+ * @param s pointer to a stream
+ * @param n number of bits, max. 24
+ * @return the value of the bits, zeros after the end of the data
+ */
+static uint32_t bits_get(png_stream_t * s, uint8_t n)
+{
+    if(n == 0) return 0;
+    if(!bits_need(s, n)) return 0;
+    uint32_t v = s->bit_buf & ((1UL << n) - 1);
+    s->bit_buf >>= n;
+    s->bit_cnt -= n;
+    return v;
+}
+
+/**
+ * Inflate the next bytes of the image data
+ * @param s pointer to a stream
+ * @param dst store the bytes here
+ * @param len number of bytes to inflate
+ * @return LV_RES_OK: no error; LV_RES_INV: invalid or too short data
+ */
+static lv_res_t inflate_read(png_stream_t * s, uint8_t * dst, uint32_t len)
+{
+    while(len) {
+        if(s->match_len) {
+            uint32_t n = LV_MIN(len, s->match_len);
+            s->match_len -= n;
+            len -= n;
+            while(n) {
+                uint8_t b = s->window[(s->window_pos - s->match_dist) & s->window_mask];
+                s->window[s->window_pos & s->window_mask] = b;
+                s->window_pos++;
+                *dst++ = b;
+                n--;
+            }
+            continue;
+        }
+
+        if(s->block_state == INFLATE_BLOCK_HEADER) {
+            if(inflate_block_header(s) != LV_RES_OK) return LV_RES_INV;
+        }
+        else if(s->block_state == INFLATE_BLOCK_STORED) {
+            uint8_t b = bits_get(s, 8);
+            s->window[s->window_pos & s->window_mask] = b;
+            s->window_pos++;
+            *dst++ = b;
+            len--;
+            s->stored_rest--;
+            if(s->stored_rest == 0) s->block_state = INFLATE_BLOCK_HEADER;
+        }
+        else {
+            int32_t sym = huffman_decode(s, s->lit);
+            if(sym < 0) return LV_RES_INV;
+            if(sym < 256) {
+                s->window[s->window_pos & s->window_mask] = sym;
+                s->window_pos++;
+                *dst++ = sym;
+                len--;
+            }
+            else if(sym == 256) {
+                s->block_state = INFLATE_BLOCK_HEADER;
+            }
+            else {
+                sym -= 257;
+                if(sym >= 29) return LV_RES_INV;
+                uint32_t match_len = len_base[sym] + bits_get(s, len_extra[sym]);
+
+                sym = huffman_decode(s, s->dist);
+                if(sym < 0 || sym >= 30) return LV_RES_INV;
+                uint32_t match_dist = dist_base[sym] + bits_get(s, dist_extra[sym]);
+                if(match_dist > s->window_pos || match_dist > s->window_mask + 1) {
+                    LV_LOG_WARN("invalid distance");
+                    return LV_RES_INV;
+                }
+
+                s->match_len = match_len;
+                s->match_dist = match_dist;
+            }
+        }
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Start a new deflate block
+ * @param s pointer to a stream
+ * @return LV_RES_OK: no error; LV_RES_INV: invalid block or no more blocks
+ */
+static lv_res_t inflate_block_header(png_stream_t * s)
+{
+    if(s->block_final) {
+        LV_LOG_WARN("not enough image data");
+        return LV_RES_INV;
+    }
+
+    s->block_final = bits_get(s, 1);
+    uint32_t type = bits_get(s, 2);
+    if(type == 0) {
+        /*Stored block, skip to the next byte boundary*/
+        bits_get(s, s->bit_cnt % 8);
+        uint32_t len = bits_get(s, 16);
+        uint32_t nlen = bits_get(s, 16);
+        if(len != (~nlen & 0xffff)) return LV_RES_INV;
+        if(len) {
+            s->stored_rest = len;
+            s->block_state = INFLATE_BLOCK_STORED;
+        }
+    }
+    else if(type == 1) {
+        /*Fixed Huffman codes*/
+        uint8_t lengths[288 + 32];
+        uint32_t i;
+        for(i = 0; i < 144; i++) lengths[i] = 8;
+        for(; i < 256; i++) lengths[i] = 9;
+        for(; i < 280; i++) lengths[i] = 7;
+        for(; i < 288; i++) lengths[i] = 8;
+        for(; i < 288 + 32; i++) lengths[i] = 5;
+        huffman_build(s->lit, lengths, 288);
+        huffman_build(s->dist, &lengths[288], 32);
+        s->block_state = INFLATE_BLOCK_HUFFMAN;
+    }
+    else if(type == 2) {
+        if(inflate_dynamic_tables(s) != LV_RES_OK) return LV_RES_INV;
+        s->block_state = INFLATE_BLOCK_HUFFMAN;
+    }
+    else {
+        return LV_RES_INV;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Read the Huffman tables of a dynamic block
+ * @param s pointer to a stream
+ * @return LV_RES_OK: no error; LV_RES_INV: invalid tables
+ */
+static lv_res_t inflate_dynamic_tables(png_stream_t * s)
+{
+    uint32_t hlit = bits_get(s, 5) + 257;
+    uint32_t hdist = bits_get(s, 5) + 1;
+    uint32_t hclen = bits_get(s, 4) + 4;
+    if(hlit > 286 || hdist > 30) return LV_RES_INV;
+
+    uint8_t lengths[288 + 32];
+    lv_memset_00(lengths, 19);
+    uint32_t i;
+    for(i = 0; i < hclen; i++) lengths[code_length_order[i]] = bits_get(s, 3);
+
+    /*The code length codes are decoded with the distance table which is built later*/
+    if(!huffman_build(s->dist, lengths, 19)) return LV_RES_INV;
+
+    i = 0;
+    while(i < hlit + hdist) {
+        int32_t sym = huffman_decode(s, s->dist);
+        if(sym < 0) return LV_RES_INV;
+        if(sym < 16) {
+            lengths[i++] = sym;
+            continue;
+        }
+
+        uint8_t len = 0;
+        uint32_t repeat;
+        if(sym == 16) {
+            if(i == 0) return LV_RES_INV;
+            len = lengths[i - 1];
+            repeat = 3 + bits_get(s, 2);
+        }
+        else if(sym == 17) {
+            repeat = 3 + bits_get(s, 3);
+        }
+        else {
+            repeat = 11 + bits_get(s, 7);
+        }
+
+        if(i + repeat > hlit + hdist) return LV_RES_INV;
+        while(repeat--) lengths[i++] = len;
+    }
+
+    if(lengths[256] == 0) return LV_RES_INV;
+    if(!huffman_build(s->lit, lengths, hlit)) return LV_RES_INV;
+    if(!huffman_build(s->dist, &lengths[hlit], hdist)) return LV_RES_INV;
+
+    return LV_RES_OK;
+}
+
+/**
+ * Build the tables of canonical Huffman codes
+ * @param h store the tables here
+ * @param lengths code length of each symbol, 0 if the symbol is not used
+ * @param n number of symbols
+ * @return true: success; false: over-subscribed code lengths
+ */
+static bool huffman_build(huffman_t * h, const uint8_t * lengths, uint32_t n)
+{
+    lv_memset_00(h->count, sizeof(h->count));
+    uint32_t i;
+    for(i = 0; i < n; i++) h->count[lengths[i]]++;
+    h->count[0] = 0;
+
+    int32_t left = 1;
+    uint16_t offs[16];
+    offs[1] = 0;
+    for(i = 1; i < 16; i++) {
+        left = (left << 1) - h->count[i];
+        if(left < 0) return false;
+        if(i < 15) offs[i + 1] = offs[i] + h->count[i];
+    }
+
+    for(i = 0; i < n; i++) {
+        if(lengths[i]) h->symbol[offs[lengths[i]]++] = i;
+    }
+
+    /*Index the short codes with their bits in reading order, i.e. reversed*/
+    lv_memset_00(h->fast, sizeof(h->fast));
+    uint32_t code = 0;
+    uint32_t k = 0;
+    uint32_t len;
+    for(len = 1; len <= HUFFMAN_FAST_BITS; len++) {
+        for(i = 0; i < h->count[len]; i++) {
+            uint32_t rev = 0;
+            uint32_t j;
+            for(j = 0; j < len; j++) rev |= ((code >> j) & 1) << (len - 1 - j);
+            for(; rev < (1 << HUFFMAN_FAST_BITS); rev += 1 << len) h->fast[rev] = (h->symbol[k] << 4) | len;
+            code++;
+            k++;
+        }
+        code <<= 1;
+    }
+
+    return true;
+}
+
+/**
+ * Decode a symbol
+ * @param s pointer to a stream
+ * @param h the Huffman tables to use
+ * @return the symbol or -1 on invalid code
+ */
+static int32_t huffman_decode(png_stream_t * s, const huffman_t * h)
+{
+    if(!bits_need(s, 15)) {
+        /*Less bits may be enough for the last codes*/
+        if(s->bit_cnt == 0) return -1;
+    }
+
+    uint16_t e = h->fast[s->bit_buf & ((1 << HUFFMAN_FAST_BITS) - 1)];
+    if(e) {
+        s->bit_buf >>= e & 0x0f;
+        s->bit_cnt -= e & 0x0f;
+        return e >> 4;
+    }
+
+    /*Longer codes, decode them bit by bit*/
+    int32_t code = 0;
+    int32_t first = 0;
+    int32_t index = 0;
+    uint32_t bits = s->bit_buf;
+    uint32_t len;
+    for(len = 1; len < 16 && len <= s->bit_cnt; len++) {
+        code |= bits & 1;
+        bits >>= 1;
+        int32_t count = h->count[len];
+        if(code - first < count) {
+            s->bit_buf >>= len;
+            s->bit_cnt -= len;
+            return h->symbol[index + code - first];
+        }
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+    }
+
+    return -1;
+}
+
+#endif /*LV_PNG_USE_STREAM*/
+
 #endif /*LV_USE_PNG*/
@@ -37,8 +37,8 @@
 /                   JPEG DECODER
 /                   ------------
 /   We are using TJpgDec - Tiny JPEG Decompressor library from ELM-CHAN for decoding each split-jpeg fragments.
-/   The tjpgd.c and tjpgd.h is not modified and those are used as it is. So if any update comes for the tiny-jpeg,
-/   just replace those files with updated files.
+/   tjpgd.c is modified to skip the IDCT of empty columns/rows and to output byte swapped RGB565 (see the header
+/   of tjpgd.c). Keep these changes if tjpgd is updated. The configuration in tjpgdcnf.h follows lv_conf.h.
 /---------------------------------------------------------------------------------------------------------------------------------*/
 
 /*********************
@@ -55,7 +55,11 @@
 /*********************
  *      DEFINES
  *********************/
+#if LV_SJPG_FAST_DECODE == 2
+#define TJPGD_WORKBUFF_SIZE             (4096 + (6 << 10))  //+ the tables of the fast huffman decoding
+#else
 #define TJPGD_WORKBUFF_SIZE             4096    //Recommended by TJPGD libray
+#endif
 
 //NEVER EDIT THESE OFFSET VALUES
 #define SJPEG_VERSION_OFFSET            8
@@ -77,7 +81,7 @@ enum io_source_type {
 typedef struct {
     enum io_source_type type;
     lv_fs_file_t lv_file;
-    uint8_t * img_cache_buff;
+    lv_color_t * img_cache_buff;
     int img_cache_x_res;
     int img_cache_y_res;
     uint8_t * raw_sjpg_data;              //Used when type==SJPEG_IO_SOURCE_C_ARRAY.
@@ -85,6 +89,12 @@ typedef struct {
     uint32_t raw_sjpg_data_next_read_pos; //Used for all types.
 } io_source_t;
 
+typedef struct {
+    int index;                          //index of the decoded frame or -1 if the slot is empty
+    uint32_t last_use;
+    lv_color_t * buf;                   //the decoded frame in native color format
+} sjpeg_frame_t;
+
 typedef struct {
     uint8_t * sjpeg_data;
     uint32_t sjpeg_data_size;
@@ -92,10 +102,11 @@ typedef struct {
     int sjpeg_y_res;
     int sjpeg_total_frames;
     int sjpeg_single_frame_height;
-    int sjpeg_cache_frame_index;
     uint8_t ** frame_base_array;        //to save base address of each split frames upto sjpeg_total_frames.
     int * frame_base_offset;            //to save base offset for fseek
-    uint8_t * frame_cache;
+    sjpeg_frame_t * frame_cache;        //LRU cache of the decoded frames
+    int frame_cache_cnt;
+    uint32_t frame_use_cnt;
     uint8_t * workb;                    //JPG work buffer for jpeg library
     JDEC * tjpeg_jd;
     io_source_t io;
@@ -111,12 +122,15 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
 static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
 static size_t input_func(JDEC * jd, uint8_t * buff, size_t ndata);
 static int is_jpg(const uint8_t * raw_data, size_t len);
+static bool frame_cache_alloc(SJPEG * sjpeg);
+static lv_color_t * frame_get(SJPEG * sjpeg, int index);
 static void lv_sjpg_cleanup(SJPEG * sjpeg);
 static void lv_sjpg_free(SJPEG * sjpeg);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static lv_split_jpeg_stats_t stats;
 
 /**********************
  *      MACROS
@@ -134,6 +148,16 @@ void lv_split_jpeg_init(void)
     lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
 }
 
+void lv_split_jpeg_get_stats(lv_split_jpeg_stats_t * stats_p)
+{
+    *stats_p = stats;
+}
+
+void lv_split_jpeg_reset_stats(void)
+{
+    lv_memset_00(&stats, sizeof(stats));
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -282,18 +306,29 @@ end:
 static int img_data_cb(JDEC * jd, void * data, JRECT * rect)
 {
     io_source_t * io = jd->device;
-    uint8_t * cache = io->img_cache_buff;
     const int xres = io->img_cache_x_res;
+
+#if JD_FORMAT == 1
+    /*With 16 bit colors tjpgd outputs RGB565 in the layout of lv_color_t*/
+    const lv_color_t * buf = data;
+    const int row_width = rect->right - rect->left + 1;
+    for(int y = rect->top; y <= rect->bottom; y++) {
+        lv_memcpy(io->img_cache_buff + y * xres + rect->left, buf, row_width * sizeof(lv_color_t));
+        buf += row_width;
+    }
+#else
     uint8_t * buf = data;
-    const int INPUT_PIXEL_SIZE = 3;
-    const int row_width = rect->right - rect->left + 1; // Row width in pixels.
-    const int row_size = row_width * INPUT_PIXEL_SIZE;  // Row size (bytes).
 
+    /*Convert the RGB888 output of the MCU to native colors once, so the lines can be simply copied*/
     for(int y = rect->top; y <= rect->bottom; y++) {
-        int row_offset = y * xres * INPUT_PIXEL_SIZE + rect->left * INPUT_PIXEL_SIZE;
-        memcpy(cache + row_offset, buf, row_size);
-        buf += row_size;
+        lv_color_t * cache = io->img_cache_buff + y * xres + rect->left;
+        for(int x = rect->left; x <= rect->right; x++) {
+            *cache = lv_color_make(buf[0], buf[1], buf[2]);
+            cache++;
+            buf += 3;
+        }
     }
+#endif
 
     return 1;
 }
@@ -394,14 +429,11 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
                 offset |= *data++ << 8;
                 sjpeg->frame_base_array[i] = sjpeg->frame_base_array[i - 1] + offset;
             }
-            sjpeg->sjpeg_cache_frame_index = -1;
-            sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3/*2*/);
-            if(! sjpeg->frame_cache) {
+            if(!frame_cache_alloc(sjpeg)) {
                 lv_sjpg_cleanup(sjpeg);
                 sjpeg = NULL;
                 return LV_RES_INV;
             }
-            sjpeg->io.img_cache_buff = sjpeg->frame_cache;
             sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
             sjpeg->workb =   lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
             if(! sjpeg->workb) {
@@ -456,15 +488,12 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
                 uint8_t * img_frame_base = sjpeg->sjpeg_data;
                 sjpeg->frame_base_array[0] = img_frame_base;
 
-                sjpeg->sjpeg_cache_frame_index = -1;
-                sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
-                if(! sjpeg->frame_cache) {
+                if(!frame_cache_alloc(sjpeg)) {
                     lv_sjpg_cleanup(sjpeg);
                     sjpeg = NULL;
                     return LV_RES_INV;
                 }
 
-                sjpeg->io.img_cache_buff = sjpeg->frame_cache;
                 sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
                 sjpeg->workb =   lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
                 if(! sjpeg->workb) {
@@ -573,14 +602,11 @@ end:
                     sjpeg->frame_base_offset[i] = sjpeg->frame_base_offset[i - 1] + offset;
                 }
 
-                sjpeg->sjpeg_cache_frame_index = -1; //INVALID AT BEGINNING for a forced compare mismatch at first time.
-                sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
-                if(! sjpeg->frame_cache) {
+                if(!frame_cache_alloc(sjpeg)) {
                     lv_fs_close(&lv_file);
                     lv_sjpg_cleanup(sjpeg);
                     return LV_RES_INV;
                 }
-                sjpeg->io.img_cache_buff = sjpeg->frame_cache;
                 sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
                 sjpeg->workb =   lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
                 if(! sjpeg->workb) {
@@ -660,15 +686,12 @@ end:
                 int img_frame_start_offset = 0;
                 sjpeg->frame_base_offset[0] = img_frame_start_offset;
 
-                sjpeg->sjpeg_cache_frame_index = -1;
-                sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
-                if(! sjpeg->frame_cache) {
+                if(!frame_cache_alloc(sjpeg)) {
                     lv_fs_close(&lv_file);
                     lv_sjpg_cleanup(sjpeg);
                     return LV_RES_INV;
                 }
 
-                sjpeg->io.img_cache_buff = sjpeg->frame_cache;
                 sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
                 sjpeg->workb =   lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
                 if(! sjpeg->workb) {
@@ -717,141 +740,17 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
                                   lv_coord_t len, uint8_t * buf)
 {
     LV_UNUSED(decoder);
-    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
-        SJPEG * sjpeg = (SJPEG *) dsc->user_data;
-        JRESULT rc;
-
-        int sjpeg_req_frame_index = y / sjpeg->sjpeg_single_frame_height;
-
-        /*If line not from cache, refresh cache */
-        if(sjpeg_req_frame_index != sjpeg->sjpeg_cache_frame_index) {
-            sjpeg->io.raw_sjpg_data = sjpeg->frame_base_array[ sjpeg_req_frame_index ];
-            if(sjpeg_req_frame_index == (sjpeg->sjpeg_total_frames - 1)) {
-                /*This is the last frame. */
-                const uint32_t frame_offset = (uint32_t)(sjpeg->io.raw_sjpg_data - sjpeg->sjpeg_data);
-                sjpeg->io.raw_sjpg_data_size = sjpeg->sjpeg_data_size - frame_offset;
-            }
-            else {
-                sjpeg->io.raw_sjpg_data_size =
-                    (uint32_t)(sjpeg->frame_base_array[sjpeg_req_frame_index + 1] - sjpeg->io.raw_sjpg_data);
-            }
-            sjpeg->io.raw_sjpg_data_next_read_pos = 0;
-            rc = jd_prepare(sjpeg->tjpeg_jd, input_func, sjpeg->workb, (size_t)TJPGD_WORKBUFF_SIZE, &(sjpeg->io));
-            if(rc != JDR_OK) return LV_RES_INV;
-            rc = jd_decomp(sjpeg->tjpeg_jd, img_data_cb, 0);
-            if(rc != JDR_OK) return LV_RES_INV;
-            sjpeg->sjpeg_cache_frame_index = sjpeg_req_frame_index;
-        }
-
-        int offset = 0;
-        uint8_t * cache = (uint8_t *)sjpeg->frame_cache + x * 3 + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res *
-                          3;
-
-#if  LV_COLOR_DEPTH == 32
-        for(int i = 0; i < len; i++) {
-            buf[offset + 3] = 0xff;
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 4;
-        }
-
-#elif  LV_COLOR_DEPTH == 16
-
-        for(int i = 0; i < len; i++) {
-            uint16_t col_16bit = (*cache++ & 0xf8) << 8;
-            col_16bit |= (*cache++ & 0xFC) << 3;
-            col_16bit |= (*cache++ >> 3);
-#if  LV_BIG_ENDIAN_SYSTEM == 1 || LV_COLOR_16_SWAP == 1
-            buf[offset++] = col_16bit >> 8;
-            buf[offset++] = col_16bit & 0xff;
-#else
-            buf[offset++] = col_16bit & 0xff;
-            buf[offset++] = col_16bit >> 8;
-#endif // LV_BIG_ENDIAN_SYSTEM
-        }
-
-#elif  LV_COLOR_DEPTH == 8
-
-        for(int i = 0; i < len; i++) {
-            uint8_t col_8bit = (*cache++ & 0xC0);
-            col_8bit |= (*cache++ & 0xe0) >> 2;
-            col_8bit |= (*cache++ & 0xe0) >> 5;
-            buf[offset++] = col_8bit;
-        }
-#else
-#error Unsupported LV_COLOR_DEPTH
-
-#endif // LV_COLOR_DEPTH
-        return LV_RES_OK;
-    }
-    else if(dsc->src_type == LV_IMG_SRC_FILE) {
-        SJPEG * sjpeg = (SJPEG *) dsc->user_data;
-        JRESULT rc;
-        int sjpeg_req_frame_index = y / sjpeg->sjpeg_single_frame_height;
-
-        lv_fs_file_t * lv_file_p = &(sjpeg->io.lv_file);
-        if(!lv_file_p) goto end;
-
-        /*If line not from cache, refresh cache */
-        if(sjpeg_req_frame_index != sjpeg->sjpeg_cache_frame_index) {
-            sjpeg->io.raw_sjpg_data_next_read_pos = (int)(sjpeg->frame_base_offset [ sjpeg_req_frame_index ]);
-            lv_fs_seek(&(sjpeg->io.lv_file), sjpeg->io.raw_sjpg_data_next_read_pos, LV_FS_SEEK_SET);
-
-            rc = jd_prepare(sjpeg->tjpeg_jd, input_func, sjpeg->workb, (size_t)TJPGD_WORKBUFF_SIZE, &(sjpeg->io));
-            if(rc != JDR_OK) return LV_RES_INV;
-
-            rc = jd_decomp(sjpeg->tjpeg_jd, img_data_cb, 0);
-            if(rc != JDR_OK) return LV_RES_INV;
-
-            sjpeg->sjpeg_cache_frame_index = sjpeg_req_frame_index;
-        }
-
-        int offset = 0;
-        uint8_t * cache = (uint8_t *)sjpeg->frame_cache + x * 3 + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res *
-                          3;
-
-#if LV_COLOR_DEPTH == 32
-        for(int i = 0; i < len; i++) {
-            buf[offset + 3] = 0xff;
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 4;
-        }
-#elif  LV_COLOR_DEPTH == 16
-
-        for(int i = 0; i < len; i++) {
-            uint16_t col_8bit = (*cache++ & 0xf8) << 8;
-            col_8bit |= (*cache++ & 0xFC) << 3;
-            col_8bit |= (*cache++ >> 3);
-#if  LV_BIG_ENDIAN_SYSTEM == 1 || LV_COLOR_16_SWAP == 1
-            buf[offset++] = col_8bit >> 8;
-            buf[offset++] = col_8bit & 0xff;
-#else
-            buf[offset++] = col_8bit & 0xff;
-            buf[offset++] = col_8bit >> 8;
-#endif // LV_BIG_ENDIAN_SYSTEM
-        }
-
-#elif  LV_COLOR_DEPTH == 8
+    SJPEG * sjpeg = (SJPEG *) dsc->user_data;
+    if(!sjpeg) return LV_RES_INV;
 
-        for(int i = 0; i < len; i++) {
-            uint8_t col_8bit = (*cache++ & 0xC0);
-            col_8bit |= (*cache++ & 0xe0) >> 2;
-            col_8bit |= (*cache++ & 0xe0) >> 5;
-            buf[offset++] = col_8bit;
-        }
+    /*Only the frames of the requested lines are decoded so only the frames in the clip area*/
+    lv_color_t * frame = frame_get(sjpeg, y / sjpeg->sjpeg_single_frame_height);
+    if(!frame) return LV_RES_INV;
 
-#else
-#error Unsupported LV_COLOR_DEPTH
+    lv_color_t * cache = frame + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res + x;
+    lv_memcpy(buf, cache, len * sizeof(lv_color_t));
 
-#endif // LV_COLOR_DEPTH
-
-        return LV_RES_OK;
-    }
-end:
-    return LV_RES_INV;
+    return LV_RES_OK;
 }
 
 /**
@@ -890,9 +789,99 @@ static int is_jpg(const uint8_t * raw_data, size_t len)
     return memcmp(jpg_signature, raw_data, sizeof(jpg_signature)) == 0;
 }
 
+/**
+ * Allocate the slots of the decoded frames. An image can't have more slots than frames.
+ * @param sjpeg pointer to an SJPEG whose resolution and frames are already known
+ * @return true: ok; false: out of memory
+ */
+static bool frame_cache_alloc(SJPEG * sjpeg)
+{
+    sjpeg->frame_cache_cnt = LV_CLAMP(1, LV_SJPG_CACHE_FRAME_CNT, sjpeg->sjpeg_total_frames);
+    sjpeg->frame_use_cnt = 0;
+    sjpeg->frame_cache = lv_mem_alloc(sizeof(sjpeg_frame_t) * sjpeg->frame_cache_cnt);
+    if(!sjpeg->frame_cache) return false;
+    lv_memset_00(sjpeg->frame_cache, sizeof(sjpeg_frame_t) * sjpeg->frame_cache_cnt);
+
+    const uint32_t frame_size = sizeof(lv_color_t) * sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height;
+    for(int i = 0; i < sjpeg->frame_cache_cnt; i++) {
+        sjpeg->frame_cache[i].index = -1;
+        sjpeg->frame_cache[i].buf = lv_mem_alloc(frame_size);
+        if(!sjpeg->frame_cache[i].buf) return false;
+    }
+
+    return true;
+}
+
+/**
+ * Get a decoded frame from the cache or decode it into the least recently used slot
+ * @param sjpeg pointer to an opened SJPEG
+ * @param index index of the frame
+ * @return pointer to the decoded frame or NULL on error
+ */
+static lv_color_t * frame_get(SJPEG * sjpeg, int index)
+{
+    if(index < 0 || index >= sjpeg->sjpeg_total_frames) return NULL;
+
+    sjpeg->frame_use_cnt++;
+
+    sjpeg_frame_t * slot = &sjpeg->frame_cache[0];
+    for(int i = 0; i < sjpeg->frame_cache_cnt; i++) {
+        sjpeg_frame_t * f = &sjpeg->frame_cache[i];
+        if(f->index == index) {
+            f->last_use = sjpeg->frame_use_cnt;
+            stats.hit_cnt++;
+            return f->buf;
+        }
+        if(f->last_use < slot->last_use) slot = f;
+    }
+
+    /*Not cached. Decode it into the least recently used (or an empty) slot*/
+    slot->index = -1;
+    if(sjpeg->io.type == SJPEG_IO_SOURCE_C_ARRAY) {
+        sjpeg->io.raw_sjpg_data = sjpeg->frame_base_array[index];
+        if(index == sjpeg->sjpeg_total_frames - 1) {
+            /*This is the last frame. */
+            const uint32_t frame_offset = (uint32_t)(sjpeg->io.raw_sjpg_data - sjpeg->sjpeg_data);
+            sjpeg->io.raw_sjpg_data_size = sjpeg->sjpeg_data_size - frame_offset;
+        }
+        else {
+            sjpeg->io.raw_sjpg_data_size = (uint32_t)(sjpeg->frame_base_array[index + 1] - sjpeg->io.raw_sjpg_data);
+        }
+        sjpeg->io.raw_sjpg_data_next_read_pos = 0;
+    }
+    else {
+        sjpeg->io.raw_sjpg_data_next_read_pos = sjpeg->frame_base_offset[index];
+        lv_fs_seek(&(sjpeg->io.lv_file), sjpeg->io.raw_sjpg_data_next_read_pos, LV_FS_SEEK_SET);
+    }
+
+    sjpeg->io.img_cache_buff = slot->buf;
+    uint32_t t_start = lv_tick_get();
+
+    JRESULT rc = jd_prepare(sjpeg->tjpeg_jd, input_func, sjpeg->workb, (size_t)TJPGD_WORKBUFF_SIZE, &(sjpeg->io));
+    if(rc != JDR_OK) return NULL;
+    rc = jd_decomp(sjpeg->tjpeg_jd, img_data_cb, 0);
+    if(rc != JDR_OK) return NULL;
+
+    uint32_t t = lv_tick_elaps(t_start);
+    stats.decode_cnt++;
+    stats.decode_time += t;
+    stats.last_decode_time = t;
+    if(t > stats.max_decode_time) stats.max_decode_time = t;
+    LV_LOG_TRACE("frame %d decoded in %d ms", index, (int)t);
+
+    slot->index = index;
+    slot->last_use = sjpeg->frame_use_cnt;
+    return slot->buf;
+}
+
 static void lv_sjpg_free(SJPEG * sjpeg)
 {
-    if(sjpeg->frame_cache) lv_mem_free(sjpeg->frame_cache);
+    if(sjpeg->frame_cache) {
+        for(int i = 0; i < sjpeg->frame_cache_cnt; i++) {
+            if(sjpeg->frame_cache[i].buf) lv_mem_free(sjpeg->frame_cache[i].buf);
+        }
+        lv_mem_free(sjpeg->frame_cache);
+    }
     if(sjpeg->frame_base_array) lv_mem_free(sjpeg->frame_base_array);
     if(sjpeg->frame_base_offset) lv_mem_free(sjpeg->frame_base_offset);
     if(sjpeg->tjpeg_jd) lv_mem_free(sjpeg->tjpeg_jd);
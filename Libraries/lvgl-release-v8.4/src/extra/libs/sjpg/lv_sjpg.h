@@ -24,12 +24,32 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/*Decoding statistics of all the SJPG/JPG images*/
+typedef struct {
+    uint32_t decode_cnt;            /*Number of decoded frames*/
+    uint32_t hit_cnt;               /*Number of lines read from an already decoded frame*/
+    uint32_t decode_time;           /*Sum of the decoding times [ms]*/
+    uint32_t last_decode_time;      /*Decoding time of the last frame [ms]*/
+    uint32_t max_decode_time;       /*Decoding time of the slowest frame [ms]*/
+} lv_split_jpeg_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
 void lv_split_jpeg_init(void);
 
+/**
+ * Get the decoding statistics of the SJPG/JPG images
+ * @param stats store the statistics here
+ */
+void lv_split_jpeg_get_stats(lv_split_jpeg_stats_t * stats);
+
+/**
+ * Clear the decoding statistics
+ */
+void lv_split_jpeg_reset_stats(void);
+
 /**********************
  *      MACROS
  **********************/
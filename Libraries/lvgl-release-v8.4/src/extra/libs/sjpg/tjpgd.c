@@ -22,6 +22,7 @@
 / Jun 11, 2021 R0.02a Some performance improvement.
 / Jul 01, 2021 R0.03  Added JD_FASTDECODE option.
 /                     Some performance improvement.
+/ LVGL: Skip the IDCT of the columns/rows without AC elements. Added JD_SWAP565 option.
 /----------------------------------------------------------------------------*/
 
 #include "tjpgd.h"
@@ -588,6 +589,15 @@ static void block_idct (
 
 	/* Process columns */
 	for (i = 0; i < 8; i++) {
+		if (!(src[8 * 1] | src[8 * 2] | src[8 * 3] | src[8 * 4] | src[8 * 5] | src[8 * 6] | src[8 * 7])) {
+			/* No AC element in the column (common after quantization), all the outputs are the DC value */
+			v0 = src[8 * 0];
+			src[8 * 1] = v0; src[8 * 2] = v0; src[8 * 3] = v0; src[8 * 4] = v0;
+			src[8 * 5] = v0; src[8 * 6] = v0; src[8 * 7] = v0;
+			src++;	/* Next column */
+			continue;
+		}
+
 		v0 = src[8 * 0];	/* Get even elements */
 		v1 = src[8 * 2];
 		v2 = src[8 * 4];
@@ -636,6 +646,19 @@ static void block_idct (
 	src -= 8;
 	for (i = 0; i < 8; i++) {
 		v0 = src[0] + (128L << 8);	/* Get even elements (remove DC offset (-128) here) */
+		if (!(src[1] | src[2] | src[3] | src[4] | src[5] | src[6] | src[7])) {
+			/* No AC element in the row, output the descaled DC value */
+#if JD_FASTDECODE >= 1
+			dst[0] = (int16_t)(v0 >> 8);
+#else
+			dst[0] = BYTECLIP(v0 >> 8);
+#endif
+			dst[1] = dst[0]; dst[2] = dst[0]; dst[3] = dst[0];
+			dst[4] = dst[0]; dst[5] = dst[0]; dst[6] = dst[0]; dst[7] = dst[0];
+			dst += 8; src += 8;	/* Next row */
+			continue;
+		}
+
 		v1 = src[2];
 		v2 = src[4];
 		v3 = src[6];
@@ -941,6 +964,9 @@ static JRESULT mcu_output (
 			w = (*s++ & 0xF8) << 8;		/* RRRRR----------- */
 			w |= (*s++ & 0xFC) << 3;	/* -----GGGGGG----- */
 			w |= *s++ >> 3;				/* -----------BBBBB */
+#if JD_SWAP565
+			w = (uint16_t)((w >> 8) | (w << 8));	/* GGGBBBBBRRRRRGGG */
+#endif
 			*d++ = w;
 		} while (--n);
 	}
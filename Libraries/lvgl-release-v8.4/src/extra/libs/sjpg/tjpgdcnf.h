@@ -5,11 +5,22 @@
 #define	JD_SZBUF		512
 /* Specifies size of stream input buffer */
 
+#if LV_COLOR_DEPTH == 16
+#define JD_FORMAT		1
+#else
 #define JD_FORMAT		0
+#endif
 /* Specifies output pixel format.
 /  0: RGB888 (24-bit/pix)
 /  1: RGB565 (16-bit/pix)
 /  2: Grayscale (8-bit/pix)
+/  RGB565 is used with 16 bit LVGL colors to output lv_color_t directly.
+*/
+
+#define JD_SWAP565		LV_COLOR_16_SWAP
+/* Swap the bytes of the RGB565 output (see LV_COLOR_16_SWAP).
+/  0: Disable
+/  1: Enable
 */
 
 #define	JD_USE_SCALE	1
@@ -24,7 +35,7 @@
 /  1: Enable
 */
 
-#define JD_FASTDECODE	0
+#define JD_FASTDECODE	LV_SJPG_FAST_DECODE
 /* Optimization level
 /  0: Basic optimization. Suitable for 8/16-bit MCUs.
 /  1: + 32-bit barrel shifter. Suitable for 32-bit MCUs.
@@ -38,6 +38,7 @@ const lv_obj_class_t lv_imgbtn_class = {
     .instance_size = sizeof(lv_imgbtn_t),
     .constructor_cb = lv_imgbtn_constructor,
     .event_cb = lv_imgbtn_event,
+    .no_draw_hooks = 1,
 };
 
 /**********************
@@ -39,6 +39,7 @@ const lv_obj_class_t lv_meter_class = {
     .constructor_cb = lv_meter_constructor,
     .destructor_cb = lv_meter_destructor,
     .event_cb = lv_meter_event,
+    .no_draw_hooks = 1,
     .instance_size = sizeof(lv_meter_t),
     .base_class = &lv_obj_class
 };
@@ -73,6 +73,7 @@ const lv_obj_class_t lv_spangroup_class  = {
     .constructor_cb = lv_spangroup_constructor,
     .destructor_cb = lv_spangroup_destructor,
     .event_cb = lv_spangroup_event,
+    .no_draw_hooks = 1,
     .instance_size = sizeof(lv_spangroup_t),
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
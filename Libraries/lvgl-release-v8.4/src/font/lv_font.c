@@ -49,7 +49,10 @@
 const uint8_t * lv_font_get_glyph_bitmap(const lv_font_t * font_p, uint32_t letter)
 {
     LV_ASSERT_NULL(font_p);
-    return font_p->get_glyph_bitmap(font_p, letter);
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_FONT);
+    const uint8_t * bitmap = font_p->get_glyph_bitmap(font_p, letter);
+    lv_mem_set_tag(tag_prev);
+    return bitmap;
 }
 
 /**
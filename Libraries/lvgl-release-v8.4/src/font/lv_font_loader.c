@@ -14,6 +14,13 @@
 #include "../misc/lv_fs.h"
 #include "lv_font_loader.h"
 
+/*********************
+ *      DEFINES
+ *********************/
+#define MAPPED_FONT_LABEL       "lvmf"
+#define MAPPED_FONT_VERSION     1
+#define MAPPED_ALIGN(x)         (((x) + 3) & ~(uint32_t)3)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -60,12 +67,88 @@ typedef struct cmap_table_bin {
     uint8_t padding;
 } cmap_table_bin_t;
 
+/*Sizes of the tables which are not stored in `lv_font_fmt_txt_dsc_t`*/
+typedef struct {
+    uint32_t glyph_cnt;
+    uint32_t bitmap_size;
+    uint32_t kern_class_mapping_length;
+} font_table_sizes_t;
+
+/*The header of a mapped font. All offsets are measured from the start of the header
+ *and all tables are 4 byte aligned.*/
+typedef struct mapped_font_header {
+    uint32_t length;
+    char label[4];
+    uint16_t version;
+    uint16_t glyph_dsc_size;
+    int16_t line_height;
+    int16_t base_line;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    uint8_t subpx;
+    uint8_t bpp;
+    uint8_t bitmap_format;
+    uint8_t kern_classes;
+    uint16_t kern_scale;
+    uint16_t cmap_num;
+    uint16_t padding;
+    uint32_t glyph_bitmap_ofs;
+    uint32_t glyph_dsc_ofs;
+    uint32_t cmaps_ofs;
+    uint32_t kern_ofs;
+    uint32_t glyph_cnt;
+    uint32_t glyph_bitmap_size;
+} mapped_font_header_t;
+
+typedef struct mapped_cmap {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint32_t unicode_list_ofs;
+    uint32_t glyph_id_ofs_list_ofs;
+    uint16_t list_length;
+    uint8_t type;
+    uint8_t padding;
+} mapped_cmap_t;
+
+/*Kerning pairs if `kern_classes == 0`, else the `left`, `right` and `values` of the classes*/
+typedef struct mapped_kern {
+    uint32_t ids_or_left_ofs;
+    uint32_t right_ofs;
+    uint32_t values_ofs;
+    uint32_t pair_cnt;
+    uint32_t class_mapping_length;
+    uint8_t glyph_ids_size;
+    uint8_t left_class_cnt;
+    uint8_t right_class_cnt;
+    uint8_t padding;
+} mapped_kern_t;
+
+/*The RAM part of a mapped font, followed by `cmap_num` cmaps.
+ *If loaded by `lv_font_load` the content of the file follows the cmaps.*/
+typedef struct {
+    lv_font_t font;
+    lv_font_fmt_txt_dsc_t dsc;
+    lv_font_fmt_txt_glyph_cache_t cache;
+    union {
+        lv_font_fmt_txt_kern_pair_t pair;
+        lv_font_fmt_txt_kern_classes_t classes;
+    } kern;
+} mapped_font_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
-int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, font_table_sizes_t * sizes);
+int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start,
+                  font_table_sizes_t * sizes);
+static lv_font_t * load_mapped_file(lv_fs_file_t * fp);
+static bool map_font(mapped_font_t * mfont, const uint8_t * data, uint32_t size);
+static bool check_mapped_cmap_ids(const mapped_font_header_t * header, const mapped_cmap_t * mcmap,
+                                  const uint8_t * data);
+static bool check_mapped_tables(const mapped_font_header_t * header, const uint8_t * data);
+static uint32_t write_mapped(const lv_font_t * font, const font_table_sizes_t * sizes, uint8_t * buf);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
 static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
@@ -90,10 +173,25 @@ lv_font_t * lv_font_load(const char * font_name)
     if(res != LV_FS_RES_OK)
         return NULL;
 
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_FONT);
+
+    /*Mapped fonts are read in one piece*/
+    char label[4];
+    if(lv_fs_seek(&file, 4, LV_FS_SEEK_SET) == LV_FS_RES_OK &&
+       lv_fs_read(&file, label, 4, NULL) == LV_FS_RES_OK &&
+       memcmp(label, MAPPED_FONT_LABEL, 4) == 0) {
+        lv_font_t * font = load_mapped_file(&file);
+        if(font == NULL) LV_LOG_WARN("Error loading font file: %s\n", font_name);
+        lv_mem_set_tag(tag_prev);
+        lv_fs_close(&file);
+        return font;
+    }
+
     lv_font_t * font = lv_mem_alloc(sizeof(lv_font_t));
     if(font) {
         memset(font, 0, sizeof(lv_font_t));
-        if(!lvgl_load_font(&file, font)) {
+        font_table_sizes_t sizes;
+        if(!lvgl_load_font(&file, font, &sizes)) {
             LV_LOG_WARN("Error loading font file: %s\n", font_name);
             /*
             * When `lvgl_load_font` fails it can leak some pointers.
@@ -104,6 +202,7 @@ lv_font_t * lv_font_load(const char * font_name)
             font = NULL;
         }
     }
+    lv_mem_set_tag(tag_prev);
 
     lv_fs_close(&file);
 
@@ -116,6 +215,12 @@ lv_font_t * lv_font_load(const char * font_name)
  */
 void lv_font_free(lv_font_t * font)
 {
+    /*Mapped fonts are allocated in one piece*/
+    if(NULL != font && font->mapped) {
+        lv_mem_free(font);
+        return;
+    }
+
     if(NULL != font) {
         lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
@@ -178,6 +283,79 @@ void lv_font_free(lv_font_t * font)
     }
 }
 
+/**
+ * Create a font which uses the tables of a mapped font in place.
+ * Only a small descriptor is allocated, the tables are not copied.
+ * @param data  pointer to a 4 byte aligned font created by `lv_font_convert_to_mapped()`,
+ *              e.g. a memory mapped flash partition. It must be valid while the font is used.
+ * @param size  size of the memory at `data` in bytes, the font is rejected if it doesn't fit
+ * @return a pointer to the font or NULL in case of error. Free it with `lv_font_free()`.
+ */
+lv_font_t * lv_font_load_mapped(const void * data, uint32_t size)
+{
+    const mapped_font_header_t * header = data;
+    if(((uintptr_t)data & 0x3) != 0) {
+        LV_LOG_WARN("The mapped font is not aligned to 4 bytes");
+        return NULL;
+    }
+    if(size < sizeof(mapped_font_header_t) || memcmp(header->label, MAPPED_FONT_LABEL, 4) != 0) {
+        LV_LOG_WARN("Not a mapped font");
+        return NULL;
+    }
+
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_FONT);
+    mapped_font_t * mfont = lv_mem_alloc(sizeof(mapped_font_t) + header->cmap_num * sizeof(lv_font_fmt_txt_cmap_t));
+    lv_mem_set_tag(tag_prev);
+    if(mfont == NULL) return NULL;
+
+    if(!map_font(mfont, data, size)) {
+        lv_mem_free(mfont);
+        return NULL;
+    }
+
+    return &mfont->font;
+}
+
+/**
+ * Convert a binary font file to the mapped format of `lv_font_load_mapped()`.
+ * The result can be stored in a file or flash partition. It depends on the byte order
+ * and on `LV_FONT_FMT_TXT_LARGE` so it should be created with the target's configuration.
+ * @param font_name filename where the font file is located
+ * @param buf       buffer for the mapped font or NULL to get the required size only
+ * @param buf_size  size of `buf` in bytes
+ * @return the size of the mapped font in bytes or 0 in case of error.
+ *         If it's larger than `buf_size` nothing is written.
+ */
+uint32_t lv_font_convert_to_mapped(const char * font_name, void * buf, uint32_t buf_size)
+{
+    lv_fs_file_t file;
+    lv_fs_res_t res = lv_fs_open(&file, font_name, LV_FS_MODE_RD);
+    if(res != LV_FS_RES_OK)
+        return 0;
+
+    lv_font_t * font = lv_mem_alloc(sizeof(lv_font_t));
+    if(font == NULL) {
+        lv_fs_close(&file);
+        return 0;
+    }
+
+    memset(font, 0, sizeof(lv_font_t));
+    font_table_sizes_t sizes;
+    uint32_t length = 0;
+    if(lvgl_load_font(&file, font, &sizes)) {
+        length = write_mapped(font, &sizes, NULL);
+        if(buf && length <= buf_size) write_mapped(font, &sizes, buf);
+    }
+    else {
+        LV_LOG_WARN("Error loading font file: %s\n", font_name);
+    }
+
+    lv_font_free(font);
+    lv_fs_close(&file);
+
+    return length;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -336,7 +514,8 @@ static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, u
 }
 
 static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
-                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header)
+                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header,
+                          font_table_sizes_t * sizes)
 {
     int32_t glyph_length = read_label(fp, start, "glyf");
     if(glyph_length < 0) {
@@ -417,6 +596,8 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
     uint8_t * glyph_bmp = (uint8_t *)lv_mem_alloc(sizeof(uint8_t) * cur_bmp_size);
 
     font_dsc->glyph_bitmap = glyph_bmp;
+    sizes->glyph_cnt = loca_count;
+    sizes->bitmap_size = cur_bmp_size;
 
     cur_bmp_size = 0;
 
@@ -479,9 +660,13 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
  *
  * `lv_font_free` will assume that all non-null pointers are allocated and
  * should be freed.
+ *
+ * The size of the tables is saved in `sizes` to convert the font to the mapped format.
  */
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, font_table_sizes_t * sizes)
 {
+    memset(sizes, 0, sizeof(font_table_sizes_t));
+
     lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
                                        lv_mem_alloc(sizeof(lv_font_fmt_txt_dsc_t));
 
@@ -562,7 +747,7 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     /*glyph*/
     uint32_t glyph_start = loca_start + loca_length;
     int32_t glyph_length = load_glyph(
-                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
+                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header, sizes);
 
     lv_mem_free(glyph_offset);
 
@@ -579,12 +764,13 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 
     uint32_t kern_start = glyph_start + glyph_length;
 
-    int32_t kern_length = load_kern(fp, font_dsc, font_header.glyph_id_format, kern_start);
+    int32_t kern_length = load_kern(fp, font_dsc, font_header.glyph_id_format, kern_start, sizes);
 
     return kern_length >= 0;
 }
 
-int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start)
+int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start,
+                  font_table_sizes_t * sizes)
 {
     int32_t kern_length = read_label(fp, start, "kern");
     if(kern_length < 0) {
@@ -655,6 +841,7 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         }
 
         int kern_values_length = sizeof(int8_t) * kern_table_rows * kern_table_cols;
+        sizes->kern_class_mapping_length = kern_class_mapping_length;
 
         uint8_t * kern_left = lv_mem_alloc(kern_class_mapping_length);
         uint8_t * kern_right = lv_mem_alloc(kern_class_mapping_length);
@@ -679,3 +866,348 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
 
     return kern_length;
 }
+
+/**
+ * Read a mapped font file into the same allocation as its descriptor
+ * @param fp    the opened font file
+ * @return      the font or NULL in case of error
+ */
+static lv_font_t * load_mapped_file(lv_fs_file_t * fp)
+{
+    mapped_font_header_t header;
+    if(lv_fs_seek(fp, 0, LV_FS_SEEK_SET) != LV_FS_RES_OK ||
+       lv_fs_read(fp, &header, sizeof(header), NULL) != LV_FS_RES_OK ||
+       header.length < sizeof(header)) {
+        return NULL;
+    }
+
+    uint32_t data_ofs = MAPPED_ALIGN(sizeof(mapped_font_t) + header.cmap_num * sizeof(lv_font_fmt_txt_cmap_t));
+    mapped_font_t * mfont = lv_mem_alloc(data_ofs + header.length);
+    if(mfont == NULL) return NULL;
+
+    uint8_t * data = (uint8_t *)mfont + data_ofs;
+    uint32_t rn;
+    if(lv_fs_seek(fp, 0, LV_FS_SEEK_SET) != LV_FS_RES_OK ||
+       lv_fs_read(fp, data, header.length, &rn) != LV_FS_RES_OK || rn != header.length ||
+       !map_font(mfont, data, header.length)) {
+        lv_mem_free(mfont);
+        return NULL;
+    }
+
+    return &mfont->font;
+}
+
+/**
+ * Initialize the descriptors of a mapped font to point to its tables
+ * @param mfont     the descriptors to initialize followed by space for the cmaps
+ * @param data      the mapped font
+ * @param size      size of the memory at `data` in bytes
+ * @return          true: the font is valid; false: it's not a mapped font, it's incompatible or corrupted
+ */
+static bool map_font(mapped_font_t * mfont, const uint8_t * data, uint32_t size)
+{
+    const mapped_font_header_t * header = (const mapped_font_header_t *)data;
+    if(memcmp(header->label, MAPPED_FONT_LABEL, 4) != 0 || header->version != MAPPED_FONT_VERSION) {
+        LV_LOG_WARN("Unknown mapped font version");
+        return false;
+    }
+
+    if(header->glyph_dsc_size != sizeof(lv_font_fmt_txt_glyph_dsc_t)) {
+        LV_LOG_WARN("The mapped font was created with different LV_FONT_FMT_TXT_LARGE");
+        return false;
+    }
+
+    if(header->length < sizeof(mapped_font_header_t) || header->length > size || !check_mapped_tables(header, data)) {
+        LV_LOG_WARN("The mapped font is corrupted");
+        return false;
+    }
+
+    lv_memset_00(mfont, sizeof(mapped_font_t));
+
+    lv_font_t * font = &mfont->font;
+    font->get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    font->get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+    font->line_height = header->line_height;
+    font->base_line = header->base_line;
+    font->subpx = header->subpx;
+    font->underline_position = header->underline_position;
+    font->underline_thickness = header->underline_thickness;
+    font->dsc = &mfont->dsc;
+    font->mapped = 1;
+
+    lv_font_fmt_txt_dsc_t * dsc = &mfont->dsc;
+    dsc->glyph_bitmap = data + header->glyph_bitmap_ofs;
+    dsc->glyph_dsc = (const lv_font_fmt_txt_glyph_dsc_t *)(data + header->glyph_dsc_ofs);
+    dsc->kern_scale = header->kern_scale;
+    dsc->cmap_num = header->cmap_num;
+    dsc->bpp = header->bpp;
+    dsc->kern_classes = header->kern_classes;
+    dsc->bitmap_format = header->bitmap_format;
+    dsc->cache = &mfont->cache;
+
+    lv_font_fmt_txt_cmap_t * cmaps = (lv_font_fmt_txt_cmap_t *)(mfont + 1);
+    const mapped_cmap_t * mcmaps = (const mapped_cmap_t *)(data + header->cmaps_ofs);
+    for(uint32_t i = 0; i < header->cmap_num; i++) {
+        cmaps[i].range_start = mcmaps[i].range_start;
+        cmaps[i].range_length = mcmaps[i].range_length;
+        cmaps[i].glyph_id_start = mcmaps[i].glyph_id_start;
+        cmaps[i].unicode_list = mcmaps[i].unicode_list_ofs ?
+                                (const uint16_t *)(data + mcmaps[i].unicode_list_ofs) : NULL;
+        cmaps[i].glyph_id_ofs_list = mcmaps[i].glyph_id_ofs_list_ofs ? data + mcmaps[i].glyph_id_ofs_list_ofs : NULL;
+        cmaps[i].list_length = mcmaps[i].list_length;
+        cmaps[i].type = mcmaps[i].type;
+    }
+    dsc->cmaps = cmaps;
+
+    if(header->kern_ofs) {
+        const mapped_kern_t * mkern = (const mapped_kern_t *)(data + header->kern_ofs);
+        if(header->kern_classes) {
+            lv_font_fmt_txt_kern_classes_t * kern = &mfont->kern.classes;
+            kern->left_class_mapping = data + mkern->ids_or_left_ofs;
+            kern->right_class_mapping = data + mkern->right_ofs;
+            kern->class_pair_values = (const int8_t *)(data + mkern->values_ofs);
+            kern->left_class_cnt = mkern->left_class_cnt;
+            kern->right_class_cnt = mkern->right_class_cnt;
+            dsc->kern_dsc = kern;
+        }
+        else {
+            lv_font_fmt_txt_kern_pair_t * kern = &mfont->kern.pair;
+            kern->glyph_ids = data + mkern->ids_or_left_ofs;
+            kern->values = (const int8_t *)(data + mkern->values_ofs);
+            kern->pair_cnt = mkern->pair_cnt;
+            kern->glyph_ids_size = mkern->glyph_ids_size;
+            dsc->kern_dsc = kern;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Check if a table is aligned and lies within a mapped font
+ * @param header    header of the mapped font, its length is already checked
+ * @param ofs       offset of the table
+ * @param size      size of the table in bytes
+ * @return          true: the table is valid
+ */
+static bool check_mapped_table(const mapped_font_header_t * header, uint32_t ofs, uint64_t size)
+{
+    return ofs >= sizeof(mapped_font_header_t) && (ofs & 0x3) == 0 && ofs <= header->length &&
+           size <= header->length - ofs;
+}
+
+/**
+ * Check if a cmap of a mapped font maps the letters to existing glyphs only
+ * @param header    header of the mapped font, its length is already checked
+ * @param mcmap     the cmap, its lists are already checked
+ * @param data      the mapped font
+ * @return          true: all glyph IDs of the cmap are valid
+ */
+static bool check_mapped_cmap_ids(const mapped_font_header_t * header, const mapped_cmap_t * mcmap,
+                                  const uint8_t * data)
+{
+    uint32_t i;
+    switch(mcmap->type) {
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+            return (uint32_t)mcmap->glyph_id_start + mcmap->range_length <= header->glyph_cnt;
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL: {
+                /*The offsets are indexed by the relative code point*/
+                if(mcmap->glyph_id_ofs_list_ofs == 0 || mcmap->list_length < mcmap->range_length) return false;
+                const uint8_t * ofs_list = data + mcmap->glyph_id_ofs_list_ofs;
+                for(i = 0; i < mcmap->range_length; i++) {
+                    if((uint32_t)mcmap->glyph_id_start + ofs_list[i] >= header->glyph_cnt) return false;
+                }
+                return true;
+            }
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+            if(mcmap->unicode_list_ofs == 0) return false;
+            return (uint32_t)mcmap->glyph_id_start + mcmap->list_length <= header->glyph_cnt;
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL: {
+                if(mcmap->unicode_list_ofs == 0 || mcmap->glyph_id_ofs_list_ofs == 0) return false;
+                const uint16_t * ofs_list = (const uint16_t *)(data + mcmap->glyph_id_ofs_list_ofs);
+                for(i = 0; i < mcmap->list_length; i++) {
+                    if((uint32_t)mcmap->glyph_id_start + ofs_list[i] >= header->glyph_cnt) return false;
+                }
+                return true;
+            }
+        default:
+            /*Unknown cmaps don't map any letter*/
+            return true;
+    }
+}
+
+/**
+ * Check the tables of a mapped font, so a corrupted font can't make the descriptors point out of it
+ * @param header    header of the mapped font, its length is already checked
+ * @param data      the mapped font
+ * @return          true: all tables lie within the font and the glyphs and the cmaps point into their tables
+ */
+static bool check_mapped_tables(const mapped_font_header_t * header, const uint8_t * data)
+{
+    /*`lv_font_fmt_txt_dsc_t` stores the number of cmaps on 9 bits*/
+    if(header->cmap_num >= (1 << 9) ||
+       !check_mapped_table(header, header->cmaps_ofs, (uint64_t)header->cmap_num * sizeof(mapped_cmap_t)) ||
+       !check_mapped_table(header, header->glyph_dsc_ofs,
+                           (uint64_t)header->glyph_cnt * sizeof(lv_font_fmt_txt_glyph_dsc_t)) ||
+       !check_mapped_table(header, header->glyph_bitmap_ofs, header->glyph_bitmap_size)) {
+        return false;
+    }
+
+    /*The bitmaps of the glyphs*/
+    const lv_font_fmt_txt_glyph_dsc_t * glyph_dsc = (const lv_font_fmt_txt_glyph_dsc_t *)(data + header->glyph_dsc_ofs);
+    for(uint32_t i = 0; i < header->glyph_cnt; i++) {
+        const lv_font_fmt_txt_glyph_dsc_t * gdsc = &glyph_dsc[i];
+        uint64_t px_cnt = (uint64_t)gdsc->box_w * gdsc->box_h;
+        if(gdsc->bitmap_index > header->glyph_bitmap_size) return false;
+        if(px_cnt == 0) continue;
+
+        /*The size of a compressed bitmap is known only after decompressing it*/
+        uint64_t bitmap_size = header->bitmap_format == LV_FONT_FMT_TXT_PLAIN ? (px_cnt * header->bpp + 7) / 8 : 1;
+        if(bitmap_size > header->glyph_bitmap_size - gdsc->bitmap_index) return false;
+    }
+
+    const mapped_cmap_t * mcmaps = (const mapped_cmap_t *)(data + header->cmaps_ofs);
+    for(uint32_t i = 0; i < header->cmap_num; i++) {
+        const mapped_cmap_t * mcmap = &mcmaps[i];
+        uint32_t id_size = mcmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL ? sizeof(uint8_t) : sizeof(uint16_t);
+        if((mcmap->unicode_list_ofs &&
+            !check_mapped_table(header, mcmap->unicode_list_ofs, mcmap->list_length * sizeof(uint16_t))) ||
+           (mcmap->glyph_id_ofs_list_ofs &&
+            !check_mapped_table(header, mcmap->glyph_id_ofs_list_ofs, mcmap->list_length * id_size))) {
+            return false;
+        }
+
+        if(!check_mapped_cmap_ids(header, mcmap, data)) return false;
+    }
+
+    if(header->kern_ofs) {
+        if(!check_mapped_table(header, header->kern_ofs, sizeof(mapped_kern_t))) return false;
+
+        const mapped_kern_t * mkern = (const mapped_kern_t *)(data + header->kern_ofs);
+        if(header->kern_classes) {
+            return check_mapped_table(header, mkern->ids_or_left_ofs, mkern->class_mapping_length) &&
+                   check_mapped_table(header, mkern->right_ofs, mkern->class_mapping_length) &&
+                   check_mapped_table(header, mkern->values_ofs, mkern->left_class_cnt * mkern->right_class_cnt);
+        }
+        else {
+            uint32_t id_size = mkern->glyph_ids_size == 0 ? sizeof(uint8_t) : sizeof(uint16_t);
+            return check_mapped_table(header, mkern->ids_or_left_ofs, (uint64_t)2 * id_size * mkern->pair_cnt) &&
+                   check_mapped_table(header, mkern->values_ofs, mkern->pair_cnt);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Append a table to a mapped font
+ * @param buf       the mapped font or NULL to calculate the offsets only
+ * @param ofs       the current size of the mapped font, it will be increased by `size`
+ * @param src       the content of the table
+ * @param size      size of the table in bytes
+ * @return          offset of the table in the mapped font
+ */
+static uint32_t put_table(uint8_t * buf, uint32_t * ofs, const void * src, uint32_t size)
+{
+    uint32_t table_ofs = MAPPED_ALIGN(*ofs);
+    if(buf) {
+        lv_memset_00(buf + *ofs, table_ofs - *ofs);
+        lv_memcpy(buf + table_ofs, src, size);
+    }
+    *ofs = table_ofs + size;
+    return table_ofs;
+}
+
+/**
+ * Save a loaded font in the mapped format
+ * @param font      a font loaded by `lvgl_load_font()`
+ * @param sizes     the size of the tables which were loaded
+ * @param buf       buffer for the mapped font or NULL to calculate its size only
+ * @return          size of the mapped font in bytes
+ */
+static uint32_t write_mapped(const lv_font_t * font, const font_table_sizes_t * sizes, uint8_t * buf)
+{
+    const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
+
+    mapped_font_header_t header;
+    lv_memset_00(&header, sizeof(header));
+    lv_memcpy(header.label, MAPPED_FONT_LABEL, 4);
+    header.version = MAPPED_FONT_VERSION;
+    header.glyph_dsc_size = sizeof(lv_font_fmt_txt_glyph_dsc_t);
+    header.line_height = font->line_height;
+    header.base_line = font->base_line;
+    header.underline_position = font->underline_position;
+    header.underline_thickness = font->underline_thickness;
+    header.subpx = font->subpx;
+    header.bpp = dsc->bpp;
+    header.bitmap_format = dsc->bitmap_format;
+    header.kern_classes = dsc->kern_classes;
+    header.kern_scale = dsc->kern_scale;
+    header.cmap_num = dsc->cmap_num;
+
+    /*The header, the cmaps and the kerning are written at the end when all offsets are known*/
+    uint32_t ofs = sizeof(header);
+    header.cmaps_ofs = MAPPED_ALIGN(ofs);
+    ofs = header.cmaps_ofs + dsc->cmap_num * sizeof(mapped_cmap_t);
+    if(dsc->kern_dsc) {
+        header.kern_ofs = MAPPED_ALIGN(ofs);
+        ofs = header.kern_ofs + sizeof(mapped_kern_t);
+    }
+
+    header.glyph_dsc_ofs = put_table(buf, &ofs, dsc->glyph_dsc, sizes->glyph_cnt * sizeof(lv_font_fmt_txt_glyph_dsc_t));
+
+    for(uint32_t i = 0; i < dsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &dsc->cmaps[i];
+        mapped_cmap_t mcmap;
+        lv_memset_00(&mcmap, sizeof(mcmap));
+        mcmap.range_start = cmap->range_start;
+        mcmap.range_length = cmap->range_length;
+        mcmap.glyph_id_start = cmap->glyph_id_start;
+        mcmap.list_length = cmap->list_length;
+        mcmap.type = cmap->type;
+        if(cmap->unicode_list) {
+            mcmap.unicode_list_ofs = put_table(buf, &ofs, cmap->unicode_list, cmap->list_length * sizeof(uint16_t));
+        }
+        if(cmap->glyph_id_ofs_list) {
+            uint32_t id_size = cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL ? sizeof(uint8_t) : sizeof(uint16_t);
+            mcmap.glyph_id_ofs_list_ofs = put_table(buf, &ofs, cmap->glyph_id_ofs_list, cmap->list_length * id_size);
+        }
+        if(buf) lv_memcpy(buf + header.cmaps_ofs + i * sizeof(mapped_cmap_t), &mcmap, sizeof(mcmap));
+    }
+
+    if(dsc->kern_dsc) {
+        mapped_kern_t mkern;
+        lv_memset_00(&mkern, sizeof(mkern));
+        if(dsc->kern_classes) {
+            const lv_font_fmt_txt_kern_classes_t * kern = dsc->kern_dsc;
+            uint32_t map_len = sizes->kern_class_mapping_length;
+            mkern.ids_or_left_ofs = put_table(buf, &ofs, kern->left_class_mapping, map_len);
+            mkern.right_ofs = put_table(buf, &ofs, kern->right_class_mapping, map_len);
+            mkern.values_ofs = put_table(buf, &ofs, kern->class_pair_values, kern->left_class_cnt * kern->right_class_cnt);
+            mkern.left_class_cnt = kern->left_class_cnt;
+            mkern.right_class_cnt = kern->right_class_cnt;
+            mkern.class_mapping_length = map_len;
+        }
+        else {
+            const lv_font_fmt_txt_kern_pair_t * kern = dsc->kern_dsc;
+            uint32_t id_size = kern->glyph_ids_size == 0 ? sizeof(uint8_t) : sizeof(uint16_t);
+            mkern.ids_or_left_ofs = put_table(buf, &ofs, kern->glyph_ids, 2 * id_size * kern->pair_cnt);
+            mkern.values_ofs = put_table(buf, &ofs, kern->values, kern->pair_cnt);
+            mkern.pair_cnt = kern->pair_cnt;
+            mkern.glyph_ids_size = kern->glyph_ids_size;
+        }
+        if(buf) lv_memcpy(buf + header.kern_ofs, &mkern, sizeof(mkern));
+    }
+
+    header.glyph_cnt = sizes->glyph_cnt;
+    header.glyph_bitmap_size = sizes->bitmap_size;
+    header.glyph_bitmap_ofs = put_table(buf, &ofs, dsc->glyph_bitmap, sizes->bitmap_size);
+    header.length = MAPPED_ALIGN(ofs);
+    if(buf) {
+        lv_memset_00(buf + ofs, header.length - ofs);
+        lv_memcpy(buf, &header, sizeof(header));
+        lv_memset_00(buf + sizeof(header), header.cmaps_ofs - sizeof(header));
+    }
+
+    return header.length;
+}
@@ -27,6 +27,8 @@ extern "C" {
  **********************/
 
 lv_font_t * lv_font_load(const char * fontName);
+lv_font_t * lv_font_load_mapped(const void * data, uint32_t size);
+uint32_t lv_font_convert_to_mapped(const char * font_name, void * buf, uint32_t buf_size);
 void lv_font_free(lv_font_t * font);
 
 /**********************
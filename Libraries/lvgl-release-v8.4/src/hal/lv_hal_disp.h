@@ -176,6 +176,11 @@ typedef struct _lv_disp_t {
     uint8_t draw_prev_over_act : 1; /**< 1: Draw previous screen over active screen*/
     uint8_t del_prev : 1;           /**< 1: Automatically delete the previous screen when the screen load anim. is ready*/
     uint8_t rendering_in_progress : 1; /**< 1: The current screen rendering is in progress*/
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+    uint8_t scr_load_snapshot : 1;  /**< 1: Draw snapshots of the screens during the screen load animation*/
+    lv_img_dsc_t * scr_snapshot_act;    /**< Snapshot of `act_scr` during a screen load animation or NULL*/
+    lv_img_dsc_t * scr_snapshot_prev;   /**< Snapshot of `prev_scr` during a screen load animation or NULL*/
+#endif
 
     lv_opa_t bg_opa;                /**<Opacity of the background color or wallpaper*/
     lv_color_t bg_color;            /**< Default display color when screens are transparent*/
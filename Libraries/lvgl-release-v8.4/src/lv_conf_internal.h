@@ -198,6 +198,38 @@
     #endif
 #endif
 
+/*Size of an arena in bytes for the scratch memory of a display refresh (e.g. `lv_mem_buf_get()`, layer buffers).
+ *The arena is reset at the end of each refresh, allocations which don't fit are served by `lv_mem_alloc()`.
+ *0: disable the arena*/
+#ifndef LV_MEM_FRAME_ARENA_SIZE
+    #ifdef CONFIG_LV_MEM_FRAME_ARENA_SIZE
+        #define LV_MEM_FRAME_ARENA_SIZE CONFIG_LV_MEM_FRAME_ARENA_SIZE
+    #else
+        #define LV_MEM_FRAME_ARENA_SIZE 0     /*[bytes]*/
+    #endif
+#endif
+
+/*Size of a region in bytes for the pools of small fixed size blocks (list nodes, objects, event descriptors).
+ *Blocks are served from size classes up to 256 bytes in O(1), allocations which don't fit use the heap.
+ *0: disable the pools. Not used with `LV_ENABLE_GC`*/
+#ifndef LV_MEM_SLAB_SIZE
+    #ifdef CONFIG_LV_MEM_SLAB_SIZE
+        #define LV_MEM_SLAB_SIZE CONFIG_LV_MEM_SLAB_SIZE
+    #else
+        #define LV_MEM_SLAB_SIZE 0     /*[bytes]*/
+    #endif
+#endif
+
+/*1: Count the allocations per subsystem (objects, styles, images, fonts, drawing) and their sizes.
+ *See `lv_mem_tag_monitor()` and `lv_mem_telemetry_to_json()`. Adds a small header to each allocation.*/
+#ifndef LV_USE_MEM_TELEMETRY
+    #ifdef CONFIG_LV_USE_MEM_TELEMETRY
+        #define LV_USE_MEM_TELEMETRY CONFIG_LV_USE_MEM_TELEMETRY
+    #else
+        #define LV_USE_MEM_TELEMETRY 0
+    #endif
+#endif
+
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #ifndef LV_MEMCPY_MEMSET_STD
     #ifdef CONFIG_LV_MEMCPY_MEMSET_STD
@@ -412,6 +444,18 @@
     #endif
 #endif
 
+/*Max. number of opaque objects to collect in each refreshed area. The parts of the objects
+ *which are covered by an opaque object drawn later are not drawn (occlusion culling).
+ *The DRAW_MAIN/POST events are not sent to the fully covered objects.
+ *0: disable occlusion culling*/
+#ifndef LV_REFR_OCCLUDER_CNT
+    #ifdef CONFIG_LV_REFR_OCCLUDER_CNT
+        #define LV_REFR_OCCLUDER_CNT CONFIG_LV_REFR_OCCLUDER_CNT
+    #else
+        #define LV_REFR_OCCLUDER_CNT 0
+    #endif
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -805,6 +849,61 @@
     #endif
 #endif
 
+/*1: Count the dispatched and the skipped events per event code. See `lv_event_get_dispatch_cnt()`*/
+#ifndef LV_USE_EVENT_STATS
+    #ifdef CONFIG_LV_USE_EVENT_STATS
+        #define LV_USE_EVENT_STATS CONFIG_LV_USE_EVENT_STATS
+    #else
+        #define LV_USE_EVENT_STATS 0
+    #endif
+#endif
+
+/*1: Measure the time, the blended pixels and the calls of each object and draw primitive while rendering.
+ *See `lv_refr_prof_get_obj_stats()` and `lv_refr_prof_to_chrome_trace()`*/
+#ifndef LV_USE_REFR_PROFILER
+    #ifdef CONFIG_LV_USE_REFR_PROFILER
+        #define LV_USE_REFR_PROFILER CONFIG_LV_USE_REFR_PROFILER
+    #else
+        #define LV_USE_REFR_PROFILER 0
+    #endif
+#endif
+#if LV_USE_REFR_PROFILER
+    /*Header and expression to get the current time in [us]. The default has only 1 ms resolution.*/
+    #ifndef LV_REFR_PROFILER_TIME_INCLUDE
+        #ifdef CONFIG_LV_REFR_PROFILER_TIME_INCLUDE
+            #define LV_REFR_PROFILER_TIME_INCLUDE CONFIG_LV_REFR_PROFILER_TIME_INCLUDE
+        #else
+            #define LV_REFR_PROFILER_TIME_INCLUDE <stdint.h>
+        #endif
+    #endif
+    #ifndef LV_REFR_PROFILER_TIME_GET
+        #ifdef CONFIG_LV_REFR_PROFILER_TIME_GET
+            #define LV_REFR_PROFILER_TIME_GET CONFIG_LV_REFR_PROFILER_TIME_GET
+        #else
+            #define LV_REFR_PROFILER_TIME_GET (lv_tick_get() * 1000)
+        #endif
+    #endif
+    /*E.g. with ESP-IDF*/
+    // #define LV_REFR_PROFILER_TIME_INCLUDE "esp_timer.h"
+    // #define LV_REFR_PROFILER_TIME_GET esp_timer_get_time()
+    /*Number of the last events to keep in a ring buffer (~20 bytes each)*/
+    #ifndef LV_REFR_PROFILER_EVENT_CNT
+        #ifdef CONFIG_LV_REFR_PROFILER_EVENT_CNT
+            #define LV_REFR_PROFILER_EVENT_CNT CONFIG_LV_REFR_PROFILER_EVENT_CNT
+        #else
+            #define LV_REFR_PROFILER_EVENT_CNT 256
+        #endif
+    #endif
+    /*Number of the most expensive objects to track*/
+    #ifndef LV_REFR_PROFILER_OBJ_CNT
+        #ifdef CONFIG_LV_REFR_PROFILER_OBJ_CNT
+            #define LV_REFR_PROFILER_OBJ_CNT CONFIG_LV_REFR_PROFILER_OBJ_CNT
+        #else
+            #define LV_REFR_PROFILER_OBJ_CNT 16
+        #endif
+    #endif
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #ifndef LV_SPRINTF_CUSTOM
     #ifdef CONFIG_LV_SPRINTF_CUSTOM
@@ -1506,6 +1605,17 @@
             #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
         #endif
     #endif
+    #ifndef LV_LABEL_LAYOUT_CACHE
+        #ifdef _LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_LABEL_LAYOUT_CACHE
+                #define LV_LABEL_LAYOUT_CACHE CONFIG_LV_LABEL_LAYOUT_CACHE
+            #else
+                #define LV_LABEL_LAYOUT_CACHE 0
+            #endif
+        #else
+            #define LV_LABEL_LAYOUT_CACHE 1   /*Keep the line breaks of the text to reuse them in drawing and position queries*/
+        #endif
+    #endif
 #endif
 
 #ifndef LV_USE_LINE
@@ -1987,6 +2097,32 @@
 
 /*File system interfaces for common APIs */
 
+/*>0: Cache this number of bytes of the files in blocks shared by the drivers with `block_cache = 1`
+ *Blocks read in sequence are read ahead. See `lv_fs_get_stats()`*/
+#ifndef LV_FS_BLOCK_CACHE_SIZE
+    #ifdef CONFIG_LV_FS_BLOCK_CACHE_SIZE
+        #define LV_FS_BLOCK_CACHE_SIZE CONFIG_LV_FS_BLOCK_CACHE_SIZE
+    #else
+        #define LV_FS_BLOCK_CACHE_SIZE 0
+    #endif
+#endif
+#if LV_FS_BLOCK_CACHE_SIZE
+    #ifndef LV_FS_BLOCK_CACHE_BLOCK_SIZE
+        #ifdef CONFIG_LV_FS_BLOCK_CACHE_BLOCK_SIZE
+            #define LV_FS_BLOCK_CACHE_BLOCK_SIZE CONFIG_LV_FS_BLOCK_CACHE_BLOCK_SIZE
+        #else
+            #define LV_FS_BLOCK_CACHE_BLOCK_SIZE 512  /*Size of a cached block in bytes*/
+        #endif
+    #endif
+    #ifndef LV_FS_BLOCK_CACHE_READ_AHEAD
+        #ifdef CONFIG_LV_FS_BLOCK_CACHE_READ_AHEAD
+            #define LV_FS_BLOCK_CACHE_READ_AHEAD CONFIG_LV_FS_BLOCK_CACHE_READ_AHEAD
+        #else
+            #define LV_FS_BLOCK_CACHE_READ_AHEAD 4    /*Number of blocks to read at once if the file is read sequentially*/
+        #endif
+    #endif
+#endif
+
 /*API for fopen, fread, etc*/
 #ifndef LV_USE_FS_STDIO
     #ifdef CONFIG_LV_USE_FS_STDIO
@@ -2049,6 +2185,13 @@
             #define LV_FS_POSIX_CACHE_SIZE 0    /*>0 to cache this number of bytes in lv_fs_read()*/
         #endif
     #endif
+    #ifndef LV_FS_POSIX_BLOCK_CACHE
+        #ifdef CONFIG_LV_FS_POSIX_BLOCK_CACHE
+            #define LV_FS_POSIX_BLOCK_CACHE CONFIG_LV_FS_POSIX_BLOCK_CACHE
+        #else
+            #define LV_FS_POSIX_BLOCK_CACHE 0   /*1: Use the shared block cache (LV_FS_BLOCK_CACHE_SIZE) instead of LV_FS_POSIX_CACHE_SIZE*/
+        #endif
+    #endif
 #endif
 
 /*API for CreateFile, ReadFile, etc*/
@@ -2141,6 +2284,34 @@
         #define LV_USE_PNG 0
     #endif
 #endif
+#if LV_USE_PNG
+    /*1: Decode the images line by line instead of at once. Needs the zlib window (max. 32 kB) and a few rows
+     *instead of the whole image. Interlaced PNGs are still decoded at once. The images can't be zoomed or rotated.*/
+    #ifndef LV_PNG_USE_STREAM
+        #ifdef CONFIG_LV_PNG_USE_STREAM
+            #define LV_PNG_USE_STREAM CONFIG_LV_PNG_USE_STREAM
+        #else
+            #define LV_PNG_USE_STREAM 0
+        #endif
+    #endif
+    #if LV_PNG_USE_STREAM
+        /*>0: Keep this many bands of decoded rows per image to draw the image again without decoding it*/
+        #ifndef LV_PNG_STREAM_BAND_CNT
+            #ifdef CONFIG_LV_PNG_STREAM_BAND_CNT
+                #define LV_PNG_STREAM_BAND_CNT CONFIG_LV_PNG_STREAM_BAND_CNT
+            #else
+                #define LV_PNG_STREAM_BAND_CNT 0
+            #endif
+        #endif
+        #ifndef LV_PNG_STREAM_BAND_HEIGHT
+            #ifdef CONFIG_LV_PNG_STREAM_BAND_HEIGHT
+                #define LV_PNG_STREAM_BAND_HEIGHT CONFIG_LV_PNG_STREAM_BAND_HEIGHT
+            #else
+                #define LV_PNG_STREAM_BAND_HEIGHT 16  /*Number of rows in a band*/
+            #endif
+        #endif
+    #endif
+#endif
 
 /*BMP decoder library*/
 #ifndef LV_USE_BMP
@@ -2160,6 +2331,33 @@
         #define LV_USE_SJPG 0
     #endif
 #endif
+#if LV_USE_SJPG
+    /*Number of decoded frames (bands of the split JPG) kept per image in native color format.
+     *Frames are reused in LRU order while the image is opened, e.g. in the image cache.*/
+    #ifndef LV_SJPG_CACHE_FRAME_CNT
+        #ifdef _LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_SJPG_CACHE_FRAME_CNT
+                #define LV_SJPG_CACHE_FRAME_CNT CONFIG_LV_SJPG_CACHE_FRAME_CNT
+            #else
+                #define LV_SJPG_CACHE_FRAME_CNT 0
+            #endif
+        #else
+            #define LV_SJPG_CACHE_FRAME_CNT 1
+        #endif
+    #endif
+
+    /*Optimization level of the decoder
+     *0: Basic optimization. Suitable for 8/16-bit MCUs.
+     *1: + 32-bit barrel shifter. Suitable for 32-bit MCUs.
+     *2: + Table based huffman decoding. Needs 6 kB more RAM while an image is opened*/
+    #ifndef LV_SJPG_FAST_DECODE
+        #ifdef CONFIG_LV_SJPG_FAST_DECODE
+            #define LV_SJPG_FAST_DECODE CONFIG_LV_SJPG_FAST_DECODE
+        #else
+            #define LV_SJPG_FAST_DECODE 0
+        #endif
+    #endif
+#endif
 
 /*GIF decoder library*/
 #ifndef LV_USE_GIF
@@ -2286,6 +2484,18 @@
         #define LV_USE_SNAPSHOT 0
     #endif
 #endif
+#if LV_USE_SNAPSHOT
+    /*1: Draw snapshots of the screens during `lv_scr_load_anim()` instead of redrawing them in every frame.
+     *Needs memory for a snapshot of both screens while the animation runs, else the screens are drawn normally.
+     *The screens don't change during the animation, e.g. a spinner stops until the new screen is loaded.*/
+    #ifndef LV_SCR_LOAD_ANIM_SNAPSHOT
+        #ifdef CONFIG_LV_SCR_LOAD_ANIM_SNAPSHOT
+            #define LV_SCR_LOAD_ANIM_SNAPSHOT CONFIG_LV_SCR_LOAD_ANIM_SNAPSHOT
+        #else
+            #define LV_SCR_LOAD_ANIM_SNAPSHOT 0
+        #endif
+    #endif
+#endif
 
 /*1: Enable Monkey test*/
 #ifndef LV_USE_MONKEY
@@ -85,6 +85,17 @@ extern "C" {
 #  define CONFIG_LV_USE_MEM_MONITOR_POS LV_ALIGN_CENTER
 #endif
 
+/*------------------
+ * PROFILER TIME
+ *-----------------*/
+
+#ifdef CONFIG_LV_REFR_PROFILER_TIME_ESP_TIMER
+#  include "esp_timer.h"
+#  define CONFIG_LV_REFR_PROFILER_TIME_GET esp_timer_get_time()
+#elif defined(CONFIG_LV_REFR_PROFILER_TIME_TICK)
+#  define CONFIG_LV_REFR_PROFILER_TIME_GET (lv_tick_get() * 1000)
+#endif
+
 /********************
  * FONT SELECTION
  *******************/
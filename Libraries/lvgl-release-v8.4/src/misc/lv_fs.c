@@ -16,19 +16,52 @@
 /*********************
  *      DEFINES
  *********************/
+#if LV_FS_BLOCK_CACHE_SIZE
+    #define BLOCK_SIZE  LV_FS_BLOCK_CACHE_BLOCK_SIZE
+    #define BLOCK_CNT   (LV_FS_BLOCK_CACHE_SIZE / LV_FS_BLOCK_CACHE_BLOCK_SIZE)
+    #if BLOCK_CNT == 0
+        #error "LV_FS_BLOCK_CACHE_SIZE must be at least LV_FS_BLOCK_CACHE_BLOCK_SIZE"
+    #endif
+    #define READ_AHEAD  LV_MIN(LV_FS_BLOCK_CACHE_READ_AHEAD, BLOCK_CNT)
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_FS_BLOCK_CACHE_SIZE
+typedef struct {
+    lv_fs_drv_t * drv;      /*NULL if the block is free*/
+    void * file_d;
+    uint32_t index;         /*Index of the block in the file*/
+    uint32_t size;          /*Number of valid bytes, less than BLOCK_SIZE only at the end of the file*/
+    uint32_t last_use;
+} fs_block_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static const char * lv_fs_get_real_path(const char * path);
+static lv_fs_res_t drv_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br);
+static lv_fs_res_t drv_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whence);
+#if LV_FS_BLOCK_CACHE_SIZE
+    static lv_fs_res_t lv_fs_read_blocks(lv_fs_file_t * file_p, uint8_t * buf, uint32_t btr, uint32_t * br);
+    static lv_fs_res_t lv_fs_write_blocks(lv_fs_file_t * file_p, const void * buf, uint32_t btw, uint32_t * bw);
+    static lv_fs_res_t lv_fs_seek_blocks(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whence);
+    static lv_fs_res_t block_drv_read(lv_fs_file_t * file_p, uint32_t pos, void * buf, uint32_t btr, uint32_t * br);
+    static fs_block_t * block_find(lv_fs_file_t * file_p, uint32_t index);
+    static fs_block_t * block_load(lv_fs_file_t * file_p, uint32_t index, uint32_t cnt, lv_fs_res_t * res);
+    static void block_invalidate(lv_fs_file_t * file_p, uint32_t first, uint32_t last);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_FS_BLOCK_CACHE_SIZE
+    static uint8_t block_mem[BLOCK_CNT * BLOCK_SIZE];
+    static fs_block_t blocks[BLOCK_CNT];
+    static uint32_t block_use_cnt;
+#endif
 
 /**********************
  *      MACROS
@@ -41,6 +74,11 @@ static const char * lv_fs_get_real_path(const char * path);
 void _lv_fs_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_fsdrv_ll), sizeof(lv_fs_drv_t *));
+
+#if LV_FS_BLOCK_CACHE_SIZE
+    lv_memset_00(blocks, sizeof(blocks));
+    block_use_cnt = 0;
+#endif
 }
 
 bool lv_fs_is_ready(char letter)
@@ -90,8 +128,14 @@ lv_fs_res_t lv_fs_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mo
 
     file_p->drv = drv;
     file_p->file_d = file_d;
+    file_p->cache = NULL;
+
+    bool block_cache = false;
+#if LV_FS_BLOCK_CACHE_SIZE
+    block_cache = drv->block_cache;
+#endif
 
-    if(drv->cache_size) {
+    if(drv->cache_size || block_cache) {
         file_p->cache = lv_mem_alloc(sizeof(lv_fs_file_cache_t));
         LV_ASSERT_MALLOC(file_p->cache);
         lv_memset_00(file_p->cache, sizeof(lv_fs_file_cache_t));
@@ -112,9 +156,13 @@ lv_fs_res_t lv_fs_close(lv_fs_file_t * file_p)
         return LV_FS_RES_NOT_IMP;
     }
 
+#if LV_FS_BLOCK_CACHE_SIZE
+    if(file_p->drv->block_cache) block_invalidate(file_p, 0, UINT32_MAX);
+#endif
+
     lv_fs_res_t res = file_p->drv->close_cb(file_p->drv, file_p->file_d);
 
-    if(file_p->drv->cache_size && file_p->cache) {
+    if(file_p->cache) {
         if(file_p->cache->buffer) {
             lv_mem_free(file_p->cache->buffer);
         }
@@ -155,12 +203,12 @@ static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, char * buf, uint32_t
             uint32_t bytes_read_to_buffer = 0;
             if(btr > buffer_size) {
                 /*If remaining data chuck is bigger than buffer size, then do not use cache, instead read it directly from FS*/
-                res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)(buf + buffer_remaining_length),
-                                           btr - buffer_remaining_length, &bytes_read_to_buffer);
+                res = drv_read(file_p, (void *)(buf + buffer_remaining_length), btr - buffer_remaining_length,
+                               &bytes_read_to_buffer);
             }
             else {
                 /*If remaining data chunk is smaller than buffer size, then read into cache buffer*/
-                res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)buffer, buffer_size, &bytes_read_to_buffer);
+                res = drv_read(file_p, (void *)buffer, buffer_size, &bytes_read_to_buffer);
                 file_p->cache->start = file_p->cache->end;
                 file_p->cache->end = file_p->cache->start + bytes_read_to_buffer;
 
@@ -174,7 +222,7 @@ static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, char * buf, uint32_t
         /*Data is not in cache buffer*/
         if(btr > buffer_size) {
             /*If bigger data is requested, then do not use cache, instead read it directly*/
-            res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)buf, btr, br);
+            res = drv_read(file_p, (void *)buf, btr, br);
         }
         else {
             /*If small data is requested, then read from FS into cache buffer*/
@@ -185,7 +233,7 @@ static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, char * buf, uint32_t
             }
 
             uint32_t bytes_read_to_buffer = 0;
-            res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)buffer, buffer_size, &bytes_read_to_buffer);
+            res = drv_read(file_p, (void *)buffer, buffer_size, &bytes_read_to_buffer);
             file_p->cache->start = file_position;
             file_p->cache->end = file_p->cache->start + bytes_read_to_buffer;
 
@@ -211,11 +259,19 @@ lv_fs_res_t lv_fs_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t
     uint32_t br_tmp = 0;
     lv_fs_res_t res;
 
+#if LV_FS_BLOCK_CACHE_SIZE
+    if(file_p->drv->block_cache) {
+        res = lv_fs_read_blocks(file_p, (uint8_t *)buf, btr, &br_tmp);
+        if(br != NULL) *br = br_tmp;
+        return res;
+    }
+#endif
+
     if(file_p->drv->cache_size) {
         res = lv_fs_read_cached(file_p, (char *)buf, btr, &br_tmp);
     }
     else {
-        res = file_p->drv->read_cb(file_p->drv, file_p->file_d, buf, btr, &br_tmp);
+        res = drv_read(file_p, buf, btr, &br_tmp);
     }
 
     if(br != NULL) *br = br_tmp;
@@ -236,6 +292,14 @@ lv_fs_res_t lv_fs_write(lv_fs_file_t * file_p, const void * buf, uint32_t btw, u
     }
 
     uint32_t bw_tmp = 0;
+#if LV_FS_BLOCK_CACHE_SIZE
+    if(file_p->drv->block_cache) {
+        lv_fs_res_t res = lv_fs_write_blocks(file_p, buf, btw, &bw_tmp);
+        if(bw != NULL) *bw = bw_tmp;
+        return res;
+    }
+#endif
+
     lv_fs_res_t res = file_p->drv->write_cb(file_p->drv, file_p->file_d, buf, btw, &bw_tmp);
     if(bw != NULL) *bw = bw_tmp;
 
@@ -252,6 +316,10 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
         return LV_FS_RES_NOT_IMP;
     }
 
+#if LV_FS_BLOCK_CACHE_SIZE
+    if(file_p->drv->block_cache) return lv_fs_seek_blocks(file_p, pos, whence);
+#endif
+
     lv_fs_res_t res = LV_FS_RES_OK;
     if(file_p->drv->cache_size) {
         switch(whence) {
@@ -260,7 +328,7 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
 
                     /*FS seek if new position is outside cache buffer*/
                     if(file_p->cache->file_position < file_p->cache->start || file_p->cache->file_position > file_p->cache->end) {
-                        res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, file_p->cache->file_position, LV_FS_SEEK_SET);
+                        res = drv_seek(file_p, file_p->cache->file_position, LV_FS_SEEK_SET);
                     }
 
                     break;
@@ -270,14 +338,14 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
 
                     /*FS seek if new position is outside cache buffer*/
                     if(file_p->cache->file_position < file_p->cache->start || file_p->cache->file_position > file_p->cache->end) {
-                        res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, file_p->cache->file_position, LV_FS_SEEK_SET);
+                        res = drv_seek(file_p, file_p->cache->file_position, LV_FS_SEEK_SET);
                     }
 
                     break;
                 }
             case LV_FS_SEEK_END: {
                     /*Because we don't know the file size, we do a little trick: do a FS seek, then get new file position from FS*/
-                    res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos, whence);
+                    res = drv_seek(file_p, pos, whence);
                     if(res == LV_FS_RES_OK) {
                         uint32_t tmp_position;
                         res = file_p->drv->tell_cb(file_p->drv, file_p->file_d, &tmp_position);
@@ -291,7 +359,7 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
         }
     }
     else {
-        res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos, whence);
+        res = drv_seek(file_p, pos, whence);
     }
 
     return res;
@@ -310,7 +378,7 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
     }
 
     lv_fs_res_t res;
-    if(file_p->drv->cache_size) {
+    if(file_p->cache) {
         *pos = file_p->cache->file_position;
         res = LV_FS_RES_OK;
     }
@@ -500,6 +568,20 @@ const char * lv_fs_get_last(const char * path)
 
     return &path[i + 1];
 }
+
+void lv_fs_get_stats(char letter, lv_fs_drv_stats_t * stats)
+{
+    lv_fs_drv_t * drv = lv_fs_get_drv(letter);
+    if(drv) *stats = drv->stats;
+    else lv_memset_00(stats, sizeof(lv_fs_drv_stats_t));
+}
+
+void lv_fs_reset_stats(char letter)
+{
+    lv_fs_drv_t * drv = lv_fs_get_drv(letter);
+    if(drv) lv_memset_00(&drv->stats, sizeof(lv_fs_drv_stats_t));
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -516,3 +598,286 @@ static const char * lv_fs_get_real_path(const char * path)
 
     return path;
 }
+
+/**
+ * Read from the driver and update the statistics of the drive
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param buf       pointer to a buffer where the read bytes are stored
+ * @param btr       Bytes To Read
+ * @param br        the number of real read bytes (Bytes Read)
+ * @return          LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t drv_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    lv_fs_drv_t * drv = file_p->drv;
+    *br = 0;
+    lv_fs_res_t res = drv->read_cb(drv, file_p->file_d, buf, btr, br);
+    drv->stats.read_cnt++;
+    if(res == LV_FS_RES_OK) drv->stats.bytes_read += *br;
+
+    return res;
+}
+
+/**
+ * Seek with the driver and update the statistics of the drive
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param pos       the new position
+ * @param whence    tells from where set the position
+ * @return          LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t drv_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    file_p->drv->stats.seek_cnt++;
+    return file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos, whence);
+}
+
+#if LV_FS_BLOCK_CACHE_SIZE
+
+/**
+ * Read from a file through the shared block cache.
+ * Reading the start of a file or continuing where the last read ended reads ahead `READ_AHEAD` blocks.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param buf       pointer to a buffer where the read bytes are stored
+ * @param btr       Bytes To Read
+ * @param br        the number of real read bytes (Bytes Read)
+ * @return          LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t lv_fs_read_blocks(lv_fs_file_t * file_p, uint8_t * buf, uint32_t btr, uint32_t * br)
+{
+    lv_fs_file_cache_t * cache = file_p->cache;
+    lv_fs_drv_stats_t * stats = &file_p->drv->stats;
+    bool sequential = cache->file_position == cache->read_end;
+    lv_fs_res_t res = LV_FS_RES_OK;
+
+    *br = 0;
+    while(*br < btr) {
+        uint32_t pos = cache->file_position + *br;
+        uint32_t index = pos / BLOCK_SIZE;
+        uint32_t offset = pos % BLOCK_SIZE;
+        uint32_t rest = btr - *br;
+
+        fs_block_t * block = block_find(file_p, index);
+        if(block) {
+            stats->hits++;
+            block->last_use = ++block_use_cnt;
+        }
+        else if(offset == 0 && rest >= BLOCK_SIZE) {
+            /*Read the whole blocks directly into the destination buffer*/
+            uint32_t btr_direct = rest - rest % BLOCK_SIZE;
+            uint32_t br_direct;
+            res = block_drv_read(file_p, pos, buf + *br, btr_direct, &br_direct);
+            if(res != LV_FS_RES_OK) break;
+
+            stats->misses++;
+            *br += br_direct;
+            if(br_direct < btr_direct) break;   /*End of the file*/
+            continue;
+        }
+        else {
+            stats->misses++;
+            block = block_load(file_p, index, sequential ? READ_AHEAD : 1, &res);
+            if(block == NULL) break;    /*Error or end of the file*/
+        }
+
+        if(block->size <= offset) break;
+        uint32_t n = LV_MIN(block->size - offset, rest);
+        lv_memcpy(buf + *br, &block_mem[(uint32_t)(block - blocks) * BLOCK_SIZE + offset], n);
+        *br += n;
+
+        if(block->size < BLOCK_SIZE) break; /*Only the last block of the file can be partial*/
+    }
+
+    cache->file_position += *br;
+    cache->read_end = cache->file_position;
+
+    return res;
+}
+
+/**
+ * Write to a file whose reads go through the shared block cache. The blocks of the written range are dropped.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param buf       pointer to a buffer with the bytes to write
+ * @param btw       Bytes To Write
+ * @param bw        the number of real written bytes (Bytes Written)
+ * @return          LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t lv_fs_write_blocks(lv_fs_file_t * file_p, const void * buf, uint32_t btw, uint32_t * bw)
+{
+    lv_fs_file_cache_t * cache = file_p->cache;
+    lv_fs_res_t res;
+
+    if(cache->drv_position != cache->file_position) {
+        res = drv_seek(file_p, cache->file_position, LV_FS_SEEK_SET);
+        if(res != LV_FS_RES_OK) return res;
+        cache->drv_position = cache->file_position;
+    }
+
+    res = file_p->drv->write_cb(file_p->drv, file_p->file_d, buf, btw, bw);
+    if(res != LV_FS_RES_OK) {
+        cache->drv_position = UINT32_MAX;   /*Unknown, seek before the next access*/
+        return res;
+    }
+
+    if(*bw) block_invalidate(file_p, cache->file_position / BLOCK_SIZE, (cache->file_position + *bw - 1) / BLOCK_SIZE);
+
+    cache->file_position += *bw;
+    cache->drv_position = cache->file_position;
+
+    return res;
+}
+
+/**
+ * Set the position in a file whose reads go through the shared block cache.
+ * Only `LV_FS_SEEK_END` calls the driver, the other seeks are done on the next read or write.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param pos       the new position
+ * @param whence    tells from where set the position
+ * @return          LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t lv_fs_seek_blocks(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    lv_fs_file_cache_t * cache = file_p->cache;
+    lv_fs_res_t res = LV_FS_RES_OK;
+
+    switch(whence) {
+        case LV_FS_SEEK_SET:
+            cache->file_position = pos;
+            break;
+        case LV_FS_SEEK_CUR:
+            cache->file_position += pos;
+            break;
+        case LV_FS_SEEK_END: {
+                /*The file size is not known so let the driver find the position*/
+                if(file_p->drv->tell_cb == NULL) return LV_FS_RES_NOT_IMP;
+                cache->drv_position = UINT32_MAX;
+                res = drv_seek(file_p, pos, whence);
+                if(res != LV_FS_RES_OK) break;
+
+                uint32_t tmp_position;
+                res = file_p->drv->tell_cb(file_p->drv, file_p->file_d, &tmp_position);
+                if(res == LV_FS_RES_OK) {
+                    cache->file_position = tmp_position;
+                    cache->drv_position = tmp_position;
+                }
+                break;
+            }
+    }
+
+    return res;
+}
+
+/**
+ * Read from the driver at a given position. Seek only if the driver's file pointer is somewhere else.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param pos       position in the file to read from
+ * @param buf       pointer to a buffer where the read bytes are stored
+ * @param btr       Bytes To Read
+ * @param br        the number of real read bytes (Bytes Read)
+ * @return          LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t block_drv_read(lv_fs_file_t * file_p, uint32_t pos, void * buf, uint32_t btr, uint32_t * br)
+{
+    lv_fs_file_cache_t * cache = file_p->cache;
+    lv_fs_res_t res;
+
+    *br = 0;
+    if(cache->drv_position != pos) {
+        res = drv_seek(file_p, pos, LV_FS_SEEK_SET);
+        if(res != LV_FS_RES_OK) return res;
+        cache->drv_position = pos;
+    }
+
+    res = drv_read(file_p, buf, btr, br);
+    if(res == LV_FS_RES_OK) cache->drv_position += *br;
+    else cache->drv_position = UINT32_MAX;   /*Unknown, seek before the next access*/
+
+    return res;
+}
+
+/**
+ * Find a block of a file in the cache
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param index     index of the block in the file
+ * @return          the cached block or NULL if not found
+ */
+static fs_block_t * block_find(lv_fs_file_t * file_p, uint32_t index)
+{
+    uint32_t i;
+    for(i = 0; i < BLOCK_CNT; i++) {
+        fs_block_t * block = &blocks[i];
+        if(block->index == index && block->file_d == file_p->file_d && block->drv == file_p->drv) return block;
+    }
+
+    return NULL;
+}
+
+/**
+ * Read blocks of a file into the cache. They replace the least recently used adjacent blocks
+ * to read all of them with one `read_cb` call.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param index     index of the first block to read
+ * @param cnt       read at most this number of blocks. Stops before the first block which is already cached.
+ * @param res       store the result of the read here
+ * @return          the block with `index` or NULL on error or if `index` is after the end of the file
+ */
+static fs_block_t * block_load(lv_fs_file_t * file_p, uint32_t index, uint32_t cnt, lv_fs_res_t * res)
+{
+    uint32_t n = 1;
+    while(n < cnt && block_find(file_p, index + n) == NULL) n++;
+
+    uint32_t first = 0;
+    uint32_t oldest = UINT32_MAX;
+    uint32_t i;
+    for(i = 0; i + n <= BLOCK_CNT; i += n) {
+        uint32_t newest = 0;
+        uint32_t j;
+        for(j = i; j < i + n; j++) {
+            if(blocks[j].drv && blocks[j].last_use > newest) newest = blocks[j].last_use;
+        }
+
+        if(newest < oldest) {
+            oldest = newest;
+            first = i;
+            if(newest == 0) break;  /*All free*/
+        }
+    }
+
+    uint32_t br;
+    *res = block_drv_read(file_p, index * BLOCK_SIZE, &block_mem[first * BLOCK_SIZE], n * BLOCK_SIZE, &br);
+
+    for(i = 0; i < n; i++) {
+        fs_block_t * block = &blocks[first + i];
+        block->size = br > i * BLOCK_SIZE ? LV_MIN(br - i * BLOCK_SIZE, BLOCK_SIZE) : 0;
+        if(block->size == 0) {
+            block->drv = NULL;
+            continue;
+        }
+
+        block->drv = file_p->drv;
+        block->file_d = file_p->file_d;
+        block->index = index + i;
+        block->last_use = ++block_use_cnt;
+    }
+
+    return blocks[first].drv ? &blocks[first] : NULL;
+}
+
+/**
+ * Drop the cached blocks of a file in a range
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param first     index of the first block to drop
+ * @param last      index of the last block to drop
+ */
+static void block_invalidate(lv_fs_file_t * file_p, uint32_t first, uint32_t last)
+{
+    uint32_t i;
+    for(i = 0; i < BLOCK_CNT; i++) {
+        fs_block_t * block = &blocks[i];
+        if(block->drv == file_p->drv && block->file_d == file_p->file_d &&
+           block->index >= first && block->index <= last) {
+            block->drv = NULL;
+        }
+    }
+}
+
+#endif /*LV_FS_BLOCK_CACHE_SIZE*/
@@ -66,9 +66,21 @@ typedef enum {
     LV_FS_SEEK_END = 0x02,      /**< Set the position from the end of the file*/
 } lv_fs_whence_t;
 
+/**
+ * Statistics of a drive. Only the accesses through `lv_fs_...()` functions are counted.
+ */
+typedef struct {
+    uint32_t read_cnt;      /**< Number of `read_cb` calls*/
+    uint32_t seek_cnt;      /**< Number of `seek_cb` calls*/
+    uint32_t bytes_read;    /**< Number of bytes returned by `read_cb`*/
+    uint32_t hits;          /**< Blocks looked up and found in the block cache*/
+    uint32_t misses;        /**< Blocks looked up and read from the drive, together with the blocks read ahead*/
+} lv_fs_drv_stats_t;
+
 typedef struct _lv_fs_drv_t {
     char letter;
     uint16_t cache_size;
+    bool block_cache;       /**< Use the blocks shared by all files instead of `cache_size`. Requires `LV_FS_BLOCK_CACHE_SIZE > 0`*/
     bool (*ready_cb)(struct _lv_fs_drv_t * drv);
 
     void * (*open_cb)(struct _lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode);
@@ -82,6 +94,8 @@ typedef struct _lv_fs_drv_t {
     lv_fs_res_t (*dir_read_cb)(struct _lv_fs_drv_t * drv, void * rddir_p, char * fn);
     lv_fs_res_t (*dir_close_cb)(struct _lv_fs_drv_t * drv, void * rddir_p);
 
+    lv_fs_drv_stats_t stats;
+
 #if LV_USE_USER_DATA
     void * user_data; /**< Custom file user data*/
 #endif
@@ -92,6 +106,10 @@ typedef struct {
     uint32_t end;
     uint32_t file_position;
     void * buffer;
+#if LV_FS_BLOCK_CACHE_SIZE
+    uint32_t drv_position;  /**< Position of the driver's file pointer*/
+    uint32_t read_end;      /**< Position after the last read to detect sequential reads*/
+#endif
 } lv_fs_file_cache_t;
 
 typedef struct {
@@ -250,6 +268,19 @@ char * lv_fs_up(char * path);
  */
 const char * lv_fs_get_last(const char * path);
 
+/**
+ * Get the read and seek statistics of a drive
+ * @param letter    letter of the drive
+ * @param stats     store the statistics here. Zeroed if the drive doesn't exist.
+ */
+void lv_fs_get_stats(char letter, lv_fs_drv_stats_t * stats);
+
+/**
+ * Reset the statistics of a drive
+ * @param letter    letter of the drive
+ */
+void lv_fs_reset_stats(char letter);
+
 /**********************
  *      MACROS
  **********************/
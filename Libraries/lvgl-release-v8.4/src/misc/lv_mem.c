@@ -12,6 +12,7 @@
 #include "lv_gc.h"
 #include "lv_assert.h"
 #include "lv_log.h"
+#include "lv_printf.h"
 
 #if LV_MEM_CUSTOM != 0
     #include LV_MEM_CUSTOM_INCLUDE
@@ -39,9 +40,55 @@
 
 #define ZERO_MEM_SENTINEL  0xa1b2c3d4
 
+#define FRAME_ARENA_NO_BLOCK  UINT32_MAX
+
+/*The GC can't see the pointers stored in the slab pools*/
+#define SLAB_PAGE_SIZE   1024
+#if LV_MEM_SLAB_SIZE >= SLAB_PAGE_SIZE && LV_ENABLE_GC == 0
+    #define USE_SLAB     1
+    #define SLAB_PAGE_CNT   (LV_MEM_SLAB_SIZE / SLAB_PAGE_SIZE)
+    #define SLAB_NO_PAGE    UINT16_MAX
+#else
+    #define USE_SLAB     0
+#endif
+
+/*Size of the header before the allocations, keeps the alignment of the allocated memory*/
+#define TELEMETRY_HEADER_SIZE  ((sizeof(telemetry_header_t) + LV_ATTRIBUTE_MEM_ALIGN_SIZE - 1) / \
+                                LV_ATTRIBUTE_MEM_ALIGN_SIZE * LV_ATTRIBUTE_MEM_ALIGN_SIZE)
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_MEM_FRAME_ARENA_SIZE
+/*Header before each block of the frame arena*/
+typedef struct {
+    uint32_t prev;      /*Offset of the previous block's header*/
+    uint32_t freed;
+} frame_block_t;
+#endif
+
+#if USE_SLAB
+/*A page of the slab region. It holds the blocks of one size class.*/
+typedef struct {
+    void * free_list;       /*Freed blocks of the page*/
+    uint16_t used_cnt;      /*Number of blocks in use*/
+    uint16_t carved_cnt;    /*Number of blocks ever given out, the rest of the page is untouched*/
+    uint16_t next;          /*Next page in the list of the class or in the list of free pages*/
+    uint16_t prev;
+    uint8_t cls;
+} slab_page_t;
+#endif
+
+#if LV_USE_MEM_TELEMETRY
+/*Header before each allocation to know its size and owner when it's freed*/
+typedef struct {
+    uint32_t size;
+    uint32_t tag;
+#ifdef LV_ARCH_64
+    uint64_t reserved;  /*Keep the 16 byte alignment of 64 bit allocators*/
+#endif
+} telemetry_header_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -49,6 +96,27 @@
 #if LV_MEM_CUSTOM == 0
     static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
 #endif
+static void * heap_alloc(size_t size);
+static void heap_free(void * p);
+static void * heap_realloc(void * p, size_t size);
+static void * mem_alloc(size_t size, bool slab);
+static void * mem_realloc(void * data_p, size_t new_size, bool slab);
+#if USE_SLAB
+    static void * slab_alloc(size_t size);
+    static bool slab_free(void * p);
+    static void * slab_realloc(void * p, size_t size, bool slab);
+    static void slab_list_add(uint8_t cls, uint16_t page_id);
+    static void slab_list_remove(uint8_t cls, uint16_t page_id);
+#endif
+#if LV_MEM_FRAME_ARENA_SIZE
+    static void * frame_arena_alloc(size_t size);
+    static bool frame_arena_release(void * p);
+#endif
+#if LV_USE_MEM_TELEMETRY
+    static void * telemetry_add(void * raw, size_t size, lv_mem_tag_t tag);
+    static void * telemetry_remove(void * data, lv_mem_tag_t * tag);
+    static uint32_t json_append(char * buf, uint32_t buf_size, uint32_t len, const char * fmt, ...);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -59,6 +127,36 @@
     static uint32_t max_used;
 #endif
 
+#if LV_MEM_FRAME_ARENA_SIZE
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT frame_arena[LV_MEM_FRAME_ARENA_SIZE / sizeof(MEM_UNIT)];
+    static uint32_t frame_top;
+    static uint32_t frame_last = FRAME_ARENA_NO_BLOCK;
+    static uint32_t frame_max_used;
+    static uint32_t frame_fallback_cnt;
+#endif
+static uint16_t frame_depth;
+
+#if USE_SLAB
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT slab_mem[SLAB_PAGE_CNT * SLAB_PAGE_SIZE / sizeof(MEM_UNIT)];
+    static slab_page_t slab_pages[SLAB_PAGE_CNT];
+    static uint16_t slab_free_page;                             /*Stack of the unused pages*/
+    static uint16_t slab_partial[_LV_MEM_SLAB_CLASS_CNT];       /*Pages with free blocks of each class*/
+    static lv_mem_slab_class_monitor_t slab_class_mon[_LV_MEM_SLAB_CLASS_CNT];
+    static uint32_t slab_used_page_cnt;
+    static uint32_t slab_max_used_page_cnt;
+    static uint32_t slab_fallback_cnt;
+    static const uint16_t slab_class_size[_LV_MEM_SLAB_CLASS_CNT] = {16, 32, 48, 64, 96, 128, 192, 256};
+#endif
+
+#if LV_USE_MEM_TELEMETRY
+    static lv_mem_tag_monitor_t tag_mon[_LV_MEM_TAG_LAST];
+    static uint32_t tag_frame_start_alloc_cnt[_LV_MEM_TAG_LAST];
+    static uint32_t tag_frame_start_free_cnt[_LV_MEM_TAG_LAST];
+    static uint32_t size_histogram[_LV_MEM_SIZE_HISTOGRAM_BINS];
+    static lv_mem_tag_t cur_tag;
+    static const char * const tag_names[_LV_MEM_TAG_LAST] = {"other", "obj", "style", "img", "font", "draw"};
+#endif
+
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
 /**********************
@@ -100,6 +198,22 @@ void lv_mem_init(void)
 #endif
 #endif
 
+#if USE_SLAB
+    uint32_t i;
+    for(i = 0; i < SLAB_PAGE_CNT; i++) {
+        slab_pages[i].next = i + 1 < SLAB_PAGE_CNT ? i + 1 : SLAB_NO_PAGE;
+    }
+    slab_free_page = 0;
+    for(i = 0; i < _LV_MEM_SLAB_CLASS_CNT; i++) {
+        slab_partial[i] = SLAB_NO_PAGE;
+        lv_memset_00(&slab_class_mon[i], sizeof(lv_mem_slab_class_monitor_t));
+        slab_class_mon[i].block_size = slab_class_size[i];
+    }
+    slab_used_page_cnt = 0;
+    slab_max_used_page_cnt = 0;
+    slab_fallback_cnt = 0;
+#endif
+
 #if LV_MEM_ADD_JUNK
     LV_LOG_WARN("LV_MEM_ADD_JUNK is enabled which makes LVGL much slower");
 #endif
@@ -124,42 +238,7 @@ void lv_mem_deinit(void)
  */
 void * lv_mem_alloc(size_t size)
 {
-    MEM_TRACE("allocating %lu bytes", (unsigned long)size);
-    if(size == 0) {
-        MEM_TRACE("using zero_mem");
-        return &zero_mem;
-    }
-
-#if LV_MEM_CUSTOM == 0
-    void * alloc = lv_tlsf_malloc(tlsf, size);
-#else
-    void * alloc = LV_MEM_CUSTOM_ALLOC(size);
-#endif
-
-    if(alloc == NULL) {
-        LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
-#if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
-        lv_mem_monitor_t mon;
-        lv_mem_monitor(&mon);
-        LV_LOG_INFO("used: %6d (%3d %%), frag: %3d %%, biggest free: %6d",
-                    (int)(mon.total_size - mon.free_size), mon.used_pct, mon.frag_pct,
-                    (int)mon.free_biggest_size);
-#endif
-    }
-#if LV_MEM_ADD_JUNK
-    else {
-        lv_memset(alloc, 0xaa, size);
-    }
-#endif
-
-    if(alloc) {
-#if LV_MEM_CUSTOM == 0
-        cur_used += size;
-        max_used = LV_MAX(cur_used, max_used);
-#endif
-        MEM_TRACE("allocated at %p", alloc);
-    }
-    return alloc;
+    return mem_alloc(size, false);
 }
 
 /**
@@ -172,16 +251,14 @@ void lv_mem_free(void * data)
     if(data == &zero_mem) return;
     if(data == NULL) return;
 
-#if LV_MEM_CUSTOM == 0
-#  if LV_MEM_ADD_JUNK
-    lv_memset(data, 0xbb, lv_tlsf_block_size(data));
-#  endif
-    size_t size = lv_tlsf_free(tlsf, data);
-    if(cur_used > size) cur_used -= size;
-    else cur_used = 0;
-#else
-    LV_MEM_CUSTOM_FREE(data);
+#if LV_USE_MEM_TELEMETRY
+    data = telemetry_remove(data, NULL);
 #endif
+
+#if USE_SLAB
+    if(slab_free(data)) return;
+#endif
+    heap_free(data);
 }
 
 /**
@@ -193,27 +270,7 @@ void lv_mem_free(void * data)
  */
 void * lv_mem_realloc(void * data_p, size_t new_size)
 {
-    MEM_TRACE("reallocating %p with %lu size", data_p, (unsigned long)new_size);
-    if(new_size == 0) {
-        MEM_TRACE("using zero_mem");
-        lv_mem_free(data_p);
-        return &zero_mem;
-    }
-
-    if(data_p == &zero_mem) return lv_mem_alloc(new_size);
-
-#if LV_MEM_CUSTOM == 0
-    void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
-#else
-    void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
-#endif
-    if(new_p == NULL) {
-        LV_LOG_ERROR("couldn't allocate memory");
-        return NULL;
-    }
-
-    MEM_TRACE("allocated at %p", new_p);
-    return new_p;
+    return mem_realloc(data_p, new_size, false);
 }
 
 lv_res_t lv_mem_test(void)
@@ -268,6 +325,54 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 #endif
 }
 
+/**
+ * Allocate a small block from the slab pools. Meant for fixed size objects which are
+ * allocated and freed often, e.g. list nodes. Falls back to the heap if no size class fits or the pools are full.
+ * @param size size of the memory to allocate in bytes
+ * @return pointer to the allocated memory. Free it with `lv_mem_free()`.
+ */
+void * lv_mem_slab_alloc(size_t size)
+{
+    return mem_alloc(size, true);
+}
+
+/**
+ * Reallocate a memory with a new size. The old content will be kept.
+ * Unlike `lv_mem_realloc()` the new memory is taken from the slab pools if possible.
+ * @param data_p pointer to an allocated memory
+ * @param new_size the desired new size in byte
+ * @return pointer to the new memory, NULL on failure
+ */
+void * lv_mem_slab_realloc(void * data_p, size_t new_size)
+{
+    return mem_realloc(data_p, new_size, true);
+}
+
+/**
+ * Give information about the usage of the slab pools
+ * @param mon_p pointer to a lv_mem_slab_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_slab_monitor(lv_mem_slab_monitor_t * mon_p)
+{
+    lv_memset_00(mon_p, sizeof(lv_mem_slab_monitor_t));
+#if USE_SLAB
+    mon_p->total_size = sizeof(slab_mem);
+    mon_p->page_cnt = SLAB_PAGE_CNT;
+    mon_p->used_page_cnt = slab_used_page_cnt;
+    mon_p->max_used_page_cnt = slab_max_used_page_cnt;
+    mon_p->fallback_cnt = slab_fallback_cnt;
+    lv_memcpy(mon_p->classes, slab_class_mon, sizeof(slab_class_mon));
+
+    uint32_t used_size = 0;
+    uint32_t i;
+    for(i = 0; i < _LV_MEM_SLAB_CLASS_CNT; i++) {
+        used_size += slab_class_mon[i].used_cnt * slab_class_mon[i].block_size;
+    }
+    if(slab_used_page_cnt) mon_p->used_pct = (uint8_t)(used_size * 100 / (slab_used_page_cnt * SLAB_PAGE_SIZE));
+#endif
+}
+
 /**
  * Get a temporal buffer with the given size.
  * @param size the required size
@@ -278,6 +383,12 @@ void * lv_mem_buf_get(uint32_t size)
 
     MEM_TRACE("begin, getting %d bytes", size);
 
+#if LV_MEM_FRAME_ARENA_SIZE
+    /*During a refresh the buffers are taken from the frame arena*/
+    void * arena_buf = frame_arena_alloc(size);
+    if(arena_buf) return arena_buf;
+#endif
+
     /*Try to find a free buffer with suitable size*/
     int8_t i_guess = -1;
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
@@ -332,6 +443,10 @@ void lv_mem_buf_release(void * p)
 {
     MEM_TRACE("begin (address: %p)", p);
 
+#if LV_MEM_FRAME_ARENA_SIZE
+    if(frame_arena_release(p)) return;
+#endif
+
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
         if(LV_GC_ROOT(lv_mem_buf[i]).p == p) {
             LV_GC_ROOT(lv_mem_buf[i]).used = 0;
@@ -357,6 +472,200 @@ void lv_mem_buf_free_all(void)
     }
 }
 
+/**
+ * Allocate scratch memory which is needed only until the end of the current display refresh.
+ * It's taken from the frame arena if there is enough space, else it's allocated with `lv_mem_alloc()`.
+ * @param size size of the memory to allocate in bytes
+ * @return pointer to the allocated memory
+ */
+void * lv_mem_frame_alloc(size_t size)
+{
+#if LV_MEM_FRAME_ARENA_SIZE
+    void * p = frame_arena_alloc(size);
+    if(p) return p;
+#endif
+    return lv_mem_alloc(size);
+}
+
+/**
+ * Free a memory allocated by `lv_mem_frame_alloc()`.
+ * The arena gives back the memory right away if it's freed in reverse order of the allocations.
+ * @param data pointer to the memory to free
+ */
+void lv_mem_frame_free(void * data)
+{
+#if LV_MEM_FRAME_ARENA_SIZE
+    if(frame_arena_release(data)) return;
+#endif
+    lv_mem_free(data);
+}
+
+/**
+ * Give information about the usage of the frame arena
+ * @param mon_p pointer to a lv_mem_frame_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_frame_monitor(lv_mem_frame_monitor_t * mon_p)
+{
+    lv_memset_00(mon_p, sizeof(lv_mem_frame_monitor_t));
+#if LV_MEM_FRAME_ARENA_SIZE
+    mon_p->total_size = sizeof(frame_arena);
+    mon_p->used = frame_top;
+    mon_p->max_used = frame_max_used;
+    mon_p->fallback_cnt = frame_fallback_cnt;
+#endif
+}
+
+/**
+ * Start using the frame arena. Called when a display refresh begins.
+ */
+void _lv_mem_frame_begin(void)
+{
+    frame_depth++;
+    if(frame_depth > 1) return;
+
+#if LV_USE_MEM_TELEMETRY
+    lv_mem_tag_t i;
+    for(i = 0; i < _LV_MEM_TAG_LAST; i++) {
+        tag_frame_start_alloc_cnt[i] = tag_mon[i].alloc_cnt;
+        tag_frame_start_free_cnt[i] = tag_mon[i].free_cnt;
+    }
+#endif
+}
+
+/**
+ * Reset the frame arena. Called when a display refresh ends.
+ */
+void _lv_mem_frame_end(void)
+{
+    if(frame_depth == 0) return;
+    frame_depth--;
+    if(frame_depth > 0) return;
+
+#if LV_USE_MEM_TELEMETRY
+    lv_mem_tag_t i;
+    for(i = 0; i < _LV_MEM_TAG_LAST; i++) {
+        tag_mon[i].frame_alloc_cnt = tag_mon[i].alloc_cnt - tag_frame_start_alloc_cnt[i];
+        tag_mon[i].frame_free_cnt = tag_mon[i].free_cnt - tag_frame_start_free_cnt[i];
+    }
+#endif
+
+#if LV_MEM_FRAME_ARENA_SIZE
+    if(frame_last != FRAME_ARENA_NO_BLOCK) {
+        MEM_TRACE("%"LV_PRIu32" bytes of the frame arena weren't freed", frame_top);
+    }
+    frame_top = 0;
+    frame_last = FRAME_ARENA_NO_BLOCK;
+#endif
+}
+
+#if LV_USE_MEM_TELEMETRY
+
+/**
+ * Set the subsystem which owns the memory allocated from now on
+ * @param tag the new tag
+ * @return the previous tag, pass it to `lv_mem_set_tag()` to restore it
+ */
+lv_mem_tag_t lv_mem_set_tag(lv_mem_tag_t tag)
+{
+    lv_mem_tag_t prev = cur_tag;
+    if(tag < _LV_MEM_TAG_LAST) cur_tag = tag;
+    return prev;
+}
+
+/**
+ * Give information about the memory allocated by a subsystem
+ * @param tag the subsystem
+ * @param mon_p pointer to a lv_mem_tag_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_tag_monitor(lv_mem_tag_t tag, lv_mem_tag_monitor_t * mon_p)
+{
+    if(tag >= _LV_MEM_TAG_LAST) {
+        lv_memset_00(mon_p, sizeof(lv_mem_tag_monitor_t));
+        return;
+    }
+    *mon_p = tag_mon[tag];
+}
+
+/**
+ * Get the histogram of the allocation sizes
+ * @param hist array of `_LV_MEM_SIZE_HISTOGRAM_BINS` elements to store the number of allocations in each bin
+ */
+void lv_mem_size_histogram(uint32_t * hist)
+{
+    lv_memcpy(hist, size_histogram, sizeof(size_histogram));
+}
+
+/**
+ * Get the name of a tag
+ * @param tag the tag
+ * @return the name of the tag, e.g. "style"
+ */
+const char * lv_mem_tag_get_name(lv_mem_tag_t tag)
+{
+    if(tag >= _LV_MEM_TAG_LAST) return "";
+    return tag_names[tag];
+}
+
+/**
+ * Reset the counters, the max sizes and the histogram. The live sizes are kept.
+ */
+void lv_mem_telemetry_reset(void)
+{
+    lv_mem_tag_t i;
+    for(i = 0; i < _LV_MEM_TAG_LAST; i++) {
+        uint32_t live_size = tag_mon[i].live_size;
+        lv_memset_00(&tag_mon[i], sizeof(lv_mem_tag_monitor_t));
+        tag_mon[i].live_size = live_size;
+        tag_mon[i].max_live_size = live_size;
+        tag_frame_start_alloc_cnt[i] = 0;
+        tag_frame_start_free_cnt[i] = 0;
+    }
+    lv_memset_00(size_histogram, sizeof(size_histogram));
+}
+
+/**
+ * Write the statistics of all tags and the size histogram as JSON
+ * @param buf the buffer to write to
+ * @param buf_size size of `buf`. The output is truncated if it's too small.
+ * @return length of the full JSON text without the terminating `'\0'`
+ */
+uint32_t lv_mem_telemetry_to_json(char * buf, uint32_t buf_size)
+{
+    uint32_t len = 0;
+    lv_mem_tag_t i;
+
+    len = json_append(buf, buf_size, len, "{\"tags\":{");
+    for(i = 0; i < _LV_MEM_TAG_LAST; i++) {
+        const lv_mem_tag_monitor_t * mon = &tag_mon[i];
+        len = json_append(buf, buf_size, len,
+                          "%s\"%s\":{\"live_size\":%"LV_PRIu32",\"max_live_size\":%"LV_PRIu32","
+                          "\"alloc_cnt\":%"LV_PRIu32",\"free_cnt\":%"LV_PRIu32","
+                          "\"frame_alloc_cnt\":%"LV_PRIu32",\"frame_free_cnt\":%"LV_PRIu32"}",
+                          i == 0 ? "" : ",", tag_names[i], mon->live_size, mon->max_live_size,
+                          mon->alloc_cnt, mon->free_cnt, mon->frame_alloc_cnt, mon->frame_free_cnt);
+    }
+
+    len = json_append(buf, buf_size, len, "},\"size_histogram\":[");
+    uint32_t b;
+    for(b = 0; b < _LV_MEM_SIZE_HISTOGRAM_BINS; b++) {
+        /*The last bin has no upper limit*/
+        if(b < _LV_MEM_SIZE_HISTOGRAM_BINS - 1) {
+            len = json_append(buf, buf_size, len, "%s{\"max_size\":%"LV_PRIu32",\"cnt\":%"LV_PRIu32"}",
+                              b == 0 ? "" : ",", (uint32_t)8 << b, size_histogram[b]);
+        }
+        else {
+            len = json_append(buf, buf_size, len, ",{\"max_size\":null,\"cnt\":%"LV_PRIu32"}", size_histogram[b]);
+        }
+    }
+    len = json_append(buf, buf_size, len, "]}");
+
+    return len;
+}
+
+#endif /*LV_USE_MEM_TELEMETRY*/
+
 #if LV_MEMCPY_MEMSET_STD == 0
 /**
  * Same as `memcpy` but optimized for 4 byte operation.
@@ -563,3 +872,407 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
     }
 }
 #endif
+
+static void * heap_alloc(size_t size)
+{
+#if LV_MEM_CUSTOM == 0
+    void * alloc = lv_tlsf_malloc(tlsf, size);
+    if(alloc) {
+        cur_used += size;
+        max_used = LV_MAX(cur_used, max_used);
+    }
+    return alloc;
+#else
+    return LV_MEM_CUSTOM_ALLOC(size);
+#endif
+}
+
+static void heap_free(void * p)
+{
+#if LV_MEM_CUSTOM == 0
+#  if LV_MEM_ADD_JUNK
+    lv_memset(p, 0xbb, lv_tlsf_block_size(p));
+#  endif
+    size_t size = lv_tlsf_free(tlsf, p);
+    if(cur_used > size) cur_used -= size;
+    else cur_used = 0;
+#else
+    LV_MEM_CUSTOM_FREE(p);
+#endif
+}
+
+static void * heap_realloc(void * p, size_t size)
+{
+#if LV_MEM_CUSTOM == 0
+    return lv_tlsf_realloc(tlsf, p, size);
+#else
+    return LV_MEM_CUSTOM_REALLOC(p, size);
+#endif
+}
+
+/**
+ * Allocate a memory dynamically
+ * @param size size of the memory to allocate in bytes
+ * @param slab true: try the slab pools first
+ * @return pointer to the allocated memory
+ */
+static void * mem_alloc(size_t size, bool slab)
+{
+    MEM_TRACE("allocating %lu bytes", (unsigned long)size);
+    if(size == 0) {
+        MEM_TRACE("using zero_mem");
+        return &zero_mem;
+    }
+
+#if LV_USE_MEM_TELEMETRY
+    size_t alloc_size = size + TELEMETRY_HEADER_SIZE;
+#else
+    size_t alloc_size = size;
+#endif
+
+#if USE_SLAB
+    void * alloc = slab ? slab_alloc(alloc_size) : NULL;
+    if(alloc == NULL) alloc = heap_alloc(alloc_size);
+#else
+    LV_UNUSED(slab);
+    void * alloc = heap_alloc(alloc_size);
+#endif
+
+#if LV_USE_MEM_TELEMETRY
+    if(alloc) alloc = telemetry_add(alloc, size, cur_tag);
+#endif
+
+    if(alloc == NULL) {
+        LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
+#if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        LV_LOG_INFO("used: %6d (%3d %%), frag: %3d %%, biggest free: %6d",
+                    (int)(mon.total_size - mon.free_size), mon.used_pct, mon.frag_pct,
+                    (int)mon.free_biggest_size);
+#endif
+    }
+#if LV_MEM_ADD_JUNK
+    else {
+        lv_memset(alloc, 0xaa, size);
+    }
+#endif
+
+    if(alloc) {
+        MEM_TRACE("allocated at %p", alloc);
+    }
+    return alloc;
+}
+
+/**
+ * Reallocate a memory with a new size. The old content will be kept.
+ * @param data_p pointer to an allocated memory
+ * @param new_size the desired new size in byte
+ * @param slab true: take the new memory from the slab pools if possible
+ * @return pointer to the new memory
+ */
+static void * mem_realloc(void * data_p, size_t new_size, bool slab)
+{
+    MEM_TRACE("reallocating %p with %lu size", data_p, (unsigned long)new_size);
+    if(new_size == 0) {
+        MEM_TRACE("using zero_mem");
+        lv_mem_free(data_p);
+        return &zero_mem;
+    }
+
+    if(data_p == &zero_mem || data_p == NULL) return mem_alloc(new_size, slab);
+
+#if LV_USE_MEM_TELEMETRY
+    /*The header moves together with the data*/
+    void * raw_p = (uint8_t *)data_p - TELEMETRY_HEADER_SIZE;
+    size_t realloc_size = new_size + TELEMETRY_HEADER_SIZE;
+#else
+    void * raw_p = data_p;
+    size_t realloc_size = new_size;
+#endif
+
+#if USE_SLAB
+    void * new_p = slab_realloc(raw_p, realloc_size, slab);
+#else
+    LV_UNUSED(slab);
+    void * new_p = heap_realloc(raw_p, realloc_size);
+#endif
+    if(new_p == NULL) {
+        LV_LOG_ERROR("couldn't allocate memory");
+        return NULL;
+    }
+
+#if LV_USE_MEM_TELEMETRY
+    lv_mem_tag_t tag;
+    new_p = telemetry_remove((uint8_t *)new_p + TELEMETRY_HEADER_SIZE, &tag);
+    new_p = telemetry_add(new_p, new_size, tag);
+#endif
+
+    MEM_TRACE("allocated at %p", new_p);
+    return new_p;
+}
+
+#if USE_SLAB
+/**
+ * Allocate a block from a page of the smallest fitting size class
+ * @param size size of the memory to allocate in bytes
+ * @return pointer to the allocated memory or NULL if no class fits or there is no free page
+ */
+static void * slab_alloc(size_t size)
+{
+    uint8_t cls = 0;
+    while(cls < _LV_MEM_SLAB_CLASS_CNT && size > slab_class_size[cls]) cls++;
+    if(cls == _LV_MEM_SLAB_CLASS_CNT) {
+        slab_fallback_cnt++;
+        return NULL;
+    }
+
+    uint16_t page_id = slab_partial[cls];
+    if(page_id == SLAB_NO_PAGE) {
+        page_id = slab_free_page;
+        if(page_id == SLAB_NO_PAGE) {
+            slab_fallback_cnt++;
+            MEM_TRACE("slab pools are full, %lu bytes are allocated from the heap", (unsigned long)size);
+            return NULL;
+        }
+        slab_free_page = slab_pages[page_id].next;
+
+        slab_page_t * page = &slab_pages[page_id];
+        page->free_list = NULL;
+        page->used_cnt = 0;
+        page->carved_cnt = 0;
+        page->cls = cls;
+        slab_list_add(cls, page_id);
+        slab_class_mon[cls].page_cnt++;
+        slab_used_page_cnt++;
+        slab_max_used_page_cnt = LV_MAX(slab_max_used_page_cnt, slab_used_page_cnt);
+    }
+
+    slab_page_t * page = &slab_pages[page_id];
+    uint32_t block_size = slab_class_size[cls];
+    void * p;
+    if(page->free_list) {
+        p = page->free_list;
+        page->free_list = *(void **)p;
+    }
+    else {
+        p = (uint8_t *)slab_mem + (uint32_t)page_id * SLAB_PAGE_SIZE + (uint32_t)page->carved_cnt * block_size;
+        page->carved_cnt++;
+    }
+
+    /*Full pages are taken out of the list to find a free block right away*/
+    page->used_cnt++;
+    if(page->used_cnt == SLAB_PAGE_SIZE / block_size) slab_list_remove(cls, page_id);
+
+    lv_mem_slab_class_monitor_t * mon = &slab_class_mon[cls];
+    mon->used_cnt++;
+    mon->max_used_cnt = LV_MAX(mon->max_used_cnt, mon->used_cnt);
+
+    return p;
+}
+
+/**
+ * Give back a block to its page
+ * @param p pointer to the memory to free
+ * @return true: `p` was in the slab pools; false: `p` is not in the slab pools
+ */
+static bool slab_free(void * p)
+{
+    uint8_t * region = (uint8_t *)slab_mem;
+    if((uint8_t *)p < region || (uint8_t *)p >= region + sizeof(slab_mem)) return false;
+
+    uint16_t page_id = (uint16_t)(((uint8_t *)p - region) / SLAB_PAGE_SIZE);
+    slab_page_t * page = &slab_pages[page_id];
+    uint8_t cls = page->cls;
+    bool was_full = page->used_cnt == SLAB_PAGE_SIZE / slab_class_size[cls];
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(p, 0xbb, slab_class_size[cls]);
+#endif
+    *(void **)p = page->free_list;
+    page->free_list = p;
+    page->used_cnt--;
+    slab_class_mon[cls].used_cnt--;
+
+    if(page->used_cnt == 0) {
+        /*Empty pages can be used by any class*/
+        if(!was_full) slab_list_remove(cls, page_id);
+        page->next = slab_free_page;
+        slab_free_page = page_id;
+        slab_class_mon[cls].page_cnt--;
+        slab_used_page_cnt--;
+    }
+    else if(was_full) {
+        slab_list_add(cls, page_id);
+    }
+
+    return true;
+}
+
+/**
+ * Reallocate a block which might be in the slab pools
+ * @param p pointer to the block
+ * @param size the desired new size in byte
+ * @param slab true: take the new memory from the slab pools if possible
+ * @return pointer to the new memory or NULL on failure
+ */
+static void * slab_realloc(void * p, size_t size, bool slab)
+{
+    uint8_t * region = (uint8_t *)slab_mem;
+    if((uint8_t *)p < region || (uint8_t *)p >= region + sizeof(slab_mem)) {
+        /*The size of a heap block is unknown so it can't be moved to the slab pools*/
+        return heap_realloc(p, size);
+    }
+
+    uint32_t block_size = slab_class_size[slab_pages[((uint8_t *)p - region) / SLAB_PAGE_SIZE].cls];
+    if(size <= block_size) return p;
+
+    void * new_p = slab ? slab_alloc(size) : NULL;
+    if(new_p == NULL) new_p = heap_alloc(size);
+    if(new_p == NULL) return NULL;
+
+    lv_memcpy(new_p, p, block_size);
+    slab_free(p);
+    return new_p;
+}
+
+/**
+ * Add a page to the front of the pages with free blocks of a class
+ * @param cls index of the size class
+ * @param page_id index of the page
+ */
+static void slab_list_add(uint8_t cls, uint16_t page_id)
+{
+    slab_page_t * page = &slab_pages[page_id];
+    page->prev = SLAB_NO_PAGE;
+    page->next = slab_partial[cls];
+    if(page->next != SLAB_NO_PAGE) slab_pages[page->next].prev = page_id;
+    slab_partial[cls] = page_id;
+}
+
+/**
+ * Remove a page from the pages with free blocks of a class
+ * @param cls index of the size class
+ * @param page_id index of the page
+ */
+static void slab_list_remove(uint8_t cls, uint16_t page_id)
+{
+    slab_page_t * page = &slab_pages[page_id];
+    if(page->prev != SLAB_NO_PAGE) slab_pages[page->prev].next = page->next;
+    else slab_partial[cls] = page->next;
+    if(page->next != SLAB_NO_PAGE) slab_pages[page->next].prev = page->prev;
+}
+#endif
+
+#if LV_MEM_FRAME_ARENA_SIZE
+/**
+ * Allocate a block from the top of the frame arena
+ * @param size size of the memory to allocate in bytes
+ * @return pointer to the allocated memory or NULL if not refreshing or there is no enough space
+ */
+static void * frame_arena_alloc(size_t size)
+{
+    if(frame_depth == 0) return NULL;
+
+    size_t block_size = sizeof(frame_block_t) + ((size + ALIGN_MASK) & ~((size_t)ALIGN_MASK));
+    if(block_size > sizeof(frame_arena) - frame_top) {
+        frame_fallback_cnt++;
+        MEM_TRACE("frame arena is full, %lu bytes are allocated from the heap", (unsigned long)size);
+        return NULL;
+    }
+
+    frame_block_t * block = (frame_block_t *)((uint8_t *)frame_arena + frame_top);
+    block->prev = frame_last;
+    block->freed = 0;
+    frame_last = frame_top;
+    frame_top += block_size;
+    frame_max_used = LV_MAX(frame_max_used, frame_top);
+
+    return block + 1;
+}
+
+/**
+ * Free a block of the frame arena
+ * @param p pointer to the memory to free
+ * @return true: `p` was in the arena; false: `p` is not in the arena
+ */
+static bool frame_arena_release(void * p)
+{
+    uint8_t * arena = (uint8_t *)frame_arena;
+    if((uint8_t *)p < arena || (uint8_t *)p >= arena + sizeof(frame_arena)) return false;
+
+    /*Ignore the blocks of an already finished refresh*/
+    frame_block_t * block = (frame_block_t *)p - 1;
+    if((uint32_t)((uint8_t *)block - arena) >= frame_top) return true;
+    block->freed = 1;
+
+    /*Give back the space of the freed blocks on the top*/
+    while(frame_last != FRAME_ARENA_NO_BLOCK) {
+        block = (frame_block_t *)(arena + frame_last);
+        if(block->freed == 0) break;
+        frame_top = frame_last;
+        frame_last = block->prev;
+    }
+
+    return true;
+}
+#endif
+
+#if LV_USE_MEM_TELEMETRY
+/**
+ * Write the header of an allocation and count it
+ * @param raw the memory returned by the allocator
+ * @param size the size requested by the user
+ * @param tag the subsystem owning the memory
+ * @return pointer to the memory after the header
+ */
+static void * telemetry_add(void * raw, size_t size, lv_mem_tag_t tag)
+{
+    telemetry_header_t * header = raw;
+    header->size = (uint32_t)size;
+    header->tag = tag;
+
+    lv_mem_tag_monitor_t * mon = &tag_mon[tag];
+    mon->live_size += (uint32_t)size;
+    mon->max_live_size = LV_MAX(mon->max_live_size, mon->live_size);
+    mon->alloc_cnt++;
+
+    uint32_t bin = 0;
+    size_t bin_max = 8;
+    while(size > bin_max && bin < _LV_MEM_SIZE_HISTOGRAM_BINS - 1) {
+        bin_max <<= 1;
+        bin++;
+    }
+    size_histogram[bin]++;
+
+    return (uint8_t *)raw + TELEMETRY_HEADER_SIZE;
+}
+
+/**
+ * Count the free of an allocation
+ * @param data pointer to the memory after the header
+ * @param tag store the tag of the allocation here if not NULL
+ * @return the memory to give back to the allocator
+ */
+static void * telemetry_remove(void * data, lv_mem_tag_t * tag)
+{
+    telemetry_header_t * header = (telemetry_header_t *)((uint8_t *)data - TELEMETRY_HEADER_SIZE);
+    lv_mem_tag_monitor_t * mon = &tag_mon[header->tag < _LV_MEM_TAG_LAST ? header->tag : LV_MEM_TAG_OTHER];
+    if(mon->live_size > header->size) mon->live_size -= header->size;
+    else mon->live_size = 0;
+    mon->free_cnt++;
+
+    if(tag) *tag = (lv_mem_tag_t)header->tag;
+    return header;
+}
+
+static uint32_t json_append(char * buf, uint32_t buf_size, uint32_t len, const char * fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int ret = lv_vsnprintf(len < buf_size ? buf + len : NULL, len < buf_size ? buf_size - len : 0, fmt, args);
+    va_end(args);
+
+    return ret > 0 ? len + ret : len;
+}
+#endif
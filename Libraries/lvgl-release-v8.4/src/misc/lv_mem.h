@@ -25,6 +25,12 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/*Number of bins of the allocation size histogram. Bin `i` counts the sizes up to `8 << i` bytes, the last the larger ones*/
+#define _LV_MEM_SIZE_HISTOGRAM_BINS 12
+
+/*Number of the size classes of the slab pools*/
+#define _LV_MEM_SLAB_CLASS_CNT 8
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -51,6 +57,66 @@ typedef struct {
 
 typedef lv_mem_buf_t lv_mem_buf_arr_t[LV_MEM_BUF_MAX_NUM];
 
+/**
+ * Subsystems owning the allocated memory
+ */
+enum {
+    LV_MEM_TAG_OTHER,
+    LV_MEM_TAG_OBJ,
+    LV_MEM_TAG_STYLE,
+    LV_MEM_TAG_IMG,
+    LV_MEM_TAG_FONT,
+    LV_MEM_TAG_DRAW,
+    _LV_MEM_TAG_LAST,
+};
+
+typedef uint8_t lv_mem_tag_t;
+
+/**
+ * Allocation statistics of a subsystem.
+ */
+typedef struct {
+    uint32_t live_size;         /**< Size of the memory allocated now*/
+    uint32_t max_live_size;     /**< Max of `live_size`*/
+    uint32_t alloc_cnt;         /**< Number of allocations*/
+    uint32_t free_cnt;          /**< Number of frees*/
+    uint32_t frame_alloc_cnt;   /**< Number of allocations during the last display refresh*/
+    uint32_t frame_free_cnt;    /**< Number of frees during the last display refresh*/
+} lv_mem_tag_monitor_t;
+
+/**
+ * Frame arena information structure.
+ */
+typedef struct {
+    uint32_t total_size;    /**< Size of the arena, 0 if disabled*/
+    uint32_t used;          /**< Size used by the current refresh*/
+    uint32_t max_used;      /**< Max size used by a refresh*/
+    uint32_t fallback_cnt;  /**< Number of allocations which didn't fit into the arena*/
+} lv_mem_frame_monitor_t;
+
+/**
+ * Statistics of a size class of the slab pools.
+ */
+typedef struct {
+    uint32_t block_size;    /**< Size of the blocks of the class*/
+    uint32_t page_cnt;      /**< Number of pages assigned to the class*/
+    uint32_t used_cnt;      /**< Number of blocks in use*/
+    uint32_t max_used_cnt;  /**< Max of `used_cnt`*/
+} lv_mem_slab_class_monitor_t;
+
+/**
+ * Slab pools information structure.
+ */
+typedef struct {
+    uint32_t total_size;        /**< Size of the region of the pools, 0 if disabled*/
+    uint32_t page_cnt;          /**< Number of pages in the region*/
+    uint32_t used_page_cnt;     /**< Number of pages assigned to a size class*/
+    uint32_t max_used_page_cnt; /**< Max of `used_page_cnt`*/
+    uint32_t fallback_cnt;      /**< Number of allocations served by the heap*/
+    uint8_t used_pct;           /**< Percentage of the assigned pages used by blocks*/
+    lv_mem_slab_class_monitor_t classes[_LV_MEM_SLAB_CLASS_CNT];
+} lv_mem_slab_monitor_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -101,6 +167,83 @@ lv_res_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+/**
+ * Allocate a small block from the slab pools. Meant for fixed size objects which are
+ * allocated and freed often, e.g. list nodes. Falls back to the heap if no size class fits or the pools are full.
+ * @param size size of the memory to allocate in bytes
+ * @return pointer to the allocated memory. Free it with `lv_mem_free()`.
+ */
+void * lv_mem_slab_alloc(size_t size);
+
+/**
+ * Reallocate a memory with a new size. The old content will be kept.
+ * Unlike `lv_mem_realloc()` the new memory is taken from the slab pools if possible.
+ * @param data_p pointer to an allocated memory
+ * @param new_size the desired new size in byte
+ * @return pointer to the new memory, NULL on failure
+ */
+void * lv_mem_slab_realloc(void * data_p, size_t new_size);
+
+/**
+ * Give information about the usage of the slab pools
+ * @param mon_p pointer to a lv_mem_slab_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_slab_monitor(lv_mem_slab_monitor_t * mon_p);
+
+#if LV_USE_MEM_TELEMETRY
+
+/**
+ * Set the subsystem which owns the memory allocated from now on
+ * @param tag the new tag
+ * @return the previous tag, pass it to `lv_mem_set_tag()` to restore it
+ */
+lv_mem_tag_t lv_mem_set_tag(lv_mem_tag_t tag);
+
+/**
+ * Give information about the memory allocated by a subsystem
+ * @param tag the subsystem
+ * @param mon_p pointer to a lv_mem_tag_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_tag_monitor(lv_mem_tag_t tag, lv_mem_tag_monitor_t * mon_p);
+
+/**
+ * Get the histogram of the allocation sizes
+ * @param hist array of `_LV_MEM_SIZE_HISTOGRAM_BINS` elements to store the number of allocations in each bin
+ */
+void lv_mem_size_histogram(uint32_t * hist);
+
+/**
+ * Get the name of a tag
+ * @param tag the tag
+ * @return the name of the tag, e.g. "style"
+ */
+const char * lv_mem_tag_get_name(lv_mem_tag_t tag);
+
+/**
+ * Reset the counters, the max sizes and the histogram. The live sizes are kept.
+ */
+void lv_mem_telemetry_reset(void);
+
+/**
+ * Write the statistics of all tags and the size histogram as JSON
+ * @param buf the buffer to write to
+ * @param buf_size size of `buf`. The output is truncated if it's too small.
+ * @return length of the full JSON text without the terminating `'\0'`
+ */
+uint32_t lv_mem_telemetry_to_json(char * buf, uint32_t buf_size);
+
+#else
+
+static inline lv_mem_tag_t lv_mem_set_tag(lv_mem_tag_t tag)
+{
+    LV_UNUSED(tag);
+    return LV_MEM_TAG_OTHER;
+}
+
+#endif /*LV_USE_MEM_TELEMETRY*/
+
 /**
  * Get a temporal buffer with the given size.
  * @param size the required size
@@ -118,6 +261,38 @@ void lv_mem_buf_release(void * p);
  */
 void lv_mem_buf_free_all(void);
 
+/**
+ * Allocate scratch memory which is needed only until the end of the current display refresh.
+ * It's taken from the frame arena if there is enough space, else it's allocated with `lv_mem_alloc()`.
+ * @param size size of the memory to allocate in bytes
+ * @return pointer to the allocated memory
+ */
+void * lv_mem_frame_alloc(size_t size);
+
+/**
+ * Free a memory allocated by `lv_mem_frame_alloc()`.
+ * The arena gives back the memory right away if it's freed in reverse order of the allocations.
+ * @param data pointer to the memory to free
+ */
+void lv_mem_frame_free(void * data);
+
+/**
+ * Give information about the usage of the frame arena
+ * @param mon_p pointer to a lv_mem_frame_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_frame_monitor(lv_mem_frame_monitor_t * mon_p);
+
+/**
+ * Start using the frame arena. Called when a display refresh begins.
+ */
+void _lv_mem_frame_begin(void);
+
+/**
+ * Reset the frame arena. Called when a display refresh ends.
+ */
+void _lv_mem_frame_end(void);
+
 //! @cond Doxygen_Suppress
 
 #if LV_MEMCPY_MEMSET_STD
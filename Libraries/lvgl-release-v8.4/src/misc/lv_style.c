@@ -166,7 +166,7 @@ void lv_style_reset(lv_style_t * style)
 {
     LV_ASSERT_STYLE(style);
 
-    if(style->prop1 == LV_STYLE_PROP_ANY) {
+    if(_LV_STYLE_IS_CONST(style)) {
         LV_LOG_ERROR("Cannot reset const style");
         return;
     }
@@ -223,7 +223,7 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 {
     LV_ASSERT_STYLE(style);
 
-    if(style->prop1 == LV_STYLE_PROP_ANY) {
+    if(_LV_STYLE_IS_CONST(style)) {
         LV_LOG_ERROR("Cannot remove prop from const style");
         return false;
     }
@@ -282,12 +282,16 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 
 void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
 {
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_STYLE);
     lv_style_set_prop_internal(style, prop, value, lv_style_set_prop_helper);
+    lv_mem_set_tag(tag_prev);
 }
 
 void lv_style_set_prop_meta(lv_style_t * style, lv_style_prop_t prop, uint16_t meta)
 {
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_STYLE);
     lv_style_set_prop_internal(style, prop | meta, null_style_value, lv_style_set_prop_meta_helper);
+    lv_mem_set_tag(tag_prev);
 }
 
 lv_style_res_t lv_style_get_prop(const lv_style_t * style, lv_style_prop_t prop, lv_style_value_t * value)
@@ -417,7 +421,7 @@ static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_
 {
     LV_ASSERT_STYLE(style);
 
-    if(style->prop1 == LV_STYLE_PROP_ANY) {
+    if(_LV_STYLE_IS_CONST(style)) {
         LV_LOG_ERROR("Cannot set property of constant style");
         return;
     }
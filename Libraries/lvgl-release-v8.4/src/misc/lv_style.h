@@ -59,6 +59,15 @@ LV_EXPORT_CONST_INT(LV_IMG_ZOOM_NONE);
         .prop1 = LV_STYLE_PROP_ANY,                                     \
         .prop_cnt = (sizeof(prop_array) / sizeof((prop_array)[0])),     \
     }
+
+#define LV_STYLE_CONST_SORTED_INIT(var_name, prop_array)                \
+    const lv_style_t var_name = {                                       \
+        .sentinel = LV_STYLE_SENTINEL_VALUE,                            \
+        .v_p = { .const_props = prop_array },                           \
+        .has_group = 0xFF,                                              \
+        .prop1 = _LV_STYLE_PROP_CONST_SORTED,                           \
+        .prop_cnt = (sizeof(prop_array) / sizeof((prop_array)[0])),     \
+    }
 #else
 #define LV_STYLE_CONST_INIT(var_name, prop_array)                       \
     const lv_style_t var_name = {                                       \
@@ -67,9 +76,20 @@ LV_EXPORT_CONST_INT(LV_IMG_ZOOM_NONE);
         .prop1 = LV_STYLE_PROP_ANY,                                     \
         .prop_cnt = (sizeof(prop_array) / sizeof((prop_array)[0])),     \
     }
+
+#define LV_STYLE_CONST_SORTED_INIT(var_name, prop_array)                \
+    const lv_style_t var_name = {                                       \
+        .v_p = { .const_props = prop_array },                           \
+        .has_group = 0xFF,                                              \
+        .prop1 = _LV_STYLE_PROP_CONST_SORTED,                           \
+        .prop_cnt = (sizeof(prop_array) / sizeof((prop_array)[0])),     \
+    }
 #endif
 // *INDENT-ON*
 
+/*True for the styles created with `LV_STYLE_CONST_INIT` and `LV_STYLE_CONST_SORTED_INIT`*/
+#define _LV_STYLE_IS_CONST(style) ((style)->prop1 >= _LV_STYLE_PROP_CONST_SORTED)
+
 #define LV_STYLE_PROP_META_INHERIT 0x8000
 #define LV_STYLE_PROP_META_INITIAL 0x4000
 #define LV_STYLE_PROP_META_MASK (LV_STYLE_PROP_META_INHERIT | LV_STYLE_PROP_META_INITIAL)
@@ -281,7 +301,8 @@ typedef enum {
     _LV_STYLE_NUM_BUILT_IN_PROPS     = _LV_STYLE_LAST_BUILT_IN_PROP + 1,
 
     LV_STYLE_PROP_ANY                = 0xFFFF,
-    _LV_STYLE_PROP_CONST             = 0xFFFF /* magic value for const styles */
+    _LV_STYLE_PROP_CONST             = 0xFFFF, /* magic value for const styles */
+    _LV_STYLE_PROP_CONST_SORTED      = 0xFFFE  /* magic value for const styles sorted by property ID */
 } lv_style_prop_t;
 
 enum {
@@ -448,20 +469,38 @@ lv_style_value_t lv_style_prop_get_default(lv_style_prop_t prop);
 static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style, lv_style_prop_t prop,
                                                        lv_style_value_t * value)
 {
-    if(style->prop1 == LV_STYLE_PROP_ANY) {
-        const lv_style_const_prop_t * const_prop;
-        uint32_t i;
-        for(i = 0; i < style->prop_cnt; i++) {
-            const_prop = style->v_p.const_props + i;
-            lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(const_prop->prop);
-            if(prop_id == prop) {
-                if(const_prop->prop & LV_STYLE_PROP_META_INHERIT)
-                    return LV_STYLE_RES_INHERIT;
-                *value = (const_prop->prop & LV_STYLE_PROP_META_INITIAL) ? lv_style_prop_get_default(prop_id) : const_prop->value;
-                return LV_STYLE_RES_FOUND;
+    if(_LV_STYLE_IS_CONST(style)) {
+        const lv_style_const_prop_t * const_prop = NULL;
+        if(style->prop1 == _LV_STYLE_PROP_CONST_SORTED) {
+            /*Binary search in the properties sorted by ID*/
+            int32_t min = 0;
+            int32_t max = (int32_t)style->prop_cnt - 1;
+            while(min <= max) {
+                int32_t mid = (min + max) >> 1;
+                lv_style_prop_t mid_id = LV_STYLE_PROP_ID_MASK(style->v_p.const_props[mid].prop);
+                if(mid_id == prop) {
+                    const_prop = style->v_p.const_props + mid;
+                    break;
+                }
+                if(mid_id < prop) min = mid + 1;
+                else max = mid - 1;
             }
         }
-        return LV_STYLE_RES_NOT_FOUND;
+        else {
+            uint32_t i;
+            for(i = 0; i < style->prop_cnt; i++) {
+                if(LV_STYLE_PROP_ID_MASK(style->v_p.const_props[i].prop) == prop) {
+                    const_prop = style->v_p.const_props + i;
+                    break;
+                }
+            }
+        }
+
+        if(const_prop == NULL) return LV_STYLE_RES_NOT_FOUND;
+        if(const_prop->prop & LV_STYLE_PROP_META_INHERIT)
+            return LV_STYLE_RES_INHERIT;
+        *value = (const_prop->prop & LV_STYLE_PROP_META_INITIAL) ? lv_style_prop_get_default(prop) : const_prop->value;
+        return LV_STYLE_RES_FOUND;
     }
 
     if(style->prop_cnt == 0) return LV_STYLE_RES_NOT_FOUND;
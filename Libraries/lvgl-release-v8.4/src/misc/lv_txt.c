@@ -26,6 +26,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static uint32_t txt_hash(const char * txt, uint32_t * len);
 
 #if LV_TXT_ENC == LV_TXT_ENC_UTF8
     static uint8_t lv_txt_utf8_size(const char * str);
@@ -379,6 +380,178 @@ lv_coord_t lv_txt_get_width(const char * txt, uint32_t length, const lv_font_t *
     return width;
 }
 
+void _lv_txt_layout_init(lv_txt_layout_t * layout)
+{
+    lv_memset_00(layout, sizeof(lv_txt_layout_t));
+}
+
+bool _lv_txt_layout_update(lv_txt_layout_t * layout, const char * txt, const lv_font_t * font,
+                           lv_coord_t letter_space, lv_coord_t max_width, lv_text_flag_t flag)
+{
+    if(txt == NULL) return false;
+    if(font == NULL) return false;
+
+    /*The max width doesn't matter in these cases, use the same layout for all of them*/
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) {
+        max_width = LV_COORD_MAX;
+        flag = (flag & ~LV_TEXT_FLAG_EXPAND) | LV_TEXT_FLAG_FIT;
+    }
+
+    uint32_t len;
+    uint32_t hash = txt_hash(txt, &len);
+    if(layout->line_start != NULL && layout->txt_hash == hash && layout->txt_len == len && layout->font == font &&
+       layout->max_width == max_width && layout->letter_space == letter_space && layout->flag == flag) {
+        return true;
+    }
+
+    _lv_txt_layout_free(layout);
+
+    /*Find the line breaks*/
+    uint32_t line_cnt = 0;
+    uint32_t line_cap = 4;
+    uint32_t * line_start = lv_mem_alloc(line_cap * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(line_start);
+    if(line_start == NULL) return false;
+
+    uint32_t i = 0;
+    while(1) {
+        if(line_cnt + 1 > line_cap) {
+            line_cap *= 2;
+            uint32_t * new_line_start = lv_mem_realloc(line_start, line_cap * sizeof(uint32_t));
+            LV_ASSERT_MALLOC(new_line_start);
+            if(new_line_start == NULL) {
+                lv_mem_free(line_start);
+                return false;
+            }
+            line_start = new_line_start;
+        }
+        line_start[line_cnt] = i;
+        if(txt[i] == '\0') break;
+
+        i += _lv_txt_get_next_line(&txt[i], font, letter_space, max_width, NULL, flag);
+        line_cnt++;
+    }
+
+    lv_coord_t * line_width = lv_mem_alloc(LV_MAX(line_cnt, 1) * sizeof(lv_coord_t));
+    LV_ASSERT_MALLOC(line_width);
+    if(line_width == NULL) {
+        lv_mem_free(line_start);
+        return false;
+    }
+
+    layout->width = 0;
+    for(i = 0; i < line_cnt; i++) {
+        line_width[i] = lv_txt_get_width(&txt[line_start[i]], line_start[i + 1] - line_start[i], font, letter_space, flag);
+        layout->width = LV_MAX(layout->width, line_width[i]);
+    }
+
+    layout->txt_hash = hash;
+    layout->txt_len = len;
+    layout->font = font;
+    layout->max_width = max_width;
+    layout->letter_space = letter_space;
+    layout->flag = flag;
+    layout->newline_end = (len > 0 && (txt[len - 1] == '\n' || txt[len - 1] == '\r')) ? 1 : 0;
+    layout->line_cnt = line_cnt;
+    layout->line_start = line_start;
+    layout->line_width = line_width;
+
+    return true;
+}
+
+void _lv_txt_layout_free(lv_txt_layout_t * layout)
+{
+    lv_mem_free(layout->line_start);
+    lv_mem_free(layout->line_width);
+    lv_mem_free(layout->letter_x);
+    _lv_txt_layout_init(layout);
+}
+
+void _lv_txt_layout_get_size(const lv_txt_layout_t * layout, lv_coord_t line_space, lv_point_t * size_res)
+{
+    uint16_t letter_height = lv_font_get_line_height(layout->font);
+    uint32_t line_cnt = layout->line_cnt;
+    if(layout->line_cnt > 0 && layout->newline_end) line_cnt++;
+
+    size_res->x = layout->width;
+    size_res->y = 0;
+
+    /*Same as `lv_txt_get_size()` but without walking the text*/
+    uint32_t i;
+    for(i = 0; i < line_cnt; i++) {
+        if((unsigned long)size_res->y + (unsigned long)letter_height + (unsigned long)line_space > LV_MAX_OF(lv_coord_t)) {
+            LV_LOG_WARN("_lv_txt_layout_get_size: integer overflow while calculating text height");
+            return;
+        }
+        size_res->y += letter_height + line_space;
+    }
+
+    /*Correction with the last line space or set the height manually if the text is empty*/
+    if(size_res->y == 0)
+        size_res->y = letter_height;
+    else
+        size_res->y -= line_space;
+}
+
+uint32_t _lv_txt_layout_get_line(const lv_txt_layout_t * layout, uint32_t byte_id)
+{
+    if(layout->line_cnt == 0) return 0;
+
+    /*Find the first line ending after `byte_id`*/
+    uint32_t low = 0;
+    uint32_t high = layout->line_cnt - 1;
+    while(low < high) {
+        uint32_t mid = (low + high) / 2;
+        if(byte_id < layout->line_start[mid + 1]) high = mid;
+        else low = mid + 1;
+    }
+    return low;
+}
+
+const lv_coord_t * _lv_txt_layout_get_letter_x(lv_txt_layout_t * layout, const char * txt)
+{
+    if(layout->letter_x) return layout->letter_x;
+
+    layout->letter_cnt = _lv_txt_get_encoded_length(txt);
+    layout->letter_x = lv_mem_alloc((layout->letter_cnt + 1) * sizeof(lv_coord_t));
+    LV_ASSERT_MALLOC(layout->letter_x);
+    if(layout->letter_x == NULL) return NULL;
+
+    /*Walk the lines like `lv_txt_get_width()`*/
+    uint32_t letter_id = 0;
+    lv_coord_t width = 0;
+    uint32_t line;
+    for(line = 0; line < layout->line_cnt; line++) {
+        uint32_t i = layout->line_start[line];
+        uint32_t line_end = layout->line_start[line + 1];
+        lv_text_cmd_state_t cmd_state = LV_TEXT_CMD_STATE_WAIT;
+        width = 0;
+        while(i < line_end) {
+            layout->letter_x[letter_id] = width > 0 ? width - layout->letter_space : 0;
+            letter_id++;
+
+            uint32_t letter;
+            uint32_t letter_next;
+            _lv_txt_encoded_letter_next_2(txt, &letter, &letter_next, &i);
+
+            if((layout->flag & LV_TEXT_FLAG_RECOLOR) != 0) {
+                if(_lv_txt_is_cmd(&cmd_state, letter) != false) {
+                    continue;
+                }
+            }
+
+            lv_coord_t char_width = lv_font_get_glyph_width(layout->font, letter, letter_next);
+            if(char_width > 0) {
+                width += char_width;
+                width += layout->letter_space;
+            }
+        }
+    }
+    layout->letter_x[letter_id] = width > 0 ? width - layout->letter_space : 0;
+
+    return layout->letter_x;
+}
+
 bool _lv_txt_is_cmd(lv_text_cmd_state_t * state, uint32_t c)
 {
     bool ret = false;
@@ -496,6 +669,24 @@ void _lv_txt_encoded_letter_next_2(const char * txt, uint32_t * letter, uint32_t
     *letter_next = *letter != '\0' ? _lv_txt_encoded_next(&txt[*ofs], NULL) : 0;
 }
 
+/**
+ * FNV-1a hash of a text
+ * @param txt a '\0' terminated string
+ * @param len pointer to store the length of the text in bytes
+ * @return the hash
+ */
+static uint32_t txt_hash(const char * txt, uint32_t * len)
+{
+    uint32_t hash = 2166136261U;
+    uint32_t i;
+    for(i = 0; txt[i] != '\0'; i++) {
+        hash ^= (uint8_t)txt[i];
+        hash *= 16777619U;
+    }
+    *len = i;
+    return hash;
+}
+
 #if LV_TXT_ENC == LV_TXT_ENC_UTF8
 /*******************************
  *   UTF-8 ENCODER/DECODER
@@ -65,6 +65,26 @@ enum {
 };
 typedef uint8_t lv_text_align_t;
 
+/**
+ * Line breaks and line widths of a text.
+ * Computed once by `_lv_txt_layout_update()` and reused until the text, the font, the max width,
+ * the letter space or the flags change.*/
+typedef struct {
+    uint32_t txt_hash;          /**< Hash of the text the layout belongs to*/
+    uint32_t txt_len;           /**< Length of the text in bytes*/
+    const lv_font_t * font;
+    lv_coord_t max_width;
+    lv_coord_t letter_space;
+    lv_text_flag_t flag;
+    uint8_t newline_end : 1;    /**< 1: the text ends with a line break, so it has an empty last line*/
+    uint32_t line_cnt;
+    uint32_t * line_start;      /**< Byte index of the first character of each line, and the length of the text*/
+    lv_coord_t * line_width;    /**< Width of each line*/
+    lv_coord_t width;           /**< Width of the longest line*/
+    uint32_t letter_cnt;
+    lv_coord_t * letter_x;      /**< X coordinate of each letter and the end of the text in their line, NULL until needed*/
+} lv_txt_layout_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -112,6 +132,56 @@ uint32_t _lv_txt_get_next_line(const char * txt, const lv_font_t * font, lv_coor
 lv_coord_t lv_txt_get_width(const char * txt, uint32_t length, const lv_font_t * font, lv_coord_t letter_space,
                             lv_text_flag_t flag);
 
+/**
+ * Initialize an empty text layout
+ * @param layout pointer to a layout
+ */
+void _lv_txt_layout_init(lv_txt_layout_t * layout);
+
+/**
+ * Update a layout for a text. The line breaks are computed again only if the text or the parameters changed.
+ * @param layout pointer to an initialized layout
+ * @param txt a '\0' terminated string
+ * @param font pointer to a font
+ * @param letter_space letter space
+ * @param max_width max width of the text (break the lines to fit this size). Set COORD_MAX to avoid
+ * line breaks
+ * @param flag settings for the text from ::lv_text_flag_t
+ * @return true: the layout is valid for the text; false: out of memory or invalid parameters
+ */
+bool _lv_txt_layout_update(lv_txt_layout_t * layout, const char * txt, const lv_font_t * font,
+                           lv_coord_t letter_space, lv_coord_t max_width, lv_text_flag_t flag);
+
+/**
+ * Free the memory of a layout and make it empty
+ * @param layout pointer to a layout
+ */
+void _lv_txt_layout_free(lv_txt_layout_t * layout);
+
+/**
+ * Get the size of the text of a layout. Same as `lv_txt_get_size()`.
+ * @param layout pointer to a valid layout
+ * @param line_space line space of the text
+ * @param size_res pointer to a 'point_t' variable to store the result
+ */
+void _lv_txt_layout_get_size(const lv_txt_layout_t * layout, lv_coord_t line_space, lv_point_t * size_res);
+
+/**
+ * Get the line of a byte index
+ * @param layout pointer to a valid layout
+ * @param byte_id byte index in the text
+ * @return index of the line containing `byte_id`, the last line if `byte_id` is the end of the text
+ */
+uint32_t _lv_txt_layout_get_line(const lv_txt_layout_t * layout, uint32_t byte_id);
+
+/**
+ * Get the x coordinate of each letter in its line, the same as `lv_txt_get_width()` from the start of the line.
+ * @param layout pointer to a valid layout
+ * @param txt the text the layout was updated with
+ * @return array with an item for each letter and one for the end of the text or NULL if out of memory
+ */
+const lv_coord_t * _lv_txt_layout_get_letter_x(lv_txt_layout_t * layout, const char * txt);
+
 /**
  * Check next character in a string and decide if the character is part of the command or not
  * @param state pointer to a txt_cmd_state_t variable which stores the current state of command
@@ -41,6 +41,7 @@ const lv_obj_class_t lv_img_class = {
     .constructor_cb = lv_img_constructor,
     .destructor_cb = lv_img_destructor,
     .event_cb = lv_img_event,
+    .no_draw_hooks = 1,
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .instance_size = sizeof(lv_img_t),
@@ -540,19 +541,46 @@ static void draw_img(lv_event_t * e)
             return;
         }
 
-        if(img->angle != 0) {
+        if(img->angle != 0 || img->w == 0 || img->h == 0) {
             info->res = LV_COVER_RES_NOT_COVER;
             return;
         }
 
-        const lv_area_t * clip_area = lv_event_get_param(e);
+        if(lv_obj_get_style_opa(obj, LV_PART_MAIN) < LV_OPA_MAX ||
+           lv_obj_get_style_blend_mode(obj, LV_PART_MAIN) != LV_BLEND_MODE_NORMAL) {
+            info->res = LV_COVER_RES_NOT_COVER;
+            return;
+        }
+
+        /*The image is drawn only on the content area, the padding shows the background*/
+        lv_coord_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+        lv_coord_t pleft = lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + border_width;
+        lv_coord_t pright = lv_obj_get_style_pad_right(obj, LV_PART_MAIN) + border_width;
+        lv_coord_t ptop = lv_obj_get_style_pad_top(obj, LV_PART_MAIN) + border_width;
+        lv_coord_t pbottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN) + border_width;
+
+        const lv_area_t * clip_area = info->area;
         if(img->zoom == LV_IMG_ZOOM_NONE) {
-            if(_lv_area_is_in(clip_area, &obj->coords, 0) == false) {
+            /*The repeated image fills the whole content area*/
+            lv_area_t a;
+            a.x1 = obj->coords.x1 + pleft;
+            a.y1 = obj->coords.y1 + ptop;
+            a.x2 = obj->coords.x2 - pright;
+            a.y2 = obj->coords.y2 - pbottom;
+
+            if(_lv_area_is_in(clip_area, &a, 0) == false) {
                 info->res = LV_COVER_RES_NOT_COVER;
                 return;
             }
         }
         else {
+            /*The zoomed tiles of a repeated or shifted image might have gaps between them*/
+            if(pleft != 0 || pright != 0 || ptop != 0 || pbottom != 0 || img->offset.x != 0 || img->offset.y != 0 ||
+               lv_obj_get_width(obj) != img->w || lv_obj_get_height(obj) != img->h) {
+                info->res = LV_COVER_RES_NOT_COVER;
+                return;
+            }
+
             lv_area_t a;
             _lv_img_buf_get_transformed_area(&a, lv_obj_get_width(obj), lv_obj_get_height(obj), 0, img->zoom, &img->pivot);
             a.x1 += obj->coords.x1;
@@ -565,6 +593,9 @@ static void draw_img(lv_event_t * e)
                 return;
             }
         }
+
+        /*The opaque image covers the area even if the background is transparent*/
+        info->res = LV_COVER_RES_COVER;
     }
     else if(code == LV_EVENT_DRAW_MAIN || code == LV_EVENT_DRAW_POST) {
 
@@ -42,6 +42,14 @@ static void draw_main(lv_event_t * e);
 
 static void lv_label_refr_text(lv_obj_t * obj);
 static void lv_label_revert_dots(lv_obj_t * label);
+static void get_txt_size(lv_obj_t * obj, lv_point_t * size_res, const lv_font_t * font, lv_coord_t letter_space,
+                         lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag);
+#if LV_LABEL_LAYOUT_CACHE
+static const lv_txt_layout_t * get_layout(lv_obj_t * obj, const lv_font_t * font, lv_coord_t letter_space,
+                                          lv_coord_t max_width, lv_text_flag_t flag);
+static uint32_t get_line_on(const lv_txt_layout_t * layout, lv_coord_t y, lv_coord_t letter_height,
+                            lv_coord_t line_space);
+#endif
 
 static bool lv_label_set_dot_tmp(lv_obj_t * label, char * data, uint32_t len);
 static char * lv_label_get_dot_tmp(lv_obj_t * label);
@@ -56,6 +64,7 @@ const lv_obj_class_t lv_label_class = {
     .constructor_cb = lv_label_constructor,
     .destructor_cb = lv_label_destructor,
     .event_cb = lv_label_event,
+    .no_draw_hooks = 1,
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .instance_size = sizeof(lv_label_t),
@@ -87,11 +96,16 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_label_t * label = (lv_label_t *)obj;
 
-    lv_obj_invalidate(obj);
-
     /*If text is NULL then just refresh with the current text*/
     if(text == NULL) text = label->text;
 
+#if LV_LABEL_LAYOUT_CACHE
+    /*Nothing to do if the same text is set again, e.g. a periodically updated value*/
+    if(label->text != NULL && label->text != text && label->static_txt == 0 && strcmp(label->text, text) == 0) return;
+#endif
+
+    lv_obj_invalidate(obj);
+
     if(label->text == text && label->static_txt == 0) {
         /*If set its own text then reallocate it (maybe its size changed)*/
 #if LV_USE_ARABIC_PERSIAN_CHARS
@@ -149,24 +163,36 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     LV_ASSERT_NULL(fmt);
 
-    lv_obj_invalidate(obj);
     lv_label_t * label = (lv_label_t *)obj;
 
     /*If text is NULL then refresh*/
     if(fmt == NULL) {
+        lv_obj_invalidate(obj);
         lv_label_refr_text(obj);
         return;
     }
 
+    va_list args;
+    va_start(args, fmt);
+    char * text = _lv_txt_set_text_vfmt(fmt, args);
+    va_end(args);
+
+#if LV_LABEL_LAYOUT_CACHE
+    /*Nothing to do if the same text is set again, e.g. a periodically updated value*/
+    if(text != NULL && label->text != NULL && label->static_txt == 0 && strcmp(label->text, text) == 0) {
+        lv_mem_free(text);
+        return;
+    }
+#endif
+
+    lv_obj_invalidate(obj);
+
     if(label->text != NULL && label->static_txt == 0) {
         lv_mem_free(label->text);
         label->text = NULL;
     }
 
-    va_list args;
-    va_start(args, fmt);
-    label->text = _lv_txt_set_text_vfmt(fmt, args);
-    va_end(args);
+    label->text = text;
     label->static_txt = 0; /*Now the text is dynamically allocated*/
 
     lv_label_refr_text(obj);
@@ -327,14 +353,27 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
 
     uint32_t byte_id = _lv_txt_encoded_get_byte_id(txt, char_id);
 
-    /*Search the line of the index letter*/;
-    while(txt[new_line_start] != '\0') {
-        new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
-        if(byte_id < new_line_start || txt[new_line_start] == '\0')
-            break; /*The line of 'index' letter begins at 'line_start'*/
+#if LV_LABEL_LAYOUT_CACHE
+    lv_txt_layout_t * layout = (lv_txt_layout_t *)get_layout((lv_obj_t *)obj, font, letter_space, max_w, flag);
+    uint32_t line_id = 0;
+    if(layout) {
+        line_id = _lv_txt_layout_get_line(layout, byte_id);
+        line_start = layout->line_start[line_id];
+        new_line_start = layout->line_start[line_id + 1];
+        y = line_id * (letter_height + line_space);
+    }
+    else
+#endif
+    {
+        /*Search the line of the index letter*/;
+        while(txt[new_line_start] != '\0') {
+            new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+            if(byte_id < new_line_start || txt[new_line_start] == '\0')
+                break; /*The line of 'index' letter begins at 'line_start'*/
 
-        y += letter_height + line_space;
-        line_start = new_line_start;
+            y += letter_height + line_space;
+            line_start = new_line_start;
+        }
     }
 
     /*If the last character is line break then go to the next line*/
@@ -342,6 +381,9 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
         if((txt[byte_id - 1] == '\n' || txt[byte_id - 1] == '\r') && txt[byte_id] == '\0') {
             y += letter_height + line_space;
             line_start = byte_id;
+#if LV_LABEL_LAYOUT_CACHE
+            line_id = layout ? layout->line_cnt : 0; /*An empty line after the last one*/
+#endif
         }
     }
 
@@ -374,19 +416,31 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
 #endif
 
     /*Calculate the x coordinate*/
-    lv_coord_t x = lv_txt_get_width(bidi_txt, visual_byte_pos, font, letter_space, flag);
+    lv_coord_t x;
+    lv_coord_t line_w = 0;
+#if LV_LABEL_LAYOUT_CACHE && LV_USE_BIDI == 0
+    /*The letter positions are the same as in the text without Bidi*/
+    const lv_coord_t * letter_x = layout ? _lv_txt_layout_get_letter_x(layout, txt) : NULL;
+    if(letter_x && char_id <= layout->letter_cnt) {
+        x = line_id < layout->line_cnt ? letter_x[char_id] : 0;
+        if(align == LV_TEXT_ALIGN_CENTER || align == LV_TEXT_ALIGN_RIGHT) {
+            line_w = line_id < layout->line_cnt ? layout->line_width[line_id] : 0;
+        }
+    }
+    else
+#endif
+    {
+        x = lv_txt_get_width(bidi_txt, visual_byte_pos, font, letter_space, flag);
+        if(align == LV_TEXT_ALIGN_CENTER || align == LV_TEXT_ALIGN_RIGHT) {
+            line_w = lv_txt_get_width(bidi_txt, new_line_start - line_start, font, letter_space, flag);
+        }
+    }
     if(char_id != line_start) x += letter_space;
 
     if(align == LV_TEXT_ALIGN_CENTER) {
-        lv_coord_t line_w;
-        line_w = lv_txt_get_width(bidi_txt, new_line_start - line_start, font, letter_space, flag);
         x += lv_area_get_width(&txt_coords) / 2 - line_w / 2;
-
     }
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        lv_coord_t line_w;
-        line_w = lv_txt_get_width(bidi_txt, new_line_start - line_start, font, letter_space, flag);
-
         x += lv_area_get_width(&txt_coords) - line_w;
     }
     pos->x = x;
@@ -428,22 +482,43 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in)
 
     lv_text_align_t align = lv_obj_calculate_style_text_align(obj, LV_PART_MAIN, label->text);
 
-    /*Search the line of the index letter*/;
-    while(txt[line_start] != '\0') {
-        new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+#if LV_LABEL_LAYOUT_CACHE
+    const lv_txt_layout_t * layout = get_layout((lv_obj_t *)obj, font, letter_space, max_w, flag);
+    uint32_t line_id = 0;
+    bool line_found = false;
+    if(layout) {
+        line_id = get_line_on(layout, pos.y, letter_height, line_space);
+        line_found = line_id < layout->line_cnt;
+        line_start = line_found ? layout->line_start[line_id] : layout->txt_len;
+        new_line_start = line_found ? layout->line_start[line_id + 1] : layout->txt_len;
+    }
+    if(line_found) {
+        /*Include the NULL terminator in the last line*/
+        uint32_t tmp = new_line_start;
+        uint32_t letter;
+        letter = _lv_txt_encoded_prev(txt, &tmp);
+        if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
+    }
+    else if(layout == NULL)
+#endif
+    {
+        /*Search the line of the index letter*/;
+        while(txt[line_start] != '\0') {
+            new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+
+            if(pos.y <= y + letter_height) {
+                /*The line is found (stored in 'line_start')*/
+                /*Include the NULL terminator in the last line*/
+                uint32_t tmp = new_line_start;
+                uint32_t letter;
+                letter = _lv_txt_encoded_prev(txt, &tmp);
+                if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
+                break;
+            }
+            y += letter_height + line_space;
 
-        if(pos.y <= y + letter_height) {
-            /*The line is found (stored in 'line_start')*/
-            /*Include the NULL terminator in the last line*/
-            uint32_t tmp = new_line_start;
-            uint32_t letter;
-            letter = _lv_txt_encoded_prev(txt, &tmp);
-            if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
-            break;
+            line_start = new_line_start;
         }
-        y += letter_height + line_space;
-
-        line_start = new_line_start;
     }
 
 #if LV_USE_BIDI
@@ -457,14 +532,18 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in)
 
     /*Calculate the x coordinate*/
     lv_coord_t x = 0;
+    lv_coord_t line_w = 0;
+    if(align == LV_TEXT_ALIGN_CENTER || align == LV_TEXT_ALIGN_RIGHT) {
+#if LV_LABEL_LAYOUT_CACHE && LV_USE_BIDI == 0
+        if(layout) line_w = line_found ? layout->line_width[line_id] : 0;
+        else
+#endif
+            line_w = lv_txt_get_width(bidi_txt, new_line_start - line_start, font, letter_space, flag);
+    }
     if(align == LV_TEXT_ALIGN_CENTER) {
-        lv_coord_t line_w;
-        line_w = lv_txt_get_width(bidi_txt, new_line_start - line_start, font, letter_space, flag);
         x += lv_area_get_width(&txt_coords) / 2 - line_w / 2;
     }
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        lv_coord_t line_w;
-        line_w = lv_txt_get_width(bidi_txt, new_line_start - line_start, font, letter_space, flag);
         x += lv_area_get_width(&txt_coords) - line_w;
     }
 
@@ -546,27 +625,38 @@ bool lv_label_is_char_under_pos(const lv_obj_t * obj, lv_point_t * pos)
     if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
     if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
-    /*Search the line of the index letter*/;
-    while(txt[line_start] != '\0') {
-        new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+    lv_coord_t line_w = 0;
+#if LV_LABEL_LAYOUT_CACHE
+    const lv_txt_layout_t * layout = get_layout((lv_obj_t *)obj, font, letter_space, max_w, flag);
+    if(layout) {
+        uint32_t line_id = get_line_on(layout, pos->y, letter_height, line_space);
+        bool line_found = line_id < layout->line_cnt;
+        line_start = line_found ? layout->line_start[line_id] : layout->txt_len;
+        new_line_start = line_found ? layout->line_start[line_id + 1] : layout->txt_len;
+        line_w = line_found ? layout->line_width[line_id] : 0;
+    }
+    else
+#endif
+    {
+        /*Search the line of the index letter*/;
+        while(txt[line_start] != '\0') {
+            new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
 
-        if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
-        y += letter_height + line_space;
+            if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
+            y += letter_height + line_space;
 
-        line_start = new_line_start;
+            line_start = new_line_start;
+        }
+        line_w = lv_txt_get_width(&txt[line_start], new_line_start - line_start, font, letter_space, flag);
     }
 
     /*Calculate the x coordinate*/
     lv_coord_t x      = 0;
     lv_coord_t last_x = 0;
     if(align == LV_TEXT_ALIGN_CENTER) {
-        lv_coord_t line_w;
-        line_w = lv_txt_get_width(&txt[line_start], new_line_start - line_start, font, letter_space, flag);
         x += lv_area_get_width(&txt_coords) / 2 - line_w / 2;
     }
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        lv_coord_t line_w;
-        line_w = lv_txt_get_width(&txt[line_start], new_line_start - line_start, font, letter_space, flag);
         x += lv_area_get_width(&txt_coords) - line_w;
     }
 
@@ -710,6 +800,10 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->sel_start = LV_DRAW_LABEL_NO_TXT_SEL;
     label->sel_end   = LV_DRAW_LABEL_NO_TXT_SEL;
 #endif
+
+#if LV_LABEL_LAYOUT_CACHE
+    _lv_txt_layout_init(&label->layout);
+#endif
     label->dot.tmp_ptr   = NULL;
     label->dot_tmp_alloc = 0;
 
@@ -728,6 +822,10 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
     if(!label->static_txt) lv_mem_free(label->text);
     label->text = NULL;
+
+#if LV_LABEL_LAYOUT_CACHE
+    _lv_txt_layout_free(&label->layout);
+#endif
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -772,10 +870,13 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
         if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
 
         lv_coord_t w = lv_obj_get_content_width(obj);
-        if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) w = LV_COORD_MAX;
+        if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) {
+            w = LV_COORD_MAX;
+            flag |= LV_TEXT_FLAG_FIT;
+        }
         else w = lv_obj_get_content_width(obj);
 
-        lv_txt_get_size(&size, label->text, font, letter_space, line_space, w, flag);
+        get_txt_size(obj, &size, font, letter_space, line_space, w, flag);
 
         lv_point_t * self_size = lv_event_get_param(e);
         self_size->x = LV_MAX(self_size->x, size.x);
@@ -809,6 +910,10 @@ static void draw_main(lv_event_t * e)
     label_draw_dsc.flag = flag;
     lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_draw_dsc);
     lv_bidi_calculate_align(&label_draw_dsc.align, &label_draw_dsc.bidi_dir, label->text);
+#if LV_LABEL_LAYOUT_CACHE
+    label_draw_dsc.layout = get_layout(obj, label_draw_dsc.font, label_draw_dsc.letter_space,
+                                       lv_area_get_width(&txt_coords), label_draw_dsc.flag);
+#endif
 
     label_draw_dsc.sel_start = lv_label_get_text_selection_start(obj);
     label_draw_dsc.sel_end = lv_label_get_text_selection_end(obj);
@@ -822,8 +927,8 @@ static void draw_main(lv_event_t * e)
     if((label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) &&
        (label_draw_dsc.align == LV_TEXT_ALIGN_CENTER || label_draw_dsc.align == LV_TEXT_ALIGN_RIGHT)) {
         lv_point_t size;
-        lv_txt_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                        LV_COORD_MAX, flag);
+        get_txt_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                     LV_COORD_MAX, flag);
         if(size.x > lv_area_get_width(&txt_coords)) {
             label_draw_dsc.align = LV_TEXT_ALIGN_LEFT;
         }
@@ -862,8 +967,8 @@ static void draw_main(lv_event_t * e)
 
     if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
         lv_point_t size;
-        lv_txt_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                        LV_COORD_MAX, flag);
+        get_txt_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                     LV_COORD_MAX, flag);
 
         /*Draw the text again on label to the original to make a circular effect */
         if(size.x > lv_area_get_width(&txt_coords)) {
@@ -912,7 +1017,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
     if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
     if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
-    lv_txt_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    get_txt_size(obj, &size, font, letter_space, line_space, max_w, flag);
 
     lv_obj_refresh_self_size(obj);
 
@@ -1269,3 +1374,46 @@ static void set_ofs_y_anim(void * obj, int32_t v)
 }
 
 #endif
+
+static void get_txt_size(lv_obj_t * obj, lv_point_t * size_res, const lv_font_t * font, lv_coord_t letter_space,
+                         lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+#if LV_LABEL_LAYOUT_CACHE
+    const lv_txt_layout_t * layout = get_layout(obj, font, letter_space, max_width, flag);
+    if(layout) {
+        _lv_txt_layout_get_size(layout, line_space, size_res);
+        return;
+    }
+#endif
+    lv_txt_get_size(size_res, label->text, font, letter_space, line_space, max_width, flag);
+}
+
+#if LV_LABEL_LAYOUT_CACHE
+/**
+ * Get the layout of the label's text. The line breaks are computed again only if the text or the parameters changed.
+ * @return the layout or NULL if it couldn't be computed
+ */
+static const lv_txt_layout_t * get_layout(lv_obj_t * obj, const lv_font_t * font, lv_coord_t letter_space,
+                                          lv_coord_t max_width, lv_text_flag_t flag)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    if(!_lv_txt_layout_update(&label->layout, label->text, font, letter_space, max_width, flag)) return NULL;
+    return &label->layout;
+}
+
+/**
+ * Get the first line whose bottom is below a y coordinate, like the line search of the position queries
+ * @return index of the line or the number of lines if there is none
+ */
+static uint32_t get_line_on(const lv_txt_layout_t * layout, lv_coord_t y, lv_coord_t letter_height,
+                            lv_coord_t line_space)
+{
+    lv_coord_t line_pitch = letter_height + line_space;
+    if(y <= letter_height) return layout->line_cnt > 0 ? 0 : layout->line_cnt;
+    if(line_pitch <= 0) return layout->line_cnt;
+
+    uint32_t line_id = (y - letter_height + line_pitch - 1) / line_pitch;
+    return LV_MIN(line_id, layout->line_cnt);
+}
+#endif
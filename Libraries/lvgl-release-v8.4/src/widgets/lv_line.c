@@ -37,6 +37,7 @@ static void lv_line_event(const lv_obj_class_t * class_p, lv_event_t * e);
 const lv_obj_class_t lv_line_class = {
     .constructor_cb = lv_line_constructor,
     .event_cb = lv_line_event,
+    .no_draw_hooks = 1,
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .instance_size = sizeof(lv_line_t),
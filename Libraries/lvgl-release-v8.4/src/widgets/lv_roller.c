@@ -48,6 +48,7 @@ static void set_y_anim(void * obj, int32_t v);
 const lv_obj_class_t lv_roller_class = {
     .constructor_cb = lv_roller_constructor,
     .event_cb = lv_roller_event,
+    .no_draw_hooks = 1,
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_DPI_DEF,
     .instance_size = sizeof(lv_roller_t),
@@ -58,6 +59,7 @@ const lv_obj_class_t lv_roller_class = {
 
 const lv_obj_class_t lv_roller_label_class  = {
     .event_cb = lv_roller_label_event,
+    .no_draw_hooks = 1,
     .instance_size = sizeof(lv_label_t),
     .base_class = &lv_label_class
 };
@@ -36,6 +36,9 @@ void lv_test_assert_fail(void);
 uint32_t custom_tick_get(void);
 #define LV_TICK_CUSTOM_SYS_TIME_EXPR custom_tick_get()
 
+uint32_t custom_time_us_get(void);
+#define LV_REFR_PROFILER_TIME_GET custom_time_us_get()
+
 typedef void * lv_user_data_t;
 
 /**********************
@@ -92,6 +92,13 @@ uint32_t custom_tick_get(void)
     return time_ms;
 }
 
+uint32_t custom_time_us_get(void)
+{
+    struct timeval tv_now;
+    gettimeofday(&tv_now, NULL);
+    return (uint32_t)(tv_now.tv_sec * 1000000 + tv_now.tv_usec);
+}
+
 void lv_test_assert_fail(void)
 {
     TEST_FAIL();
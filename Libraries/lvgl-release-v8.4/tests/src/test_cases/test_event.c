@@ -23,4 +23,70 @@ void test_event_object_deletion(void)
     lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
 }
 
+static uint32_t draw_hook_cnt;
+
+static void draw_hook_event_cb(lv_event_t * e)
+{
+    if(lv_event_get_code(e) == LV_EVENT_DRAW_MAIN_BEGIN) draw_hook_cnt++;
+}
+
+static void draw_hook_class_event_cb(const lv_obj_class_t * cls, lv_event_t * e)
+{
+    LV_UNUSED(cls);
+    draw_hook_event_cb(e);
+    lv_obj_event_base(cls, e);
+}
+
+static const lv_obj_class_t draw_hook_class = {
+    .event_cb = draw_hook_class_event_cb,
+    .base_class = &lv_obj_class
+};
+
+void test_event_draw_hooks_are_sent_only_if_used(void)
+{
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_refr_now(NULL);
+
+#if LV_USE_EVENT_STATS
+    lv_event_reset_stats();
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_event_get_skip_cnt(LV_EVENT_DRAW_MAIN_BEGIN));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_event_get_dispatch_cnt(LV_EVENT_DRAW_MAIN_BEGIN));
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_event_get_dispatch_cnt(LV_EVENT_DRAW_MAIN));
+#endif
+
+    /*An event callback gets the hooks*/
+    draw_hook_cnt = 0;
+    lv_obj_add_event_cb(label, draw_hook_event_cb, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, draw_hook_cnt);
+
+    /*Not after it's removed*/
+    draw_hook_cnt = 0;
+    lv_obj_add_event_cb(label, draw_hook_event_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_remove_event_cb(label, draw_hook_event_cb);
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, draw_hook_cnt);
+
+    /*`LV_EVENT_ALL` gets everything*/
+    lv_obj_remove_event_cb(label, draw_hook_event_cb);
+    lv_obj_add_event_cb(label, draw_hook_event_cb, LV_EVENT_ALL, NULL);
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, draw_hook_cnt);
+
+    /*Classes get the hooks unless they tell they don't use them*/
+    draw_hook_cnt = 0;
+    lv_obj_t * obj = lv_obj_class_create_obj(&draw_hook_class, lv_scr_act());
+    lv_obj_class_init_obj(obj);
+    lv_obj_del(label);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, draw_hook_cnt);
+
+    lv_obj_del(obj);
+}
+
 #endif
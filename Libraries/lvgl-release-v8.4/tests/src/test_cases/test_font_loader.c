@@ -12,9 +12,12 @@
 
 #include "unity/unity.h"
 
+#include <stdio.h>
+
 /*********************
  *      DEFINES
  *********************/
+#define LOAD_CNT    50
 
 /**********************
  *      TYPEDEFS
@@ -25,7 +28,12 @@
  **********************/
 
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2);
+static void * convert_to_mapped(const char * path, uint32_t * size);
 void test_font_loader(void);
+void test_font_loader_mapped(void);
+void test_font_loader_mapped_file(void);
+void test_font_loader_mapped_corrupted(void);
+void test_font_loader_mapped_is_faster(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -72,6 +80,141 @@ void test_font_loader(void)
     lv_font_free(font_3_bin);
 }
 
+void test_font_loader_mapped(void)
+{
+    uint32_t size_1;
+    uint32_t size_2;
+    uint32_t size_3;
+    void * data_1 = convert_to_mapped("A:src/test_fonts/font_1.fnt", &size_1);
+    void * data_2 = convert_to_mapped("A:src/test_fonts/font_2.fnt", &size_2);
+    void * data_3 = convert_to_mapped("A:src/test_fonts/font_3.fnt", &size_3);
+
+    lv_font_t * font_1_mapped = lv_font_load_mapped(data_1, size_1);
+    lv_font_t * font_2_mapped = lv_font_load_mapped(data_2, size_2);
+    lv_font_t * font_3_mapped = lv_font_load_mapped(data_3, size_3);
+
+    compare_fonts(&font_1, font_1_mapped);
+    compare_fonts(&font_2, font_2_mapped);
+    compare_fonts(&font_3, font_3_mapped);
+
+    /*The tables are used in place*/
+    const lv_font_fmt_txt_dsc_t * dsc = font_1_mapped->dsc;
+    TEST_ASSERT_TRUE(dsc->glyph_bitmap > (uint8_t *)data_1);
+    TEST_ASSERT_TRUE(dsc->glyph_bitmap < (uint8_t *)data_1 + size_1);
+
+    lv_font_free(font_1_mapped);
+    lv_font_free(font_2_mapped);
+    lv_font_free(font_3_mapped);
+
+    lv_mem_free(data_1);
+    lv_mem_free(data_2);
+    lv_mem_free(data_3);
+
+    /*Not a mapped font*/
+    uint32_t not_mapped[16] = {0};
+    TEST_ASSERT_NULL(lv_font_load_mapped(not_mapped, sizeof(not_mapped)));
+}
+
+void test_font_loader_mapped_corrupted(void)
+{
+    uint32_t size;
+    uint32_t * data = convert_to_mapped("A:src/test_fonts/font_2.fnt", &size);
+
+    /*Truncated*/
+    TEST_ASSERT_NULL(lv_font_load_mapped(data, size - 4));
+    TEST_ASSERT_NULL(lv_font_load_mapped(data, 8));
+
+    /*Tables out of the font, the offsets of the bitmap, glyph dsc, cmaps and kerning are the 8th to 11th words*/
+    const uint32_t ofs_idx[] = {7, 8, 9, 10};
+    for(uint32_t i = 0; i < sizeof(ofs_idx) / sizeof(ofs_idx[0]); i++) {
+        uint32_t ofs = data[ofs_idx[i]];
+        data[ofs_idx[i]] = size - 4;
+        TEST_ASSERT_NULL(lv_font_load_mapped(data, size));
+        data[ofs_idx[i]] = ofs;
+    }
+
+    /*Unaligned table*/
+    data[9] += 2;
+    TEST_ASSERT_NULL(lv_font_load_mapped(data, size));
+    data[9] -= 2;
+
+    /*Bitmap out of the bitmap table, the glyph count and the bitmap size are the 12th and 13th words*/
+    uint32_t glyph_cnt = data[11];
+    lv_font_fmt_txt_glyph_dsc_t * glyph_dsc = (lv_font_fmt_txt_glyph_dsc_t *)((uint8_t *)data + data[8]);
+    uint32_t bitmap_index = glyph_dsc[glyph_cnt - 1].bitmap_index;
+    glyph_dsc[glyph_cnt - 1].bitmap_index = data[12] - 1;
+    TEST_ASSERT_NULL(lv_font_load_mapped(data, size));
+    glyph_dsc[glyph_cnt - 1].bitmap_index = bitmap_index;
+
+    /*Glyph IDs out of the glyph table, the glyph ID start of the first cmap is its 4th half word*/
+    data[11] = glyph_cnt - 1;
+    TEST_ASSERT_NULL(lv_font_load_mapped(data, size));
+    data[11] = glyph_cnt;
+
+    uint16_t * cmap_0 = (uint16_t *)((uint8_t *)data + data[9]);
+    cmap_0[3] += glyph_cnt;
+    TEST_ASSERT_NULL(lv_font_load_mapped(data, size));
+    cmap_0[3] -= glyph_cnt;
+
+    lv_font_t * font = lv_font_load_mapped(data, size);
+    TEST_ASSERT_NOT_NULL(font);
+    lv_font_free(font);
+
+    lv_mem_free(data);
+}
+
+void test_font_loader_mapped_file(void)
+{
+    /*`lv_font_load` recognizes the mapped fonts too*/
+    uint32_t size;
+    void * data = convert_to_mapped("A:src/test_fonts/font_2.fnt", &size);
+
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:/tmp/lv_test_font_2_mapped.fnt", LV_FS_MODE_WR));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, data, size, NULL));
+    lv_fs_close(&f);
+    lv_mem_free(data);
+
+    lv_font_t * font_2_bin = lv_font_load("A:/tmp/lv_test_font_2_mapped.fnt");
+    compare_fonts(&font_2, font_2_bin);
+    lv_font_free(font_2_bin);
+
+    remove("/tmp/lv_test_font_2_mapped.fnt");
+}
+
+void test_font_loader_mapped_is_faster(void)
+{
+    uint32_t size;
+    void * data = convert_to_mapped("A:src/test_fonts/font_1.fnt", &size);
+
+    uint32_t t = custom_tick_get();
+    for(int i = 0; i < LOAD_CNT; i++) {
+        lv_font_free(lv_font_load("B:src/test_fonts/font_1.fnt"));
+    }
+    uint32_t load_time = custom_tick_get() - t;
+
+    t = custom_tick_get();
+    for(int i = 0; i < LOAD_CNT; i++) {
+        lv_font_free(lv_font_load_mapped(data, size));
+    }
+    uint32_t load_mapped_time = custom_tick_get() - t;
+
+    LV_LOG_USER("Loading font_1 %d times: %d ms, mapped: %d ms", LOAD_CNT, (int)load_time, (int)load_mapped_time);
+    TEST_ASSERT_TRUE(load_mapped_time < load_time);
+
+    lv_mem_free(data);
+}
+
+static void * convert_to_mapped(const char * path, uint32_t * size)
+{
+    *size = lv_font_convert_to_mapped(path, NULL, 0);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, *size);
+
+    void * data = lv_mem_alloc(*size);
+    TEST_ASSERT_EQUAL_UINT32(*size, lv_font_convert_to_mapped(path, data, *size));
+    return data;
+}
+
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
 {
     TEST_ASSERT_NOT_NULL_MESSAGE(f1, "font not null");
@@ -49,4 +49,199 @@ void test_read(void)
     lv_fs_close(&fb);
 }
 
+#if LV_FS_BLOCK_CACHE_SIZE
+#define FONT_PATH   "src/test_fonts/font_1.fnt"
+#define FONT_SIZE   6876
+
+static uint8_t font_exp[FONT_SIZE];
+
+static void load_font_exp(void)
+{
+    FILE * f = fopen(FONT_PATH, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    TEST_ASSERT_EQUAL_UINT32(FONT_SIZE, fread(font_exp, 1, FONT_SIZE, f));
+    fclose(f);
+}
+
+/*Read the font in small chunks and return the number of reads of the driver*/
+static uint32_t read_small_chunks(void)
+{
+    lv_fs_reset_stats('B');
+
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "B:" FONT_PATH, LV_FS_MODE_RD));
+
+    uint8_t buf[13];
+    uint32_t cnt = 0;
+    uint32_t br = 1;
+    while(br) {
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &br));
+        TEST_ASSERT_TRUE(memcmp(buf, font_exp + cnt, br) == 0);
+        cnt += br;
+    }
+    TEST_ASSERT_EQUAL_UINT32(FONT_SIZE, cnt);
+    lv_fs_close(&f);
+
+    lv_fs_drv_stats_t stats;
+    lv_fs_get_stats('B', &stats);
+    TEST_ASSERT_EQUAL_UINT32(FONT_SIZE, stats.bytes_read);
+    return stats.read_cnt;
+}
+#endif
+
+void test_block_cache_reads_ahead(void)
+{
+#if LV_FS_BLOCK_CACHE_SIZE
+    load_font_exp();
+
+    lv_fs_drv_t * drv = lv_fs_get_drv('B');
+    drv->block_cache = false;
+    uint32_t uncached_cnt = read_small_chunks();
+    drv->block_cache = true;
+    uint32_t cached_cnt = read_small_chunks();
+
+    /*One read per chunk and one to find the end of the file*/
+    TEST_ASSERT_EQUAL_UINT32((FONT_SIZE + 12) / 13 + 1, uncached_cnt);
+    /*The sequential reads are read ahead*/
+    uint32_t read_ahead_size = LV_FS_BLOCK_CACHE_BLOCK_SIZE * LV_FS_BLOCK_CACHE_READ_AHEAD;
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(FONT_SIZE / read_ahead_size + 1, cached_cnt);
+
+    lv_fs_drv_stats_t stats;
+    lv_fs_get_stats('B', &stats);
+    TEST_ASSERT_EQUAL_UINT32((FONT_SIZE + read_ahead_size - 1) / read_ahead_size, stats.misses);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats.misses, stats.hits);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.seek_cnt);
+#endif
+}
+
+void test_block_cache_random_access(void)
+{
+#if LV_FS_BLOCK_CACHE_SIZE
+    load_font_exp();
+    lv_fs_reset_stats('B');
+
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "B:" FONT_PATH, LV_FS_MODE_RD));
+
+    uint8_t buf[1500];
+    uint32_t pos = 0;
+    uint32_t seed = 12345;
+    uint32_t i;
+    for(i = 0; i < 500; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint32_t r = seed >> 8;
+        switch(r % 4) {
+            case 0:
+                pos = r % (FONT_SIZE + 100);
+                TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, pos, LV_FS_SEEK_SET));
+                break;
+            case 1:
+                pos += r % 64;
+                TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, r % 64, LV_FS_SEEK_CUR));
+                break;
+            case 2:
+                /*Like the decoders getting the file size*/
+                TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, 0, LV_FS_SEEK_END));
+                TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_tell(&f, &pos));
+                TEST_ASSERT_EQUAL_UINT32(FONT_SIZE, pos);
+                pos -= r % 700;
+                TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, pos, LV_FS_SEEK_SET));
+                break;
+            default:
+                break;
+        }
+
+        uint32_t btr = (r >> 4) % 8 == 0 ? (r >> 8) % sizeof(buf) : (r >> 8) % 40;
+        uint32_t br;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, btr, &br));
+        uint32_t br_exp = pos < FONT_SIZE ? LV_MIN(btr, FONT_SIZE - pos) : 0;
+        TEST_ASSERT_EQUAL_UINT32(br_exp, br);
+        TEST_ASSERT_TRUE(memcmp(buf, font_exp + pos, br) == 0);
+        pos += br;
+
+        uint32_t tell;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_tell(&f, &tell));
+        TEST_ASSERT_EQUAL_UINT32(pos, tell);
+    }
+
+    lv_fs_close(&f);
+
+    /*Most of the small reads are found in the cache*/
+    lv_fs_drv_stats_t stats;
+    lv_fs_get_stats('B', &stats);
+    TEST_ASSERT_LESS_THAN_UINT32(stats.hits, stats.read_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(stats.hits, stats.seek_cnt);
+#endif
+}
+
+void test_block_cache_is_shared_by_files(void)
+{
+#if LV_FS_BLOCK_CACHE_SIZE
+    load_font_exp();
+
+    lv_fs_file_t f1;
+    lv_fs_file_t f2;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f1, "B:" FONT_PATH, LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f2, "B:src/test_files/readtest.txt", LV_FS_MODE_RD));
+
+    uint8_t buf[37];
+    uint32_t pos1 = 0;
+    uint32_t pos2 = 0;
+    uint32_t br = 1;
+    while(br) {
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f1, buf, sizeof(buf), &br));
+        TEST_ASSERT_TRUE(memcmp(buf, font_exp + pos1, br) == 0);
+        pos1 += br;
+
+        uint32_t br2;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f2, buf, sizeof(buf), &br2));
+        TEST_ASSERT_TRUE(memcmp(buf, read_exp + pos2, br2) == 0);
+        pos2 += br2;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(FONT_SIZE, pos1);
+    TEST_ASSERT_EQUAL_UINT32(strlen(read_exp) + 1, pos2);  /*The file ends with a '\0'*/
+
+    lv_fs_close(&f1);
+    lv_fs_close(&f2);
+#endif
+}
+
+void test_block_cache_write_drops_blocks(void)
+{
+#if LV_FS_BLOCK_CACHE_SIZE
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "B:/tmp/lv_test_block_cache.txt", LV_FS_MODE_WR | LV_FS_MODE_RD));
+
+    uint8_t data[LV_FS_BLOCK_CACHE_BLOCK_SIZE * 3];
+    uint32_t i;
+    for(i = 0; i < sizeof(data); i++) data[i] = (uint8_t)i;
+
+    uint32_t bw;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, data, sizeof(data), &bw));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(data), bw);
+
+    uint8_t buf[100];
+    uint32_t br;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, LV_FS_BLOCK_CACHE_BLOCK_SIZE - 50, LV_FS_SEEK_SET));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &br));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(buf), br);
+    TEST_ASSERT_TRUE(memcmp(buf, data + LV_FS_BLOCK_CACHE_BLOCK_SIZE - 50, br) == 0);
+
+    /*Overwrite the cached range*/
+    lv_memset(data + LV_FS_BLOCK_CACHE_BLOCK_SIZE - 10, 0xaa, 20);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, LV_FS_BLOCK_CACHE_BLOCK_SIZE - 10, LV_FS_SEEK_SET));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, data + LV_FS_BLOCK_CACHE_BLOCK_SIZE - 10, 20, &bw));
+    TEST_ASSERT_EQUAL_UINT32(20, bw);
+
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, LV_FS_BLOCK_CACHE_BLOCK_SIZE - 50, LV_FS_SEEK_SET));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &br));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(buf), br);
+    TEST_ASSERT_TRUE(memcmp(buf, data + LV_FS_BLOCK_CACHE_BLOCK_SIZE - 50, br) == 0);
+
+    lv_fs_close(&f);
+    remove("/tmp/lv_test_block_cache.txt");
+#endif
+}
+
 #endif
@@ -0,0 +1,84 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+LV_IMG_DECLARE(img_bulb_gif)
+
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * gif = NULL;
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    gif = lv_gif_create(active_screen);
+    lv_gif_set_src(gif, &img_bulb_gif);
+    lv_obj_center(gif);
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+/* Render the next frame without waiting for its delay and return the size of the invalidated areas */
+static uint32_t next_frame(bool in_coords)
+{
+    lv_gif_t * gifobj = (lv_gif_t *)gif;
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->inv_p = 0;
+
+    gifobj->last_call = lv_tick_get() - 60000;
+    gifobj->timer->timer_cb(gifobj->timer);
+
+    uint32_t size = 0;
+    uint16_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i]) continue;
+        if(in_coords) TEST_ASSERT_TRUE(_lv_area_is_in(&disp->inv_areas[i], &gif->coords, 0));
+        size += lv_area_get_size(&disp->inv_areas[i]);
+    }
+    return size;
+}
+
+void test_gif_uses_native_color_format_without_transparency(void)
+{
+    lv_gif_t * gifobj = (lv_gif_t *)gif;
+    TEST_ASSERT_EQUAL(gifobj->gif->has_alpha ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR,
+                      gifobj->imgdsc.header.cf);
+    /*The bulb never restores a frame to a transparent background*/
+    TEST_ASSERT_FALSE(gifobj->gif->has_alpha);
+    TEST_ASSERT_EQUAL_PTR(gifobj->gif->canvas + sizeof(lv_color_t) * 60 * 80, gifobj->gif->frame);
+}
+
+void test_gif_invalidates_only_the_changed_area(void)
+{
+    uint32_t full_size = lv_area_get_size(&gif->coords);
+    uint32_t total = 0;
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        uint32_t size = next_frame(true);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(full_size, size);
+        total += size;
+    }
+
+    /*The frames of the bulb change only a part of the image*/
+    TEST_ASSERT_LESS_THAN_UINT32(20 * full_size, total);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, total);
+}
+
+void test_gif_invalidates_everything_if_transformed(void)
+{
+    lv_img_set_zoom(gif, 512);
+    lv_refr_now(NULL);
+
+    lv_area_t coords;
+    lv_obj_get_coords(gif, &coords);
+    next_frame(false);
+    lv_disp_t * disp = lv_disp_get_default();
+    TEST_ASSERT_EQUAL_UINT16(1, disp->inv_p);
+    TEST_ASSERT_TRUE(_lv_area_is_in(&coords, &disp->inv_areas[0], 0));
+}
+
+#endif
@@ -0,0 +1,77 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * label = NULL;
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    label = lv_label_create(active_screen);
+    lv_obj_set_width(label, 100);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+void test_label_letter_pos_should_round_trip_through_letter_on(void)
+{
+    lv_label_set_text(label, "A label wrapped into several lines\nwith a new line");
+    lv_obj_update_layout(label);
+
+    const char * txt = lv_label_get_text(label);
+    uint32_t letter_cnt = _lv_txt_get_encoded_length(txt);
+    lv_coord_t prev_y = 0;
+    uint32_t i;
+    for(i = 0; i < letter_cnt; i++) {
+        lv_point_t pos;
+        lv_label_get_letter_pos(label, i, &pos);
+        TEST_ASSERT_GREATER_OR_EQUAL_INT16(prev_y, pos.y);
+        prev_y = pos.y;
+
+        if(txt[_lv_txt_encoded_get_byte_id(txt, i)] == '\n') continue;
+        /*Hit the middle of the letter's line*/
+        pos.y += lv_font_get_line_height(lv_obj_get_style_text_font(label, LV_PART_MAIN)) / 2;
+        TEST_ASSERT_EQUAL_UINT32(i, lv_label_get_letter_on(label, &pos));
+        TEST_ASSERT_TRUE(lv_label_is_char_under_pos(label, &pos));
+    }
+    TEST_ASSERT_GREATER_THAN_INT16(0, prev_y);
+}
+
+void test_label_letter_pos_should_handle_trailing_new_line(void)
+{
+    lv_label_set_text(label, "Line\n");
+    lv_obj_update_layout(label);
+
+    lv_point_t pos;
+    lv_label_get_letter_pos(label, 5, &pos);
+    TEST_ASSERT_EQUAL_INT16(0, pos.x);
+    TEST_ASSERT_EQUAL_INT16(lv_font_get_line_height(lv_obj_get_style_text_font(label, LV_PART_MAIN)) +
+                            lv_obj_get_style_text_line_space(label, LV_PART_MAIN), pos.y);
+}
+
+#if LV_LABEL_LAYOUT_CACHE
+void test_label_same_text_should_keep_the_layout(void)
+{
+    lv_label_set_text(label, "Some text to lay out");
+    lv_obj_update_layout(label);
+    const uint32_t * line_start = ((lv_label_t *)label)->layout.line_start;
+    TEST_ASSERT_NOT_NULL(line_start);
+
+    lv_label_set_text(label, "Some text to lay out");
+    lv_label_set_text_fmt(label, "Some text to %s", "lay out");
+    lv_obj_update_layout(label);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_PTR(line_start, ((lv_label_t *)label)->layout.line_start);
+
+    lv_label_set_text(label, "Some other text");
+    lv_obj_update_layout(label);
+    TEST_ASSERT_EQUAL_UINT32(strlen("Some other text"), ((lv_label_t *)label)->layout.txt_len);
+}
+#endif
+
+#endif
@@ -0,0 +1,196 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define TREE_DEPTH      4
+#define TREE_FANOUT     3
+#define LIST_ROW_CNT    50
+#define COORDS_MAX      256
+
+static lv_obj_t * active_screen = NULL;
+static uint32_t layout_cnt;
+static lv_area_t coords[COORDS_MAX];
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    layout_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+static void layout_changed_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    layout_cnt++;
+    (*cnt)++;
+}
+
+/* Nested flex containers sized to their content with fixed size leaves.
+ * The layout updates of the root are counted in `cnt[0]`, the ones of each branch in `cnt[1..]`*/
+static lv_obj_t * create_tree(lv_obj_t * parent, uint32_t depth, uint32_t * cnt)
+{
+    lv_obj_t * cont = lv_obj_create(parent);
+    lv_obj_set_size(cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(cont, depth % 2 ? LV_FLEX_FLOW_ROW : LV_FLEX_FLOW_COLUMN);
+    lv_obj_add_event_cb(cont, layout_changed_cb, LV_EVENT_LAYOUT_CHANGED, &cnt[0]);
+
+    uint32_t i;
+    for(i = 0; i < TREE_FANOUT; i++) {
+        if(depth > 1) {
+            create_tree(cont, depth - 1, depth == TREE_DEPTH ? &cnt[i + 1] : cnt);
+        }
+        else {
+            lv_obj_t * leaf = lv_obj_create(cont);
+            lv_obj_set_size(leaf, 20 + i * 5, 10);
+        }
+    }
+
+    return cont;
+}
+
+static void mark_all_as_dirty(lv_obj_t * obj)
+{
+    lv_obj_mark_layout_as_dirty(obj);
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        mark_all_as_dirty(lv_obj_get_child(obj, i));
+    }
+}
+
+static void save_coords(lv_obj_t * obj, uint32_t * idx)
+{
+    TEST_ASSERT_LESS_THAN(COORDS_MAX, *idx);
+    lv_obj_get_coords(obj, &coords[*idx]);
+    (*idx)++;
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        save_coords(lv_obj_get_child(obj, i), idx);
+    }
+}
+
+static void check_coords(lv_obj_t * obj, uint32_t * idx)
+{
+    lv_area_t a;
+    lv_obj_get_coords(obj, &a);
+    TEST_ASSERT_EQUAL_INT32(coords[*idx].x1, a.x1);
+    TEST_ASSERT_EQUAL_INT32(coords[*idx].y1, a.y1);
+    TEST_ASSERT_EQUAL_INT32(coords[*idx].x2, a.x2);
+    TEST_ASSERT_EQUAL_INT32(coords[*idx].y2, a.y2);
+    (*idx)++;
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        check_coords(lv_obj_get_child(obj, i), idx);
+    }
+}
+
+/* The incremental update has to give the same result as laying out everything again */
+static void check_full_layout(lv_obj_t * root)
+{
+    uint32_t idx = 0;
+    save_coords(root, &idx);
+
+    mark_all_as_dirty(root);
+    lv_obj_update_layout(root);
+
+    idx = 0;
+    check_coords(root, &idx);
+}
+
+void test_layout_changed_leaf_updates_only_its_ancestors(void)
+{
+    uint32_t cnt[TREE_FANOUT + 1] = {0};
+    lv_obj_t * root = create_tree(active_screen, TREE_DEPTH, cnt);
+    lv_obj_update_layout(root);
+
+    /*Resize a leaf in the last branch*/
+    lv_obj_t * cont = root;
+    uint32_t depth;
+    for(depth = 1; depth < TREE_DEPTH; depth++) cont = lv_obj_get_child(cont, TREE_FANOUT - 1);
+    lv_obj_t * leaf = lv_obj_get_child(cont, 0);
+
+    lv_memset_00(cnt, sizeof(cnt));
+    layout_cnt = 0;
+    lv_obj_set_width(leaf, 60);
+    lv_obj_update_layout(root);
+
+    TEST_ASSERT_EQUAL_INT32(60, lv_obj_get_width(leaf));
+    /*Only the containers on the path to the leaf are updated, the other branches are untouched*/
+    TEST_ASSERT_EQUAL_UINT32(0, cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(0, cnt[2]);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, cnt[3]);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, cnt[0]);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2 * TREE_DEPTH, layout_cnt);
+
+    check_full_layout(root);
+}
+
+void test_layout_resize_updates_children_depending_on_parent(void)
+{
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 200, 100);
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    lv_obj_set_style_border_width(cont, 0, 0);
+
+    lv_obj_t * fixed = lv_obj_create(cont);
+    lv_obj_set_size(fixed, 20, 20);
+    lv_obj_t * pct = lv_obj_create(cont);
+    lv_obj_set_size(pct, LV_PCT(50), 20);
+    lv_obj_t * centered = lv_obj_create(cont);
+    lv_obj_set_size(centered, 20, 20);
+    lv_obj_center(centered);
+    lv_obj_update_layout(cont);
+
+    lv_obj_set_width(cont, 300);
+    lv_obj_update_layout(cont);
+
+    TEST_ASSERT_EQUAL_INT32(cont->coords.x1, fixed->coords.x1);
+    TEST_ASSERT_EQUAL_INT32(150, lv_obj_get_width(pct));
+    TEST_ASSERT_EQUAL_INT32(140, lv_obj_get_x(centered));
+    check_full_layout(cont);
+
+    /*In RTL the right edge is kept so every child moves*/
+    lv_obj_set_style_base_dir(cont, LV_BASE_DIR_RTL, 0);
+    lv_obj_update_layout(cont);
+    lv_obj_set_width(cont, 250);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(cont->coords.x2, fixed->coords.x2);
+    check_full_layout(cont);
+}
+
+void test_layout_scrolling_a_list_needs_no_layout_update(void)
+{
+    uint32_t cnt = 0;
+    lv_obj_t * list = lv_obj_create(active_screen);
+    lv_obj_set_size(list, 200, 300);
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
+    lv_obj_add_event_cb(list, layout_changed_cb, LV_EVENT_LAYOUT_CHANGED, &cnt);
+
+    uint32_t i;
+    for(i = 0; i < LIST_ROW_CNT; i++) {
+        lv_obj_t * row = lv_obj_create(list);
+        lv_obj_set_size(row, LV_PCT(100), LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+        lv_obj_add_event_cb(row, layout_changed_cb, LV_EVENT_LAYOUT_CHANGED, &cnt);
+        lv_obj_t * label = lv_label_create(row);
+        lv_label_set_text_fmt(label, "Row %d", (int)i);
+    }
+    lv_obj_update_layout(list);
+
+    cnt = 0;
+    lv_obj_scroll_to_y(list, 400, LV_ANIM_OFF);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_EQUAL_UINT32(0, cnt);
+
+    /*Changing a row updates the row and the list only*/
+    lv_label_set_text(lv_obj_get_child(lv_obj_get_child(list, 10), 0), "A much longer row\nin two lines");
+    lv_obj_update_layout(list);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(4, cnt);
+    check_full_layout(list);
+}
+
+#endif
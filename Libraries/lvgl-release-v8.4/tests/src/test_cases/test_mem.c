@@ -23,4 +23,258 @@ void test_mem_buf_realloc(void)
 #endif
 }
 
+void test_mem_frame_arena_is_reset_after_refresh(void)
+{
+#if LV_MEM_FRAME_ARENA_SIZE
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 200, 100);
+    lv_obj_set_style_radius(obj, 20, 0);
+    lv_obj_set_style_opa(obj, LV_OPA_50, 0);
+    lv_obj_set_style_shadow_width(obj, 10, 0);
+    lv_refr_now(NULL);
+
+    lv_mem_frame_monitor_t mon;
+    lv_mem_frame_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(LV_MEM_FRAME_ARENA_SIZE, mon.total_size);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.used);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, mon.max_used);
+
+    /*Redrawing the same content fits into the arena again*/
+    uint32_t fallback_cnt = mon.fallback_cnt;
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    lv_mem_frame_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.used);
+    TEST_ASSERT_EQUAL_UINT32(fallback_cnt, mon.fallback_cnt);
+
+    /*Outside of a refresh the heap is used*/
+    void * p = lv_mem_frame_alloc(16);
+    lv_mem_frame_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.used);
+    lv_mem_frame_free(p);
+
+    lv_obj_del(obj);
+#endif
+}
+
+void test_mem_frame_arena_frees_in_reverse_order(void)
+{
+#if LV_MEM_FRAME_ARENA_SIZE
+    lv_mem_frame_monitor_t mon;
+    _lv_mem_frame_begin();
+
+    void * a = lv_mem_frame_alloc(10);
+    void * b = lv_mem_buf_get(100);
+    void * c = lv_mem_frame_alloc(30);
+    lv_mem_frame_monitor(&mon);
+    uint32_t used_all = mon.used;
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(140, used_all);
+
+    /*Not the last block, the space is kept*/
+    lv_mem_buf_release(b);
+    lv_mem_frame_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(used_all, mon.used);
+
+    /*The last block gives back the freed blocks below it too*/
+    lv_mem_frame_free(c);
+    lv_mem_frame_monitor(&mon);
+    TEST_ASSERT_LESS_THAN_UINT32(used_all, mon.used);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, mon.used);
+
+    lv_mem_frame_free(a);
+    lv_mem_frame_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.used);
+
+    /*Too large allocations are served by the heap*/
+    uint32_t fallback_cnt = mon.fallback_cnt;
+    void * large = lv_mem_frame_alloc(LV_MEM_FRAME_ARENA_SIZE);
+    TEST_ASSERT_NOT_NULL(large);
+    lv_mem_frame_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(fallback_cnt + 1, mon.fallback_cnt);
+    lv_mem_frame_free(large);
+
+    _lv_mem_frame_end();
+#endif
+}
+
+void test_mem_telemetry_counts_per_tag(void)
+{
+#if LV_USE_MEM_TELEMETRY
+    lv_mem_tag_monitor_t style_mon;
+    lv_mem_tag_monitor(LV_MEM_TAG_STYLE, &style_mon);
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+    lv_obj_set_style_radius(obj, 5, 0);
+
+    lv_mem_tag_monitor_t mon;
+    lv_mem_tag_monitor(LV_MEM_TAG_STYLE, &mon);
+    TEST_ASSERT_GREATER_THAN_UINT32(style_mon.live_size, mon.live_size);
+    TEST_ASSERT_GREATER_THAN_UINT32(style_mon.alloc_cnt, mon.alloc_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(mon.live_size, mon.max_live_size);
+
+    lv_mem_tag_monitor(LV_MEM_TAG_OBJ, &mon);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(sizeof(lv_obj_t), mon.live_size);
+
+    /*The tag is restored after the allocation*/
+    lv_mem_tag_t tag_prev = lv_mem_set_tag(LV_MEM_TAG_FONT);
+    lv_mem_tag_monitor(LV_MEM_TAG_FONT, &mon);
+    void * p = lv_mem_alloc(100);
+    p = lv_mem_realloc(p, 3000);
+    TEST_ASSERT_EQUAL(LV_MEM_TAG_FONT, lv_mem_set_tag(tag_prev));
+    lv_mem_tag_monitor_t font_mon;
+    lv_mem_tag_monitor(LV_MEM_TAG_FONT, &font_mon);
+    TEST_ASSERT_EQUAL_UINT32(mon.live_size + 3000, font_mon.live_size);
+    lv_mem_free(p);
+    lv_mem_tag_monitor(LV_MEM_TAG_FONT, &font_mon);
+    TEST_ASSERT_EQUAL_UINT32(mon.live_size, font_mon.live_size);
+    TEST_ASSERT_EQUAL_UINT32(mon.free_cnt + 2, font_mon.free_cnt);
+
+    /*Drawing allocates during the refresh only*/
+    lv_obj_del(obj);
+    lv_refr_now(NULL);
+    lv_mem_tag_monitor(LV_MEM_TAG_DRAW, &mon);
+    TEST_ASSERT_EQUAL_UINT32(mon.frame_alloc_cnt, mon.frame_free_cnt);
+
+    uint32_t hist[_LV_MEM_SIZE_HISTOGRAM_BINS];
+    lv_mem_size_histogram(hist);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, hist[0] + hist[1] + hist[2]);
+    TEST_ASSERT_EQUAL_STRING("style", lv_mem_tag_get_name(LV_MEM_TAG_STYLE));
+#endif
+}
+
+void test_mem_telemetry_to_json(void)
+{
+#if LV_USE_MEM_TELEMETRY
+    lv_mem_telemetry_reset();
+    lv_mem_free(lv_mem_alloc(20));
+
+    uint32_t len = lv_mem_telemetry_to_json(NULL, 0);
+    char * json = lv_mem_alloc(len + 1);
+    TEST_ASSERT_EQUAL_UINT32(len, lv_mem_telemetry_to_json(json, len + 1));
+    TEST_ASSERT_EQUAL_UINT32(len, strlen(json));
+    TEST_ASSERT_EQUAL_STRING_LEN("{\"tags\":{\"other\":{", json, 18);
+    TEST_ASSERT_NOT_NULL(strstr(json, "\"draw\":{"));
+    TEST_ASSERT_NOT_NULL(strstr(json, "\"size_histogram\":[{\"max_size\":8,\"cnt\":0},{\"max_size\":16,\"cnt\":0},"
+                                "{\"max_size\":32,\"cnt\":1}"));
+    TEST_ASSERT_EQUAL_STRING("]}", json + len - 2);
+
+    /*Truncated to the buffer*/
+    char small[16];
+    TEST_ASSERT_EQUAL_UINT32(len, lv_mem_telemetry_to_json(small, sizeof(small)));
+    TEST_ASSERT_EQUAL_STRING_LEN(json, small, sizeof(small) - 1);
+    TEST_ASSERT_EQUAL_CHAR('\0', small[sizeof(small) - 1]);
+    lv_mem_free(json);
+#endif
+}
+
+void test_mem_slab_alloc_free_realloc(void)
+{
+#if LV_MEM_SLAB_SIZE
+    lv_mem_slab_monitor_t mon_start;
+    lv_mem_slab_monitor(&mon_start);
+    TEST_ASSERT_EQUAL_UINT32(LV_MEM_SLAB_SIZE, mon_start.total_size);
+
+    uint8_t * a = lv_mem_slab_alloc(10);
+    uint8_t * b = lv_mem_slab_alloc(10);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_NOT_NULL(b);
+    lv_memset(a, 0x5a, 10);
+
+    lv_mem_slab_monitor_t mon;
+    lv_mem_slab_monitor(&mon);
+    uint32_t used_cnt = 0;
+    uint32_t used_cnt_start = 0;
+    uint32_t i;
+    for(i = 0; i < _LV_MEM_SLAB_CLASS_CNT; i++) {
+        used_cnt += mon.classes[i].used_cnt;
+        used_cnt_start += mon_start.classes[i].used_cnt;
+    }
+    TEST_ASSERT_EQUAL_UINT32(used_cnt_start + 2, used_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, mon.used_page_cnt);
+
+    /*Growing keeps the content*/
+    uint8_t * a_old = a;
+    a = lv_mem_slab_realloc(a, 200);
+    TEST_ASSERT_NOT_NULL(a);
+    for(i = 0; i < 10; i++) TEST_ASSERT_EQUAL_HEX8(0x5a, a[i]);
+    a[199] = 0x5a;
+
+    /*Freed blocks are reused*/
+    lv_mem_free(b);
+    uint8_t * c = lv_mem_slab_alloc(10);
+    TEST_ASSERT_TRUE(c == b || c == a_old);
+    lv_mem_free(c);
+
+    /*Too large for the size classes*/
+    void * large = lv_mem_slab_alloc(1000);
+    TEST_ASSERT_NOT_NULL(large);
+    lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.fallback_cnt + 1, mon.fallback_cnt);
+    lv_mem_free(large);
+
+    /*Moved to the heap by `lv_mem_realloc()`*/
+    a = lv_mem_realloc(a, 2000);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_EQUAL_HEX8(0x5a, a[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x5a, a[199]);
+    lv_mem_free(a);
+
+    lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.used_page_cnt, mon.used_page_cnt);
+#endif
+}
+
+void test_mem_slab_churn(void)
+{
+#if LV_MEM_SLAB_SIZE
+    lv_mem_slab_monitor_t mon_start;
+    lv_mem_slab_monitor(&mon_start);
+
+    /*Switch between screens with many objects, events and animations like a UI does*/
+    uint32_t round;
+    uint32_t max_used_page_cnt = 0;
+    for(round = 0; round < 20; round++) {
+        lv_obj_t * scr = lv_obj_create(NULL);
+        uint32_t i;
+        for(i = 0; i < 50; i++) {
+            lv_obj_t * btn = lv_btn_create(scr);
+            lv_obj_t * label = lv_label_create(btn);
+            lv_label_set_text(label, "Button");
+            lv_obj_add_event_cb(btn, NULL, LV_EVENT_CLICKED, NULL);
+            lv_obj_fade_in(btn, 100, i);
+        }
+        lv_scr_load_anim(scr, LV_SCR_LOAD_ANIM_NONE, 0, 0, true);
+        lv_refr_now(NULL);
+
+        lv_mem_slab_monitor_t mon;
+        lv_mem_slab_monitor(&mon);
+        if(round == 0) max_used_page_cnt = mon.max_used_page_cnt;
+    }
+
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_scr_load_anim(scr, LV_SCR_LOAD_ANIM_NONE, 0, 0, true);
+    lv_refr_now(NULL);
+    lv_anim_del_all();
+
+    lv_mem_slab_monitor_t mon;
+    lv_mem_slab_monitor(&mon);
+    /*The pages of the deleted screens are reused*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(max_used_page_cnt * 2, mon.max_used_page_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(mon_start.used_page_cnt + 1, mon.used_page_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, mon.classes[0].max_used_cnt + mon.classes[1].max_used_cnt +
+                                    mon.classes[2].max_used_cnt + mon.classes[3].max_used_cnt);
+
+    uint32_t used_cnt = 0;
+    uint32_t used_cnt_start = 0;
+    uint32_t i;
+    for(i = 0; i < _LV_MEM_SLAB_CLASS_CNT; i++) {
+        used_cnt += mon.classes[i].used_cnt;
+        used_cnt_start += mon_start.classes[i].used_cnt;
+    }
+    /*Only the new screen itself is left*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(used_cnt_start + 2, used_cnt);
+#endif
+}
+
 #endif
@@ -0,0 +1,230 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "../../src/extra/libs/png/lodepng.h"
+
+#define PNG_DIR "B:src/test_files/png/"
+
+#if LV_PNG_USE_STREAM
+static const char * png_files[] = {
+    "gray_1.png",
+    "gray_2_trns.png",
+    "gray_4.png",
+    "gray_16_trns.png",
+    "rgb_8_fixed.png",
+    "rgb_16_trns.png",
+    "palette_2_trns.png",
+    "palette_8.png",
+    "gray_alpha_8_stored.png",
+    "gray_alpha_16.png",
+    "rgba_8_chunks.png",
+    "rgba_16.png",
+};
+#endif
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+#if LV_PNG_USE_STREAM
+/*Decode the whole image with lodepng as a reference*/
+static uint8_t * decode_ref(const char * path, unsigned * w, unsigned * h)
+{
+    unsigned char * data;
+    size_t size;
+    TEST_ASSERT_EQUAL(0, lodepng_load_file(&data, &size, path));
+
+    uint8_t * rgba = NULL;
+    TEST_ASSERT_EQUAL(0, lodepng_decode32(&rgba, w, h, data, size));
+    lv_mem_free(data);
+    return rgba;
+}
+
+/*Compare a line read by the decoder with the reference RGBA pixels*/
+static void check_line(const uint8_t * line, const uint8_t * rgba, uint32_t len)
+{
+    uint32_t i;
+    for(i = 0; i < len; i++) {
+        lv_color_t c = lv_color_make(rgba[i * 4], rgba[i * 4 + 1], rgba[i * 4 + 2]);
+        const uint8_t * px = &line[i * LV_IMG_PX_SIZE_ALPHA_BYTE];
+        TEST_ASSERT_EQUAL_HEX32(c.full & 0xffffff, (px[0] | (px[1] << 8) | (px[2] << 16)));
+        TEST_ASSERT_EQUAL_HEX8(rgba[i * 4 + 3], px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1]);
+    }
+}
+#endif
+
+void test_png_stream_decodes_all_formats(void)
+{
+#if LV_PNG_USE_STREAM
+    uint32_t f;
+    for(f = 0; f < sizeof(png_files) / sizeof(png_files[0]); f++) {
+        char path[64];
+        lv_snprintf(path, sizeof(path), PNG_DIR "%s", png_files[f]);
+
+        unsigned w;
+        unsigned h;
+        uint8_t * rgba = decode_ref(path, &w, &h);
+
+        lv_img_decoder_dsc_t dsc;
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, path, lv_color_black(), 0));
+        TEST_ASSERT_NULL(dsc.img_data);
+        TEST_ASSERT_EQUAL_UINT32(w, dsc.header.w);
+
+        uint8_t line[64 * LV_IMG_PX_SIZE_ALPHA_BYTE];
+        uint32_t y;
+        for(y = 0; y < h; y++) {
+            TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, y, w, line));
+            check_line(line, &rgba[y * w * 4], w);
+        }
+
+        /*Parts of lines, bottom to top*/
+        for(y = h; y > 0; y--) {
+            TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 3, y - 1, w - 5, line));
+            check_line(line, &rgba[((y - 1) * w + 3) * 4], w - 5);
+        }
+
+        lv_img_decoder_close(&dsc);
+        lv_mem_free(rgba);
+    }
+#endif
+}
+
+void test_png_stream_decodes_variables(void)
+{
+#if LV_PNG_USE_STREAM
+    unsigned char * data;
+    size_t size;
+    TEST_ASSERT_EQUAL(0, lodepng_load_file(&data, &size, PNG_DIR "rgba_8_chunks.png"));
+
+    lv_img_dsc_t img_dsc;
+    lv_memset_00(&img_dsc, sizeof(img_dsc));
+    img_dsc.data = data;
+    img_dsc.data_size = size;
+
+    unsigned w;
+    unsigned h;
+    uint8_t * rgba = decode_ref(PNG_DIR "rgba_8_chunks.png", &w, &h);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, &img_dsc, lv_color_black(), 0));
+    TEST_ASSERT_NULL(dsc.img_data);
+
+    uint8_t line[64 * LV_IMG_PX_SIZE_ALPHA_BYTE];
+    uint32_t y;
+    for(y = 0; y < h; y++) {
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, y, w, line));
+        check_line(line, &rgba[y * w * 4], w);
+    }
+
+    lv_img_decoder_close(&dsc);
+    lv_mem_free(rgba);
+    lv_mem_free(data);
+#endif
+}
+
+void test_png_stream_falls_back_for_interlaced(void)
+{
+#if LV_PNG_USE_STREAM
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, PNG_DIR "interlaced.png", lv_color_black(), 0));
+    TEST_ASSERT_NOT_NULL(dsc.img_data);
+    lv_img_decoder_close(&dsc);
+#endif
+}
+
+void test_png_stream_uses_bounded_memory(void)
+{
+#if LV_PNG_USE_STREAM && LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, PNG_DIR "background.png", lv_color_black(), 0));
+    TEST_ASSERT_EQUAL_UINT32(466, dsc.header.w);
+
+    uint8_t * line = lv_mem_alloc(466 * LV_IMG_PX_SIZE_ALPHA_BYTE);
+    uint32_t y;
+    for(y = 0; y < 466; y++) {
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, y, 466, line));
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    uint32_t used = mon_start.free_size - mon.free_size;
+
+    /*The window, two rows and the bands instead of the whole image*/
+    uint32_t bands_size = LV_PNG_STREAM_BAND_CNT * LV_PNG_STREAM_BAND_HEIGHT * 466 * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    TEST_ASSERT_LESS_THAN_UINT32(bands_size + 48 * 1024, used);
+    TEST_ASSERT_LESS_THAN_UINT32(466 * 466 * LV_IMG_PX_SIZE_ALPHA_BYTE / 4, used);
+
+    lv_mem_free(line);
+    lv_img_decoder_close(&dsc);
+#endif
+}
+
+void test_png_stream_band_cache(void)
+{
+#if LV_PNG_USE_STREAM && LV_PNG_STREAM_BAND_CNT
+    /*The image fits into the bands*/
+    unsigned w;
+    unsigned h;
+    uint8_t * rgba = decode_ref(PNG_DIR "gray_alpha_8_stored.png", &w, &h);
+    TEST_ASSERT_LESS_OR_EQUAL(LV_PNG_STREAM_BAND_CNT * LV_PNG_STREAM_BAND_HEIGHT, h);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, PNG_DIR "gray_alpha_8_stored.png", lv_color_black(), 0));
+
+    uint8_t line[64 * LV_IMG_PX_SIZE_ALPHA_BYTE];
+    uint32_t y;
+    for(y = 0; y < h; y++) {
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, y, w, line));
+    }
+
+    /*Drawing it again doesn't read the file*/
+    lv_fs_reset_stats('B');
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        for(y = 0; y < h; y++) {
+            TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, y, w, line));
+            check_line(line, &rgba[y * w * 4], w);
+        }
+    }
+
+    lv_fs_drv_stats_t stats;
+    lv_fs_get_stats('B', &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.read_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.seek_cnt);
+
+    lv_img_decoder_close(&dsc);
+    lv_mem_free(rgba);
+#endif
+}
+
+void test_png_stream_draw(void)
+{
+#if LV_PNG_USE_STREAM
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, PNG_DIR "background.png");
+    lv_obj_center(img);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    /*The center of the screen is in the center of the image*/
+    lv_color_t c = lv_color_make(233 * 255 / 465, 233 * 255 / 465, (233 + 233) / 4);
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_color_t * buf = disp->driver->draw_buf->buf_act;
+    lv_color_t px = buf[disp->driver->hor_res * (disp->driver->ver_res / 2) + disp->driver->hor_res / 2];
+    TEST_ASSERT_EQUAL_HEX32(c.full & 0xffffff, px.full & 0xffffff);
+
+    lv_obj_del(img);
+#endif
+}
+
+#endif
@@ -0,0 +1,273 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * active_screen = NULL;
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+#if LV_REFR_OCCLUDER_CNT
+static uint32_t draw_main_cnt;
+static uint32_t draw_main_px_cnt;
+
+static void draw_main_event_cb(lv_event_t * e)
+{
+    lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+    draw_main_cnt++;
+    draw_main_px_cnt += lv_area_get_size(draw_ctx->clip_area);
+}
+
+static void refr_all(void)
+{
+    draw_main_cnt = 0;
+    draw_main_px_cnt = 0;
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(NULL);
+}
+
+static lv_obj_t * rect_create(lv_obj_t * parent, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                              uint32_t color)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(color), 0);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    return obj;
+}
+
+static lv_obj_t * covered_obj_create(void)
+{
+    lv_obj_t * obj = rect_create(active_screen, 100, 100, 200, 100, 0xff0000);
+    lv_obj_add_event_cb(obj, draw_main_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Covered");
+    lv_obj_add_event_cb(label, draw_main_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    return obj;
+}
+
+static uint32_t get_px(lv_coord_t x, lv_coord_t y)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_color_t * buf = disp->driver->draw_buf->buf_act;
+    return lv_color_to32(buf[y * lv_disp_get_hor_res(disp) + x]) & 0xffffff;
+}
+
+static uint32_t color_native(uint32_t c)
+{
+    return lv_color_to32(lv_color_hex(c)) & 0xffffff;
+}
+
+#define TILE_SIZE 20
+static lv_color_t tile_map[TILE_SIZE * TILE_SIZE];
+static lv_img_dsc_t tile_dsc = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.w = TILE_SIZE,
+    .header.h = TILE_SIZE,
+    .data_size = sizeof(tile_map),
+    .data = (const uint8_t *)tile_map,
+};
+
+static lv_obj_t * img_create(lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h, uint32_t color)
+{
+    uint32_t i;
+    for(i = 0; i < TILE_SIZE * TILE_SIZE; i++) tile_map[i] = lv_color_hex(color);
+
+    lv_obj_t * img = lv_img_create(active_screen);
+    lv_obj_remove_style_all(img);
+    lv_img_set_src(img, &tile_dsc);
+    lv_obj_set_pos(img, x, y);
+    lv_obj_set_size(img, w, h);
+    return img;
+}
+
+#if LV_USE_REFR_PROFILER
+static uint32_t refr_all_blend_px(void)
+{
+    lv_refr_prof_reset();
+    refr_all();
+    lv_refr_prof_stats_t stats;
+    lv_refr_prof_get_stats(LV_REFR_PROF_BLEND, &stats);
+    return stats.px_cnt;
+}
+#endif
+#endif
+
+void test_refr_occlusion_skips_the_covered_objects(void)
+{
+#if LV_REFR_OCCLUDER_CNT
+    covered_obj_create();
+    lv_obj_t * cover = rect_create(active_screen, 50, 50, 300, 200, 0x0000ff);
+
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(0, draw_main_cnt);
+    TEST_ASSERT_EQUAL_HEX32(color_native(0x0000ff), get_px(200, 150));
+
+    /*Drawn if the covering object is not opaque*/
+    lv_obj_set_style_bg_opa(cover, LV_OPA_50, 0);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+
+    lv_obj_set_style_bg_opa(cover, LV_OPA_COVER, 0);
+    lv_obj_set_style_opa(cover, LV_OPA_50, 0);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+
+    /*The opacity of the parent is applied on the children too*/
+    lv_obj_set_style_opa(cover, LV_OPA_COVER, 0);
+    lv_obj_t * parent = rect_create(active_screen, 0, 0, 400, 300, 0x00ff00);
+    lv_obj_set_style_bg_opa(parent, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_opa(parent, LV_OPA_50, 0);
+    lv_obj_set_parent(cover, parent);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+#endif
+}
+
+void test_refr_occlusion_clips_the_partially_covered_objects(void)
+{
+#if LV_REFR_OCCLUDER_CNT
+    covered_obj_create();
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+    uint32_t label_size = draw_main_px_cnt - 200 * 100;
+
+    /*Covers the bottom 60 rows of the object, the label is not covered*/
+    rect_create(active_screen, 0, 140, 800, 100, 0x0000ff);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+    TEST_ASSERT_EQUAL_UINT32(200 * 40 + label_size, draw_main_px_cnt);
+    TEST_ASSERT_EQUAL_HEX32(color_native(0xff0000), get_px(250, 139));
+    TEST_ASSERT_EQUAL_HEX32(color_native(0x0000ff), get_px(250, 140));
+
+    /*A middle part can't be removed from the clip area*/
+    lv_obj_t * cover = lv_obj_get_child(active_screen, 1);
+    lv_obj_set_pos(cover, 0, 130);
+    lv_obj_set_height(cover, 10);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+    TEST_ASSERT_EQUAL_UINT32(200 * 100 + label_size, draw_main_px_cnt);
+    TEST_ASSERT_EQUAL_HEX32(color_native(0x0000ff), get_px(250, 135));
+#endif
+}
+
+void test_refr_occlusion_with_rounded_and_nested_covers(void)
+{
+#if LV_REFR_OCCLUDER_CNT
+    covered_obj_create();
+
+    /*The middle of a rounded object is opaque too*/
+    lv_obj_t * cover = rect_create(active_screen, 40, 90, 320, 120, 0x0000ff);
+    lv_obj_set_style_radius(cover, 30, 0);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(0, draw_main_cnt);
+
+    /*Only the middle is opaque if the whole side is rounded*/
+    lv_obj_set_style_radius(cover, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_x(cover, 60);
+    lv_obj_set_width(cover, 280);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+
+    /*An opaque child of a transparent object covers too*/
+    lv_obj_set_style_radius(cover, 0, 0);
+    lv_obj_set_style_bg_opa(cover, LV_OPA_TRANSP, 0);
+    rect_create(cover, 0, 0, 280, 120, 0x00ff00);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(0, draw_main_cnt);
+    TEST_ASSERT_EQUAL_HEX32(color_native(0x00ff00), get_px(200, 150));
+
+    /*Not with clip corner as the children are masked*/
+    lv_obj_set_style_radius(cover, 10, 0);
+    lv_obj_set_style_clip_corner(cover, true, 0);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+#endif
+}
+
+void test_refr_occlusion_with_opaque_image(void)
+{
+#if LV_REFR_OCCLUDER_CNT
+    lv_obj_t * obj = covered_obj_create();
+
+    /*The tiles of the image cover the object even without background*/
+    lv_obj_t * img = img_create(50, 50, 300, 200, 0x0000ff);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(0, draw_main_cnt);
+    TEST_ASSERT_EQUAL_HEX32(color_native(0x0000ff), get_px(200, 150));
+
+#if LV_USE_REFR_PROFILER
+    /*Nothing is blended for the covered objects*/
+    uint32_t blend_px = refr_all_blend_px();
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    TEST_ASSERT_EQUAL_UINT32(refr_all_blend_px(), blend_px);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+#endif
+
+    /*The padding is not covered by the image*/
+    lv_obj_set_style_pad_left(img, 60, 0);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+    TEST_ASSERT_EQUAL_HEX32(color_native(0xff0000), get_px(105, 150));
+    TEST_ASSERT_EQUAL_HEX32(color_native(0x0000ff), get_px(110, 150));
+
+    /*Not covered by a semi-transparent image*/
+    lv_obj_set_style_pad_left(img, 0, 0);
+    lv_obj_set_style_img_opa(img, LV_OPA_50, 0);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+
+    /*Not covered if the zoomed image is repeated*/
+    lv_obj_set_style_img_opa(img, LV_OPA_COVER, 0);
+    lv_img_set_zoom(img, 512);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+#endif
+}
+
+void test_refr_occlusion_ignores_the_layers(void)
+{
+#if LV_REFR_OCCLUDER_CNT
+    lv_obj_t * obj = covered_obj_create();
+    lv_obj_t * cover = rect_create(active_screen, 50, 50, 300, 200, 0x0000ff);
+
+    /*A transformed object doesn't cover its original area*/
+    lv_obj_set_style_transform_angle(cover, 300, 0);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+
+    /*Objects on a layer are not culled by each other*/
+    lv_obj_set_style_transform_angle(cover, 0, 0);
+    lv_obj_t * layer = rect_create(active_screen, 0, 0, 400, 300, 0x00ff00);
+    lv_obj_set_style_opa(layer, LV_OPA_90, 0);
+    lv_obj_set_parent(obj, layer);
+    lv_obj_set_parent(cover, layer);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+
+    /*Without the opacity it's not a layer and can cover the objects below it*/
+    lv_obj_set_parent(obj, active_screen);
+    lv_obj_move_to_index(obj, 0);
+    lv_obj_set_style_opa(layer, LV_OPA_COVER, 0);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(0, draw_main_cnt);
+
+    /*Drawn again when the covering object is hidden*/
+    lv_obj_add_flag(layer, LV_OBJ_FLAG_HIDDEN);
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+    TEST_ASSERT_EQUAL_HEX32(color_native(0xff0000), get_px(110, 190));
+#endif
+}
+
+#endif
@@ -0,0 +1,182 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * active_screen = NULL;
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+#if LV_USE_REFR_PROFILER
+static char trace[64 * 1024];
+
+static void refr_all(void)
+{
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(NULL);
+}
+
+static lv_refr_prof_stats_t get_stats(lv_refr_prof_type_t type)
+{
+    lv_refr_prof_stats_t stats;
+    lv_refr_prof_get_stats(type, &stats);
+    return stats;
+}
+
+static const lv_refr_prof_obj_stats_t * find_obj(const lv_refr_prof_obj_stats_t * buf, uint32_t cnt,
+                                                 const lv_obj_t * obj)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(buf[i].obj == obj) return &buf[i];
+    }
+    return NULL;
+}
+#endif
+
+void test_refr_prof_counts_the_primitives(void)
+{
+#if LV_USE_REFR_PROFILER
+    lv_obj_t * label = lv_label_create(active_screen);
+    lv_label_set_text(label, "Hello");
+    lv_obj_update_layout(label);
+
+    lv_refr_prof_reset();
+    refr_all();
+
+    TEST_ASSERT_EQUAL_UINT32(1, get_stats(LV_REFR_PROF_FRAME).call_cnt);
+    TEST_ASSERT_EQUAL_UINT32(5, get_stats(LV_REFR_PROF_LETTER).call_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, get_stats(LV_REFR_PROF_RECT).call_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, get_stats(LV_REFR_PROF_ARC).call_cnt);
+
+    /*The whole display is blended at least once and all blending happens while drawing the objects*/
+    lv_refr_prof_stats_t frame = get_stats(LV_REFR_PROF_FRAME);
+    lv_refr_prof_stats_t obj = get_stats(LV_REFR_PROF_OBJ);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(800 * 480, frame.px_cnt);
+    TEST_ASSERT_EQUAL_UINT32(frame.px_cnt, get_stats(LV_REFR_PROF_BLEND).px_cnt);
+    TEST_ASSERT_EQUAL_UINT32(frame.px_cnt, obj.px_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(frame.time, obj.time);
+#endif
+}
+
+void test_refr_prof_attributes_to_the_objects(void)
+{
+#if LV_USE_REFR_PROFILER
+    lv_obj_t * obj = lv_obj_create(active_screen);
+    lv_obj_set_size(obj, 200, 100);
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Hi");
+
+    lv_refr_prof_reset();
+    refr_all();
+    refr_all();
+
+    lv_refr_prof_obj_stats_t buf[LV_REFR_PROFILER_OBJ_CNT];
+    uint32_t cnt = lv_refr_prof_get_obj_stats(buf, LV_REFR_PROFILER_OBJ_CNT);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(3, cnt);
+
+    const lv_refr_prof_obj_stats_t * s_scr = find_obj(buf, cnt, active_screen);
+    const lv_refr_prof_obj_stats_t * s_obj = find_obj(buf, cnt, obj);
+    const lv_refr_prof_obj_stats_t * s_label = find_obj(buf, cnt, label);
+    TEST_ASSERT_NOT_NULL(s_scr);
+    TEST_ASSERT_NOT_NULL(s_obj);
+    TEST_ASSERT_NOT_NULL(s_label);
+    TEST_ASSERT_EQUAL_PTR(&lv_label_class, s_label->class_p);
+    TEST_ASSERT_EQUAL_UINT32(2, s_obj->stats.call_cnt);
+
+    /*The children's pixels are not counted for the parents*/
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2 * 800 * 480, s_scr->stats.px_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(2 * 800 * 480 + 2 * 200 * 100, s_scr->stats.px_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2 * 200 * 100, s_obj->stats.px_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, s_label->stats.px_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(s_obj->stats.px_cnt, s_label->stats.px_cnt);
+
+    /*Sorted by time*/
+    uint32_t i;
+    for(i = 1; i < cnt; i++) {
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(buf[i].stats.time, buf[i - 1].stats.time);
+    }
+
+    /*Only the most expensive ones if the buffer is small*/
+    lv_refr_prof_obj_stats_t top;
+    TEST_ASSERT_EQUAL_UINT32(1, lv_refr_prof_get_obj_stats(&top, 1));
+    TEST_ASSERT_EQUAL_PTR(buf[0].obj, top.obj);
+#endif
+}
+
+void test_refr_prof_records_nested_events(void)
+{
+#if LV_USE_REFR_PROFILER
+    lv_obj_t * btn = lv_btn_create(active_screen);
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text(label, "Button");
+
+    lv_refr_prof_reset();
+    uint32_t i;
+    for(i = 0; i < 10; i++) refr_all();
+
+    /*The ring buffer keeps the last events*/
+    uint32_t cnt = lv_refr_prof_get_event_cnt();
+    TEST_ASSERT_EQUAL_UINT32(LV_REFR_PROFILER_EVENT_CNT, cnt);
+    TEST_ASSERT_NULL(lv_refr_prof_get_event(cnt));
+
+    /*The frame ends last and contains all the others*/
+    const lv_refr_prof_event_t * frame = lv_refr_prof_get_event(cnt - 1);
+    TEST_ASSERT_EQUAL(LV_REFR_PROF_FRAME, frame->type);
+    TEST_ASSERT_EQUAL_UINT8(0, frame->depth);
+
+    bool label_found = false;
+    for(i = cnt - 1; i > 0; i--) {
+        const lv_refr_prof_event_t * e = lv_refr_prof_get_event(i - 1);
+        if(e->type == LV_REFR_PROF_FRAME) break;
+        TEST_ASSERT_GREATER_THAN_UINT8(0, e->depth);
+        TEST_ASSERT_TRUE(e->start - frame->start <= frame->dur);
+        TEST_ASSERT_TRUE(e->start + e->dur - frame->start <= frame->dur);
+        if(e->obj == label) label_found = true;
+    }
+    TEST_ASSERT_TRUE(label_found);
+#endif
+}
+
+void test_refr_prof_exports_chrome_trace(void)
+{
+#if LV_USE_REFR_PROFILER
+    lv_obj_t * label = lv_label_create(active_screen);
+    lv_label_set_text(label, "Trace");
+
+    lv_refr_prof_reset();
+    TEST_ASSERT_EQUAL_UINT32(0, lv_refr_prof_get_event_cnt());
+    refr_all();
+
+    uint32_t len = lv_refr_prof_to_chrome_trace(NULL, 0);
+    TEST_ASSERT_LESS_THAN_UINT32(sizeof(trace), len);
+    TEST_ASSERT_EQUAL_UINT32(len, lv_refr_prof_to_chrome_trace(trace, sizeof(trace)));
+    TEST_ASSERT_EQUAL_UINT32(len, strlen(trace));
+
+    TEST_ASSERT_EQUAL_STRING_LEN("{\"traceEvents\":[{\"name\":\"", trace, 25);
+    TEST_ASSERT_EQUAL_STRING("],\"displayTimeUnit\":\"ms\"}", &trace[len - 25]);
+    TEST_ASSERT_NOT_NULL(strstr(trace, "\"name\":\"frame\",\"cat\":\"refr\",\"ph\":\"X\""));
+    TEST_ASSERT_NOT_NULL(strstr(trace, "\"name\":\"letter\",\"cat\":\"draw\""));
+
+    /*One JSON object per event*/
+    uint32_t obj_cnt = 0;
+    const char * p;
+    for(p = trace; (p = strstr(p, "\"ph\":\"X\"")) != NULL; p++) obj_cnt++;
+    TEST_ASSERT_EQUAL_UINT32(lv_refr_prof_get_event_cnt(), obj_cnt);
+
+    /*Truncated output*/
+    char small[32];
+    TEST_ASSERT_EQUAL_UINT32(len, lv_refr_prof_to_chrome_trace(small, sizeof(small)));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(small) - 1, strlen(small));
+#endif
+}
+
+#endif
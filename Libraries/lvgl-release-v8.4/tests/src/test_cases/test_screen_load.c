@@ -124,4 +124,166 @@ void test_screen_load_with_delete_event(void)
     TEST_ASSERT_EQUAL(lv_obj_is_valid(screen_with_anim_4), true);
 }
 
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+#define FB_SIZE (800 * 480)
+
+/*Blending a layer and an image with opacity can round differently*/
+#define FADE_TOLERANCE  2
+
+static lv_color_t fb_snapshot[FB_SIZE];
+static lv_color_t fb_normal[FB_SIZE];
+
+static lv_obj_t * create_screen(lv_color_t bg_color, const char * text)
+{
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, bg_color, 0);
+
+    lv_obj_t * obj = lv_obj_create(scr);
+    lv_obj_set_size(obj, 300, 200);
+    lv_obj_align(obj, LV_ALIGN_TOP_LEFT, 50, 50);
+
+    lv_obj_t * btn = lv_btn_create(scr);
+    lv_obj_align(btn, LV_ALIGN_BOTTOM_RIGHT, -50, -50);
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text(label, text);
+    return scr;
+}
+
+/*Redraw the whole display and copy the result*/
+static void render(lv_color_t * buf)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    TEST_ASSERT_EQUAL_UINT32(FB_SIZE, lv_disp_get_hor_res(disp) * lv_disp_get_ver_res(disp));
+    lv_obj_invalidate(lv_layer_top());
+    lv_refr_now(disp);
+    lv_memcpy(buf, disp->driver->draw_buf->buf_act, sizeof(fb_snapshot));
+}
+
+static bool is_on_child(lv_obj_t * scr, lv_coord_t x, lv_coord_t y)
+{
+    lv_point_t p = {x, y};
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(scr); i++) {
+        lv_obj_t * child = lv_obj_get_child(scr, i);
+        lv_area_t area;
+        lv_area_copy(&area, &child->coords);
+        lv_area_increase(&area, _lv_obj_get_ext_draw_size(child), _lv_obj_get_ext_draw_size(child));
+        if(_lv_area_is_point_on(&area, &p, 0)) return true;
+    }
+    return false;
+}
+
+/*Drawing the snapshots has to give the same result as drawing the screens.
+ *The children inherit the opacity of the screen so normally they are faded twice.
+ *The snapshots are faded only once so the children are skipped while fading.*/
+static void check_snapshots(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    bool fade = lv_obj_get_style_opa(disp->act_scr, 0) < LV_OPA_COVER ||
+                lv_obj_get_style_opa(disp->prev_scr, 0) < LV_OPA_COVER;
+#if LV_MEM_CUSTOM
+    TEST_ASSERT_NOT_NULL(disp->scr_snapshot_act);
+    TEST_ASSERT_NOT_NULL(disp->scr_snapshot_prev);
+#else
+    /*The test heap can't hold the snapshot of two 800x480 screens so the screens are drawn normally*/
+    TEST_ASSERT_NULL(disp->scr_snapshot_act);
+    TEST_ASSERT_NULL(disp->scr_snapshot_prev);
+#endif
+    render(fb_snapshot);
+
+    lv_img_dsc_t * snapshot_act = disp->scr_snapshot_act;
+    lv_img_dsc_t * snapshot_prev = disp->scr_snapshot_prev;
+    disp->scr_snapshot_act = NULL;
+    disp->scr_snapshot_prev = NULL;
+    render(fb_normal);
+    disp->scr_snapshot_act = snapshot_act;
+    disp->scr_snapshot_prev = snapshot_prev;
+
+    uint32_t i;
+    for(i = 0; i < FB_SIZE; i++) {
+        if(fb_snapshot[i].full == fb_normal[i].full) continue;
+        lv_coord_t x = i % 800;
+        lv_coord_t y = i / 800;
+        if(fade && (is_on_child(disp->act_scr, x, y) || is_on_child(disp->prev_scr, x, y))) continue;
+        uint32_t c_normal = lv_color_to32(fb_normal[i]);
+        uint32_t c_snapshot = lv_color_to32(fb_snapshot[i]);
+        uint32_t ch;
+        for(ch = 0; ch < 24; ch += 8) {
+            int32_t diff = (int32_t)((c_normal >> ch) & 0xff) - (int32_t)((c_snapshot >> ch) & 0xff);
+            TEST_ASSERT_LESS_OR_EQUAL_INT32(FADE_TOLERANCE, LV_ABS(diff));
+        }
+    }
+
+    /*The white containers of the screens are on each other so they stay white*/
+    if(fade && snapshot_act) {
+        TEST_ASSERT_EQUAL_HEX32(0xffffff, lv_color_to32(fb_snapshot[150 * 800 + 200]) & 0xffffff);
+    }
+}
+
+static void check_anim(lv_scr_load_anim_t anim_type)
+{
+    lv_obj_t * scr_old = create_screen(lv_palette_main(LV_PALETTE_RED), "Old");
+    lv_obj_t * scr_new = create_screen(lv_palette_main(LV_PALETTE_BLUE), "New");
+    lv_scr_load(scr_old);
+    lv_refr_now(NULL);
+
+    lv_scr_load_anim(scr_new, anim_type, 1000, 0, true);
+    lv_test_indev_wait(300);
+    check_snapshots();
+    lv_test_indev_wait(300);
+    check_snapshots();
+
+    /*The snapshots are freed at the end*/
+    lv_test_indev_wait(500);
+    lv_disp_t * disp = lv_disp_get_default();
+    TEST_ASSERT_EQUAL_PTR(scr_new, lv_scr_act());
+    TEST_ASSERT_NULL(disp->scr_snapshot_act);
+    TEST_ASSERT_NULL(disp->scr_snapshot_prev);
+    TEST_ASSERT_FALSE(lv_obj_is_valid(scr_old));
+}
+#endif
+
+void test_screen_load_anim_snapshot_fade(void)
+{
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+    check_anim(LV_SCR_LOAD_ANIM_FADE_IN);
+    check_anim(LV_SCR_LOAD_ANIM_FADE_OUT);
+#endif
+}
+
+void test_screen_load_anim_snapshot_move(void)
+{
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+    check_anim(LV_SCR_LOAD_ANIM_MOVE_LEFT);
+    check_anim(LV_SCR_LOAD_ANIM_OVER_BOTTOM);
+    check_anim(LV_SCR_LOAD_ANIM_OUT_RIGHT);
+#endif
+}
+
+void test_screen_load_anim_snapshot_interrupted(void)
+{
+#if LV_USE_SNAPSHOT && LV_SCR_LOAD_ANIM_SNAPSHOT
+    lv_obj_t * scr_1 = create_screen(lv_palette_main(LV_PALETTE_RED), "1");
+    lv_obj_t * scr_2 = create_screen(lv_palette_main(LV_PALETTE_GREEN), "2");
+    lv_obj_t * scr_3 = create_screen(lv_palette_main(LV_PALETTE_BLUE), "3");
+    lv_scr_load(scr_1);
+
+    lv_scr_load_anim(scr_2, LV_SCR_LOAD_ANIM_MOVE_TOP, 1000, 0, true);
+    lv_test_indev_wait(300);
+
+    /*The new animation replaces the snapshots*/
+    lv_scr_load_anim(scr_3, LV_SCR_LOAD_ANIM_FADE_IN, 1000, 0, true);
+    lv_test_indev_wait(300);
+    check_snapshots();
+
+    /*Deleting a screen drops the snapshots*/
+    lv_obj_del(scr_2);
+    lv_disp_t * disp = lv_disp_get_default();
+    TEST_ASSERT_NULL(disp->scr_snapshot_act);
+    TEST_ASSERT_NULL(disp->scr_snapshot_prev);
+    lv_test_indev_wait(800);
+    TEST_ASSERT_EQUAL_PTR(scr_3, lv_scr_act());
+#endif
+}
+
 #endif
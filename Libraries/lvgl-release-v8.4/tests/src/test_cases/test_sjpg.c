@@ -0,0 +1,247 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+/*320x240 px in 15 frames of 16 rows*/
+#define SJPG_PATH       "B:../examples/libs/sjpg/small_image.sjpg"
+#define SJPG_W          320
+#define SJPG_H          240
+#define SJPG_FRAME_H    16
+#define JPG_PATH        "B:src/test_files/jpg/photo.jpg"
+
+/*Samples of the reference decoder at every 8th pixel from (3;3) in RGB888*/
+#define SJPG_REF_PATH   "B:src/test_files/jpg/small_image.ref"
+#define JPG_REF_PATH    "B:src/test_files/jpg/photo.ref"
+#define REF_STEP        8
+#define REF_OFS         3
+
+/*The reference clips Y, Cb and Cr before the color conversion. The optimized decoders are more accurate
+ *so a few pixels can differ significantly. The lower color depths can round to the next value.*/
+#define REF_TOLERANCE       (LV_COLOR_DEPTH == 32 ? 1 : 8)
+#define REF_MAX_DIFF        16
+#define REF_MAX_DIFF_PCT    1   /*Max. ratio of the color channels differing more than REF_TOLERANCE*/
+
+static lv_obj_t * active_screen = NULL;
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+#if LV_USE_SJPG
+static lv_color_t line1[SJPG_W];
+static lv_color_t line2[SJPG_W];
+
+static void read_line(lv_img_decoder_dsc_t * dsc, lv_coord_t y, lv_color_t * buf)
+{
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(dsc, 0, y, SJPG_W, (uint8_t *)buf));
+}
+
+static uint32_t decode_cnt(void)
+{
+    lv_split_jpeg_stats_t stats;
+    lv_split_jpeg_get_stats(&stats);
+    return stats.decode_cnt;
+}
+
+static uint8_t * load_file(const char * path, uint32_t * size)
+{
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, path, LV_FS_MODE_RD));
+    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    lv_fs_tell(&f, size);
+    lv_fs_seek(&f, 0, LV_FS_SEEK_SET);
+    uint8_t * data = lv_mem_alloc(*size);
+    uint32_t rn;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, data, *size, &rn));
+    TEST_ASSERT_EQUAL_UINT32(*size, rn);
+    lv_fs_close(&f);
+    return data;
+}
+
+static void check_ref(const char * src, const char * ref_path)
+{
+    uint32_t ref_size;
+    uint8_t * ref = load_file(ref_path, &ref_size);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, src, lv_color_black(), 0));
+    lv_coord_t w = dsc.header.w;
+    lv_color_t * line = lv_mem_alloc(w * sizeof(lv_color_t));
+
+    uint32_t i = 0;
+    uint32_t diff_cnt = 0;
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = REF_OFS; y < dsc.header.h; y += REF_STEP) {
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, y, w, (uint8_t *)line));
+        for(x = REF_OFS; x < w; x += REF_STEP) {
+            TEST_ASSERT_LESS_THAN_UINT32(ref_size, i + 2);
+            /*Compare in the native color format to allow the rounding of the lower color depths*/
+            uint32_t c_ref = lv_color_to32(lv_color_make(ref[i], ref[i + 1], ref[i + 2]));
+            uint32_t c_act = lv_color_to32(line[x]);
+            uint32_t ch;
+            for(ch = 0; ch < 24; ch += 8) {
+                int32_t diff = (int32_t)((c_ref >> ch) & 0xff) - (int32_t)((c_act >> ch) & 0xff);
+                TEST_ASSERT_LESS_OR_EQUAL_INT32(REF_MAX_DIFF, LV_ABS(diff));
+                if(LV_ABS(diff) > REF_TOLERANCE) diff_cnt++;
+            }
+            i += 3;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(ref_size, i);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(ref_size * REF_MAX_DIFF_PCT / 100, diff_cnt);
+
+    lv_mem_free(line);
+    lv_img_decoder_close(&dsc);
+    lv_mem_free(ref);
+}
+#endif
+
+void test_sjpg_decodes_the_same_from_file_and_variable(void)
+{
+#if LV_USE_SJPG
+    uint32_t size;
+    uint8_t * data = load_file(SJPG_PATH, &size);
+
+    lv_img_dsc_t img_dsc;
+    lv_memset_00(&img_dsc, sizeof(img_dsc));
+    img_dsc.data = data;
+    img_dsc.data_size = size;
+
+    lv_img_decoder_dsc_t dsc_file;
+    lv_img_decoder_dsc_t dsc_var;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc_file, SJPG_PATH, lv_color_black(), 0));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc_var, &img_dsc, lv_color_black(), 0));
+    TEST_ASSERT_EQUAL_UINT32(SJPG_W, dsc_file.header.w);
+    TEST_ASSERT_EQUAL_UINT32(SJPG_H, dsc_file.header.h);
+
+    /*Bottom to top to jump between the frames*/
+    lv_coord_t y;
+    for(y = SJPG_H - 1; y >= 0; y--) {
+        read_line(&dsc_file, y, line1);
+        read_line(&dsc_var, y, line2);
+        TEST_ASSERT_TRUE(memcmp(line1, line2, sizeof(line1)) == 0);
+    }
+
+    /*A part of a line is the same as the whole line*/
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc_var, 100, 37, 50, (uint8_t *)line2));
+    read_line(&dsc_file, 37, line1);
+    TEST_ASSERT_TRUE(memcmp(&line1[100], line2, 50 * sizeof(lv_color_t)) == 0);
+
+    lv_img_decoder_close(&dsc_file);
+    lv_img_decoder_close(&dsc_var);
+    lv_mem_free(data);
+#endif
+}
+
+void test_sjpg_keeps_the_recently_used_frames(void)
+{
+#if LV_USE_SJPG && LV_SJPG_CACHE_FRAME_CNT >= 4
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, SJPG_PATH, lv_color_black(), 0));
+    lv_split_jpeg_reset_stats();
+
+    lv_coord_t y;
+    for(y = 0; y < 4 * SJPG_FRAME_H; y++) read_line(&dsc, y, line1);
+    TEST_ASSERT_EQUAL_UINT32(4, decode_cnt());
+
+    /*Frame 0 is the most recently used now and frame 3 the least*/
+    read_line(&dsc, 3 * SJPG_FRAME_H, line2);
+    for(y = 4 * SJPG_FRAME_H - 1; y >= 0; y--) read_line(&dsc, y, line1);
+    TEST_ASSERT_EQUAL_UINT32(4, decode_cnt());
+
+    lv_split_jpeg_stats_t stats;
+    lv_split_jpeg_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(4 * SJPG_FRAME_H * 2 + 1 - 4, stats.hit_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(stats.decode_time, stats.max_decode_time);
+
+    /*Frame 4 replaces frame 3 which is decoded again*/
+    read_line(&dsc, 4 * SJPG_FRAME_H, line1);
+    read_line(&dsc, 0, line1);
+    TEST_ASSERT_EQUAL_UINT32(5, decode_cnt());
+    read_line(&dsc, 3 * SJPG_FRAME_H, line1);
+    TEST_ASSERT_EQUAL_UINT32(6, decode_cnt());
+    TEST_ASSERT_TRUE(memcmp(line1, line2, sizeof(line1)) == 0);
+
+    lv_img_decoder_close(&dsc);
+#endif
+}
+
+void test_sjpg_decodes_only_the_visible_frames(void)
+{
+#if LV_USE_SJPG
+    lv_obj_t * img = lv_img_create(active_screen);
+    lv_img_set_src(img, SJPG_PATH);
+    lv_obj_set_pos(img, 0, -200);
+    lv_obj_update_layout(img);
+    TEST_ASSERT_EQUAL_INT32(-200, img->coords.y1);
+
+    lv_split_jpeg_reset_stats();
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(NULL);
+
+    /*Only the rows 200..239 are on the screen*/
+    TEST_ASSERT_EQUAL_UINT32(3, decode_cnt());
+
+    /*The drawn pixels are the decoded ones*/
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, SJPG_PATH, lv_color_black(), 0));
+    read_line(&dsc, 200, line1);
+    lv_img_decoder_close(&dsc);
+
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_color_t * buf = disp->driver->draw_buf->buf_act;
+    lv_coord_t x;
+    for(x = 0; x < SJPG_W; x += 10) {
+        TEST_ASSERT_EQUAL_HEX32(lv_color_to32(line1[x]) & 0xffffff, lv_color_to32(buf[x]) & 0xffffff);
+    }
+#endif
+}
+
+void test_sjpg_matches_the_reference_decoder(void)
+{
+#if LV_USE_SJPG
+    check_ref(SJPG_PATH, SJPG_REF_PATH);
+    check_ref(JPG_PATH, JPG_REF_PATH);
+#endif
+}
+
+/*Not a real test: print the decoding time of the images*/
+void test_sjpg_decode_benchmark(void)
+{
+#if LV_USE_SJPG
+    static const char * corpus[] = {SJPG_PATH, JPG_PATH};
+    uint32_t i;
+    for(i = 0; i < sizeof(corpus) / sizeof(corpus[0]); i++) {
+        lv_split_jpeg_reset_stats();
+        /*The LVGL tick is not running in the tests*/
+        uint32_t t_start = custom_tick_get();
+        uint32_t r;
+        for(r = 0; r < 20; r++) {
+            lv_img_decoder_dsc_t dsc;
+            TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, corpus[i], lv_color_black(), 0));
+            lv_coord_t y;
+            for(y = 0; y < dsc.header.h; y++) {
+                TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, y, 1, (uint8_t *)line1));
+            }
+            lv_img_decoder_close(&dsc);
+        }
+
+        lv_split_jpeg_stats_t stats;
+        lv_split_jpeg_get_stats(&stats);
+        char msg[128];
+        lv_snprintf(msg, sizeof(msg), "%s: %d us/image, %d frames/image", corpus[i],
+                    (int)((custom_tick_get() - t_start) * 1000 / r), (int)(stats.decode_cnt / r));
+        TEST_MESSAGE(msg);
+    }
+#endif
+}
+
+#endif
@@ -106,4 +106,71 @@ void test_inherit_meta_with_lower_precedence_style(void)
     TEST_ASSERT_EQUAL_HEX(lv_color_hex(0xff0000).full, lv_obj_get_style_text_color(grandchild, LV_PART_MAIN).full);
 }
 
+static const lv_style_const_prop_t sorted_props[] = {
+    LV_STYLE_CONST_WIDTH(100),
+    LV_STYLE_CONST_PAD_TOP(3),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x11, 0x22, 0x33)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_50),
+    {.prop = LV_STYLE_BORDER_COLOR | LV_STYLE_PROP_META_INHERIT},
+    {.prop = LV_STYLE_BORDER_WIDTH | LV_STYLE_PROP_META_INITIAL, .value = {.num = 10}},
+    LV_STYLE_CONST_TEXT_FONT(LV_FONT_DEFAULT),
+};
+static LV_STYLE_CONST_SORTED_INIT(sorted_style, sorted_props);
+static LV_STYLE_CONST_INIT(unsorted_style, sorted_props);
+
+void test_const_sorted_style_get_prop(void)
+{
+    lv_style_value_t v;
+    lv_style_value_t v_unsorted;
+    lv_style_prop_t prop;
+    for(prop = 1; prop < _LV_STYLE_NUM_BUILT_IN_PROPS; prop++) {
+        lv_style_res_t res = lv_style_get_prop(&sorted_style, prop, &v);
+        TEST_ASSERT_EQUAL(lv_style_get_prop(&unsorted_style, prop, &v_unsorted), res);
+        if(res == LV_STYLE_RES_FOUND) TEST_ASSERT_EQUAL_MEMORY(&v_unsorted, &v, sizeof(v));
+    }
+
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&sorted_style, LV_STYLE_X, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&sorted_style, LV_STYLE_BG_GRAD_COLOR, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&sorted_style, LV_STYLE_TRANSFORM_PIVOT_Y, &v));
+
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&sorted_style, LV_STYLE_WIDTH, &v));
+    TEST_ASSERT_EQUAL(100, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&sorted_style, LV_STYLE_TEXT_FONT, &v));
+    TEST_ASSERT_EQUAL_PTR(LV_FONT_DEFAULT, v.ptr);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_INHERIT, lv_style_get_prop(&sorted_style, LV_STYLE_BORDER_COLOR, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&sorted_style, LV_STYLE_BORDER_WIDTH, &v));
+    TEST_ASSERT_EQUAL(lv_style_prop_get_default(LV_STYLE_BORDER_WIDTH).num, v.num);
+}
+
+void test_const_sorted_style_is_read_only(void)
+{
+    lv_style_t * style = (lv_style_t *)&sorted_style;
+    lv_style_set_height(style, 10);
+    TEST_ASSERT_FALSE(lv_style_remove_prop(style, LV_STYLE_WIDTH));
+    lv_style_reset(style);
+
+    lv_style_value_t v;
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&sorted_style, LV_STYLE_HEIGHT, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&sorted_style, LV_STYLE_WIDTH, &v));
+}
+
+void test_const_sorted_style_on_object(void)
+{
+    lv_obj_t * obj_local = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_width(obj_local, 100, LV_PART_MAIN);
+    lv_obj_set_style_pad_top(obj_local, 3, LV_PART_MAIN);
+    lv_obj_set_style_bg_color(obj_local, lv_color_hex(0x112233), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(obj_local, LV_OPA_50, LV_PART_MAIN);
+
+    lv_obj_t * obj_const = lv_obj_create(lv_scr_act());
+    lv_obj_add_style(obj_const, (lv_style_t *)&sorted_style, LV_PART_MAIN);
+    lv_obj_update_layout(lv_scr_act());
+
+    TEST_ASSERT_EQUAL(lv_obj_get_width(obj_local), lv_obj_get_width(obj_const));
+    TEST_ASSERT_EQUAL(lv_obj_get_style_pad_top(obj_local, LV_PART_MAIN), lv_obj_get_style_pad_top(obj_const, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_HEX(lv_obj_get_style_bg_color(obj_local, LV_PART_MAIN).full,
+                          lv_obj_get_style_bg_color(obj_const, LV_PART_MAIN).full);
+    TEST_ASSERT_EQUAL(lv_obj_get_style_bg_opa(obj_local, LV_PART_MAIN), lv_obj_get_style_bg_opa(obj_const, LV_PART_MAIN));
+}
+
 #endif
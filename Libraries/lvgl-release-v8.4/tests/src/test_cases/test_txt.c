@@ -204,4 +204,66 @@ void test_txt_next_line_should_handle_empty_string(void)
     TEST_ASSERT_EQUAL_UINT32(0, next_line);
 }
 
+#if LV_LABEL_LAYOUT_CACHE
+void test_txt_layout_should_match_txt_get_size(void)
+{
+    static const char * txts[] = {"", "Hello", "Hello\n", "\n\n", "A longer text which is wrapped into lines",
+                                  "Two\nlines and a trailing newline\n", "Long_word_without_break_points_at_all"
+                                 };
+    static const lv_coord_t widths[] = {20, 60, 150, LV_COORD_MAX};
+    static const lv_text_flag_t flags[] = {LV_TEXT_FLAG_NONE, LV_TEXT_FLAG_RECOLOR, LV_TEXT_FLAG_EXPAND};
+    const lv_font_t * font = &lv_font_montserrat_14;
+    lv_txt_layout_t layout;
+    _lv_txt_layout_init(&layout);
+
+    uint32_t t, w, f;
+    for(t = 0; t < sizeof(txts) / sizeof(txts[0]); t++) {
+        for(w = 0; w < sizeof(widths) / sizeof(widths[0]); w++) {
+            for(f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+                lv_point_t expected;
+                lv_point_t size;
+                lv_txt_get_size(&expected, txts[t], font, 2, 3, widths[w], flags[f]);
+                TEST_ASSERT_TRUE(_lv_txt_layout_update(&layout, txts[t], font, 2, widths[w], flags[f]));
+                _lv_txt_layout_get_size(&layout, 3, &size);
+                TEST_ASSERT_EQUAL_INT16(expected.x, size.x);
+                TEST_ASSERT_EQUAL_INT16(expected.y, size.y);
+            }
+        }
+    }
+
+    _lv_txt_layout_free(&layout);
+}
+
+void test_txt_layout_letter_x_should_match_txt_get_width(void)
+{
+    const char * txt = "Wrapped text with \xc3\xa1" "ccents\nand a new line";
+    const lv_font_t * font = &lv_font_montserrat_14;
+    lv_txt_layout_t layout;
+    _lv_txt_layout_init(&layout);
+    TEST_ASSERT_TRUE(_lv_txt_layout_update(&layout, txt, font, 1, 80, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_GREATER_THAN_UINT32(2, layout.line_cnt);
+
+    const lv_coord_t * letter_x = _lv_txt_layout_get_letter_x(&layout, txt);
+    TEST_ASSERT_NOT_NULL(letter_x);
+    TEST_ASSERT_EQUAL_UINT32(_lv_txt_get_encoded_length(txt), layout.letter_cnt);
+
+    uint32_t char_id;
+    for(char_id = 0; char_id <= layout.letter_cnt; char_id++) {
+        uint32_t byte_id = _lv_txt_encoded_get_byte_id(txt, char_id);
+        uint32_t line = _lv_txt_layout_get_line(&layout, byte_id);
+        uint32_t line_start = layout.line_start[line];
+        TEST_ASSERT_EQUAL_INT16(lv_txt_get_width(&txt[line_start], byte_id - line_start, font, 1, LV_TEXT_FLAG_NONE),
+                                letter_x[char_id]);
+    }
+
+    /*The same parameters keep the layout*/
+    const uint32_t * line_start = layout.line_start;
+    TEST_ASSERT_TRUE(_lv_txt_layout_update(&layout, txt, font, 1, 80, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_EQUAL_PTR(line_start, layout.line_start);
+    TEST_ASSERT_EQUAL_PTR(letter_x, layout.letter_x);
+
+    _lv_txt_layout_free(&layout);
+}
+#endif
+
 #endif
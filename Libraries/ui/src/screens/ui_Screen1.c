@@ -5,6 +5,26 @@
 
 #include "../ui.h"
 
+/*Constant styles generated by style_sheet_gen.py. Do not edit.*/
+static const lv_style_const_prop_t style_ui_Button4_main_default_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xE6, 0x45, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BG_IMG_SRC(&ui_img_1611000061),
+    LV_STYLE_CONST_BG_IMG_RECOLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_IMG_RECOLOR_OPA(255),
+};
+static LV_STYLE_CONST_SORTED_INIT(style_ui_Button4_main_default, style_ui_Button4_main_default_props);
+
+static const lv_style_const_prop_t style_ui_Button6_main_default_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xE6, 0x45, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BG_IMG_SRC(&ui_img_1594878714),
+    LV_STYLE_CONST_BG_IMG_RECOLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_IMG_RECOLOR_OPA(255),
+};
+static LV_STYLE_CONST_SORTED_INIT(style_ui_Button6_main_default, style_ui_Button6_main_default_props);
+/*End of the generated constant styles*/
+
 extern  void my_timer1(lv_timer_t * timer);
 
 void ui_Screen1_screen_init(void)
@@ -39,11 +59,7 @@ void ui_Screen1_screen_init(void)
     lv_obj_set_align(ui_Button4, LV_ALIGN_CENTER);
     lv_obj_add_flag(ui_Button4, LV_OBJ_FLAG_SCROLL_ON_FOCUS);     /// Flags
     lv_obj_clear_flag(ui_Button4, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
-    lv_obj_set_style_bg_color(ui_Button4, lv_color_hex(0xE64500), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Button4, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_src(ui_Button4, &ui_img_1611000061, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_recolor(ui_Button4, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_recolor_opa(ui_Button4, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Button4, (lv_style_t *)&style_ui_Button4_main_default, LV_PART_MAIN | LV_STATE_DEFAULT);
 
 
     ui_Button6 = lv_btn_create(ui_Screen1);
@@ -54,11 +70,7 @@ void ui_Screen1_screen_init(void)
     lv_obj_set_align(ui_Button6, LV_ALIGN_CENTER);
     lv_obj_add_flag(ui_Button6, LV_OBJ_FLAG_SCROLL_ON_FOCUS);     /// Flags
     lv_obj_clear_flag(ui_Button6, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
-    lv_obj_set_style_bg_color(ui_Button6, lv_color_hex(0xE64500), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Button6, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_src(ui_Button6, &ui_img_1594878714, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_recolor(ui_Button6, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_recolor_opa(ui_Button6, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Button6, (lv_style_t *)&style_ui_Button6_main_default, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     lv_obj_add_event_cb(ui_background, ui_event_background, LV_EVENT_ALL, NULL);
     lv_obj_add_event_cb(ui_Button4, ui_event_Button4, LV_EVENT_ALL, NULL);
@@ -5,6 +5,42 @@
 
 #include "../ui.h"
 #include "lvgl.h"
+
+/*Constant styles generated by style_sheet_gen.py. Do not edit.*/
+static const lv_style_const_prop_t style_ui_Roller1_main_default_props[] = {
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_HOR),
+    LV_STYLE_CONST_BG_MAIN_STOP(0),
+    LV_STYLE_CONST_BG_GRAD_STOP(255),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_48),
+};
+static LV_STYLE_CONST_SORTED_INIT(style_ui_Roller1_main_default, style_ui_Roller1_main_default_props);
+
+static const lv_style_const_prop_t style_ui_Roller1_selected_default_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xE6, 0x45, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+};
+static LV_STYLE_CONST_SORTED_INIT(style_ui_Roller1_selected_default, style_ui_Roller1_selected_default_props);
+
+static const lv_style_const_prop_t style_ui_Button1_main_default_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xE6, 0x45, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BG_IMG_SRC(&ui_img_1609717271),
+    LV_STYLE_CONST_BG_IMG_RECOLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_IMG_RECOLOR_OPA(255),
+};
+static LV_STYLE_CONST_SORTED_INIT(style_ui_Button1_main_default, style_ui_Button1_main_default_props);
+
+static const lv_style_const_prop_t style_ui_Button7_main_default_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xE6, 0x45, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_IMG_SRC(&ui_img_2062528660),
+    LV_STYLE_CONST_BG_IMG_RECOLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_IMG_RECOLOR_OPA(255),
+};
+static LV_STYLE_CONST_SORTED_INIT(style_ui_Button7_main_default, style_ui_Button7_main_default_props);
+/*End of the generated constant styles*/
+
 int options_max_num=15;//索引  从0 开始  下面改，这个数字也得改
  char * options[] = {"15","16","17","18","19","20","21","22","23","24","25","26","27","28","29","30"};
  int  options2[]={15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30}; 
@@ -19,13 +55,9 @@ void ui_time_screen_init(void)
     lv_obj_set_width(ui_Roller1, 100);
     lv_obj_set_height(ui_Roller1, 200);
     lv_obj_set_align(ui_Roller1, LV_ALIGN_CENTER);
-    lv_obj_set_style_text_font(ui_Roller1, &lv_font_montserrat_48, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_main_stop(ui_Roller1, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_grad_stop(ui_Roller1, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_grad_dir(ui_Roller1, LV_GRAD_DIR_HOR, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Roller1, (lv_style_t *)&style_ui_Roller1_main_default, LV_PART_MAIN | LV_STATE_DEFAULT);
 
-    lv_obj_set_style_bg_color(ui_Roller1, lv_color_hex(0xE64500), LV_PART_SELECTED | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Roller1, 255, LV_PART_SELECTED | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Roller1, (lv_style_t *)&style_ui_Roller1_selected_default, LV_PART_SELECTED | LV_STATE_DEFAULT);
 
     ui_Image1 = lv_img_create(ui_time);
     lv_img_set_src(ui_Image1, &ui_img_756072277);
@@ -45,11 +77,7 @@ void ui_time_screen_init(void)
     lv_obj_set_align(ui_Button1, LV_ALIGN_CENTER);
     lv_obj_add_flag(ui_Button1, LV_OBJ_FLAG_SCROLL_ON_FOCUS);     /// Flags
     lv_obj_clear_flag(ui_Button1, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
-    lv_obj_set_style_bg_color(ui_Button1, lv_color_hex(0xE64500), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Button1, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_src(ui_Button1, &ui_img_1609717271, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_recolor(ui_Button1, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_recolor_opa(ui_Button1, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Button1, (lv_style_t *)&style_ui_Button1_main_default, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_Image6 = lv_img_create(ui_time);
     lv_img_set_src(ui_Image6, &ui_img_1307502690);
@@ -69,12 +97,7 @@ void ui_time_screen_init(void)
     lv_obj_set_align(ui_Button7, LV_ALIGN_CENTER);
     lv_obj_add_flag(ui_Button7, LV_OBJ_FLAG_SCROLL_ON_FOCUS);     /// Flags
     lv_obj_clear_flag(ui_Button7, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
-    lv_obj_set_style_bg_color(ui_Button7, lv_color_hex(0xE64500), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Button7, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_grad_color(ui_Button7, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_src(ui_Button7, &ui_img_2062528660, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_recolor(ui_Button7, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_img_recolor_opa(ui_Button7, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Button7, (lv_style_t *)&style_ui_Button7_main_default, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     lv_obj_add_event_cb(ui_Button1, ui_event_Button1, LV_EVENT_ALL, NULL);
     lv_obj_add_event_cb(ui_Button7, ui_event_Button7, LV_EVENT_ALL, NULL);
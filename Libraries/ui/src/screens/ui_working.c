@@ -6,6 +6,38 @@
 #include "../ui.h"
 #include "lvgl.h"
 #include <stdio.h>
+
+/*Constant styles generated by style_sheet_gen.py. Do not edit.*/
+static const lv_style_const_prop_t style_ui_Label1_main_default_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_48),
+};
+static LV_STYLE_CONST_SORTED_INIT(style_ui_Label1_main_default, style_ui_Label1_main_default_props);
+
+static const lv_style_const_prop_t style_ui_Bar2_indicator_default_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFF, 0x45, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+};
+static LV_STYLE_CONST_SORTED_INIT(style_ui_Bar2_indicator_default, style_ui_Bar2_indicator_default_props);
+
+static const lv_style_const_prop_t style_ui_Button3_main_default_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xE6, 0x45, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+};
+static LV_STYLE_CONST_SORTED_INIT(style_ui_Button3_main_default, style_ui_Button3_main_default_props);
+
+static const lv_style_const_prop_t style_ui_Label4_main_default_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_32),
+};
+static LV_STYLE_CONST_SORTED_INIT(style_ui_Label4_main_default, style_ui_Label4_main_default_props);
+
+static const lv_style_const_prop_t style_ui_Spinner3_indicator_default_props[] = {
+    LV_STYLE_CONST_ARC_WIDTH(20),
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0xE6, 0x45, 0x00)),
+    LV_STYLE_CONST_ARC_OPA(255),
+};
+static LV_STYLE_CONST_SORTED_INIT(style_ui_Spinner3_indicator_default, style_ui_Spinner3_indicator_default_props);
+/*End of the generated constant styles*/
+
 // 声明全局变量来存储进度条的值  
 static int bar_value = 0;  
  int selected_index=0;
@@ -73,7 +105,7 @@ void ui_working_screen_init(void)
     lv_obj_set_y(ui_Label1, -63);
     lv_obj_set_align(ui_Label1, LV_ALIGN_CENTER);
     lv_label_set_text(ui_Label1, "15");
-    lv_obj_set_style_text_font(ui_Label1, &lv_font_montserrat_48, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Label1, (lv_style_t *)&style_ui_Label1_main_default, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_Label2 = lv_label_create(ui_working);
     lv_obj_set_width(ui_Label2, LV_SIZE_CONTENT);   /// 1
@@ -82,7 +114,7 @@ void ui_working_screen_init(void)
     lv_obj_set_y(ui_Label2, -141);
     lv_obj_set_align(ui_Label2, LV_ALIGN_CENTER);
     lv_label_set_text(ui_Label2, "working");
-    lv_obj_set_style_text_font(ui_Label2, &lv_font_montserrat_48, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Label2, (lv_style_t *)&style_ui_Label1_main_default, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_Bar2 = lv_bar_create(ui_working);
     lv_bar_set_mode(ui_Bar2, LV_BAR_MODE_SYMMETRICAL);
@@ -94,8 +126,7 @@ void ui_working_screen_init(void)
     lv_obj_set_y(ui_Bar2, 22);
     lv_obj_set_align(ui_Bar2, LV_ALIGN_CENTER);
 
-    lv_obj_set_style_bg_color(ui_Bar2, lv_color_hex(0xFF4500), LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Bar2, 255, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Bar2, (lv_style_t *)&style_ui_Bar2_indicator_default, LV_PART_INDICATOR | LV_STATE_DEFAULT);
 
     ui_Button3 = lv_btn_create(ui_working);
     lv_obj_set_width(ui_Button3, 100);
@@ -105,8 +136,7 @@ void ui_working_screen_init(void)
     lv_obj_set_align(ui_Button3, LV_ALIGN_CENTER);
     lv_obj_add_flag(ui_Button3, LV_OBJ_FLAG_SCROLL_ON_FOCUS);     /// Flags
     lv_obj_clear_flag(ui_Button3, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
-    lv_obj_set_style_bg_color(ui_Button3, lv_color_hex(0xE64500), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Button3, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Button3, (lv_style_t *)&style_ui_Button3_main_default, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_Label4 = lv_label_create(ui_working);
     lv_obj_set_width(ui_Label4, LV_SIZE_CONTENT);   /// 1
@@ -115,7 +145,7 @@ void ui_working_screen_init(void)
     lv_obj_set_y(ui_Label4, 127);
     lv_obj_set_align(ui_Label4, LV_ALIGN_CENTER);
     lv_label_set_text(ui_Label4, "stop");
-    lv_obj_set_style_text_font(ui_Label4, &lv_font_montserrat_32, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Label4, (lv_style_t *)&style_ui_Label4_main_default, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_Spinner3 = lv_spinner_create(ui_working, 1000, 90);
     lv_obj_set_width(ui_Spinner3, 460);
@@ -123,9 +153,7 @@ void ui_working_screen_init(void)
     lv_obj_set_align(ui_Spinner3, LV_ALIGN_CENTER);
     lv_obj_clear_flag(ui_Spinner3, LV_OBJ_FLAG_CLICKABLE);      /// Flags
 
-    lv_obj_set_style_arc_color(ui_Spinner3, lv_color_hex(0xE64500), LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_Spinner3, 255, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_width(ui_Spinner3, 20, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Spinner3, (lv_style_t *)&style_ui_Spinner3_indicator_default, LV_PART_INDICATOR | LV_STATE_DEFAULT);
 
     lv_obj_add_event_cb(ui_Button3, ui_event_Button3, LV_EVENT_ALL, NULL);
 
@@ -643,8 +643,8 @@ static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
     Touch *tp = (Touch *)indev_drv->user_data;
     TouchPoint point;
 
-    /* Read data from touch controller */
-    int read_touch_result = tp->readPoints(&point, 1, 0);
+    /* Read data from touch controller, or from the interrupt-driven pipeline without any bus transaction */
+    int read_touch_result = tp->isPipelineRunning() ? tp->readPipelinePoints(&point, 1) : tp->readPoints(&point, 1, 0);
     if (read_touch_result > 0) {
         data->point.x = point.x;
         data->point.y = point.y;
@@ -787,6 +787,18 @@ bool lvgl_port_init(LCD *lcd, Touch *tp)
         tp->swapXY(!transformation.swap_xy);
         tp->mirrorX(!transformation.mirror_x);
 #endif
+#endif
+
+#if LVGL_PORT_TOUCH_USE_PIPELINE
+        // The pipeline clamps to the transformed resolution, so start it after the rotation is applied
+        if (tp->isInterruptEnabled()) {
+            TouchPipeline::Config pipeline_config = {};
+            pipeline_config.enable_prediction = LVGL_PORT_TOUCH_PIPELINE_PREDICTION;
+            pipeline_config.prediction_us = LVGL_PORT_TOUCH_PIPELINE_PREDICTION_MS * 1000;
+            ESP_UTILS_CHECK_FALSE_RETURN(tp->startPipeline(pipeline_config), false, "Start touch pipeline failed");
+        } else {
+            ESP_UTILS_LOGW("Touch interrupt pin is not set, fall back to polling");
+        }
 #endif
     }
 
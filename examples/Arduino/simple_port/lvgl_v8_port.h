@@ -58,6 +58,17 @@
                                                             // This can be set to `1` only if the SoCs support dual-core,
                                                             // otherwise it should be set to `-1` or `0`
 
+/**
+ * Touch input related parameters, can be adjusted by users
+ *
+ *  (The pipeline requires the interrupt pin of the touch controller, otherwise the touch is polled as before)
+ */
+#define LVGL_PORT_TOUCH_USE_PIPELINE            (0)     // Read the touch controller only on interrupt edges, the LVGL
+                                                        // input read is then free while nothing is touched
+#define LVGL_PORT_TOUCH_PIPELINE_PREDICTION     (0)     // Extrapolate the touch position during drags to hide the
+                                                        // bus and frame latency
+#define LVGL_PORT_TOUCH_PIPELINE_PREDICTION_MS  (16)    // How far ahead to extrapolate, typically one frame period
+
 /**
  * Avoid tering related configurations, can be adjusted by users.
  *
@@ -9,18 +9,15 @@
 // Style: circular button
 //
 
-void init_style_circular_button_MAIN_DEFAULT(lv_style_t *style) {
-    lv_style_set_bg_color(style, lv_color_hex(0xff15171a));
+// Constant style in flash instead of a style allocated and filled at runtime
+static const lv_style_const_prop_t style_circular_button_MAIN_DEFAULT_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x15, 0x17, 0x1a)),
+    LV_STYLE_CONST_PROPS_END
 };
+static LV_STYLE_CONST_INIT(style_circular_button_MAIN_DEFAULT, style_circular_button_MAIN_DEFAULT_props);
 
 lv_style_t *get_style_circular_button_MAIN_DEFAULT() {
-    static lv_style_t *style;
-    if (!style) {
-        style = lv_malloc(sizeof(lv_style_t));
-        lv_style_init(style);
-        init_style_circular_button_MAIN_DEFAULT(style);
-    }
-    return style;
+    return (lv_style_t *)&style_circular_button_MAIN_DEFAULT;
 };
 
 void add_style_circular_button(lv_obj_t *obj) {